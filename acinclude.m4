@@ -6,6 +6,11 @@ dnl Function to detect if libevt dependencies are available
 AC_DEFUN([AX_LIBEVT_CHECK_LOCAL],
   [dnl Check for internationalization functions in libevt/libevt_i18n.c
   AC_CHECK_FUNCS([bindtextdomain])
+
+  dnl Headers and functions included in libevt/libevt_mapped_file.c
+  AC_CHECK_HEADERS([fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+  AC_CHECK_FUNCS([fstat mmap munmap])
 ])
 
 dnl Function to detect if evttools dependencies are available
@@ -21,6 +26,14 @@ AC_DEFUN([AX_EVTTOOLS_CHECK_LOCAL],
      [1])
   ])
 
+  dnl Functions used in evttools/export_job.c
+  AC_CHECK_FUNCS([open_memstream])
+
+  dnl Headers and functions included in evttools/follow_handle.c
+  AC_CHECK_HEADERS([poll.h sys/inotify.h sys/stat.h])
+
+  AC_CHECK_FUNCS([stat])
+
   dnl Headers included in evttools/log_handle.c
   AC_CHECK_HEADERS([stdarg.h varargs.h])
 
@@ -0,0 +1,1276 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+#include <wide_string.h>
+
+#include "carve_handle.h"
+#include "evttools_libbfio.h"
+#include "evttools_libcerror.h"
+#include "evttools_libclocale.h"
+#include "evttools_libevt.h"
+#include "evttools_libfdatetime.h"
+
+#define CARVE_HANDLE_NOTIFY_STREAM	stdout
+
+/* Copies a decimal or hexadecimal (0x prefixed) string to a 64-bit value
+ * Returns 1 if successful, 0 if the string is not a valid value or -1 on error
+ */
+int carve_handle_copy_string_to_64bit(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error )
+{
+	static char *function       = "carve_handle_copy_string_to_64bit";
+	size_t string_index         = 0;
+	size_t string_length        = 0;
+	uint64_t safe_value_64bit   = 0;
+	uint64_t base               = 10;
+	uint8_t digit               = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 64-bit.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == (system_character_t) '0' )
+	 && ( ( string[ 1 ] == (system_character_t) 'x' )
+	  || ( string[ 1 ] == (system_character_t) 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		return( 0 );
+	}
+	while( string_index < string_length )
+	{
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'a' )
+		      && ( string[ string_index ] <= (system_character_t) 'f' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'a' + 10 );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'A' )
+		      && ( string[ string_index ] <= (system_character_t) 'F' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'A' + 10 );
+		}
+		else
+		{
+			return( 0 );
+		}
+		if( safe_value_64bit > ( ( (uint64_t) INT64_MAX - digit ) / base ) )
+		{
+			return( 0 );
+		}
+		safe_value_64bit *= base;
+		safe_value_64bit += digit;
+
+		string_index++;
+	}
+	*value_64bit = safe_value_64bit;
+
+	return( 1 );
+}
+
+/* Creates a carve handle
+ * Make sure the value carve_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_initialize";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*carve_handle = memory_allocate_structure(
+	                 carve_handle_t );
+
+	if( *carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *carve_handle,
+	     0,
+	     sizeof( carve_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carve handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_carver_initialize(
+	     &( ( *carve_handle )->carver ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize carver.",
+		 function );
+
+		goto on_error;
+	}
+	( *carve_handle )->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
+	( *carve_handle )->notify_stream  = CARVE_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *carve_handle != NULL )
+	{
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a carve handle
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_free";
+	int result            = 1;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carve_handle != NULL )
+	{
+		if( ( *carve_handle )->input_file_io_handle != NULL )
+		{
+			if( carve_handle_close_input(
+			     *carve_handle,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libevt_carver_free(
+		     &( ( *carve_handle )->carver ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free carver.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *carve_handle );
+
+		*carve_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the carve handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_signal_abort";
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->abort = 1;
+
+	if( carve_handle->carver != NULL )
+	{
+		if( libevt_carver_signal_abort(
+		     carve_handle->carver,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal carver to abort.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_set_ascii_codepage(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function  = "carve_handle_set_ascii_codepage";
+	size_t string_length   = 0;
+	uint32_t feature_flags = 0;
+	int result             = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	feature_flags = LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_KOI8
+	              | LIBCLOCALE_CODEPAGE_FEATURE_FLAG_HAVE_WINDOWS;
+
+	string_length = system_string_length(
+	                 string );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libclocale_codepage_copy_from_string_wide(
+	          &( carve_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#else
+	result = libclocale_codepage_copy_from_string(
+	          &( carve_handle->ascii_codepage ),
+	          string,
+	          string_length,
+	          feature_flags,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Sets the range offset
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int carve_handle_set_range_offset(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_range_offset";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = carve_handle_copy_string_to_64bit(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		carve_handle->range_offset = (off64_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Sets the range size
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int carve_handle_set_range_size(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_set_range_size";
+	uint64_t value_64bit  = 0;
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = carve_handle_copy_string_to_64bit(
+	          string,
+	          &value_64bit,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string to 64-bit value.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		carve_handle->range_size = (size64_t) value_64bit;
+	}
+	return( result );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "carve_handle_open_input";
+	size_t filename_length = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carve handle - input file IO handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_carver_set_ascii_codepage(
+	     carve_handle->carver,
+	     carve_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_file_initialize(
+	     &( carve_handle->input_file_io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     carve_handle->input_file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set input file IO handle filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     carve_handle->input_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &( carve_handle->input_file_io_handle ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_close_input";
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( carve_handle->input_file_io_handle != NULL )
+	{
+		if( libbfio_handle_close(
+		     carve_handle->input_file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libbfio_handle_free(
+		     &( carve_handle->input_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Prints a POSIX value
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_posix_time_value_fprint(
+     carve_handle_t *carve_handle,
+     const char *value_name,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	system_character_t date_time_string[ 32 ];
+
+	libfdatetime_posix_time_t *posix_time = NULL;
+	static char *function                 = "carve_handle_posix_time_value_fprint";
+	int result                            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == 0 )
+	{
+		fprintf(
+		 carve_handle->notify_stream,
+		 "%s: Not set (0)\n",
+		 value_name );
+
+		return( 1 );
+	}
+	if( libfdatetime_posix_time_initialize(
+	     &posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create POSIX time.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfdatetime_posix_time_copy_from_32bit(
+	     posix_time,
+	     value_32bit,
+	     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy POSIX time from 32-bit.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libfdatetime_posix_time_copy_to_utf16_string(
+		  posix_time,
+		  (uint16_t *) date_time_string,
+		  32,
+		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		  error );
+#else
+	result = libfdatetime_posix_time_copy_to_utf8_string(
+		  posix_time,
+		  (uint8_t *) date_time_string,
+		  32,
+		  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+		  error );
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to copy POSIX time to string.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "%s: %" PRIs_SYSTEM " UTC\n",
+	 value_name,
+	 date_time_string );
+
+	if( libfdatetime_posix_time_free(
+	     &posix_time,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free POSIX time.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Prints a carved record
+ * Returns 1 if successful or -1 on error
+ */
+int carve_handle_record_fprint(
+     libevt_record_t *record,
+     off64_t record_offset,
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *value_string = NULL;
+	static char *function            = "carve_handle_record_fprint";
+	size_t value_string_size         = 0;
+	uint32_t value_32bit             = 0;
+	uint16_t value_16bit             = 0;
+	int number_of_strings            = 0;
+	int result                       = 0;
+	int value_string_index           = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Record at offset\t\t: %" PRIi64 " (0x%08" PRIx64 ")\n",
+	 record_offset,
+	 record_offset );
+
+	if( libevt_record_get_identifier(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Event number\t\t\t: %" PRIu32 "\n",
+	 value_32bit );
+
+	if( libevt_record_get_creation_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( carve_handle_posix_time_value_fprint(
+	     carve_handle,
+	     "Creation time\t\t\t",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print POSIX time value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_written_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( carve_handle_posix_time_value_fprint(
+	     carve_handle,
+	     "Written time\t\t\t",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print POSIX time value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_type(
+	     record,
+	     &value_16bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event type.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Event type\t\t\t: %" PRIu16 "\n",
+	 value_16bit );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_source_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_source_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_source_name(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_source_name(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 carve_handle->notify_stream,
+		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_computer_name(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_computer_name(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve computer name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 carve_handle->notify_stream,
+		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	if( libevt_record_get_event_identifier(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+	 value_32bit,
+	 value_32bit );
+
+	if( libevt_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Number of strings\t\t: %d\n",
+	 number_of_strings );
+
+	for( value_string_index = 0;
+	     value_string_index < number_of_strings;
+	     value_string_index++ )
+	{
+		fprintf(
+		 carve_handle->notify_stream,
+		 "String: %d\t\t\t: ",
+		 value_string_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#else
+		result = libevt_record_get_utf8_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			value_string = system_string_allocate(
+					value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libevt_record_get_utf16_string(
+				  record,
+				  value_string_index,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libevt_record_get_utf8_string(
+				  record,
+				  value_string_index,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 value_string_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 carve_handle->notify_stream,
+			 "%" PRIs_SYSTEM "",
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
+		fprintf(
+		 carve_handle->notify_stream,
+		 "\n" );
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "\n" );
+
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Callback for the carver that prints a carved record
+ * Returns 1 to continue carving, 0 to stop or -1 on error
+ */
+int carve_handle_carve_record_callback(
+     libevt_record_t *record,
+     off64_t record_offset,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	carve_handle_t *carve_handle = NULL;
+	static char *function        = "carve_handle_carve_record_callback";
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle = (carve_handle_t *) callback_data;
+
+	if( carve_handle->abort != 0 )
+	{
+		return( 0 );
+	}
+	if( carve_handle_record_fprint(
+	     record,
+	     record_offset,
+	     carve_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print record at offset: %" PRIi64 ".",
+		 function,
+		 record_offset );
+
+		return( -1 );
+	}
+	carve_handle->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Carves the event records from the input
+ * Returns 1 if successful, 0 if aborted or -1 on error
+ */
+int carve_handle_carve_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "carve_handle_carve_input";
+	int result            = 0;
+
+	if( carve_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carve handle.",
+		 function );
+
+		return( -1 );
+	}
+	carve_handle->number_of_records = 0;
+
+	result = libevt_carver_scan_file_io_handle(
+	          carve_handle->carver,
+	          carve_handle->input_file_io_handle,
+	          carve_handle->range_offset,
+	          carve_handle->range_size,
+	          &carve_handle_carve_record_callback,
+	          (void *) carve_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to carve records.",
+		 function );
+
+		return( -1 );
+	}
+	fprintf(
+	 carve_handle->notify_stream,
+	 "Number of carved records\t: %d\n",
+	 carve_handle->number_of_records );
+
+	return( result );
+}
+
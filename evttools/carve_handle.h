@@ -0,0 +1,142 @@
+/*
+ * Carve handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CARVE_HANDLE_H )
+#define _CARVE_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evttools_libbfio.h"
+#include "evttools_libcerror.h"
+#include "evttools_libevt.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct carve_handle carve_handle_t;
+
+struct carve_handle
+{
+	/* The libevt carver
+	 */
+	libevt_carver_t *carver;
+
+	/* The input file IO handle
+	 */
+	libbfio_handle_t *input_file_io_handle;
+
+	/* The range offset
+	 */
+	off64_t range_offset;
+
+	/* The range size
+	 */
+	size64_t range_size;
+
+	/* The ascii codepage
+	 */
+	int ascii_codepage;
+
+	/* The number of carved records
+	 */
+	int number_of_records;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int carve_handle_copy_string_to_64bit(
+     const system_character_t *string,
+     uint64_t *value_64bit,
+     libcerror_error_t **error );
+
+int carve_handle_initialize(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_free(
+     carve_handle_t **carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_signal_abort(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_set_ascii_codepage(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int carve_handle_set_range_offset(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int carve_handle_set_range_size(
+     carve_handle_t *carve_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int carve_handle_open_input(
+     carve_handle_t *carve_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int carve_handle_close_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_posix_time_value_fprint(
+     carve_handle_t *carve_handle,
+     const char *value_name,
+     uint32_t value_32bit,
+     libcerror_error_t **error );
+
+int carve_handle_record_fprint(
+     libevt_record_t *record,
+     off64_t record_offset,
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+int carve_handle_carve_record_callback(
+     libevt_record_t *record,
+     off64_t record_offset,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int carve_handle_carve_input(
+     carve_handle_t *carve_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CARVE_HANDLE_H ) */
+
@@ -0,0 +1,2575 @@
+/*
+ * Catalog handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "catalog_handle.h"
+#include "evt_message_catalog.h"
+#include "evttools_libbfio.h"
+#include "evttools_libcerror.h"
+#include "evttools_libregf.h"
+#include "evttools_libuna.h"
+#include "evttools_system_split_string.h"
+#include "hash_table.h"
+#include "message_catalog.h"
+#include "message_handle.h"
+#include "message_string_table.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+
+#define CATALOG_HANDLE_NOTIFY_STREAM	stdout
+
+/* The event source values that are stored in the message catalog
+ */
+const system_character_t *catalog_handle_event_source_value_names[ 3 ] = {
+	_SYSTEM_STRING( "EventMessageFile" ),
+	_SYSTEM_STRING( "CategoryMessageFile" ),
+	_SYSTEM_STRING( "ParameterMessageFile" ) };
+
+/* Creates a catalog handle
+ * Make sure the value catalog_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_initialize(
+     catalog_handle_t **catalog_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_initialize";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*catalog_handle = memory_allocate_structure(
+	                   catalog_handle_t );
+
+	if( *catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *catalog_handle,
+	     0,
+	     sizeof( catalog_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog handle.",
+		 function );
+
+		memory_free(
+		 *catalog_handle );
+
+		*catalog_handle = NULL;
+
+		return( -1 );
+	}
+	if( message_handle_initialize(
+	     &( ( *catalog_handle )->message_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_initialize(
+	     &( ( *catalog_handle )->strings ),
+	     1024,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &catalog_handle_free_string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create strings hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_initialize(
+	     &( ( *catalog_handle )->message_files ),
+	     256,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message files hash table.",
+		 function );
+
+		goto on_error;
+	}
+	( *catalog_handle )->notify_stream = CATALOG_HANDLE_NOTIFY_STREAM;
+
+	return( 1 );
+
+on_error:
+	if( *catalog_handle != NULL )
+	{
+		if( ( *catalog_handle )->strings != NULL )
+		{
+			hash_table_free(
+			 &( ( *catalog_handle )->strings ),
+			 NULL );
+		}
+		if( ( *catalog_handle )->message_handle != NULL )
+		{
+			message_handle_free(
+			 &( ( *catalog_handle )->message_handle ),
+			 NULL );
+		}
+		memory_free(
+		 *catalog_handle );
+
+		*catalog_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a catalog handle
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_free(
+     catalog_handle_t **catalog_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_free";
+	int result            = 1;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog_handle != NULL )
+	{
+		if( ( *catalog_handle )->event_source_values != NULL )
+		{
+			if( hash_table_free(
+			     &( ( *catalog_handle )->event_source_values ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free event source values hash table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( hash_table_free(
+		     &( ( *catalog_handle )->message_files ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message files hash table.",
+			 function );
+
+			result = -1;
+		}
+		if( hash_table_free(
+		     &( ( *catalog_handle )->strings ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free strings hash table.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *catalog_handle )->strings_data != NULL )
+		{
+			memory_free(
+			 ( *catalog_handle )->strings_data );
+		}
+		if( ( *catalog_handle )->messages != NULL )
+		{
+			memory_free(
+			 ( *catalog_handle )->messages );
+		}
+		if( ( *catalog_handle )->message_files_data != NULL )
+		{
+			memory_free(
+			 ( *catalog_handle )->message_files_data );
+		}
+		if( ( *catalog_handle )->event_source_values_data != NULL )
+		{
+			memory_free(
+			 ( *catalog_handle )->event_source_values_data );
+		}
+		if( message_handle_free(
+		     &( ( *catalog_handle )->message_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *catalog_handle );
+
+		*catalog_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the catalog handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_signal_abort(
+     catalog_handle_t *catalog_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_signal_abort";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	catalog_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Sets the SOFTWARE registry filename
+ * Returns 1 if successful or -1 error
+ */
+int catalog_handle_set_software_registry_filename(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_set_software_registry_filename";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_software_registry_filename(
+	     catalog_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set SOFTWARE registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the SYSTEM registry filename
+ * Returns 1 if successful or -1 error
+ */
+int catalog_handle_set_system_registry_filename(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_set_system_registry_filename";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_system_registry_filename(
+	     catalog_handle->message_handle,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set SYSTEM registry filename in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the directory containing the SOFTWARE and SYSTEM registry file
+ * Returns 1 if successful or -1 error
+ */
+int catalog_handle_set_registry_directory_name(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *name,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_set_registry_directory_name";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_registry_directory_name(
+	     catalog_handle->message_handle,
+	     name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set registry directory name in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the resource files (search) path
+ * Returns 1 if successful or -1 error
+ */
+int catalog_handle_set_resource_files_path(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_set_resource_files_path";
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_set_resource_files_path(
+	     catalog_handle->message_handle,
+	     path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource files path in message handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees a string offset
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_free_string_offset(
+     uint32_t **string_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_free_string_offset";
+
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string_offset != NULL )
+	{
+		memory_free(
+		 *string_offset );
+
+		*string_offset = NULL;
+	}
+	return( 1 );
+}
+
+/* Resizes data to contain at least the required data size
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_resize_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t required_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *resized_data = NULL;
+	static char *function = "catalog_handle_resize_data";
+	size_t new_data_size  = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_data_size <= *data_size )
+	{
+		return( 1 );
+	}
+	/* Grow the data exponentially so that appending is amortized constant time
+	 */
+	new_data_size = *data_size;
+
+	if( new_data_size < 4096 )
+	{
+		new_data_size = 4096;
+	}
+	while( new_data_size < required_data_size )
+	{
+		if( new_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			new_data_size = required_data_size;
+
+			break;
+		}
+		new_data_size *= 2;
+	}
+	resized_data = (uint8_t *) memory_reallocate(
+	                            *data,
+	                            sizeof( uint8_t ) * new_data_size );
+
+	if( resized_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	*data      = resized_data;
+	*data_size = new_data_size;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 string to the strings data
+ * A string that was appended before is stored once
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_append_utf8_string(
+     catalog_handle_t *catalog_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_offset,
+     libcerror_error_t **error )
+{
+	uint32_t *cached_string_offset = NULL;
+	static char *function          = "catalog_handle_append_utf8_string";
+	int result                     = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string[ utf8_string_size - 1 ] != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported UTF-8 string - missing end-of-string character.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string offset.",
+		 function );
+
+		return( -1 );
+	}
+	result = hash_table_get_value_by_key(
+	          catalog_handle->strings,
+	          utf8_string,
+	          utf8_string_size,
+	          (intptr_t **) &cached_string_offset,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string from hash table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		*string_offset = *cached_string_offset;
+
+		return( 1 );
+	}
+	/* The offsets in the message catalog are 32-bit
+	 */
+	if( utf8_string_size > ( (size_t) UINT32_MAX - catalog_handle->strings_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid strings data size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_handle_resize_data(
+	     &( catalog_handle->strings_data ),
+	     &( catalog_handle->strings_data_allocated_size ),
+	     catalog_handle->strings_data_size + utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize strings data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     &( catalog_handle->strings_data[ catalog_handle->strings_data_size ] ),
+	     utf8_string,
+	     utf8_string_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string to strings data.",
+		 function );
+
+		goto on_error;
+	}
+	cached_string_offset = (uint32_t *) memory_allocate(
+	                                     sizeof( uint32_t ) );
+
+	if( cached_string_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string offset.",
+		 function );
+
+		goto on_error;
+	}
+	*cached_string_offset = (uint32_t) catalog_handle->strings_data_size;
+
+	if( hash_table_set_value_by_key(
+	     catalog_handle->strings,
+	     utf8_string,
+	     utf8_string_size,
+	     (intptr_t *) cached_string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set string in hash table.",
+		 function );
+
+		goto on_error;
+	}
+	*string_offset = *cached_string_offset;
+
+	catalog_handle->strings_data_size += utf8_string_size;
+
+	return( 1 );
+
+on_error:
+	if( ( result == 0 )
+	 && ( cached_string_offset != NULL ) )
+	{
+		memory_free(
+		 cached_string_offset );
+	}
+	return( -1 );
+}
+
+/* Appends a string to the strings data
+ * The string is stored as UTF-8
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_append_string(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *string,
+     size_t string_length,
+     uint32_t *string_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "catalog_handle_append_string";
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	uint8_t *utf8_string    = NULL;
+	size_t utf8_string_size = 0;
+#endif
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libuna_utf8_string_size_from_utf16(
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine UTF-8 string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	utf8_string = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf8_string_copy_from_utf16(
+	     utf8_string,
+	     utf8_string_size,
+	     (libuna_utf16_character_t *) string,
+	     string_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_handle_append_utf8_string(
+	     catalog_handle,
+	     utf8_string,
+	     utf8_string_size,
+	     string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 utf8_string );
+
+	return( 1 );
+
+on_error:
+	if( utf8_string != NULL )
+	{
+		memory_free(
+		 utf8_string );
+	}
+	return( -1 );
+#else
+	/* The narrow system strings are UTF-8 and terminated by an end-of-string character
+	 */
+	if( catalog_handle_append_utf8_string(
+	     catalog_handle,
+	     (uint8_t *) string,
+	     string_length + 1,
+	     string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+#endif
+}
+
+/* Appends a message
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_append_message(
+     catalog_handle_t *catalog_handle,
+     uint32_t message_identifier,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	catalog_handle_message_t *message = NULL;
+	static char *function             = "catalog_handle_append_message";
+	uint32_t string_offset            = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_handle->number_of_messages == UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid catalog handle - number of messages value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_handle_append_string(
+	     catalog_handle,
+	     string,
+	     string_length,
+	     &string_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_identifier );
+
+		return( -1 );
+	}
+	if( catalog_handle_resize_data(
+	     (uint8_t **) &( catalog_handle->messages ),
+	     &( catalog_handle->messages_size ),
+	     sizeof( catalog_handle_message_t ) * ( (size_t) catalog_handle->number_of_messages + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize messages.",
+		 function );
+
+		return( -1 );
+	}
+	message = &( catalog_handle->messages[ catalog_handle->number_of_messages ] );
+
+	message->identifier      = message_identifier;
+	message->string_offset   = string_offset;
+	message->sequence_number = catalog_handle->number_of_messages;
+
+	catalog_handle->number_of_messages += 1;
+
+	return( 1 );
+}
+
+/* Reads the messages of the message table of a resource file
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_read_message_string_table(
+     catalog_handle_t *catalog_handle,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	message_string_t *message_string             = NULL;
+	message_string_table_t *message_string_table = NULL;
+	static char *function                        = "catalog_handle_read_message_string_table";
+	int message_index                            = 0;
+	int result                                   = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_get_message_string_table(
+	          resource_file,
+	          &message_string_table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 1 );
+	}
+	for( message_index = 0;
+	     message_index < message_string_table->number_of_message_strings;
+	     message_index++ )
+	{
+		message_string = &( message_string_table->message_strings[ message_index ] );
+
+		/* A message string that is not available is not looked up in the message table
+		 */
+		if( ( message_string->string == NULL )
+		 || ( message_string->string_size == 0 ) )
+		{
+			continue;
+		}
+		if( catalog_handle_append_message(
+		     catalog_handle,
+		     message_string->identifier,
+		     message_string->string,
+		     message_string->string_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append message: 0x%08" PRIx32 ".",
+			 function,
+			 message_string->identifier );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Compares two messages by identifier and sequence number
+ * Returns -1 if the first message is less than the second, 0 if equal or 1 if greater
+ */
+int catalog_handle_compare_messages(
+     const catalog_handle_message_t *first_message,
+     const catalog_handle_message_t *second_message )
+{
+	if( first_message->identifier < second_message->identifier )
+	{
+		return( -1 );
+	}
+	else if( first_message->identifier > second_message->identifier )
+	{
+		return( 1 );
+	}
+	if( first_message->sequence_number < second_message->sequence_number )
+	{
+		return( -1 );
+	}
+	else if( first_message->sequence_number > second_message->sequence_number )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Reads the messages of a specific message file
+ * The messages of the MUI resource file are read after the messages of the resource file,
+ * as they are only used for messages that are not in the resource file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int catalog_handle_read_message_file(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_message_file_entry_t *message_file_entry = NULL;
+	resource_file_t *resource_file                               = NULL;
+	static char *function                                        = "catalog_handle_read_message_file";
+	uint32_t first_message_index                                 = 0;
+	uint32_t message_index                                       = 0;
+	uint32_t mui_file_type                                       = 0;
+	uint32_t number_of_messages                                  = 0;
+	uint32_t resource_filename_offset                            = 0;
+	int result                                                   = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	result = message_handle_get_resource_file_by_name(
+	          message_handle,
+	          resource_filename,
+	          resource_filename_length,
+	          &resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	first_message_index = catalog_handle->number_of_messages;
+
+	if( catalog_handle_read_message_string_table(
+	     catalog_handle,
+	     resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message string table of resource file.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_get_mui_file_type(
+	          resource_file,
+	          &mui_file_type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI file type.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		result = message_handle_get_mui_resource_file_by_name(
+		          message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          &resource_file,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve MUI resource file.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			if( catalog_handle_read_message_string_table(
+			     catalog_handle,
+			     resource_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read message string table of MUI resource file.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	/* Sort the messages by identifier and keep the first of messages with the same identifier,
+	 * which is the message that is retrieved from the resource files
+	 */
+	number_of_messages = catalog_handle->number_of_messages - first_message_index;
+
+	if( number_of_messages > 1 )
+	{
+		qsort(
+		 &( catalog_handle->messages[ first_message_index ] ),
+		 (size_t) number_of_messages,
+		 sizeof( catalog_handle_message_t ),
+		 (int (*)(const void *, const void *)) &catalog_handle_compare_messages );
+
+		number_of_messages = 1;
+
+		for( message_index = first_message_index + 1;
+		     message_index < catalog_handle->number_of_messages;
+		     message_index++ )
+		{
+			if( catalog_handle->messages[ message_index ].identifier == catalog_handle->messages[ first_message_index + number_of_messages - 1 ].identifier )
+			{
+				continue;
+			}
+			catalog_handle->messages[ first_message_index + number_of_messages ] = catalog_handle->messages[ message_index ];
+
+			number_of_messages++;
+		}
+		catalog_handle->number_of_messages = first_message_index + number_of_messages;
+	}
+	if( catalog_handle_append_string(
+	     catalog_handle,
+	     resource_filename,
+	     resource_filename_length,
+	     &resource_filename_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_handle_resize_data(
+	     &( catalog_handle->message_files_data ),
+	     &( catalog_handle->message_files_data_size ),
+	     sizeof( evt_message_catalog_message_file_entry_t ) * ( (size_t) catalog_handle->number_of_message_files + 1 ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize message files data.",
+		 function );
+
+		return( -1 );
+	}
+	message_file_entry = (evt_message_catalog_message_file_entry_t *) &( catalog_handle->message_files_data[ sizeof( evt_message_catalog_message_file_entry_t ) * catalog_handle->number_of_message_files ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 message_file_entry->resource_filename_offset,
+	 resource_filename_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 message_file_entry->first_message_index,
+	 first_message_index );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 message_file_entry->number_of_messages,
+	 number_of_messages );
+
+	catalog_handle->number_of_message_files += 1;
+
+	return( 1 );
+}
+
+/* Reads the messages of the message files in an event source value
+ * The value can contain multiple message filenames separated by ;
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_read_message_files(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const system_character_t *value_string,
+     size_t value_string_length,
+     libcerror_error_t **error )
+{
+	system_character_t *key                               = NULL;
+	system_character_t *resource_filename_string_segment  = NULL;
+	system_split_string_t *resource_filename_split_string = NULL;
+	intptr_t *existing_value                              = NULL;
+	static char *function                                 = "catalog_handle_read_message_files";
+	size_t key_size                                       = 0;
+	size_t resource_filename_string_segment_size          = 0;
+	int resource_filename_number_of_segments              = 0;
+	int resource_filename_segment_index                   = 0;
+	int result                                            = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( system_string_split(
+	     value_string,
+	     value_string_length + 1,
+	     (system_character_t) ';',
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split resource filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_split_string_get_number_of_segments(
+	     resource_filename_split_string,
+	     &resource_filename_number_of_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of resource filename string segments.",
+		 function );
+
+		goto on_error;
+	}
+	for( resource_filename_segment_index = 0;
+	     resource_filename_segment_index < resource_filename_number_of_segments;
+	     resource_filename_segment_index++ )
+	{
+		if( catalog_handle->abort != 0 )
+		{
+			break;
+		}
+		if( system_split_string_get_segment_by_index(
+		     resource_filename_split_string,
+		     resource_filename_segment_index,
+		     &resource_filename_string_segment,
+		     &resource_filename_string_segment_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource filename string segment: %d.",
+			 function,
+			 resource_filename_segment_index );
+
+			goto on_error;
+		}
+		if( ( resource_filename_string_segment == NULL )
+		 || ( resource_filename_string_segment_size <= 1 ) )
+		{
+			continue;
+		}
+		/* The messages of a message file are read once, the message file is looked up
+		 * by its normalized name like in the resource file cache
+		 */
+		if( resource_file_cache_get_key(
+		     resource_filename_string_segment,
+		     resource_filename_string_segment_size - 1,
+		     &key,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message file key.",
+			 function );
+
+			goto on_error;
+		}
+		result = hash_table_get_value_by_key(
+		          catalog_handle->message_files,
+		          (uint8_t *) key,
+		          key_size,
+		          &existing_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message file from hash table.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( hash_table_set_value_by_key(
+			     catalog_handle->message_files,
+			     (uint8_t *) key,
+			     key_size,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set message file in hash table.",
+				 function );
+
+				goto on_error;
+			}
+			result = catalog_handle_read_message_file(
+			          catalog_handle,
+			          message_handle,
+			          resource_filename_string_segment,
+			          resource_filename_string_segment_size - 1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read message file: %" PRIs_SYSTEM ".",
+				 function,
+				 resource_filename_string_segment );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				fprintf(
+				 catalog_handle->notify_stream,
+				 "Missing message file: %" PRIs_SYSTEM "\n",
+				 resource_filename_string_segment );
+			}
+		}
+		memory_free(
+		 key );
+
+		key = NULL;
+	}
+	if( system_split_string_free(
+	     &resource_filename_split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free resource filename split string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	if( resource_filename_split_string != NULL )
+	{
+		system_split_string_free(
+		 &resource_filename_split_string,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the values and message files of a specific event source
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_read_event_source(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_event_source_value_entry_t *event_source_value_entry = NULL;
+	system_character_t *key                                                  = NULL;
+	system_character_t *value_string                                         = NULL;
+	const system_character_t *value_name                                     = NULL;
+	intptr_t *existing_value                                                 = NULL;
+	static char *function                                                    = "catalog_handle_read_event_source";
+	size_t key_size                                                          = 0;
+	size_t value_name_length                                                 = 0;
+	size_t value_string_size                                                 = 0;
+	uint32_t event_log_name_offset                                           = 0;
+	uint32_t event_source_offset                                             = 0;
+	uint32_t value_name_offset                                               = 0;
+	uint32_t value_string_offset                                             = 0;
+	int result                                                               = 0;
+	int value_name_index                                                     = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_name_index = 0;
+	     value_name_index < 3;
+	     value_name_index++ )
+	{
+		value_name = catalog_handle_event_source_value_names[ value_name_index ];
+
+		value_name_length = system_string_length(
+		                     value_name );
+
+		/* An event source can be defined in multiple control sets,
+		 * the value is retrieved once like it is by the message handle
+		 */
+		if( message_catalog_get_event_source_value_key(
+		     event_source,
+		     event_source_length,
+		     value_name,
+		     value_name_length,
+		     &key,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value key.",
+			 function );
+
+			goto on_error;
+		}
+		result = hash_table_get_value_by_key(
+		          catalog_handle->event_source_values,
+		          (uint8_t *) key,
+		          key_size,
+		          &existing_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value from hash table.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			memory_free(
+			 key );
+
+			key = NULL;
+
+			continue;
+		}
+		if( hash_table_set_value_by_key(
+		     catalog_handle->event_source_values,
+		     (uint8_t *) key,
+		     key_size,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set event source value in hash table.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 key );
+
+		key = NULL;
+
+		result = message_handle_get_value_by_event_source_from_registry(
+		          message_handle,
+		          event_source,
+		          event_source_length,
+		          value_name,
+		          value_name_length,
+		          &value_string,
+		          &value_string_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %" PRIs_SYSTEM " of event source: %" PRIs_SYSTEM ".",
+			 function,
+			 value_name,
+			 event_source );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( ( value_string == NULL )
+		 || ( value_string_size == 0 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle->number_of_event_source_values == UINT32_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid catalog handle - number of event source values value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle_append_utf8_string(
+		     catalog_handle,
+		     (uint8_t *) eventlog_key_name,
+		     narrow_string_length( eventlog_key_name ) + 1,
+		     &event_log_name_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event log name.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle_append_string(
+		     catalog_handle,
+		     event_source,
+		     event_source_length,
+		     &event_source_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event source.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle_append_string(
+		     catalog_handle,
+		     value_name,
+		     value_name_length,
+		     &value_name_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value name.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle_append_string(
+		     catalog_handle,
+		     value_string,
+		     value_string_size - 1,
+		     &value_string_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value string.",
+			 function );
+
+			goto on_error;
+		}
+		if( catalog_handle_resize_data(
+		     &( catalog_handle->event_source_values_data ),
+		     &( catalog_handle->event_source_values_data_size ),
+		     sizeof( evt_message_catalog_event_source_value_entry_t ) * ( (size_t) catalog_handle->number_of_event_source_values + 1 ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize event source values data.",
+			 function );
+
+			goto on_error;
+		}
+		event_source_value_entry = (evt_message_catalog_event_source_value_entry_t *) &( catalog_handle->event_source_values_data[ sizeof( evt_message_catalog_event_source_value_entry_t ) * catalog_handle->number_of_event_source_values ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 event_source_value_entry->event_log_name_offset,
+		 event_log_name_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 event_source_value_entry->event_source_offset,
+		 event_source_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 event_source_value_entry->value_name_offset,
+		 value_name_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 event_source_value_entry->value_string_offset,
+		 value_string_offset );
+
+		catalog_handle->number_of_event_source_values += 1;
+
+		if( catalog_handle_read_message_files(
+		     catalog_handle,
+		     message_handle,
+		     value_string,
+		     value_string_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read message files of value: %" PRIs_SYSTEM ".",
+			 function,
+			 value_name );
+
+			goto on_error;
+		}
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	return( -1 );
+}
+
+/* Reads the event sources, which are the sub keys of an eventlog key
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_read_event_sources_key(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libregf_key_t *eventlog_key,
+     libcerror_error_t **error )
+{
+	libregf_key_t *sub_key      = NULL;
+	system_character_t *name    = NULL;
+	static char *function       = "catalog_handle_read_event_sources_key";
+	size_t name_size            = 0;
+	int number_of_sub_keys      = 0;
+	int result                  = 0;
+	int sub_key_index           = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libregf_key_get_number_of_sub_keys(
+	     eventlog_key,
+	     &number_of_sub_keys,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of sub keys.",
+		 function );
+
+		goto on_error;
+	}
+	for( sub_key_index = 0;
+	     sub_key_index < number_of_sub_keys;
+	     sub_key_index++ )
+	{
+		if( catalog_handle->abort != 0 )
+		{
+			break;
+		}
+		if( libregf_key_get_sub_key(
+		     eventlog_key,
+		     sub_key_index,
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libregf_key_get_utf16_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#else
+		result = libregf_key_get_utf8_name_size(
+		          sub_key,
+		          &name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub key: %d name size.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+		if( name_size > 1 )
+		{
+			if( ( name_size > (size_t) SSIZE_MAX )
+			 || ( ( sizeof( system_character_t ) * name_size ) > (size_t) SSIZE_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid name size value exceeds maximum.",
+				 function );
+
+				goto on_error;
+			}
+			name = system_string_allocate(
+			        name_size );
+
+			if( name == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create name string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libregf_key_get_utf16_name(
+			          sub_key,
+			          (uint16_t *) name,
+			          name_size,
+			          error );
+#else
+			result = libregf_key_get_utf8_name(
+			          sub_key,
+			          (uint8_t *) name,
+			          name_size,
+			          error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve sub key: %d name.",
+				 function,
+				 sub_key_index );
+
+				goto on_error;
+			}
+			if( catalog_handle_read_event_source(
+			     catalog_handle,
+			     message_handle,
+			     eventlog_key_name,
+			     name,
+			     name_size - 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read event source: %" PRIs_SYSTEM ".",
+				 function,
+				 name );
+
+				goto on_error;
+			}
+			memory_free(
+			 name );
+
+			name = NULL;
+		}
+		if( libregf_key_free(
+		     &sub_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free sub key: %d.",
+			 function,
+			 sub_key_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( name != NULL )
+	{
+		memory_free(
+		 name );
+	}
+	if( sub_key != NULL )
+	{
+		libregf_key_free(
+		 &sub_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the event sources of a specific event log
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_read_event_log(
+     catalog_handle_t *catalog_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	message_handle_t *message_handle = NULL;
+	static char *function            = "catalog_handle_read_event_log";
+	uint32_t number_of_messages      = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_handle->event_source_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog handle - event source values hash table already set.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_messages = catalog_handle->number_of_messages;
+
+	/* The registry files are opened per event log
+	 */
+	if( message_handle_initialize(
+	     &message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_copy_settings(
+	     message_handle,
+	     catalog_handle->message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy message handle settings.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_open_input(
+	     message_handle,
+	     eventlog_key_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_initialize(
+	     &( catalog_handle->event_source_values ),
+	     256,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event source values hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle->control_set_1_eventlog_services_key != NULL )
+	{
+		if( catalog_handle_read_event_sources_key(
+		     catalog_handle,
+		     message_handle,
+		     eventlog_key_name,
+		     message_handle->control_set_1_eventlog_services_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read control set 1 event sources.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_handle->control_set_2_eventlog_services_key != NULL )
+	{
+		if( catalog_handle_read_event_sources_key(
+		     catalog_handle,
+		     message_handle,
+		     eventlog_key_name,
+		     message_handle->control_set_2_eventlog_services_key,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read control set 2 event sources.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	fprintf(
+	 catalog_handle->notify_stream,
+	 "Event log: %s, number of messages: %" PRIu32 "\n",
+	 eventlog_key_name,
+	 catalog_handle->number_of_messages - number_of_messages );
+
+	if( hash_table_free(
+	     &( catalog_handle->event_source_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free event source values hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_close_input(
+	     message_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close input of message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle_free(
+	     &message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free message handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( catalog_handle->event_source_values != NULL )
+	{
+		hash_table_free(
+		 &( catalog_handle->event_source_values ),
+		 NULL );
+	}
+	if( message_handle != NULL )
+	{
+		message_handle_close_input(
+		 message_handle,
+		 NULL );
+		message_handle_free(
+		 &message_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Writes the message catalog file
+ * Returns 1 if successful or -1 on error
+ */
+int catalog_handle_write(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_header_t header;
+
+	evt_message_catalog_message_entry_t *message_entry = NULL;
+	libbfio_handle_t *file_io_handle                   = NULL;
+	uint8_t *message_entries_data                      = NULL;
+	static char *function                              = "catalog_handle_write";
+	size_t filename_length                             = 0;
+	size_t message_entries_data_size                   = 0;
+	ssize_t write_count                                = 0;
+	uint32_t message_index                             = 0;
+
+	if( catalog_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) catalog_handle->number_of_messages > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( evt_message_catalog_message_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog handle - number of messages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	message_entries_data_size = sizeof( evt_message_catalog_message_entry_t ) * catalog_handle->number_of_messages;
+
+	if( message_entries_data_size > 0 )
+	{
+		message_entries_data = (uint8_t *) memory_allocate(
+		                                    sizeof( uint8_t ) * message_entries_data_size );
+
+		if( message_entries_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create message entries data.",
+			 function );
+
+			goto on_error;
+		}
+		message_entry = (evt_message_catalog_message_entry_t *) message_entries_data;
+
+		for( message_index = 0;
+		     message_index < catalog_handle->number_of_messages;
+		     message_index++ )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 message_entry->identifier,
+			 catalog_handle->messages[ message_index ].identifier );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 message_entry->string_offset,
+			 catalog_handle->messages[ message_index ].string_offset );
+
+			message_entry++;
+		}
+	}
+	if( memory_set(
+	     &header,
+	     0,
+	     sizeof( evt_message_catalog_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     header.signature,
+	     evt_message_catalog_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 header.format_version,
+	 MESSAGE_CATALOG_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_event_source_values,
+	 catalog_handle->number_of_event_source_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_message_files,
+	 catalog_handle->number_of_message_files );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.number_of_messages,
+	 catalog_handle->number_of_messages );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 header.strings_data_size,
+	 (uint32_t) catalog_handle->strings_data_size );
+
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               file_io_handle,
+	               (uint8_t *) &header,
+	               sizeof( evt_message_catalog_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( evt_message_catalog_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write header.",
+		 function );
+
+		goto on_error;
+	}
+	if( catalog_handle->number_of_event_source_values > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               catalog_handle->event_source_values_data,
+		               sizeof( evt_message_catalog_event_source_value_entry_t ) * catalog_handle->number_of_event_source_values,
+		               error );
+
+		if( write_count != (ssize_t) ( sizeof( evt_message_catalog_event_source_value_entry_t ) * catalog_handle->number_of_event_source_values ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write event source value entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( catalog_handle->number_of_message_files > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               catalog_handle->message_files_data,
+		               sizeof( evt_message_catalog_message_file_entry_t ) * catalog_handle->number_of_message_files,
+		               error );
+
+		if( write_count != (ssize_t) ( sizeof( evt_message_catalog_message_file_entry_t ) * catalog_handle->number_of_message_files ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message file entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_entries_data_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               message_entries_data,
+		               message_entries_data_size,
+		               error );
+
+		if( write_count != (ssize_t) message_entries_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write message entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( catalog_handle->strings_data_size > 0 )
+	{
+		write_count = libbfio_handle_write_buffer(
+		               file_io_handle,
+		               catalog_handle->strings_data,
+		               catalog_handle->strings_data_size,
+		               error );
+
+		if( write_count != (ssize_t) catalog_handle->strings_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write strings data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_entries_data != NULL )
+	{
+		memory_free(
+		 message_entries_data );
+	}
+	fprintf(
+	 catalog_handle->notify_stream,
+	 "Number of event source values: %" PRIu32 ", message files: %" PRIu32 ", messages: %" PRIu32 "\n",
+	 catalog_handle->number_of_event_source_values,
+	 catalog_handle->number_of_message_files,
+	 catalog_handle->number_of_messages );
+
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( message_entries_data != NULL )
+	{
+		memory_free(
+		 message_entries_data );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,253 @@
+/*
+ * Catalog handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _CATALOG_HANDLE_H )
+#define _CATALOG_HANDLE_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "evttools_libregf.h"
+#include "hash_table.h"
+#include "message_handle.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct catalog_handle_message catalog_handle_message_t;
+
+struct catalog_handle_message
+{
+	/* The message identifier
+	 */
+	uint32_t identifier;
+
+	/* The offset of the message string in the strings data
+	 */
+	uint32_t string_offset;
+
+	/* The sequence number, which is used to keep the first of messages with the same identifier
+	 */
+	uint32_t sequence_number;
+};
+
+typedef struct catalog_handle catalog_handle_t;
+
+struct catalog_handle
+{
+	/* The message handle
+	 * Contains the settings used to open the registry and resource files
+	 */
+	message_handle_t *message_handle;
+
+	/* The event source value entries data
+	 */
+	uint8_t *event_source_values_data;
+
+	/* The event source value entries data size
+	 */
+	size_t event_source_values_data_size;
+
+	/* The number of event source value entries
+	 */
+	uint32_t number_of_event_source_values;
+
+	/* The message file entries data
+	 */
+	uint8_t *message_files_data;
+
+	/* The message file entries data size
+	 */
+	size_t message_files_data_size;
+
+	/* The number of message file entries
+	 */
+	uint32_t number_of_message_files;
+
+	/* The messages
+	 */
+	catalog_handle_message_t *messages;
+
+	/* The messages size
+	 */
+	size_t messages_size;
+
+	/* The number of messages
+	 */
+	uint32_t number_of_messages;
+
+	/* The strings data
+	 */
+	uint8_t *strings_data;
+
+	/* The allocated strings data size
+	 */
+	size_t strings_data_allocated_size;
+
+	/* The strings data size
+	 */
+	size_t strings_data_size;
+
+	/* The strings hash table
+	 * Maps a string to its offset in the strings data, so that every string is stored once
+	 */
+	hash_table_t *strings;
+
+	/* The message files hash table
+	 * Contains the (normalized) resource filenames of which the messages were read
+	 */
+	hash_table_t *message_files;
+
+	/* The event source values hash table
+	 * Contains the event source values of the event log that is being read
+	 */
+	hash_table_t *event_source_values;
+
+	/* The notification output stream
+	 */
+	FILE *notify_stream;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int catalog_handle_initialize(
+     catalog_handle_t **catalog_handle,
+     libcerror_error_t **error );
+
+int catalog_handle_free(
+     catalog_handle_t **catalog_handle,
+     libcerror_error_t **error );
+
+int catalog_handle_signal_abort(
+     catalog_handle_t *catalog_handle,
+     libcerror_error_t **error );
+
+int catalog_handle_set_software_registry_filename(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int catalog_handle_set_system_registry_filename(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int catalog_handle_set_registry_directory_name(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *name,
+     libcerror_error_t **error );
+
+int catalog_handle_set_resource_files_path(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int catalog_handle_free_string_offset(
+     uint32_t **string_offset,
+     libcerror_error_t **error );
+
+int catalog_handle_resize_data(
+     uint8_t **data,
+     size_t *data_size,
+     size_t required_data_size,
+     libcerror_error_t **error );
+
+int catalog_handle_append_utf8_string(
+     catalog_handle_t *catalog_handle,
+     const uint8_t *utf8_string,
+     size_t utf8_string_size,
+     uint32_t *string_offset,
+     libcerror_error_t **error );
+
+int catalog_handle_append_string(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *string,
+     size_t string_length,
+     uint32_t *string_offset,
+     libcerror_error_t **error );
+
+int catalog_handle_append_message(
+     catalog_handle_t *catalog_handle,
+     uint32_t message_identifier,
+     const system_character_t *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int catalog_handle_read_message_string_table(
+     catalog_handle_t *catalog_handle,
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
+int catalog_handle_compare_messages(
+     const catalog_handle_message_t *first_message,
+     const catalog_handle_message_t *second_message );
+
+int catalog_handle_read_message_file(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     libcerror_error_t **error );
+
+int catalog_handle_read_message_files(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const system_character_t *value_string,
+     size_t value_string_length,
+     libcerror_error_t **error );
+
+int catalog_handle_read_event_source(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     libcerror_error_t **error );
+
+int catalog_handle_read_event_sources_key(
+     catalog_handle_t *catalog_handle,
+     message_handle_t *message_handle,
+     const char *eventlog_key_name,
+     libregf_key_t *eventlog_key,
+     libcerror_error_t **error );
+
+int catalog_handle_read_event_log(
+     catalog_handle_t *catalog_handle,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
+int catalog_handle_write(
+     catalog_handle_t *catalog_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _CATALOG_HANDLE_H ) */
+
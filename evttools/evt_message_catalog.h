@@ -0,0 +1,131 @@
+/*
+ * The message catalog file definition
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVT_MESSAGE_CATALOG_H )
+#define _EVT_MESSAGE_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message catalog file is not part of the EVT format, it is created by evtcatalog
+ * to store the event source values and message tables resolved from the Windows Registry
+ * and resource files, so that they do not need to be resolved again.
+ * The header is followed by the event source value entries, the message file entries,
+ * the message entries and the strings data. All values are stored in little-endian and
+ * all strings are stored as UTF-8 with an end-of-string character.
+ */
+typedef struct evt_message_catalog_header evt_message_catalog_header_t;
+
+struct evt_message_catalog_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "EVTCAT\x00\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of event source value entries
+	 */
+	uint8_t number_of_event_source_values[ 4 ];
+
+	/* The number of message file entries
+	 */
+	uint8_t number_of_message_files[ 4 ];
+
+	/* The number of message entries
+	 */
+	uint8_t number_of_messages[ 4 ];
+
+	/* The size of the strings data
+	 */
+	uint8_t strings_data_size[ 4 ];
+
+	/* Unknown (reserved)
+	 */
+	uint8_t unknown1[ 4 ];
+};
+
+typedef struct evt_message_catalog_event_source_value_entry evt_message_catalog_event_source_value_entry_t;
+
+struct evt_message_catalog_event_source_value_entry
+{
+	/* The offset of the event log (key) name in the strings data
+	 */
+	uint8_t event_log_name_offset[ 4 ];
+
+	/* The offset of the event source in the strings data
+	 */
+	uint8_t event_source_offset[ 4 ];
+
+	/* The offset of the value name in the strings data
+	 */
+	uint8_t value_name_offset[ 4 ];
+
+	/* The offset of the value string in the strings data
+	 */
+	uint8_t value_string_offset[ 4 ];
+};
+
+typedef struct evt_message_catalog_message_file_entry evt_message_catalog_message_file_entry_t;
+
+struct evt_message_catalog_message_file_entry
+{
+	/* The offset of the resource filename in the strings data
+	 */
+	uint8_t resource_filename_offset[ 4 ];
+
+	/* The index of the first message entry of the message file
+	 */
+	uint8_t first_message_index[ 4 ];
+
+	/* The number of message entries of the message file
+	 * The message entries of a message file are sorted by identifier
+	 */
+	uint8_t number_of_messages[ 4 ];
+};
+
+typedef struct evt_message_catalog_message_entry evt_message_catalog_message_entry_t;
+
+struct evt_message_catalog_message_entry
+{
+	/* The message identifier
+	 */
+	uint8_t identifier[ 4 ];
+
+	/* The offset of the message string in the strings data
+	 */
+	uint8_t string_offset[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVT_MESSAGE_CATALOG_H ) */
+
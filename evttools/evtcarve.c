@@ -0,0 +1,404 @@
+/*
+ * Carves Windows Event Log (EVT) records from arbitrary data
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "carve_handle.h"
+#include "evttools_getopt.h"
+#include "evttools_libcerror.h"
+#include "evttools_libclocale.h"
+#include "evttools_libcnotify.h"
+#include "evttools_libevt.h"
+#include "evttools_output.h"
+#include "evttools_signal.h"
+#include "evttools_unused.h"
+
+carve_handle_t *evtcarve_carve_handle = NULL;
+int evtcarve_abort                    = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtcarve to carve Windows Event Log (EVT) records from\n"
+	                 "arbitrary data, such as a pagefile, memory image or unallocated\n"
+	                 "space.\n\n" );
+
+	fprintf( stream, "Usage: evtcarve [ -c codepage ] [ -o offset ] [ -s size ]\n"
+	                 "                [ -hvV ] source\n\n" );
+
+	fprintf( stream, "\tsource: the source file\n\n" );
+
+	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
+	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
+	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
+	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
+	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-o:     offset of the range to carve, in decimal or hexadecimal\n"
+	                 "\t        with a 0x prefix (default is 0)\n" );
+	fprintf( stream, "\t-s:     size of the range to carve, in decimal or hexadecimal\n"
+	                 "\t        with a 0x prefix (default is until the end of the source)\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtcarve
+ */
+void evtcarve_signal_handler(
+      evttools_signal_t signal EVTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "evtcarve_signal_handler";
+
+	EVTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtcarve_abort = 1;
+
+	if( evtcarve_carve_handle != NULL )
+	{
+		if( carve_handle_signal_abort(
+		     evtcarve_carve_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal carve handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                  = NULL;
+	system_character_t *option_ascii_codepage = NULL;
+	system_character_t *option_range_offset   = NULL;
+	system_character_t *option_range_size     = NULL;
+	system_character_t *source                = NULL;
+	char *program                             = "evtcarve";
+	system_integer_t option                   = 0;
+	int result                                = 0;
+	int verbose                               = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evttools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "c:ho:s:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'c':
+				option_ascii_codepage = optarg;
+
+				break;
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'o':
+				option_range_offset = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_range_size = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	source = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+	libevt_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevt_notify_set_verbose(
+	 verbose );
+
+	if( carve_handle_initialize(
+	     &evtcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize carve handle.\n" );
+
+		goto on_error;
+	}
+	if( option_ascii_codepage != NULL )
+	{
+		result = carve_handle_set_ascii_codepage(
+		          evtcarve_carve_handle,
+		          option_ascii_codepage,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set ASCII codepage in carve handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
+		}
+	}
+	if( option_range_offset != NULL )
+	{
+		result = carve_handle_set_range_offset(
+		          evtcarve_carve_handle,
+		          option_range_offset,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported range offset.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_range_size != NULL )
+	{
+		result = carve_handle_set_range_size(
+		          evtcarve_carve_handle,
+		          option_range_size,
+		          &error );
+
+		if( result != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported range size.\n" );
+
+			goto on_error;
+		}
+	}
+	if( carve_handle_open_input(
+	     evtcarve_carve_handle,
+	     source,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to open: %" PRIs_SYSTEM ".\n",
+		 source );
+
+		goto on_error;
+	}
+	if( evttools_signal_attach(
+	     evtcarve_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	result = carve_handle_carve_input(
+	          evtcarve_carve_handle,
+	          &error );
+
+	if( result == -1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to carve records.\n" );
+
+		goto on_error;
+	}
+	if( evttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( carve_handle_close_input(
+	     evtcarve_carve_handle,
+	     &error ) != 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to close carve handle.\n" );
+
+		goto on_error;
+	}
+	if( carve_handle_free(
+	     &evtcarve_carve_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free carve handle.\n" );
+
+		goto on_error;
+	}
+	if( evtcarve_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Carving aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtcarve_carve_handle != NULL )
+	{
+		carve_handle_free(
+		 &evtcarve_carve_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
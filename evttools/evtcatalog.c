@@ -0,0 +1,432 @@
+/*
+ * Creates a message catalog file from the Windows Registry and resource files
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "catalog_handle.h"
+#include "evttools_getopt.h"
+#include "evttools_libcerror.h"
+#include "evttools_libclocale.h"
+#include "evttools_libcnotify.h"
+#include "evttools_output.h"
+#include "evttools_signal.h"
+#include "evttools_unused.h"
+
+/* The event logs of which the event sources are stored in the message catalog
+ */
+#define EVTCATALOG_NUMBER_OF_EVENT_LOGS	5
+
+const char *evtcatalog_event_log_key_names[ EVTCATALOG_NUMBER_OF_EVENT_LOGS ] = {
+	"Application",
+	"Internet Explorer",
+	"Security",
+	"System",
+	"Windows PowerShell" };
+
+catalog_handle_t *evtcatalog_catalog_handle = NULL;
+int evtcatalog_abort                        = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtcatalog to create a message catalog file that contains\n"
+	                 "the event source values and event messages of the Windows\n"
+	                 "Registry and resource files. The message catalog file can be\n"
+	                 "used by evtexport to resolve the event messages.\n\n" );
+
+	fprintf( stream, "Usage: evtcatalog [ -p resource_files_path ]\n"
+	                 "                  [ -r registry_directory_name ]\n"
+	                 "                  [ -s system_registry_file ]\n"
+	                 "                  [ -S software_registry_file ] [ -hvV ]\n"
+	                 "                  catalog_file\n\n" );
+
+	fprintf( stream, "\tcatalog_file: the message catalog file\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-p:     search PATH for the resource files (default is the current\n"
+	                 "\t        working directory)\n" );
+	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
+	                 "\t        (Windows) Registry file\n" );
+	fprintf( stream, "\t-s:     filename of the SYSTEM (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-S:     filename of the SOFTWARE (Windows) Registry file.\n"
+	                 "\t        This option overrides the path provided by -r\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtcatalog
+ */
+void evtcatalog_signal_handler(
+      evttools_signal_t signal EVTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "evtcatalog_signal_handler";
+
+	EVTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtcatalog_abort = 1;
+
+	if( evtcatalog_catalog_handle != NULL )
+	{
+		if( catalog_handle_signal_abort(
+		     evtcatalog_catalog_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal catalog handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error                              = NULL;
+	system_character_t *option_registry_directory_name    = NULL;
+	system_character_t *option_resource_files_path        = NULL;
+	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_system_registry_filename   = NULL;
+	system_character_t *target                            = NULL;
+	char *program                                         = "evtcatalog";
+	system_integer_t option                               = 0;
+	int event_log_index                                   = 0;
+	int verbose                                           = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evttools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hp:r:s:S:vV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'p':
+				option_resource_files_path = optarg;
+
+				break;
+
+			case (system_integer_t) 'r':
+				option_registry_directory_name = optarg;
+
+				break;
+
+			case (system_integer_t) 's':
+				option_system_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'S':
+				option_software_registry_filename = optarg;
+
+				break;
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing catalog file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	target = argv[ optind ];
+
+	libcnotify_verbose_set(
+	 verbose );
+
+	if( catalog_handle_initialize(
+	     &evtcatalog_catalog_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to create catalog handle.\n" );
+
+		goto on_error;
+	}
+	if( option_resource_files_path != NULL )
+	{
+		if( catalog_handle_set_resource_files_path(
+		     evtcatalog_catalog_handle,
+		     option_resource_files_path,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource files path in catalog handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_software_registry_filename != NULL )
+	{
+		if( catalog_handle_set_software_registry_filename(
+		     evtcatalog_catalog_handle,
+		     option_software_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set software registry filename in catalog handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_system_registry_filename != NULL )
+	{
+		if( catalog_handle_set_system_registry_filename(
+		     evtcatalog_catalog_handle,
+		     option_system_registry_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set system registry filename in catalog handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( option_registry_directory_name != NULL )
+	{
+		if( catalog_handle_set_registry_directory_name(
+		     evtcatalog_catalog_handle,
+		     option_registry_directory_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set registry directory name in catalog handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( evttools_signal_attach(
+	     evtcatalog_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	for( event_log_index = 0;
+	     event_log_index < EVTCATALOG_NUMBER_OF_EVENT_LOGS;
+	     event_log_index++ )
+	{
+		if( evtcatalog_abort != 0 )
+		{
+			break;
+		}
+		if( catalog_handle_read_event_log(
+		     evtcatalog_catalog_handle,
+		     evtcatalog_event_log_key_names[ event_log_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to read event log: %s.\n",
+			 evtcatalog_event_log_key_names[ event_log_index ] );
+
+			goto on_error;
+		}
+	}
+	if( evttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtcatalog_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Creating message catalog aborted.\n" );
+
+		catalog_handle_free(
+		 &evtcatalog_catalog_handle,
+		 NULL );
+
+		return( EXIT_FAILURE );
+	}
+	/* The message catalog file is only written after all event logs were read,
+	 * so that an aborted run does not leave a partial message catalog file
+	 */
+	if( catalog_handle_write(
+	     evtcatalog_catalog_handle,
+	     target,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to write message catalog file: %" PRIs_SYSTEM ".\n",
+		 target );
+
+		goto on_error;
+	}
+	if( catalog_handle_free(
+	     &evtcatalog_catalog_handle,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to free catalog handle.\n" );
+
+		goto on_error;
+	}
+	fprintf(
+	 stdout,
+	 "Message catalog written: %" PRIs_SYSTEM ".\n",
+	 target );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtcatalog_catalog_handle != NULL )
+	{
+		catalog_handle_free(
+		 &evtcatalog_catalog_handle,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
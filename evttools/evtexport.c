@@ -42,9 +42,11 @@
 #include "evttools_output.h"
 #include "evttools_unused.h"
 #include "export_handle.h"
+#include "follow_handle.h"
 #include "log_handle.h"
 
 export_handle_t *evtexport_export_handle = NULL;
+follow_handle_t *evtexport_follow_handle = NULL;
 int evtexport_abort                      = 0;
 
 /* Prints the executable usage information
@@ -59,24 +61,56 @@ void usage_fprint(
 	fprintf( stream, "Use evtexport to export items stored in a Windows Event\n"
 	                 "Log (EVT) file.\n\n" );
 
-	fprintf( stream, "Usage: evtexport [ -c codepage ] [ -l log_file ] [ -m mode ]\n"
-	                 "                 [ -p resource_files_path ] [ -r registy_files_path ]\n"
-	                 "                 [ -s system_file ] [ -S software_file ]\n"
-	                 "                 [ -t event_log_type ] [ -hvV ] source\n\n" );
-
-	fprintf( stream, "\tsource: the source file\n\n" );
-
+	fprintf( stream, "Usage: evtexport [ -b start_time ] [ -c codepage ]\n"
+	                 "                 [ -C event_categories ] [ -e end_time ]\n"
+	                 "                 [ -i event_identifiers ] [ -j threads ]\n"
+	                 "                 [ -k number_of_files ] [ -K size ] [ -l log_file ]\n"
+	                 "                 [ -m mode ] [ -n source_name ]\n"
+	                 "                 [ -p resource_files_path ]\n"
+	                 "                 [ -r registy_files_path ] [ -s system_file ]\n"
+	                 "                 [ -S software_file ] [ -t event_log_type ]\n"
+	                 "                 [ -T event_types ] [ -x message_catalog_file ]\n"
+	                 "                 [ -fhMvV ] source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source file or directory, the .evt files in a source\n"
+	                 "\t        directory are exported in order of their name\n\n" );
+
+	fprintf( stream, "\t-b:     only export the records last written at or after the start\n"
+	                 "\t        time, in number of seconds since January 1, 1970 (POSIX time)\n" );
 	fprintf( stream, "\t-c:     codepage of ASCII strings, options: ascii, windows-874,\n"
 	                 "\t        windows-932, windows-936, windows-949, windows-950,\n"
 	                 "\t        windows-1250, windows-1251, windows-1252 (default),\n"
 	                 "\t        windows-1253, windows-1254, windows-1255, windows-1256\n"
 	                 "\t        windows-1257 or windows-1258\n" );
+	fprintf( stream, "\t-C:     only export the records with one of the comma separated\n"
+	                 "\t        event categories\n" );
+	fprintf( stream, "\t-e:     only export the records last written at or before the end\n"
+	                 "\t        time, in number of seconds since January 1, 1970 (POSIX time)\n" );
+	fprintf( stream, "\t-f:     follow the source file, after the export wait for changes\n"
+	                 "\t        and export the records that were appended to it until\n"
+	                 "\t        interrupted, like tail -F. If the source file is replaced\n"
+	                 "\t        the records of the replacement file are exported\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-i:     only export the records with one of the comma separated\n"
+	                 "\t        event identifiers\n" );
+	fprintf( stream, "\t-j:     maximum number of threads used to export the source files or\n"
+	                 "\t        the records of a single source file, between 1 (default)\n"
+	                 "\t        and 64, the output is written in order of the source files\n"
+	                 "\t        and records\n" );
+	fprintf( stream, "\t-k:     maximum number of resource files that are kept open to resolve\n"
+	                 "\t        the event messages, between 1 and 65536, default is 64\n" );
+	fprintf( stream, "\t-K:     maximum size in MiB of the resource sections of the resource\n"
+	                 "\t        files that are kept open, 0 represents no maximum, default\n"
+	                 "\t        is 256\n" );
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, items (default), recovered\n"
 	                 "\t        'all' exports the (allocated) items and recovered items,\n"
 	                 "\t        'items' exports the (allocated) items and 'recovered' exports\n"
 	                 "\t        the recovered items\n" );
+	fprintf( stream, "\t-M:     merge the records of the source files in order of their last\n"
+	                 "\t        written time, the event log type of the first source file is\n"
+	                 "\t        used to resolve the event messages\n" );
+	fprintf( stream, "\t-n:     only export the records with the (case sensitive) source name\n" );
 	fprintf( stream, "\t-p:     search PATH for the resource files (default is the current\n"
 	                 "\t        working directory)\n" );
 	fprintf( stream, "\t-r:     name of the directory containing the SOFTWARE and SYSTEM\n"
@@ -88,8 +122,18 @@ void usage_fprint(
 	fprintf( stream, "\t-t:     event log type, options: application, security, system\n"
 	                 "\t        if not specified the event log type is determined based\n"
 	                 "\t        on the filename.\n" );
-	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-T:     only export the records with one of the comma separated\n"
+	                 "\t        event types, options: error, warning, information,\n"
+	                 "\t        audit_success, audit_failure\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr, including the resource file cache\n"
+	                 "\t        statistics\n" );
+	fprintf( stream, "\t-x:     filename of a message catalog file created with evtcatalog,\n"
+	                 "\t        the event messages are resolved using the message catalog\n"
+	                 "\t        instead of the (Windows) Registry and resource files\n"
+	                 "\t        and the -p, -r, -s and -S options are ignored\n" );
 	fprintf( stream, "\t-V:     print version\n" );
+	fprintf( stream, "\n\tThe -b, -C, -e, -f, -i, -M, -n and -T options apply to the (allocated) items\n"
+	                 "\tand not to the recovered items\n" );
 }
 
 /* Signal handler for evtexport
@@ -120,6 +164,22 @@ void evtexport_signal_handler(
 			 &error );
 		}
 	}
+	if( evtexport_follow_handle != NULL )
+	{
+		if( follow_handle_signal_abort(
+		     evtexport_follow_handle,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal follow handle to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
 	/* Force stdin to close otherwise any function reading it will remain blocked
 	 */
 #if defined( WINAPI ) && !defined( __CYGWIN__ )
@@ -147,18 +207,32 @@ int main( int argc, char * const argv[] )
 	libcerror_error_t *error                              = NULL;
 	log_handle_t *log_handle                              = NULL;
 	system_character_t *option_ascii_codepage             = NULL;
+	system_character_t *option_end_time                   = NULL;
+	system_character_t *option_event_categories           = NULL;
+	system_character_t *option_event_identifiers          = NULL;
 	system_character_t *option_event_log_type             = NULL;
+	system_character_t *option_event_types                = NULL;
 	system_character_t *option_export_mode                = NULL;
 	system_character_t *option_log_filename               = NULL;
+	system_character_t *option_maximum_number_of_threads  = NULL;
+	system_character_t *option_message_catalog_filename   = NULL;
+	system_character_t *option_resource_file_cache_files  = NULL;
+	system_character_t *option_resource_file_cache_size   = NULL;
 	system_character_t *option_resource_files_path        = NULL;
 	system_character_t *option_preferred_language         = NULL;
 	system_character_t *option_registry_directory_name    = NULL;
 	system_character_t *option_software_registry_filename = NULL;
+	system_character_t *option_source_name                = NULL;
+	system_character_t *option_start_time                 = NULL;
 	system_character_t *option_system_registry_filename   = NULL;
 	system_character_t *source                            = NULL;
 	char *program                                         = "evtexport";
 	system_integer_t option                               = 0;
+	int follow                                            = 0;
+	int merge                                             = 0;
+	int number_of_source_files                            = 0;
 	int result                                            = 0;
+	int source_index                                      = 0;
 	int verbose                                           = 0;
 
 	libcnotify_stream_set(
@@ -194,7 +268,7 @@ int main( int argc, char * const argv[] )
 	while( ( option = evttools_getopt(
 	                   argc,
 	                   argv,
-	                   _SYSTEM_STRING( "c:hl:m:p:r:s:S:t:vV" ) ) ) != (system_integer_t) -1 )
+	                   _SYSTEM_STRING( "b:c:C:e:fhi:j:k:K:l:m:Mn:p:r:s:S:t:T:vVx:" ) ) ) != (system_integer_t) -1 )
 	{
 		switch( option )
 		{
@@ -210,17 +284,57 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_FAILURE );
 
+			case (system_integer_t) 'b':
+				option_start_time = optarg;
+
+				break;
+
 			case (system_integer_t) 'c':
 				option_ascii_codepage = optarg;
 
 				break;
 
+			case (system_integer_t) 'C':
+				option_event_categories = optarg;
+
+				break;
+
+			case (system_integer_t) 'e':
+				option_end_time = optarg;
+
+				break;
+
+			case (system_integer_t) 'f':
+				follow = 1;
+
+				break;
+
 			case (system_integer_t) 'h':
 				usage_fprint(
 				 stdout );
 
 				return( EXIT_SUCCESS );
 
+			case (system_integer_t) 'i':
+				option_event_identifiers = optarg;
+
+				break;
+
+			case (system_integer_t) 'j':
+				option_maximum_number_of_threads = optarg;
+
+				break;
+
+			case (system_integer_t) 'k':
+				option_resource_file_cache_files = optarg;
+
+				break;
+
+			case (system_integer_t) 'K':
+				option_resource_file_cache_size = optarg;
+
+				break;
+
 			case (system_integer_t) 'l':
 				option_log_filename = optarg;
 
@@ -231,6 +345,16 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'M':
+				merge = 1;
+
+				break;
+
+			case (system_integer_t) 'n':
+				option_source_name = optarg;
+
+				break;
+
 			case (system_integer_t) 'p':
 				option_resource_files_path = optarg;
 
@@ -256,6 +380,11 @@ int main( int argc, char * const argv[] )
 
 				break;
 
+			case (system_integer_t) 'T':
+				option_event_types = optarg;
+
+				break;
+
 			case (system_integer_t) 'v':
 				verbose = 1;
 
@@ -266,6 +395,11 @@ int main( int argc, char * const argv[] )
 				 stdout );
 
 				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'x':
+				option_message_catalog_filename = optarg;
+
+				break;
 		}
 	}
 	if( optind == argc )
@@ -279,8 +413,6 @@ int main( int argc, char * const argv[] )
 
 		return( EXIT_FAILURE );
 	}
-	source = argv[ optind ];
-
 	libcnotify_verbose_set(
 	 verbose );
 	libevt_notify_set_stream(
@@ -309,6 +441,44 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( export_handle_append_source(
+		     evtexport_export_handle,
+		     argv[ source_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to append source: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			goto on_error;
+		}
+	}
+	number_of_source_files = evtexport_export_handle->number_of_source_filenames;
+
+	if( number_of_source_files == 0 )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		goto on_error;
+	}
+	if( ( follow != 0 )
+	 && ( number_of_source_files > 1 ) )
+	{
+		fprintf(
+		 stderr,
+		 "Follow mode does not support multiple source files.\n" );
+
+		goto on_error;
+	}
+	source = evtexport_export_handle->source_filenames[ 0 ];
+
 	if( option_ascii_codepage != NULL )
 	{
 		result = export_handle_set_ascii_codepage(
@@ -331,6 +501,72 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_maximum_number_of_threads != NULL )
+	{
+		result = export_handle_set_maximum_number_of_threads(
+		          evtexport_export_handle,
+		          option_maximum_number_of_threads,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set maximum number of threads.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported maximum number of threads defaulting to: 1.\n" );
+		}
+	}
+	if( option_resource_file_cache_files != NULL )
+	{
+		result = export_handle_set_resource_file_cache_number_of_files(
+		          evtexport_export_handle,
+		          option_resource_file_cache_files,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource file cache number of files.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported resource file cache number of files defaulting to: 64.\n" );
+		}
+	}
+	if( option_resource_file_cache_size != NULL )
+	{
+		result = export_handle_set_resource_file_cache_size(
+		          evtexport_export_handle,
+		          option_resource_file_cache_size,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set resource file cache size.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported resource file cache size defaulting to: 256.\n" );
+		}
+	}
 	if( option_event_log_type != NULL )
 	{
 		result = export_handle_set_event_log_type(
@@ -369,8 +605,13 @@ int main( int argc, char * const argv[] )
 			 "Unsupported export mode defaulting to: items.\n" );
 		}
 	}
-	if( ( option_event_log_type == NULL )
-	 || ( result == 0 ) )
+	/* When the records of multiple source files are exported separately
+	 * the event log type is determined per source file
+	 */
+	if( ( ( merge != 0 )
+	  || ( number_of_source_files == 1 ) )
+	 && ( ( option_event_log_type == NULL )
+	  || ( result == 0 ) ) )
 	{
 		result = export_handle_set_event_log_type_from_filename(
 			  evtexport_export_handle,
@@ -400,6 +641,20 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_message_catalog_filename != NULL )
+	{
+		if( export_handle_set_message_catalog_filename(
+		     evtexport_export_handle,
+		     option_message_catalog_filename,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set message catalog filename in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( option_software_registry_filename != NULL )
 	{
 		if( export_handle_set_software_registry_filename(
@@ -457,6 +712,145 @@ int main( int argc, char * const argv[] )
 			goto on_error;
 		}
 	}
+	if( option_event_identifiers != NULL )
+	{
+		result = export_handle_set_event_identifiers(
+		          evtexport_export_handle,
+		          option_event_identifiers,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event identifiers in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported event identifiers: %" PRIs_SYSTEM ".\n",
+			 option_event_identifiers );
+
+			goto on_error;
+		}
+	}
+	if( option_event_categories != NULL )
+	{
+		result = export_handle_set_event_categories(
+		          evtexport_export_handle,
+		          option_event_categories,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event categories in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported event categories: %" PRIs_SYSTEM ".\n",
+			 option_event_categories );
+
+			goto on_error;
+		}
+	}
+	if( option_event_types != NULL )
+	{
+		result = export_handle_set_event_types(
+		          evtexport_export_handle,
+		          option_event_types,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set event types in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported event types: %" PRIs_SYSTEM ".\n",
+			 option_event_types );
+
+			goto on_error;
+		}
+	}
+	if( option_start_time != NULL )
+	{
+		result = export_handle_set_start_time(
+		          evtexport_export_handle,
+		          option_start_time,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set start time in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported start time: %" PRIs_SYSTEM ".\n",
+			 option_start_time );
+
+			goto on_error;
+		}
+	}
+	if( option_end_time != NULL )
+	{
+		result = export_handle_set_end_time(
+		          evtexport_export_handle,
+		          option_end_time,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set end time in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported end time: %" PRIs_SYSTEM ".\n",
+			 option_end_time );
+
+			goto on_error;
+		}
+	}
+	if( option_source_name != NULL )
+	{
+		if( export_handle_set_source_name(
+		     evtexport_export_handle,
+		     option_source_name,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set source name in export handle.\n" );
+
+			goto on_error;
+		}
+	}
 	if( log_handle_open(
 	     log_handle,
 	     option_log_filename,
@@ -469,30 +863,189 @@ int main( int argc, char * const argv[] )
 
 		goto on_error;
 	}
-	if( export_handle_open_input(
-	     evtexport_export_handle,
-	     source,
-	     &error ) != 1 )
+	if( ( merge == 0 )
+	 && ( number_of_source_files > 1 ) )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to open: %" PRIs_SYSTEM ".\n",
-		 source );
+		if( evttools_signal_attach(
+		     evtexport_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
 
-		goto on_error;
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = export_handle_export_source_files(
+		          evtexport_export_handle,
+		          log_handle,
+		          &error );
+
+		if( evttools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export source files.\n" );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( export_handle_open_input(
+		     evtexport_export_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open: %" PRIs_SYSTEM ".\n",
+			 source );
+
+			goto on_error;
+		}
+		for( source_index = 1;
+		     source_index < number_of_source_files;
+		     source_index++ )
+		{
+			if( export_handle_open_merge_input(
+			     evtexport_export_handle,
+			     evtexport_export_handle->source_filenames[ source_index ],
+			     &error ) != 1 )
+			{
+				fprintf(
+				 stderr,
+				 "Unable to open: %" PRIs_SYSTEM ".\n",
+				 evtexport_export_handle->source_filenames[ source_index ] );
+
+				goto on_error;
+			}
+		}
+		result = export_handle_export_file(
+		          evtexport_export_handle,
+		          log_handle,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export file.\n" );
+
+			goto on_error;
+		}
 	}
-	result = export_handle_export_file(
-	          evtexport_export_handle,
-	          log_handle,
-	          &error );
+	if( follow != 0 )
+	{
+		if( follow_handle_initialize(
+		     &evtexport_follow_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to initialize follow handle.\n" );
+
+			goto on_error;
+		}
+		if( follow_handle_open(
+		     evtexport_follow_handle,
+		     source,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to open follow handle.\n" );
 
-	if( result == -1 )
+			goto on_error;
+		}
+		if( evttools_signal_attach(
+		     evtexport_signal_handler,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to attach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		result = export_handle_follow_file(
+		          evtexport_export_handle,
+		          evtexport_follow_handle,
+		          log_handle,
+		          &error );
+
+		if( evttools_signal_detach(
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to detach signal handler.\n" );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to follow file.\n" );
+
+			goto on_error;
+		}
+		if( follow_handle_close(
+		     evtexport_follow_handle,
+		     &error ) != 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to close follow handle.\n" );
+
+			goto on_error;
+		}
+		if( follow_handle_free(
+		     &evtexport_follow_handle,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to free follow handle.\n" );
+
+			goto on_error;
+		}
+	}
+	if( verbose != 0 )
 	{
-		fprintf(
-		 stderr,
-		 "Unable to export file.\n" );
+		if( export_handle_resource_file_cache_statistics_fprint(
+		     evtexport_export_handle,
+		     stderr,
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to print resource file cache statistics.\n" );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 	if( export_handle_close_input(
 	     evtexport_export_handle,
@@ -550,6 +1103,12 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( evtexport_follow_handle != NULL )
+	{
+		follow_handle_free(
+		 &evtexport_follow_handle,
+		 NULL );
+	}
 	if( evtexport_export_handle != NULL )
 	{
 		export_handle_free(
@@ -0,0 +1,476 @@
+/*
+ * Creates index files of Windows Event Log (EVT) files
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evttools_getopt.h"
+#include "evttools_libcerror.h"
+#include "evttools_libclocale.h"
+#include "evttools_libcnotify.h"
+#include "evttools_libevt.h"
+#include "evttools_output.h"
+#include "evttools_signal.h"
+#include "evttools_unused.h"
+
+/* The suffix of the index file name
+ */
+#define EVTINDEX_INDEX_FILE_SUFFIX		_SYSTEM_STRING( ".evtidx" )
+#define EVTINDEX_INDEX_FILE_SUFFIX_LENGTH	7
+
+libevt_file_t *evtindex_file = NULL;
+int evtindex_abort           = 0;
+
+/* Prints the executable usage information
+ */
+void usage_fprint(
+      FILE *stream )
+{
+	if( stream == NULL )
+	{
+		return;
+	}
+	fprintf( stream, "Use evtindex to create index files of Windows Event Log (EVT)\n"
+	                 "files. The index file of a source file is named: source.evtidx\n"
+	                 "and allows the source file to be reopened without reading\n"
+	                 "all its records.\n\n" );
+
+	fprintf( stream, "Usage: evtindex [ -hvV ] source [ source ... ]\n\n" );
+
+	fprintf( stream, "\tsource: the source file(s)\n\n" );
+
+	fprintf( stream, "\t-h:     shows this help\n" );
+	fprintf( stream, "\t-v:     verbose output to stderr\n" );
+	fprintf( stream, "\t-V:     print version\n" );
+}
+
+/* Signal handler for evtindex
+ */
+void evtindex_signal_handler(
+      evttools_signal_t signal EVTTOOLS_ATTRIBUTE_UNUSED )
+{
+	libcerror_error_t *error = NULL;
+	static char *function   = "evtindex_signal_handler";
+
+	EVTTOOLS_UNREFERENCED_PARAMETER( signal )
+
+	evtindex_abort = 1;
+
+	if( evtindex_file != NULL )
+	{
+		if( libevt_file_signal_abort(
+		     evtindex_file,
+		     &error ) != 1 )
+		{
+			libcnotify_printf(
+			 "%s: unable to signal file to abort.\n",
+			 function );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	/* Force stdin to close otherwise any function reading it will remain blocked
+	 */
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+	if( _close(
+	     0 ) != 0 )
+#else
+	if( close(
+	     0 ) != 0 )
+#endif
+	{
+		libcnotify_printf(
+		 "%s: unable to close stdin.\n",
+		 function );
+	}
+}
+
+/* Creates the index file of a source file
+ * The index file is created by opening the source file with the index path set,
+ * an existing index file that matches the source file is kept
+ * Returns 1 if successful or -1 on error
+ */
+int evtindex_index_file(
+     const system_character_t *source,
+     libcerror_error_t **error )
+{
+	system_character_t *index_path = NULL;
+	static char *function          = "evtindex_index_file";
+	size_t index_path_size         = 0;
+	size_t source_length           = 0;
+
+	if( source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source.",
+		 function );
+
+		return( -1 );
+	}
+	source_length = system_string_length(
+	                 source );
+
+	index_path_size = source_length + EVTINDEX_INDEX_FILE_SUFFIX_LENGTH + 1;
+
+	index_path = system_string_allocate(
+	              index_path_size );
+
+	if( index_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     index_path,
+	     source,
+	     source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy source to index path.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     &( index_path[ source_length ] ),
+	     EVTINDEX_INDEX_FILE_SUFFIX,
+	     EVTINDEX_INDEX_FILE_SUFFIX_LENGTH ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy suffix to index path.",
+		 function );
+
+		goto on_error;
+	}
+	index_path[ index_path_size - 1 ] = 0;
+
+	if( libevt_file_initialize(
+	     &evtindex_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevt_file_set_index_path_wide(
+	     evtindex_file,
+	     index_path,
+	     error ) != 1 )
+#else
+	if( libevt_file_set_index_path(
+	     evtindex_file,
+	     index_path,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index path.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevt_file_open_wide(
+	     evtindex_file,
+	     source,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevt_file_open(
+	     evtindex_file,
+	     source,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_close(
+	     evtindex_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_free(
+	     &evtindex_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 index_path );
+
+	return( 1 );
+
+on_error:
+	if( evtindex_file != NULL )
+	{
+		libevt_file_free(
+		 &evtindex_file,
+		 NULL );
+	}
+	if( index_path != NULL )
+	{
+		memory_free(
+		 index_path );
+	}
+	return( -1 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain( int argc, wchar_t * const argv[] )
+#else
+int main( int argc, char * const argv[] )
+#endif
+{
+	libcerror_error_t *error = NULL;
+	char *program            = "evtindex";
+	system_integer_t option  = 0;
+	int result               = EXIT_SUCCESS;
+	int source_index         = 0;
+	int verbose              = 0;
+
+	libcnotify_stream_set(
+	 stderr,
+	 NULL );
+	libcnotify_verbose_set(
+	 1 );
+
+	if( libclocale_initialize(
+	     "evttools",
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize locale values.\n" );
+
+		goto on_error;
+	}
+	if( evttools_output_initialize(
+	     _IONBF,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to initialize output settings.\n" );
+
+		goto on_error;
+	}
+	evtoutput_version_fprint(
+	 stdout,
+	 program );
+
+	while( ( option = evttools_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "hvV" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM "\n",
+				 argv[ optind - 1 ] );
+
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_FAILURE );
+
+			case (system_integer_t) 'h':
+				usage_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+
+			case (system_integer_t) 'v':
+				verbose = 1;
+
+				break;
+
+			case (system_integer_t) 'V':
+				evtoutput_copyright_fprint(
+				 stdout );
+
+				return( EXIT_SUCCESS );
+		}
+	}
+	if( optind == argc )
+	{
+		fprintf(
+		 stderr,
+		 "Missing source file.\n" );
+
+		usage_fprint(
+		 stdout );
+
+		return( EXIT_FAILURE );
+	}
+	libcnotify_verbose_set(
+	 verbose );
+	libevt_notify_set_stream(
+	 stderr,
+	 NULL );
+	libevt_notify_set_verbose(
+	 verbose );
+
+	if( evttools_signal_attach(
+	     evtindex_signal_handler,
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to attach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	/* A source that cannot be indexed does not prevent the remaining sources
+	 * from being indexed
+	 */
+	for( source_index = optind;
+	     source_index < argc;
+	     source_index++ )
+	{
+		if( evtindex_abort != 0 )
+		{
+			break;
+		}
+		fprintf(
+		 stdout,
+		 "Indexing: %" PRIs_SYSTEM "\n",
+		 argv[ source_index ] );
+
+		if( evtindex_index_file(
+		     argv[ source_index ],
+		     &error ) != 1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to index: %" PRIs_SYSTEM ".\n",
+			 argv[ source_index ] );
+
+			libcnotify_print_error_backtrace(
+			 error );
+			libcerror_error_free(
+			 &error );
+
+			result = EXIT_FAILURE;
+		}
+	}
+	if( evttools_signal_detach(
+	     &error ) != 1 )
+	{
+		fprintf(
+		 stderr,
+		 "Unable to detach signal handler.\n" );
+
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	if( evtindex_abort != 0 )
+	{
+		fprintf(
+		 stdout,
+		 "Indexing aborted.\n" );
+
+		return( EXIT_FAILURE );
+	}
+	return( result );
+
+on_error:
+	if( error != NULL )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+		libcerror_error_free(
+		 &error );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -196,3 +196,184 @@ int evtinput_determine_event_log_type_from_filename(
 	return( result );
 }
 
+/* Determines the event type from a string
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int evtinput_determine_event_type(
+     const system_character_t *string,
+     uint16_t *event_type,
+     libcerror_error_t **error )
+{
+	static char *function = "evtinput_determine_event_type";
+	size_t string_length  = 0;
+	int result            = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event type.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( string_length == 5 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "error" ),
+		     5 ) == 0 )
+		{
+			*event_type = LIBEVT_EVENT_TYPE_ERROR;
+			result      = 1;
+		}
+	}
+	else if( string_length == 7 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "warning" ),
+		     7 ) == 0 )
+		{
+			*event_type = LIBEVT_EVENT_TYPE_WARNING;
+			result      = 1;
+		}
+	}
+	else if( string_length == 11 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "information" ),
+		     11 ) == 0 )
+		{
+			*event_type = LIBEVT_EVENT_TYPE_INFORMATION;
+			result      = 1;
+		}
+	}
+	else if( string_length == 13 )
+	{
+		if( system_string_compare_no_case(
+		     string,
+		     _SYSTEM_STRING( "audit_success" ),
+		     13 ) == 0 )
+		{
+			*event_type = LIBEVT_EVENT_TYPE_AUDIT_SUCCESS;
+			result      = 1;
+		}
+		else if( system_string_compare_no_case(
+		          string,
+		          _SYSTEM_STRING( "audit_failure" ),
+		          13 ) == 0 )
+		{
+			*event_type = LIBEVT_EVENT_TYPE_AUDIT_FAILURE;
+			result      = 1;
+		}
+	}
+	return( result );
+}
+
+/* Copies a decimal or hexadecimal (0x prefixed) string to a 32-bit value
+ * Returns 1 if successful, 0 if the string is not a valid value or -1 on error
+ */
+int evtinput_copy_string_to_32bit(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error )
+{
+	static char *function     = "evtinput_copy_string_to_32bit";
+	size_t string_index       = 0;
+	size_t string_length      = 0;
+	uint32_t base             = 10;
+	uint32_t safe_value_32bit = 0;
+	uint8_t digit             = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value 32-bit.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( ( string_length > 2 )
+	 && ( string[ 0 ] == (system_character_t) '0' )
+	 && ( ( string[ 1 ] == (system_character_t) 'x' )
+	  || ( string[ 1 ] == (system_character_t) 'X' ) ) )
+	{
+		base         = 16;
+		string_index = 2;
+	}
+	if( string_index >= string_length )
+	{
+		return( 0 );
+	}
+	while( string_index < string_length )
+	{
+		if( ( string[ string_index ] >= (system_character_t) '0' )
+		 && ( string[ string_index ] <= (system_character_t) '9' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) '0' );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'a' )
+		      && ( string[ string_index ] <= (system_character_t) 'f' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'a' + 10 );
+		}
+		else if( ( base == 16 )
+		      && ( string[ string_index ] >= (system_character_t) 'A' )
+		      && ( string[ string_index ] <= (system_character_t) 'F' ) )
+		{
+			digit = (uint8_t) ( string[ string_index ] - (system_character_t) 'A' + 10 );
+		}
+		else
+		{
+			return( 0 );
+		}
+		if( safe_value_32bit > ( ( UINT32_MAX - digit ) / base ) )
+		{
+			return( 0 );
+		}
+		safe_value_32bit *= base;
+		safe_value_32bit += digit;
+
+		string_index++;
+	}
+	*value_32bit = safe_value_32bit;
+
+	return( 1 );
+}
+
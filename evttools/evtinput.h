@@ -51,6 +51,16 @@ int evtinput_determine_event_log_type_from_filename(
      int *event_log_type,
      libcerror_error_t **error );
 
+int evtinput_determine_event_type(
+     const system_character_t *string,
+     uint16_t *event_type,
+     libcerror_error_t **error );
+
+int evtinput_copy_string_to_32bit(
+     const system_character_t *string,
+     uint32_t *value_32bit,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -1,5 +1,5 @@
 /*
- * The libfcache header wrapper
+ * The internal libcthreads header
  *
  * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
  *
@@ -19,32 +19,42 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
-#if !defined( _LIBEVT_LIBFCACHE_H )
-#define _LIBEVT_LIBFCACHE_H
+#if !defined( _EVTTOOLS_LIBCTHREADS_H )
+#define _EVTTOOLS_LIBCTHREADS_H
 
 #include <common.h>
 
-/* Define HAVE_LOCAL_LIBFCACHE for local use of libfcache
- */
-#if defined( HAVE_LOCAL_LIBFCACHE )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
 
-#include <libfcache_cache.h>
-#include <libfcache_date_time.h>
-#include <libfcache_definitions.h>
-#include <libfcache_types.h>
+/* Define HAVE_LOCAL_LIBCTHREADS for local use of libcthreads
+ */
+#if defined( HAVE_LOCAL_LIBCTHREADS )
+
+#include <libcthreads_condition.h>
+#include <libcthreads_definitions.h>
+#include <libcthreads_lock.h>
+#include <libcthreads_mutex.h>
+#include <libcthreads_read_write_lock.h>
+#include <libcthreads_queue.h>
+#include <libcthreads_thread.h>
+#include <libcthreads_thread_attributes.h>
+#include <libcthreads_thread_pool.h>
+#include <libcthreads_types.h>
 
 #else
 
-/* If libtool DLL support is enabled set LIBFCACHE_DLL_IMPORT
- * before including libfcache.h
+/* If libtool DLL support is enabled set LIBCTHREADS_DLL_IMPORT
+ * before including libcthreads.h
  */
 #if defined( _WIN32 ) && defined( DLL_IMPORT )
-#define LIBFCACHE_DLL_IMPORT
+#define LIBCTHREADS_DLL_IMPORT
 #endif
 
-#include <libfcache.h>
+#include <libcthreads.h>
 
-#endif /* defined( HAVE_LOCAL_LIBFCACHE ) */
+#endif /* defined( HAVE_LOCAL_LIBCTHREADS ) */
 
-#endif /* !defined( _LIBEVT_LIBFCACHE_H ) */
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#endif
 
@@ -24,13 +24,23 @@
 #include <system_string.h>
 #include <types.h>
 
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
 #include "evtinput.h"
+#include "evttools_libcdirectory.h"
 #include "evttools_libcerror.h"
 #include "evttools_libcnotify.h"
 #include "evttools_libclocale.h"
+#include "evttools_libcpath.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libevt.h"
 #include "evttools_libfdatetime.h"
+#include "evttools_system_split_string.h"
 #include "export_handle.h"
+#include "export_job.h"
+#include "follow_handle.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
@@ -38,6 +48,13 @@
 
 #define EXPORT_HANDLE_NOTIFY_STREAM		stdout
 
+enum EXPORT_HANDLE_FILTER_VALUE_TYPES
+{
+	EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_CATEGORY,
+	EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_IDENTIFIER,
+	EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_TYPE
+};
+
 const char *export_handle_get_event_log_key_name(
              int event_log_type )
 {
@@ -176,16 +193,38 @@ int export_handle_initialize(
 
 		goto on_error;
 	}
-	( *export_handle )->export_mode    = EXPORT_MODE_ITEMS;
-	( *export_handle )->event_log_type = EVTTOOLS_EVENT_LOG_TYPE_UNKNOWN;
-	( *export_handle )->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
-	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
+	if( libevt_filter_initialize(
+	     &( ( *export_handle )->filter ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize filter.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_handle )->export_mode     = EXPORT_MODE_ITEMS;
+	( *export_handle )->event_log_type  = EVTTOOLS_EVENT_LOG_TYPE_UNKNOWN;
+	( *export_handle )->ascii_codepage  = LIBEVT_CODEPAGE_WINDOWS_1252;
+	( *export_handle )->filter_end_time = 0xffffffffUL;
+	( *export_handle )->notify_stream   = EXPORT_HANDLE_NOTIFY_STREAM;
+
+	( *export_handle )->maximum_number_of_threads = 1;
 
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libevt_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
 		if( ( *export_handle )->message_handle != NULL )
 		{
 			message_handle_free(
@@ -208,7 +247,9 @@ int export_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_free";
+	int event_log_type    = 0;
 	int result            = 1;
+	int source_index      = 0;
 
 	if( export_handle == NULL )
 	{
@@ -252,6 +293,60 @@ int export_handle_free(
 
 			result = -1;
 		}
+		for( event_log_type = 0;
+		     event_log_type < EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES;
+		     event_log_type++ )
+		{
+			if( ( *export_handle )->event_log_message_handles[ event_log_type ] == NULL )
+			{
+				continue;
+			}
+			if( message_handle_close_input(
+			     ( *export_handle )->event_log_message_handles[ event_log_type ],
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close input of event log: %d message handle.",
+				 function,
+				 event_log_type );
+
+				result = -1;
+			}
+			if( message_handle_free(
+			     &( ( *export_handle )->event_log_message_handles[ event_log_type ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free event log: %d message handle.",
+				 function,
+				 event_log_type );
+
+				result = -1;
+			}
+		}
+		if( ( *export_handle )->source_filenames != NULL )
+		{
+			for( source_index = 0;
+			     source_index < ( *export_handle )->number_of_source_filenames;
+			     source_index++ )
+			{
+				memory_free(
+				 ( *export_handle )->source_filenames[ source_index ] );
+			}
+			memory_free(
+			 ( *export_handle )->source_filenames );
+		}
+		if( ( *export_handle )->message_string_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_handle )->message_string_buffer );
+		}
 		if( libevt_file_free(
 		     &( ( *export_handle )->input_file ),
 		     error ) != 1 )
@@ -265,6 +360,19 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( libevt_filter_free(
+		     &( ( *export_handle )->filter ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free filter.",
+			 function );
+
+			result = -1;
+		}
 		memory_free(
 		 *export_handle );
 
@@ -281,6 +389,8 @@ int export_handle_signal_abort(
      libcerror_error_t **error )
 {
 	static char *function = "export_handle_signal_abort";
+	int event_log_type    = 0;
+	int file_index        = 0;
 
 	if( export_handle == NULL )
 	{
@@ -308,6 +418,29 @@ int export_handle_signal_abort(
 
 		return( -1 );
 	}
+	for( event_log_type = 0;
+	     event_log_type < EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES;
+	     event_log_type++ )
+	{
+		if( export_handle->event_log_message_handles[ event_log_type ] == NULL )
+		{
+			continue;
+		}
+		if( message_handle_signal_abort(
+		     export_handle->event_log_message_handles[ event_log_type ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal event log: %d message handle to abort.",
+			 function,
+			 event_log_type );
+
+			return( -1 );
+		}
+	}
 	if( export_handle->input_file != NULL )
 	{
 		if( libevt_file_signal_abort(
@@ -324,6 +457,25 @@ int export_handle_signal_abort(
 			return( -1 );
 		}
 	}
+	for( file_index = 0;
+	     file_index < export_handle->number_of_merge_input_files;
+	     file_index++ )
+	{
+		if( libevt_file_signal_abort(
+		     export_handle->merge_input_files[ file_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to signal merge input file: %d to abort.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
 	return( 1 );
 }
 
@@ -751,15 +903,15 @@ int export_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the input
- * Returns 1 if successful or -1 on error
+/* Sets the message catalog filename
+ * Returns 1 if successful or -1 error
  */
-int export_handle_open_input(
+int export_handle_set_message_catalog_filename(
      export_handle_t *export_handle,
      const system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_open_input";
+	static char *function = "export_handle_set_message_catalog_filename";
 
 	if( export_handle == NULL )
 	{
@@ -772,83 +924,43 @@ int export_handle_open_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid export handle input is already open.",
-		 function );
-
-		return( -1 );
-	}
-	if( message_handle_open_input(
+	if( message_handle_set_message_catalog_filename(
 	     export_handle->message_handle,
-	     export_handle_get_event_log_key_name(
-	      export_handle->event_log_type ),
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input of message handle.",
-		 function );
-
-		return( -1 );
-	}
-	if( libevt_file_set_ascii_codepage(
-	     export_handle->input_file,
-	     export_handle->ascii_codepage,
+	     filename,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set ASCII codepage in input file.",
-		 function );
-
-		return( -1 );
-	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	if( libevt_file_open_wide(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVT_OPEN_READ,
-	     error ) != 1 )
-#else
-	if( libevt_file_open(
-	     export_handle->input_file,
-	     filename,
-	     LIBEVT_OPEN_READ,
-	     error ) != 1 )
-#endif
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open input file.",
+		 "%s: unable to set message catalog filename in message handle.",
 		 function );
 
 		return( -1 );
 	}
-	export_handle->input_is_open = 1;
-
 	return( 1 );
 }
 
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
+/* Sets comma separated values of the record filter
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
-int export_handle_close_input(
+int export_handle_set_filter_values(
      export_handle_t *export_handle,
+     const system_character_t *string,
+     int filter_value_type,
      libcerror_error_t **error )
 {
-	static char *function = "export_handle_close_input";
-	int result            = 0;
+	system_character_t *string_segment  = NULL;
+	system_split_string_t *split_string = NULL;
+	static char *function               = "export_handle_set_filter_values";
+	size_t string_length                = 0;
+	size_t string_segment_size          = 0;
+	uint32_t value_32bit                = 0;
+	uint16_t event_type                 = 0;
+	uint16_t event_types                = 0;
+	int number_of_segments              = 0;
+	int result                          = 1;
+	int segment_index                   = 0;
 
 	if( export_handle == NULL )
 	{
@@ -861,318 +973,299 @@ int export_handle_close_input(
 
 		return( -1 );
 	}
-	if( export_handle->input_is_open != 0 )
+	if( string == NULL )
 	{
-		if( message_handle_close_input(
-		     export_handle->message_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input of message handle.",
-			 function );
-
-			result = -1;
-		}
-		if( libevt_file_close(
-		     export_handle->input_file,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close input file.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
 
-			result = -1;
-		}
-		export_handle->input_is_open = 0;
+		return( -1 );
 	}
-	return( result );
-}
-
-/* Prints a POSIX value
- * Returns 1 if successful or -1 on error
- */
-int export_handle_posix_time_value_fprint(
-     export_handle_t *export_handle,
-     const char *value_name,
-     uint32_t value_32bit,
-     libcerror_error_t **error )
-{
-	system_character_t date_time_string[ 32 ];
-
-	libfdatetime_posix_time_t *posix_time = NULL;
-	static char *function                 = "export_handle_posix_time_fprint";
-	int result                            = 0;
+	string_length = system_string_length(
+	                 string );
 
-	if( export_handle == NULL )
+	if( system_string_split(
+	     string,
+	     string_length + 1,
+	     (system_character_t) ',',
+	     &split_string,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to split string.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( value_32bit == 0 )
+	if( system_split_string_get_number_of_segments(
+	     split_string,
+	     &number_of_segments,
+	     error ) != 1 )
 	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: Not set (0)\n",
-		 value_name );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of string segments.",
+		 function );
+
+		goto on_error;
 	}
-	else
+	for( segment_index = 0;
+	     segment_index < number_of_segments;
+	     segment_index++ )
 	{
-		if( libfdatetime_posix_time_initialize(
-		     &posix_time,
+		if( system_split_string_get_segment_by_index(
+		     split_string,
+		     segment_index,
+		     &string_segment,
+		     &string_segment_size,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create POSIX time.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string segment: %d.",
+			 function,
+			 segment_index );
 
 			goto on_error;
 		}
-		if( libfdatetime_posix_time_copy_from_32bit(
-		     posix_time,
-		     value_32bit,
-		     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
-		     error ) != 1 )
+		if( string_segment == NULL )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy POSIX time from 32-bit.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing string segment: %d.",
+			 function,
+			 segment_index );
 
 			goto on_error;
 		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libfdatetime_posix_time_copy_to_utf16_string(
-			  posix_time,
-			  (uint16_t *) date_time_string,
-			  32,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
-			  error );
-#else
-		result = libfdatetime_posix_time_copy_to_utf8_string(
-			  posix_time,
-			  (uint8_t *) date_time_string,
-			  32,
-			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
-			  error );
-#endif
-		if( result != 1 )
+		if( filter_value_type == EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_TYPE )
+		{
+			result = evtinput_determine_event_type(
+			          string_segment,
+			          &event_type,
+			          error );
+		}
+		else
+		{
+			result = evtinput_copy_string_to_32bit(
+			          string_segment,
+			          &value_32bit,
+			          error );
+		}
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to copy POSIX time to string.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine value of string segment: %d.",
+			 function,
+			 segment_index );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "%s: %" PRIs_SYSTEM " UTC\n",
-		 value_name,
-		 date_time_string );
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( filter_value_type == EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_CATEGORY )
+		{
+			if( value_32bit > (uint32_t) UINT16_MAX )
+			{
+				result = 0;
 
-		if( libfdatetime_posix_time_free(
-		     &posix_time,
+				break;
+			}
+			if( libevt_filter_append_event_category(
+			     export_handle->filter,
+			     (uint16_t) value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append event category to filter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( filter_value_type == EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_IDENTIFIER )
+		{
+			if( libevt_filter_append_event_identifier(
+			     export_handle->filter,
+			     value_32bit,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append event identifier to filter.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			event_types |= event_type;
+		}
+	}
+	if( ( result == 1 )
+	 && ( filter_value_type == EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_TYPE ) )
+	{
+		if( libevt_filter_set_event_types(
+		     export_handle->filter,
+		     event_types,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free POSIX time.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set event types in filter.",
 			 function );
 
 			goto on_error;
 		}
 	}
-	return( 1 );
+	if( system_split_string_free(
+	     &split_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free split string.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
 
 on_error:
-	if( posix_time != NULL )
+	if( split_string != NULL )
 	{
-		libfdatetime_posix_time_free(
-		 &posix_time,
+		system_split_string_free(
+		 &split_string,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Exports the record event category
- * Returns 1 if successful or -1 on error
+/* Sets the event identifiers of the record filter from a comma separated string
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
  */
-int export_handle_export_record_event_category(
+int export_handle_set_event_identifiers(
      export_handle_t *export_handle,
-     libevt_record_t *record,
-     const system_character_t *event_source,
-     size_t event_source_length,
-     log_handle_t *log_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	system_character_t *message_filename = NULL;
-	message_string_t *message_string     = NULL;
-	static char *function                = "export_handle_export_record_event_category";
-	size_t message_filename_size         = 0;
-	size_t message_string_index          = 0;
-	uint16_t event_category              = 0;
-	int result                           = 0;
+	static char *function = "export_handle_set_event_identifiers";
+	int result            = 0;
 
-	if( export_handle == NULL )
+	result = export_handle_set_filter_values(
+	          export_handle,
+	          string,
+	          EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_IDENTIFIER,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event identifiers.",
 		 function );
-
-		return( -1 );
 	}
-	if( libevt_record_get_event_category(
-	     record,
-	     &event_category,
-	     error ) != 1 )
+	return( result );
+}
+
+/* Sets the event categories of the record filter from a comma separated string
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_event_categories(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_event_categories";
+	int result            = 0;
+
+	result = export_handle_set_filter_values(
+	          export_handle,
+	          string,
+	          EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_CATEGORY,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event category.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event categories.",
 		 function );
-
-		goto on_error;
 	}
-	if( event_source != NULL )
-	{
-		result = message_handle_get_value_by_event_source(
-		          export_handle->message_handle,
-		          event_source,
-		          event_source_length,
-		          _SYSTEM_STRING( "CategoryMessageFile" ),
-		          19,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve category message filename.",
-			 function );
-
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Category message filename\t: %" PRIs_SYSTEM "\n",
-			 message_filename );
-
-			result = message_handle_get_message_string(
-				  export_handle->message_handle,
-				  message_filename,
-				  message_filename_size - 1,
-				  (uint32_t) event_category,
-				  &message_string,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-				 function,
-				 (uint32_t) event_category,
-				 message_filename );
+	return( result );
+}
 
-				goto on_error;
-			}
-			memory_free(
-			 message_filename );
+/* Sets the event types of the record filter from a comma separated string
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_event_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_event_types";
+	int result            = 0;
 
-			message_filename = NULL;
-		}
-	}
-	if( message_string != NULL )
-	{
-		for( message_string_index = 0;
-		     message_string_index < message_string->string_size;
-		     message_string_index++ )
-		{
-			if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '\n' )
-			 || ( ( message_string->string )[ message_string_index ] == (system_character_t) '\r' ) )
-			{
-				( message_string->string )[ message_string_index ] = 0;
-			}
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event category\t\t\t: %" PRIs_SYSTEM " (%" PRIu16 ")\n",
-		 message_string->string,
-		 event_category );
-	}
-	else
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "Event category\t\t\t: %" PRIu16 "\n",
-		 event_category );
-	}
-	return( 1 );
+	result = export_handle_set_filter_values(
+	          export_handle,
+	          string,
+	          EXPORT_HANDLE_FILTER_VALUE_TYPE_EVENT_TYPE,
+	          error );
 
-on_error:
-	if( message_filename != NULL )
+	if( result == -1 )
 	{
-		memory_free(
-		 message_filename );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set event types.",
+		 function );
 	}
-	return( -1 );
+	return( result );
 }
 
-/* Exports the record event message
+/* Sets the source name of the record filter
  * Returns 1 if successful or -1 on error
  */
-int export_handle_export_record_event_message(
+int export_handle_set_source_name(
      export_handle_t *export_handle,
-     libevt_record_t *record,
-     const system_character_t *event_source,
-     size_t event_source_length,
-     uint32_t event_identifier,
-     log_handle_t *log_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-	system_character_t *message_filename = NULL;
-	message_string_t *message_string     = NULL;
-	system_character_t *value_string     = NULL;
-	static char *function                = "export_handle_export_record_event_message";
-	size_t message_filename_size         = 0;
-	size_t value_string_size             = 0;
-	int number_of_strings                = 0;
-	int result                           = 0;
-	int value_string_index               = 0;
+	static char *function = "export_handle_set_source_name";
+	size_t string_length  = 0;
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1185,226 +1278,59 @@ int export_handle_export_record_event_message(
 
 		return( -1 );
 	}
-	if( event_source != NULL )
+	if( string == NULL )
 	{
-		result = message_handle_get_value_by_event_source(
-		          export_handle->message_handle,
-		          event_source,
-		          event_source_length,
-		          _SYSTEM_STRING( "EventMessageFile" ),
-		          16,
-		          &message_filename,
-		          &message_filename_size,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message filename.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 "Message filename\t\t: %" PRIs_SYSTEM "\n",
-			 message_filename );
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
 
-			result = message_handle_get_message_string(
-				  export_handle->message_handle,
-				  message_filename,
-				  message_filename_size - 1,
-				  event_identifier,
-				  &message_string,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
-				 function,
-				 event_identifier,
-				 message_filename );
-
-				goto on_error;
-			}
-			memory_free(
-			 message_filename );
-
-			message_filename = NULL;
-		}
-	}
-	if( libevt_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_filter_set_utf16_source_name(
+	          export_handle->filter,
+	          (uint16_t *) string,
+	          string_length,
+	          error );
+#else
+	result = libevt_filter_set_utf8_source_name(
+	          export_handle->filter,
+	          (uint8_t *) string,
+	          string_length,
+	          error );
+#endif
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source name in filter.",
 		 function );
 
-		goto on_error;
-	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Number of strings\t\t: %d\n",
-	 number_of_strings );
-
-	for( value_string_index = 0;
-	     value_string_index < number_of_strings;
-	     value_string_index++ )
-	{
-		fprintf(
-		 export_handle->notify_stream,
-		 "String: %d\t\t\t: ",
-		 value_string_index + 1 );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevt_record_get_utf16_string_size(
-			  record,
-			  value_string_index,
-			  &value_string_size,
-			  error );
-#else
-		result = libevt_record_get_utf8_string_size(
-			  record,
-			  value_string_index,
-			  &value_string_size,
-			  error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve string: %d size.",
-			 function,
-			 value_string_index );
-
-			goto on_error;
-		}
-		if( value_string_size > 0 )
-		{
-			value_string = system_string_allocate(
-					value_string_size );
-
-			if( value_string == NULL )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_MEMORY,
-				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-				 "%s: unable to create value string.",
-				 function );
-
-				goto on_error;
-			}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-			result = libevt_record_get_utf16_string(
-				  record,
-				  value_string_index,
-				  (uint16_t *) value_string,
-				  value_string_size,
-				  error );
-#else
-			result = libevt_record_get_utf8_string(
-				  record,
-				  value_string_index,
-				  (uint8_t *) value_string,
-				  value_string_size,
-				  error );
-#endif
-			if( result != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve string: %d.",
-				 function,
-				 value_string_index );
-
-				goto on_error;
-			}
-			fprintf(
-			 export_handle->notify_stream,
-			 "%" PRIs_SYSTEM "",
-			 value_string );
-
-			memory_free(
-			 value_string );
-
-			value_string = NULL;
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "\n" );
-	}
-	if( message_string != NULL )
-	{
-		if( message_string_fprint(
-		     message_string,
-		     record,
-		     export_handle->notify_stream,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print message string.",
-			 function );
-
-			goto on_error;
-		}
+		return( -1 );
 	}
 	return( 1 );
-
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( message_filename != NULL )
-	{
-		memory_free(
-		 message_filename );
-	}
-	return( -1 );
 }
 
-/* Exports the record
- * Returns 1 if successful or -1 on error
+/* Sets the start of the written time range of the record filter
+ * The time is a POSIX timestamp, in number of seconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
  */
-int export_handle_export_record(
+int export_handle_set_start_time(
      export_handle_t *export_handle,
-     libevt_record_t *record,
-     log_handle_t *log_handle,
+     const system_character_t *string,
      libcerror_error_t **error )
 {
-
-	system_character_t *source_name       = NULL;
-	system_character_t *value_string      = NULL;
-	static char *function                 = "export_handle_export_record";
-	size_t source_name_size               = 0;
-	size_t value_string_size              = 0;
-	uint32_t event_identifier             = 0;
-	uint32_t value_32bit                  = 0;
-	uint16_t event_type                   = 0;
-	int result                            = 0;
+	static char *function = "export_handle_set_start_time";
+	uint32_t start_time   = 0;
+	int result            = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1417,301 +1343,513 @@ int export_handle_export_record(
 
 		return( -1 );
 	}
-	if( libevt_record_get_identifier(
-	     record,
-	     &value_32bit,
-	     error ) != 1 )
+	result = evtinput_copy_string_to_32bit(
+	          string,
+	          &start_time,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve identifier.",
+		 "%s: unable to determine start time.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event number\t\t\t: %" PRIu32 "\n",
-	 value_32bit );
-
-	if( libevt_record_get_creation_time(
-	     record,
-	     &value_32bit,
+	else if( ( result == 0 )
+	      || ( start_time > export_handle->filter_end_time ) )
+	{
+		return( 0 );
+	}
+	if( libevt_filter_set_time_range(
+	     export_handle->filter,
+	     start_time,
+	     export_handle->filter_end_time,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve creation time.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time range in filter.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( export_handle_posix_time_value_fprint(
-	     export_handle,
-	     "Creation time\t\t\t",
-	     value_32bit,
-	     error ) != 1 )
+	export_handle->filter_start_time = start_time;
+
+	return( 1 );
+}
+
+/* Sets the end of the written time range of the record filter
+ * The time is a POSIX timestamp, in number of seconds since January 1, 1970 00:00:00 UTC
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_end_time(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_end_time";
+	uint32_t end_time     = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print POSIX time value.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libevt_record_get_written_time(
-	     record,
-	     &value_32bit,
-	     error ) != 1 )
+	result = evtinput_copy_string_to_32bit(
+	          string,
+	          &end_time,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve written time.",
+		 "%s: unable to determine end time.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( export_handle_posix_time_value_fprint(
-	     export_handle,
-	     "Written time\t\t\t",
-	     value_32bit,
+	else if( ( result == 0 )
+	      || ( end_time < export_handle->filter_start_time ) )
+	{
+		return( 0 );
+	}
+	if( libevt_filter_set_time_range(
+	     export_handle->filter,
+	     export_handle->filter_start_time,
+	     end_time,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-		 "%s: unable to print POSIX time value.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set time range in filter.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libevt_record_get_event_type(
-	     record,
-	     &event_type,
-	     error ) != 1 )
+	export_handle->filter_end_time = end_time;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of threads used to export the source files
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_maximum_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function              = "export_handle_set_maximum_number_of_threads";
+	uint32_t maximum_number_of_threads = 0;
+	int result                         = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event type\t\t\t: %s (%" PRIu16 ")\n",
-	 export_handle_get_event_type(
-	  event_type ),
-	 event_type );
-
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevt_record_get_utf16_user_security_identifier_size(
-	          record,
-	          &value_string_size,
-	          error );
-#else
-	result = libevt_record_get_utf8_user_security_identifier_size(
-	          record,
-	          &value_string_size,
+	result = evtinput_copy_string_to_32bit(
+	          string,
+	          &maximum_number_of_threads,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve user security identifier size.",
+		 "%s: unable to determine maximum number of threads.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result != 0 )
-	 && ( value_string_size > 0 ) )
+	else if( ( result == 0 )
+	      || ( maximum_number_of_threads == 0 )
+	      || ( maximum_number_of_threads > 64 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		return( 0 );
+	}
+	export_handle->maximum_number_of_threads = (int) maximum_number_of_threads;
 
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
+	return( 1 );
+}
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevt_record_get_utf16_user_security_identifier(
-		          record,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libevt_record_get_utf8_user_security_identifier(
-		          record,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve user security identifier.",
-			 function );
+/* Sets the maximum number of resource files in the resource file cache
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_resource_file_cache_number_of_files(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function            = "export_handle_set_resource_file_cache_number_of_files";
+	uint32_t maximum_number_of_files = 0;
+	int result                       = 0;
 
-			goto on_error;
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "User security identifier\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		memory_free(
-		 value_string );
+		return( -1 );
+	}
+	if( export_handle->message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing message handle.",
+		 function );
 
-		value_string = NULL;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevt_record_get_utf16_computer_name_size(
-	          record,
-	          &value_string_size,
-	          error );
-#else
-	result = libevt_record_get_utf8_computer_name_size(
-	          record,
-	          &value_string_size,
+	result = evtinput_copy_string_to_32bit(
+	          string,
+	          &maximum_number_of_files,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve computer name size.",
+		 "%s: unable to determine maximum number of resource files.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result != 0 )
-	 && ( value_string_size > 0 ) )
+	else if( ( result == 0 )
+	      || ( maximum_number_of_files == 0 )
+	      || ( maximum_number_of_files > 65536 ) )
 	{
-		value_string = system_string_allocate(
-		                value_string_size );
+		return( 0 );
+	}
+	if( message_handle_set_resource_file_cache_maximum_values(
+	     export_handle->message_handle,
+	     (int) maximum_number_of_files,
+	     export_handle->message_handle->resource_file_cache->maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache maximum values in message handle.",
+		 function );
 
-		if( value_string == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create value string.",
-			 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevt_record_get_utf16_computer_name(
-		          record,
-		          (uint16_t *) value_string,
-		          value_string_size,
-		          error );
-#else
-		result = libevt_record_get_utf8_computer_name(
-		          record,
-		          (uint8_t *) value_string,
-		          value_string_size,
-		          error );
-#endif
-		if( result != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve computer name.",
-			 function );
+/* Sets the maximum size, in MiB, of the resource sections of the resource files in the resource file cache
+ * A maximum size of 0 represents no maximum
+ * Returns 1 if successful, 0 if unsupported value or -1 on error
+ */
+int export_handle_set_resource_file_cache_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_resource_file_cache_size";
+	uint32_t maximum_size = 0;
+	int result            = 0;
 
-			goto on_error;
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
-		 value_string );
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
 
-		memory_free(
-		 value_string );
+		return( -1 );
+	}
+	if( export_handle->message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing message handle.",
+		 function );
 
-		value_string = NULL;
+		return( -1 );
 	}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-	result = libevt_record_get_utf16_source_name_size(
-	          record,
-	          &source_name_size,
-	          error );
-#else
-	result = libevt_record_get_utf8_source_name_size(
-	          record,
-	          &source_name_size,
+	result = evtinput_copy_string_to_32bit(
+	          string,
+	          &maximum_size,
 	          error );
-#endif
+
 	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve source name size.",
+		 "%s: unable to determine maximum size.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( result != 0 )
-	 && ( source_name_size > 0 ) )
+	else if( ( result == 0 )
+	      || ( maximum_size > 1048576 ) )
 	{
-		source_name = system_string_allocate(
-		               source_name_size );
+		return( 0 );
+	}
+	if( message_handle_set_resource_file_cache_maximum_values(
+	     export_handle->message_handle,
+	     export_handle->message_handle->resource_file_cache->maximum_number_of_entries,
+	     (size64_t) maximum_size * 1024 * 1024,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache maximum values in message handle.",
+		 function );
 
-		if( source_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create event source.",
-			 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			goto on_error;
-		}
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-		result = libevt_record_get_utf16_source_name(
-		          record,
-		          (uint16_t *) source_name,
-		          source_name_size,
-		          error );
+/* Compares two source filenames
+ * Returns a negative value if the first filename sorts before the second, 0 if equal or a positive value otherwise
+ */
+int export_handle_compare_source_filenames(
+     const void *first_source_filename,
+     const void *second_source_filename )
+{
+	const system_character_t *first_filename  = NULL;
+	const system_character_t *second_filename = NULL;
+	size_t first_filename_length              = 0;
+	size_t second_filename_length             = 0;
+
+	first_filename  = *( (const system_character_t **) first_source_filename );
+	second_filename = *( (const system_character_t **) second_source_filename );
+
+	first_filename_length = system_string_length(
+	                         first_filename );
+
+	second_filename_length = system_string_length(
+	                          second_filename );
+
+	if( first_filename_length > second_filename_length )
+	{
+		first_filename_length = second_filename_length;
+	}
+	/* Including the end-of-string character of the shortest filename
+	 */
+	return( system_string_compare(
+	         first_filename,
+	         second_filename,
+	         first_filename_length + 1 ) );
+}
+
+/* Appends a source
+ * If the source is a directory the files in the directory with the .evt extension are appended
+ * in order of their name, otherwise the source is appended as a filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_source(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error )
+{
+	libcdirectory_directory_t *directory             = NULL;
+	libcdirectory_directory_entry_t *directory_entry = NULL;
+	system_character_t *directory_entry_name         = NULL;
+	system_character_t *source_filename              = NULL;
+	static char *function                            = "export_handle_append_source";
+	size_t directory_entry_name_length               = 0;
+	size_t path_length                               = 0;
+	size_t source_filename_size                      = 0;
+	uint8_t directory_entry_type                     = 0;
+	int first_source_index                           = 0;
+	int result                                       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	path_length = system_string_length(
+	               path );
+
+	if( libcdirectory_directory_initialize(
+	     &directory,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libcdirectory_directory_open_wide(
+		  directory,
+		  path,
+		  NULL );
 #else
-		result = libevt_record_get_utf8_source_name(
-		          record,
-		          (uint8_t *) source_name,
-		          source_name_size,
+	result = libcdirectory_directory_open(
+		  directory,
+		  path,
+		  NULL );
+#endif
+	/* If the path cannot be opened as a directory it is considered a filename
+	 */
+	if( result != 1 )
+	{
+		if( libcdirectory_directory_free(
+		     &directory,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free directory.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_append_source_filename(
+		     export_handle,
+		     path,
+		     path_length,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source filename.",
+			 function );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
+	if( libcdirectory_directory_entry_initialize(
+	     &directory_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create directory entry.",
+		 function );
+
+		goto on_error;
+	}
+	first_source_index = export_handle->number_of_source_filenames;
+
+	do
+	{
+		result = libcdirectory_directory_read_entry(
+		          directory,
+		          directory_entry,
 		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read directory entry.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libcdirectory_directory_entry_get_type(
+		     directory_entry,
+		     &directory_entry_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve directory entry type.",
+			 function );
+
+			goto on_error;
+		}
+		if( directory_entry_type != LIBCDIRECTORY_ENTRY_TYPE_FILE )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcdirectory_directory_entry_get_name_wide(
+			  directory_entry,
+			  (wchar_t **) &directory_entry_name,
+			  error );
+#else
+		result = libcdirectory_directory_entry_get_name(
+			  directory_entry,
+			  (char **) &directory_entry_name,
+			  error );
 #endif
 		if( result != 1 )
 		{
@@ -1719,111 +1857,3050 @@ int export_handle_export_record(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve source name.",
+			 "%s: unable to retrieve directory entry name.",
 			 function );
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
-		 source_name );
+		directory_entry_name_length = system_string_length(
+		                               directory_entry_name );
+
+		if( ( directory_entry_name_length <= 4 )
+		 || ( system_string_compare_no_case(
+		       &( directory_entry_name[ directory_entry_name_length - 4 ] ),
+		       _SYSTEM_STRING( ".evt" ),
+		       4 ) != 0 ) )
+		{
+			continue;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libcpath_path_join_wide(
+			  &source_filename,
+			  &source_filename_size,
+			  path,
+			  path_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#else
+		result = libcpath_path_join(
+			  &source_filename,
+			  &source_filename_size,
+			  path,
+			  path_length,
+			  directory_entry_name,
+			  directory_entry_name_length,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create source filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_append_source_filename(
+		     export_handle,
+		     source_filename,
+		     source_filename_size - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append source filename.",
+			 function );
+
+			goto on_error;
+		}
+		memory_free(
+		 source_filename );
+
+		source_filename = NULL;
 	}
-	if( export_handle_export_record_event_category(
-	     export_handle,
-	     record,
-	     source_name,
-	     source_name_size - 1,
-	     log_handle,
+	while( result != 0 );
+
+	/* The order of the directory entries depends on the file system
+	 * hence the source filenames are sorted to make the output reproducible
+	 */
+	if( ( export_handle->number_of_source_filenames - first_source_index ) > 1 )
+	{
+		qsort(
+		 &( export_handle->source_filenames[ first_source_index ] ),
+		 (size_t) ( export_handle->number_of_source_filenames - first_source_index ),
+		 sizeof( system_character_t * ),
+		 &export_handle_compare_source_filenames );
+	}
+	if( libcdirectory_directory_entry_free(
+	     &directory_entry,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to export event category.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory entry.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevt_record_get_event_identifier(
-	     record,
-	     &event_identifier,
+	if( libcdirectory_directory_close(
+	     directory,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close directory.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdirectory_directory_free(
+	     &directory,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve event identifier.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free directory.",
 		 function );
 
 		goto on_error;
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
-	 event_identifier,
-	 event_identifier );
+	return( 1 );
 
-	if( export_handle_export_record_event_message(
-	     export_handle,
-	     record,
-	     source_name,
-	     source_name_size - 1,
-	     event_identifier,
-	     log_handle,
-	     error ) != 1 )
+on_error:
+	if( source_filename != NULL )
+	{
+		memory_free(
+		 source_filename );
+	}
+	if( directory_entry != NULL )
+	{
+		libcdirectory_directory_entry_free(
+		 &directory_entry,
+		 NULL );
+	}
+	if( directory != NULL )
+	{
+		libcdirectory_directory_free(
+		 &directory,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Appends a source filename
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_source_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error )
+{
+	system_character_t **source_filenames = NULL;
+	system_character_t *source_filename   = NULL;
+	static char *function                 = "export_handle_append_source_filename";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( filename_length == 0 )
+	 || ( filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->number_of_source_filenames >= ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of source filenames value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	source_filename = system_string_allocate(
+	                   filename_length + 1 );
+
+	if( source_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     source_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy source filename.",
+		 function );
+
+		goto on_error;
+	}
+	source_filename[ filename_length ] = 0;
+
+	source_filenames = (system_character_t **) memory_reallocate(
+	                                            export_handle->source_filenames,
+	                                            sizeof( system_character_t * ) * ( export_handle->number_of_source_filenames + 1 ) );
+
+	if( source_filenames == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize source filenames.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->source_filenames = source_filenames;
+
+	export_handle->source_filenames[ export_handle->number_of_source_filenames ] = source_filename;
+
+	export_handle->number_of_source_filenames += 1;
+
+	return( 1 );
+
+on_error:
+	if( source_filename != NULL )
+	{
+		memory_free(
+		 source_filename );
+	}
+	return( -1 );
+}
+
+/* Opens the input
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_open_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_open_input(
+	     export_handle->message_handle,
+	     export_handle_get_event_log_key_name(
+	      export_handle->event_log_type ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input of message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_set_ascii_codepage(
+	     export_handle->input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevt_file_open_wide(
+	     export_handle->input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevt_file_open(
+	     export_handle->input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		return( -1 );
+	}
+	export_handle->input_is_open = 1;
+
+	return( 1 );
+}
+
+/* Opens an input of which the records are merged with those of the input
+ * The input must be opened first
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_open_merge_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libevt_file_t **merge_input_files = NULL;
+	libevt_file_t *input_file         = NULL;
+	static char *function             = "export_handle_open_merge_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle input is not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->number_of_merge_input_files < 0 )
+	 || ( (size_t) export_handle->number_of_merge_input_files >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_file_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid export handle - number of merge input files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_initialize(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_set_ascii_codepage(
+	     input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevt_file_open_wide(
+	     input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevt_file_open(
+	     input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	merge_input_files = (libevt_file_t **) memory_reallocate(
+	                                        export_handle->merge_input_files,
+	                                        sizeof( libevt_file_t * ) * ( export_handle->number_of_merge_input_files + 1 ) );
+
+	if( merge_input_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize merge input files.",
+		 function );
+
+		goto on_error;
+	}
+	export_handle->merge_input_files = merge_input_files;
+
+	export_handle->merge_input_files[ export_handle->number_of_merge_input_files ] = input_file;
+
+	export_handle->number_of_merge_input_files += 1;
+
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		libevt_file_free(
+		 &input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reopens the input, for example after the file was replaced by log rotation
+ * The previous input file is only closed once the file was opened successfully,
+ * otherwise the previous input file remains available
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_reopen_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	libevt_file_t *input_file = NULL;
+	static char *function     = "export_handle_reopen_input";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle input is not open.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_initialize(
+	     &input_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_set_ascii_codepage(
+	     input_file,
+	     export_handle->ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set ASCII codepage in input file.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libevt_file_open_wide(
+	     input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#else
+	if( libevt_file_open(
+	     input_file,
+	     filename,
+	     LIBEVT_OPEN_READ,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_close(
+	     export_handle->input_file,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close previous input file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_free(
+	     &( export_handle->input_file ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous input file.",
+		 function );
+
+		export_handle->input_file = input_file;
+
+		return( -1 );
+	}
+	export_handle->input_file = input_file;
+
+	return( 1 );
+
+on_error:
+	if( input_file != NULL )
+	{
+		libevt_file_free(
+		 &input_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int export_handle_close_input(
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_close_input";
+	int file_index        = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->input_is_open != 0 )
+	{
+		if( message_handle_close_input(
+		     export_handle->message_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input of message handle.",
+			 function );
+
+			result = -1;
+		}
+		if( libevt_file_close(
+		     export_handle->input_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			result = -1;
+		}
+		export_handle->input_is_open = 0;
+	}
+	for( file_index = 0;
+	     file_index < export_handle->number_of_merge_input_files;
+	     file_index++ )
+	{
+		if( libevt_file_close(
+		     export_handle->merge_input_files[ file_index ],
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close merge input file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+		if( libevt_file_free(
+		     &( export_handle->merge_input_files[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free merge input file: %d.",
+			 function,
+			 file_index );
+
+			result = -1;
+		}
+	}
+	if( export_handle->merge_input_files != NULL )
+	{
+		memory_free(
+		 export_handle->merge_input_files );
+
+		export_handle->merge_input_files = NULL;
+	}
+	export_handle->number_of_merge_input_files = 0;
+
+	return( result );
+}
+
+/* Prints a POSIX value
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_posix_time_value_fprint(
+     export_handle_t *export_handle,
+     const char *value_name,
+     uint32_t value_32bit,
+     libcerror_error_t **error )
+{
+	system_character_t date_time_string[ 32 ];
+
+	libfdatetime_posix_time_t *posix_time = NULL;
+	static char *function                 = "export_handle_posix_time_fprint";
+	int result                            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_32bit == 0 )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "%s: Not set (0)\n",
+		 value_name );
+	}
+	else
+	{
+		if( libfdatetime_posix_time_initialize(
+		     &posix_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create POSIX time.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfdatetime_posix_time_copy_from_32bit(
+		     posix_time,
+		     value_32bit,
+		     LIBFDATETIME_POSIX_TIME_VALUE_TYPE_SECONDS_32BIT_SIGNED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy POSIX time from 32-bit.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libfdatetime_posix_time_copy_to_utf16_string(
+			  posix_time,
+			  (uint16_t *) date_time_string,
+			  32,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+			  error );
+#else
+		result = libfdatetime_posix_time_copy_to_utf8_string(
+			  posix_time,
+			  (uint8_t *) date_time_string,
+			  32,
+			  LIBFDATETIME_STRING_FORMAT_TYPE_CTIME | LIBFDATETIME_STRING_FORMAT_FLAG_DATE_TIME,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to copy POSIX time to string.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "%s: %" PRIs_SYSTEM " UTC\n",
+		 value_name,
+		 date_time_string );
+
+		if( libfdatetime_posix_time_free(
+		     &posix_time,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free POSIX time.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( posix_time != NULL )
+	{
+		libfdatetime_posix_time_free(
+		 &posix_time,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the record event category
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_event_category(
+     export_handle_t *export_handle,
+     libevt_record_t *record,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	const system_character_t *message_filename = NULL;
+	message_string_t *message_string           = NULL;
+	static char *function                      = "export_handle_export_record_event_category";
+	size_t message_filename_size               = 0;
+	size_t message_string_length               = 0;
+	uint16_t event_category                    = 0;
+	int message_handle_is_locked               = 0;
+	int message_string_is_pinned               = 0;
+	int result                                 = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_get_event_category(
+	     record,
+	     &event_category,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event category.",
+		 function );
+
+		goto on_error;
+	}
+	/* The message strings are cached by the message handle, which can be shared
+	 * with other threads, hence the message handle is locked while the message
+	 * string is retrieved
+	 */
+	if( message_handle_grab(
+	     export_handle->message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab message handle.",
+		 function );
+
+		goto on_error;
+	}
+	message_handle_is_locked = 1;
+
+	if( event_source != NULL )
+	{
+		result = message_handle_get_value_by_event_source(
+		          export_handle->message_handle,
+		          event_source,
+		          event_source_length,
+		          _SYSTEM_STRING( "CategoryMessageFile" ),
+		          19,
+		          &message_filename,
+		          &message_filename_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve category message filename.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Category message filename\t: %" PRIs_SYSTEM "\n",
+			 message_filename );
+
+			result = message_handle_get_message_string(
+				  export_handle->message_handle,
+				  message_filename,
+				  message_filename_size - 1,
+				  (uint32_t) event_category,
+				  &message_string,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
+				 function,
+				 (uint32_t) event_category,
+				 message_filename );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The message string is pinned so that it can be printed without
+	 * locking the message handle
+	 */
+	if( message_string != NULL )
+	{
+		if( message_string_pin(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pin message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_string_is_pinned = 1;
+	}
+	message_handle_is_locked = 0;
+
+	if( message_handle_release(
+	     export_handle->message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_string != NULL )
+	{
+		/* The pinned message string is shared with other threads, hence
+		 * only the part before the first end-of-line is printed
+		 */
+		for( message_string_length = 0;
+		     message_string_length < message_string->string_size;
+		     message_string_length++ )
+		{
+			if( ( ( message_string->string )[ message_string_length ] == 0 )
+			 || ( ( message_string->string )[ message_string_length ] == (system_character_t) '\n' )
+			 || ( ( message_string->string )[ message_string_length ] == (system_character_t) '\r' ) )
+			{
+				break;
+			}
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Event category\t\t\t: %.*" PRIs_SYSTEM " (%" PRIu16 ")\n",
+		 (int) message_string_length,
+		 message_string->string,
+		 event_category );
+	}
+	else
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "Event category\t\t\t: %" PRIu16 "\n",
+		 event_category );
+	}
+	if( message_string_is_pinned != 0 )
+	{
+		if( message_handle_grab(
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab message handle.",
+			 function );
+
+			goto on_error;
+		}
+		message_handle_is_locked = 1;
+		message_string_is_pinned = 0;
+
+		if( message_string_unpin(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unpin message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_handle_is_locked = 0;
+
+		if( message_handle_release(
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release message handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( message_string_is_pinned != 0 )
+	{
+		if( message_handle_is_locked == 0 )
+		{
+			message_handle_is_locked = message_handle_grab(
+			                            export_handle->message_handle,
+			                            NULL );
+		}
+		if( message_handle_is_locked == 1 )
+		{
+			message_string_unpin(
+			 message_string,
+			 NULL );
+		}
+	}
+	if( message_handle_is_locked == 1 )
+	{
+		message_handle_release(
+		 export_handle->message_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the record event message
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_event_message(
+     export_handle_t *export_handle,
+     libevt_record_t *record,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     uint32_t event_identifier,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	const system_character_t *message_filename = NULL;
+	message_string_t *message_string           = NULL;
+	system_character_t *value_string           = NULL;
+	static char *function                      = "export_handle_export_record_event_message";
+	size_t message_filename_size               = 0;
+	size_t value_string_size                   = 0;
+	int message_handle_is_locked               = 0;
+	int message_string_is_pinned               = 0;
+	int number_of_strings                      = 0;
+	int result                                 = 0;
+	int value_string_index                     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle_grab(
+	     export_handle->message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab message handle.",
+		 function );
+
+		goto on_error;
+	}
+	message_handle_is_locked = 1;
+
+	if( event_source != NULL )
+	{
+		result = message_handle_get_value_by_event_source(
+		          export_handle->message_handle,
+		          event_source,
+		          event_source_length,
+		          _SYSTEM_STRING( "EventMessageFile" ),
+		          16,
+		          &message_filename,
+		          &message_filename_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message filename.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			fprintf(
+			 export_handle->notify_stream,
+			 "Message filename\t\t: %" PRIs_SYSTEM "\n",
+			 message_filename );
+
+			result = message_handle_get_message_string(
+				  export_handle->message_handle,
+				  message_filename,
+				  message_filename_size - 1,
+				  event_identifier,
+				  &message_string,
+				  error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message string: 0x%08" PRIx32 " from: %" PRIs_SYSTEM ".",
+				 function,
+				 event_identifier,
+				 message_filename );
+
+				goto on_error;
+			}
+		}
+	}
+	/* The message string is compiled once while it is cached and the compiled
+	 * message string is pinned so that it can be printed without locking the message handle
+	 */
+	if( message_string != NULL )
+	{
+		if( message_string_compile(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to compile message string.",
+			 function );
+
+			goto on_error;
+		}
+		if( message_string_pin(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pin message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_string_is_pinned = 1;
+	}
+	message_handle_is_locked = 0;
+
+	if( message_handle_release(
+	     export_handle->message_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release message handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Number of strings\t\t: %d\n",
+	 number_of_strings );
+
+	for( value_string_index = 0;
+	     value_string_index < number_of_strings;
+	     value_string_index++ )
+	{
+		fprintf(
+		 export_handle->notify_stream,
+		 "String: %d\t\t\t: ",
+		 value_string_index + 1 );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#else
+		result = libevt_record_get_utf8_string_size(
+			  record,
+			  value_string_index,
+			  &value_string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve string: %d size.",
+			 function,
+			 value_string_index );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			value_string = system_string_allocate(
+					value_string_size );
+
+			if( value_string == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value string.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			result = libevt_record_get_utf16_string(
+				  record,
+				  value_string_index,
+				  (uint16_t *) value_string,
+				  value_string_size,
+				  error );
+#else
+			result = libevt_record_get_utf8_string(
+				  record,
+				  value_string_index,
+				  (uint8_t *) value_string,
+				  value_string_size,
+				  error );
+#endif
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 value_string_index );
+
+				goto on_error;
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "%" PRIs_SYSTEM "",
+			 value_string );
+
+			memory_free(
+			 value_string );
+
+			value_string = NULL;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "\n" );
+	}
+	if( message_string != NULL )
+	{
+		if( message_string_fprint(
+		     message_string,
+		     record,
+		     &( export_handle->message_string_buffer ),
+		     &( export_handle->message_string_buffer_size ),
+		     export_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print message string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( message_string_is_pinned != 0 )
+	{
+		if( message_handle_grab(
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab message handle.",
+			 function );
+
+			goto on_error;
+		}
+		message_handle_is_locked = 1;
+		message_string_is_pinned = 0;
+
+		if( message_string_unpin(
+		     message_string,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to unpin message string.",
+			 function );
+
+			goto on_error;
+		}
+		message_handle_is_locked = 0;
+
+		if( message_handle_release(
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release message handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( message_string_is_pinned != 0 )
+	{
+		if( message_handle_is_locked == 0 )
+		{
+			message_handle_is_locked = message_handle_grab(
+			                            export_handle->message_handle,
+			                            NULL );
+		}
+		if( message_handle_is_locked == 1 )
+		{
+			message_string_unpin(
+			 message_string,
+			 NULL );
+		}
+	}
+	if( message_handle_is_locked == 1 )
+	{
+		message_handle_release(
+		 export_handle->message_handle,
+		 NULL );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Exports the record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record(
+     export_handle_t *export_handle,
+     libevt_record_t *record,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+
+	system_character_t *source_name       = NULL;
+	system_character_t *value_string      = NULL;
+	static char *function                 = "export_handle_export_record";
+	size_t source_name_size               = 0;
+	size_t value_string_size              = 0;
+	uint32_t event_identifier             = 0;
+	uint32_t value_32bit                  = 0;
+	uint16_t event_type                   = 0;
+	int result                            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_get_identifier(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Event number\t\t\t: %" PRIu32 "\n",
+	 value_32bit );
+
+	if( libevt_record_get_creation_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve creation time.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_posix_time_value_fprint(
+	     export_handle,
+	     "Creation time\t\t\t",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print POSIX time value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_written_time(
+	     record,
+	     &value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve written time.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_posix_time_value_fprint(
+	     export_handle,
+	     "Written time\t\t\t",
+	     value_32bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+		 "%s: unable to print POSIX time value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_type(
+	     record,
+	     &event_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event type.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Event type\t\t\t: %s (%" PRIu16 ")\n",
+	 export_handle_get_event_type(
+	  event_type ),
+	 event_type );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_user_security_identifier_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve user security identifier size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_user_security_identifier(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_user_security_identifier(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve user security identifier.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "User security identifier\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_computer_name_size(
+	          record,
+	          &value_string_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve computer name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( value_string_size > 0 ) )
+	{
+		value_string = system_string_allocate(
+		                value_string_size );
+
+		if( value_string == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create value string.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_computer_name(
+		          record,
+		          (uint16_t *) value_string,
+		          value_string_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_computer_name(
+		          record,
+		          (uint8_t *) value_string,
+		          value_string_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve computer name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Computer name\t\t\t: %" PRIs_SYSTEM "\n",
+		 value_string );
+
+		memory_free(
+		 value_string );
+
+		value_string = NULL;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libevt_record_get_utf16_source_name_size(
+	          record,
+	          &source_name_size,
+	          error );
+#else
+	result = libevt_record_get_utf8_source_name_size(
+	          record,
+	          &source_name_size,
+	          error );
+#endif
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( result != 0 )
+	 && ( source_name_size > 0 ) )
+	{
+		source_name = system_string_allocate(
+		               source_name_size );
+
+		if( source_name == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create event source.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_record_get_utf16_source_name(
+		          record,
+		          (uint16_t *) source_name,
+		          source_name_size,
+		          error );
+#else
+		result = libevt_record_get_utf8_source_name(
+		          record,
+		          (uint8_t *) source_name,
+		          source_name_size,
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve source name.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_handle->notify_stream,
+		 "Source name\t\t\t: %" PRIs_SYSTEM "\n",
+		 source_name );
+	}
+	if( export_handle_export_record_event_category(
+	     export_handle,
+	     record,
+	     source_name,
+	     source_name_size - 1,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export event category.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_get_event_identifier(
+	     record,
+	     &event_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event identifier.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "Event identifier\t\t: 0x%08" PRIx32 " (%" PRIu32 ")\n",
+	 event_identifier,
+	 event_identifier );
+
+	if( export_handle_export_record_event_message(
+	     export_handle,
+	     record,
+	     source_name,
+	     source_name_size - 1,
+	     event_identifier,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export event message.",
+		 function );
+
+		goto on_error;
+	}
+	fprintf(
+	 export_handle->notify_stream,
+	 "\n" );
+
+	if( source_name != NULL )
+	{
+		memory_free(
+		 source_name );
+
+		source_name = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( source_name != NULL )
+	{
+		memory_free(
+		 source_name );
+	}
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	return( -1 );
+}
+
+/* Exports a range of records
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_record_range(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevt_record_iterator_t *record_iterator = NULL;
+	libevt_record_t *record                   = NULL;
+	static char *function                     = "export_handle_export_record_range";
+	int end_record_index                      = 0;
+	int record_index                          = 0;
+	int result                                = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index > ( INT_MAX - number_of_records ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	end_record_index = first_record_index + number_of_records;
+
+	/* The records are read sequentially hence they are streamed
+	 * instead of being retrieved by index
+	 */
+	if( libevt_record_iterator_initialize(
+	     &record_iterator,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	/* The filter is applied by the record iterator so that records that
+	 * are not exported are skipped before they are parsed
+	 */
+	if( libevt_record_iterator_set_filter(
+	     record_iterator,
+	     export_handle->filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filter in record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_iterator_set_end_record_index(
+	     record_iterator,
+	     end_record_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set end record index in record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( first_record_index > 0 )
+	{
+		if( libevt_record_iterator_set_record_index(
+		     record_iterator,
+		     first_record_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set record index in record iterator.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( record_index = first_record_index;
+	     record_index < end_record_index;
+	     record_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			goto on_error;
+		}
+		result = libevt_record_iterator_get_next_record(
+		          record_iterator,
+		          &record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( libevt_record_iterator_free(
+	     &record_iterator,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_iterator != NULL )
+	{
+		libevt_record_iterator_free(
+		 &record_iterator,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Exports a range of records using multiple threads
+ * The records are split into ranges that are exported by a thread pool,
+ * where the output of every range is buffered until the output of the preceding
+ * ranges has been written, so that the output is in order of the records
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_records_in_parallel(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_job_t **export_jobs             = NULL;
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	static char *function                  = "export_handle_export_records_in_parallel";
+	int export_job_index                   = 0;
+	int maximum_number_of_export_jobs      = 0;
+	int number_of_export_jobs              = 0;
+	int number_of_range_records            = 0;
+	int number_of_threads                  = 0;
+	int output_range_index                 = 0;
+	int range_index                        = 0;
+	int record_index                       = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( first_record_index < 0 )
+	 || ( number_of_records < 0 )
+	 || ( first_record_index > ( INT_MAX - number_of_records ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record range value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_export_jobs = number_of_records / EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB;
+
+	if( ( number_of_records % EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB ) != 0 )
+	{
+		number_of_export_jobs += 1;
+	}
+	number_of_threads = export_handle->maximum_number_of_threads;
+
+	if( number_of_threads > number_of_export_jobs )
+	{
+		number_of_threads = number_of_export_jobs;
+	}
+	if( number_of_threads <= 1 )
+	{
+		return( export_handle_export_record_range(
+		         export_handle,
+		         file,
+		         first_record_index,
+		         number_of_records,
+		         log_handle,
+		         error ) );
+	}
+	/* The number of ranges that are exported ahead of the output is bounded
+	 * to limit the size of the buffered output, hence at most 2 x the number
+	 * of threads ranges of records are buffered
+	 */
+	maximum_number_of_export_jobs = 2 * number_of_threads;
+
+	export_jobs = (export_job_t **) memory_allocate(
+	                                 sizeof( export_job_t * ) * maximum_number_of_export_jobs );
+
+	if( export_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     export_jobs,
+	     0,
+	     sizeof( export_job_t * ) * maximum_number_of_export_jobs ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export jobs.",
+		 function );
+
+		memory_free(
+		 export_jobs );
+
+		export_jobs = NULL;
+
+		goto on_error;
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_threads,
+	     maximum_number_of_export_jobs,
+	     (int (*)(intptr_t *, void *)) &export_job_export,
+	     (void *) export_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	record_index = first_record_index;
+
+	for( range_index = 0;
+	     range_index < number_of_export_jobs;
+	     range_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		number_of_range_records = first_record_index + number_of_records - record_index;
+
+		if( number_of_range_records > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB )
+		{
+			number_of_range_records = EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB;
+		}
+		export_job_index = range_index % maximum_number_of_export_jobs;
+
+		if( export_job_initialize(
+		     &( export_jobs[ export_job_index ] ),
+		     export_handle,
+		     export_handle->message_handle,
+		     NULL,
+		     1,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export job: %d.",
+			 function,
+			 range_index );
+
+			goto on_error;
+		}
+		if( export_job_set_record_range(
+		     export_jobs[ export_job_index ],
+		     file,
+		     record_index,
+		     number_of_range_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set record range of export job: %d.",
+			 function,
+			 range_index );
+
+			export_job_free(
+			 &( export_jobs[ export_job_index ] ),
+			 NULL );
+
+			goto on_error;
+		}
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) export_jobs[ export_job_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push export job: %d onto thread pool.",
+			 function,
+			 range_index );
+
+			export_job_free(
+			 &( export_jobs[ export_job_index ] ),
+			 NULL );
+
+			goto on_error;
+		}
+		record_index += number_of_range_records;
+
+		while( ( range_index + 1 - output_range_index ) >= maximum_number_of_export_jobs )
+		{
+			export_job_index = output_range_index % maximum_number_of_export_jobs;
+
+			if( export_job_finish(
+			     &( export_jobs[ export_job_index ] ),
+			     export_handle,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to finish export job: %d.",
+				 function,
+				 output_range_index );
+
+				goto on_error;
+			}
+			output_range_index++;
+		}
+	}
+	while( output_range_index < range_index )
+	{
+		export_job_index = output_range_index % maximum_number_of_export_jobs;
+
+		if( export_job_finish(
+		     &( export_jobs[ export_job_index ] ),
+		     export_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to finish export job: %d.",
+			 function,
+			 output_range_index );
+
+			goto on_error;
+		}
+		output_range_index++;
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 export_jobs );
+
+	if( export_handle->abort != 0 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		/* Make sure the export jobs are no longer in use before they are freed
+		 */
+		export_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( export_jobs != NULL )
+	{
+		for( export_job_index = 0;
+		     export_job_index < maximum_number_of_export_jobs;
+		     export_job_index++ )
+		{
+			if( export_jobs[ export_job_index ] != NULL )
+			{
+				export_job_free(
+				 &( export_jobs[ export_job_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 export_jobs );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the records starting with the first record index
+ * If multiple threads are allowed the records of large files are exported
+ * by multiple threads
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_records(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     int first_record_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_export_records";
+	int number_of_records = 0;
+	int result            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_get_number_of_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index >= number_of_records )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( ( export_handle->maximum_number_of_threads > 1 )
+	 && ( ( number_of_records - first_record_index ) > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB ) )
+	{
+		result = export_handle_export_records_in_parallel(
+		          export_handle,
+		          file,
+		          first_record_index,
+		          number_of_records - first_record_index,
+		          log_handle,
+		          error );
+	}
+	else
+#endif
+	{
+		result = export_handle_export_record_range(
+		          export_handle,
+		          file,
+		          first_record_index,
+		          number_of_records - first_record_index,
+		          log_handle,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export records: %d to %d.",
+		 function,
+		 first_record_index,
+		 number_of_records - 1 );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Exports the records of the input file and the merge input files in order of their last written time
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_merged_records(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevt_multi_file_t *multi_file = NULL;
+	libevt_record_t *record         = NULL;
+	static char *function           = "export_handle_export_merged_records";
+	int file_index                  = 0;
+	int multi_file_index            = 0;
+	int number_of_records           = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_multi_file_initialize(
+	     &multi_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create multi file.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_multi_file_append_file(
+	     multi_file,
+	     export_handle->input_file,
+	     &multi_file_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append input file to multi file.",
+		 function );
+
+		goto on_error;
+	}
+	for( file_index = 0;
+	     file_index < export_handle->number_of_merge_input_files;
+	     file_index++ )
+	{
+		if( libevt_multi_file_append_file(
+		     multi_file,
+		     export_handle->merge_input_files[ file_index ],
+		     &multi_file_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append merge input file: %d to multi file.",
+			 function,
+			 file_index );
+
+			goto on_error;
+		}
+	}
+	/* The filter is applied by the record iterators of the multi file so that
+	 * records that are not exported are skipped before they are parsed
+	 */
+	if( libevt_multi_file_set_filter(
+	     multi_file,
+	     export_handle->filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filter in multi file.",
+		 function );
+
+		goto on_error;
+	}
+	while( export_handle->abort == 0 )
+	{
+		result = libevt_multi_file_get_next_record(
+		          multi_file,
+		          &file_index,
+		          &record_index,
+		          &record,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next record.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export record: %d of file: %d.",
+			 function,
+			 record_index,
+			 file_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		number_of_records++;
+	}
+	if( export_handle->abort != 0 )
+	{
+		goto on_error;
+	}
+	if( libevt_multi_file_free(
+	     &multi_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free multi file.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+
+on_error:
+	if( multi_file != NULL )
+	{
+		libevt_multi_file_free(
+		 &multi_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports the recovered records
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_recovered_records(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libevt_record_t *record = NULL;
+	static char *function   = "export_handle_export_recovered_records";
+	int number_of_records   = 0;
+	int record_index        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_get_number_of_recovered_records(
+	     file,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of recovered records.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records == 0 )
+	{
+		return( 0 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( export_handle->abort != 0 )
+		{
+			return( -1 );
+		}
+		if( libevt_file_get_recovered_record_by_index(
+		     file,
+		     record_index,
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve recovered record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+		if( export_handle_export_record(
+		     export_handle,
+		     record,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered record: %d.",
+			 function,
+			 record_index );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+		if( libevt_record_free(
+		     &record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record: %d.",
+			 function,
+			 record_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Exports the records from the file
+ * Returns the 1 if succesful, 0 if no records are available or -1 on error
+ */
+int export_handle_export_file(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function        = "export_handle_export_file";
+	int file_index               = 0;
+	int result                   = 0;
+	int result_recovered_records = 0;
+	int result_records           = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	 && ( export_handle->number_of_merge_input_files > 0 ) )
+	{
+		result_records = export_handle_export_merged_records(
+				  export_handle,
+				  log_handle,
+				  error );
+
+		if( result_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export merged records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	{
+		result_records = export_handle_export_records(
+				  export_handle,
+				  export_handle->input_file,
+				  0,
+				  log_handle,
+				  error );
+
+		if( result_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	{
+		result_recovered_records = export_handle_export_recovered_records(
+					    export_handle,
+					    export_handle->input_file,
+					    log_handle,
+					    error );
+
+		if( result_recovered_records == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export recovered records.",
+			 function );
+
+			return( -1 );
+		}
+		for( file_index = 0;
+		     file_index < export_handle->number_of_merge_input_files;
+		     file_index++ )
+		{
+			result = export_handle_export_recovered_records(
+			          export_handle,
+			          export_handle->merge_input_files[ file_index ],
+			          log_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export recovered records of merge input file: %d.",
+				 function,
+				 file_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				result_recovered_records = 1;
+			}
+		}
+	}
+	if( ( result_records != 0 )
+	 || ( result_recovered_records != 0 ) )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the message handle of a specific event log type
+ * The message handle is created and opened on first use and is shared
+ * by the source files of the same event log type
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_event_log_message_handle(
+     export_handle_t *export_handle,
+     int event_log_type,
+     message_handle_t **message_handle,
+     libcerror_error_t **error )
+{
+	message_handle_t *safe_message_handle = NULL;
+	static char *function                 = "export_handle_get_event_log_message_handle";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( event_log_type < 0 )
+	 || ( event_log_type >= EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event log type value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GENERIC,
-		 "%s: unable to export event message.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	fprintf(
-	 export_handle->notify_stream,
-	 "\n" );
-
-	if( source_name != NULL )
+	if( export_handle->event_log_message_handles[ event_log_type ] == NULL )
 	{
-		memory_free(
-		 source_name );
+		if( message_handle_initialize(
+		     &safe_message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message handle.",
+			 function );
 
-		source_name = NULL;
+			goto on_error;
+		}
+		if( message_handle_copy_settings(
+		     safe_message_handle,
+		     export_handle->message_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy message handle settings.",
+			 function );
+
+			goto on_error;
+		}
+		if( message_handle_open_input(
+		     safe_message_handle,
+		     export_handle_get_event_log_key_name(
+		      event_log_type ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input of message handle.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->event_log_message_handles[ event_log_type ] = safe_message_handle;
 	}
+	*message_handle = export_handle->event_log_message_handles[ event_log_type ];
+
 	return( 1 );
 
 on_error:
-	if( source_name != NULL )
-	{
-		memory_free(
-		 source_name );
-	}
-	if( value_string != NULL )
+	if( safe_message_handle != NULL )
 	{
-		memory_free(
-		 value_string );
+		message_handle_free(
+		 &safe_message_handle,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Exports the records
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Exports the records of the source files
+ * If multiple threads are allowed the source files are exported by a thread pool,
+ * where the output of every source file is buffered until the output of the preceding
+ * source files has been written, so that the output is in order of the source files
+ * The source files of the same event log type share a message handle
+ * Returns 1 if successful, 0 if no records were exported or -1 on error
  */
-int export_handle_export_records(
+int export_handle_export_source_files(
      export_handle_t *export_handle,
-     libevt_file_t *file,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libevt_record_t *record = NULL;
-	static char *function   = "export_handle_export_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+#endif
+	export_job_t **export_jobs             = NULL;
+	message_handle_t *message_handle       = NULL;
+	static char *function                  = "export_handle_export_source_files";
+	int event_log_type                     = 0;
+	int export_job_index                   = 0;
+	int maximum_number_of_export_jobs      = 0;
+	int number_of_threads                  = 0;
+	int output_source_index                = 0;
+	int records_exported                   = 0;
+	int result                             = 0;
+	int source_index                       = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1836,115 +4913,405 @@ int export_handle_export_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
+	if( export_handle->input_is_open != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export handle input is already open.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevt_file_get_number_of_records(
-	     file,
-	     &number_of_records,
-	     error ) != 1 )
+	if( export_handle->number_of_source_filenames == 0 )
+	{
+		return( 0 );
+	}
+	number_of_threads = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	number_of_threads = export_handle->maximum_number_of_threads;
+
+	if( number_of_threads > export_handle->number_of_source_filenames )
+	{
+		number_of_threads = export_handle->number_of_source_filenames;
+	}
+#endif
+	/* The number of source files that are exported ahead of the output
+	 * is bounded to limit the size of the buffered output
+	 */
+	maximum_number_of_export_jobs = 1;
+
+	if( number_of_threads > 1 )
+	{
+		maximum_number_of_export_jobs = 2 * number_of_threads;
+	}
+	export_jobs = (export_job_t **) memory_allocate(
+	                                 sizeof( export_job_t * ) * maximum_number_of_export_jobs );
+
+	if( export_jobs == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export jobs.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( number_of_records == 0 )
+	if( memory_set(
+	     export_jobs,
+	     0,
+	     sizeof( export_job_t * ) * maximum_number_of_export_jobs ) == NULL )
 	{
-		return( 0 );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export jobs.",
+		 function );
+
+		memory_free(
+		 export_jobs );
+
+		export_jobs = NULL;
+
+		goto on_error;
 	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( number_of_threads > 1 )
+	{
+		if( libcthreads_thread_pool_create(
+		     &thread_pool,
+		     NULL,
+		     number_of_threads,
+		     maximum_number_of_export_jobs,
+		     (int (*)(intptr_t *, void *)) &export_job_export,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	for( source_index = 0;
+	     source_index < export_handle->number_of_source_filenames;
+	     source_index++ )
 	{
 		if( export_handle->abort != 0 )
 		{
-			return( -1 );
+			break;
 		}
-		if( libevt_file_get_record_by_index(
-		     file,
-		     record_index,
-		     &record,
+		event_log_type = export_handle->event_log_type;
+
+		if( event_log_type == EVTTOOLS_EVENT_LOG_TYPE_UNKNOWN )
+		{
+			if( evtinput_determine_event_log_type_from_filename(
+			     export_handle->source_filenames[ source_index ],
+			     &event_log_type,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to determine event log type of source file: %d from filename.",
+				 function,
+				 source_index );
+
+				goto on_error;
+			}
+		}
+		if( export_handle_get_event_log_message_handle(
+		     export_handle,
+		     event_log_type,
+		     &message_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 "%s: unable to retrieve event log: %d message handle.",
 			 function,
-			 record_index );
+			 event_log_type );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( export_handle_export_record(
+		export_job_index = source_index % maximum_number_of_export_jobs;
+
+		if( export_job_initialize(
+		     &( export_jobs[ export_job_index ] ),
 		     export_handle,
-		     record,
+		     message_handle,
+		     export_handle->source_filenames[ source_index ],
+		     (uint8_t) ( number_of_threads > 1 ),
 		     log_handle,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record: %d.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export job: %d.",
 			 function,
-			 record_index );
+			 source_index );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
+			goto on_error;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( thread_pool != NULL )
+		{
+			if( libcthreads_thread_pool_push(
+			     thread_pool,
+			     (intptr_t *) export_jobs[ export_job_index ],
+			     error ) != 1 )
 			{
-				libcnotify_print_error_backtrace(
-				 *error );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push export job: %d onto thread pool.",
+				 function,
+				 source_index );
+
+				export_job_free(
+				 &( export_jobs[ export_job_index ] ),
+				 NULL );
+
+				goto on_error;
 			}
+		}
+		else
 #endif
-			libcerror_error_free(
-			 error );
+		{
+			export_job_export(
+			 export_jobs[ export_job_index ],
+			 export_handle );
 		}
-		if( libevt_record_free(
-		     &record,
+		while( ( source_index + 1 - output_source_index ) >= maximum_number_of_export_jobs )
+		{
+			export_job_index = output_source_index % maximum_number_of_export_jobs;
+
+			result = export_job_finish(
+			          &( export_jobs[ export_job_index ] ),
+			          export_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to finish export job: %d.",
+				 function,
+				 output_source_index );
+
+				goto on_error;
+			}
+			else if( result != 0 )
+			{
+				records_exported = 1;
+			}
+			output_source_index++;
+		}
+	}
+	while( output_source_index < source_index )
+	{
+		export_job_index = output_source_index % maximum_number_of_export_jobs;
+
+		result = export_job_finish(
+		          &( export_jobs[ export_job_index ] ),
+		          export_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to finish export job: %d.",
+			 function,
+			 output_source_index );
+
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			records_exported = 1;
+		}
+		output_source_index++;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		if( libcthreads_thread_pool_join(
+		     &thread_pool,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+			 "%s: unable to join thread pool.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
+	memory_free(
+	 export_jobs );
+
+	if( export_handle->abort != 0 )
+	{
+		return( -1 );
+	}
+	return( records_exported );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( thread_pool != NULL )
+	{
+		/* Make sure the export jobs are no longer in use before they are freed
+		 */
+		export_handle->abort = 1;
+
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+#endif
+	if( export_jobs != NULL )
+	{
+		for( export_job_index = 0;
+		     export_job_index < maximum_number_of_export_jobs;
+		     export_job_index++ )
+		{
+			if( export_jobs[ export_job_index ] != NULL )
+			{
+				export_job_free(
+				 &( export_jobs[ export_job_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 export_jobs );
+	}
+	return( -1 );
+}
+
+/* Retrieves the identifier (record number) of a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_get_record_identifier_by_index(
+     export_handle_t *export_handle,
+     int record_index,
+     uint32_t *identifier,
+     libcerror_error_t **error )
+{
+	libevt_record_t *record = NULL;
+	static char *function   = "export_handle_get_record_identifier_by_index";
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_file_get_record_by_index(
+	     export_handle->input_file,
+	     record_index,
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
 
-			return( -1 );
-		}
+		goto on_error;
+	}
+	if( libevt_record_get_identifier(
+	     record,
+	     identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve identifier of record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	if( libevt_record_free(
+	     &record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Exports the recovered records
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Follows the file and exports the records that are appended to it
+ * The records are exported until abort is signalled
+ * A failure to reopen or refresh the file is retried on the next wait cycle
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_recovered_records(
+int export_handle_follow_file(
      export_handle_t *export_handle,
-     libevt_file_t *file,
+     follow_handle_t *follow_handle,
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
-	libevt_record_t *record = NULL;
-	static char *function   = "export_handle_export_recovered_records";
-	int number_of_records   = 0;
-	int record_index        = 0;
+	static char *function       = "export_handle_follow_file";
+	uint32_t last_record_number = 0;
+	uint32_t record_number      = 0;
+	uint8_t reopen_input        = 0;
+	int first_record_index      = 0;
+	int has_last_record_number  = 0;
+	int number_of_records       = 0;
+	int number_of_retries       = 0;
+	int result                  = 0;
 
 	if( export_handle == NULL )
 	{
@@ -1957,19 +5324,19 @@ int export_handle_export_recovered_records(
 
 		return( -1 );
 	}
-	if( file == NULL )
+	if( follow_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 "%s: invalid follow handle.",
 		 function );
 
 		return( -1 );
 	}
-	if( libevt_file_get_number_of_recovered_records(
-	     file,
+	if( libevt_file_get_number_of_records(
+	     export_handle->input_file,
 	     &number_of_records,
 	     error ) != 1 )
 	{
@@ -1977,52 +5344,116 @@ int export_handle_export_recovered_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of recovered records.",
+		 "%s: unable to retrieve number of records.",
 		 function );
 
 		return( -1 );
 	}
-	if( number_of_records == 0 )
-	{
-		return( 0 );
-	}
-	for( record_index = 0;
-	     record_index < number_of_records;
-	     record_index++ )
+	if( number_of_records > 0 )
 	{
-		if( export_handle->abort != 0 )
-		{
-			return( -1 );
-		}
-		if( libevt_file_get_recovered_record_by_index(
-		     file,
-		     record_index,
-		     &record,
+		if( export_handle_get_record_identifier_by_index(
+		     export_handle,
+		     number_of_records - 1,
+		     &last_record_number,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve recovered record: %d.",
-			 function,
-			 record_index );
+			 "%s: unable to retrieve last record number.",
+			 function );
 
 			return( -1 );
 		}
-		if( export_handle_export_record(
-		     export_handle,
-		     record,
-		     log_handle,
-		     error ) != 1 )
+		has_last_record_number = 1;
+	}
+	while( export_handle->abort == 0 )
+	{
+		result = follow_handle_wait(
+		          follow_handle,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered record: %d.",
-			 function,
-			 record_index );
+			 "%s: unable to wait for changes.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( export_handle->abort != 0 )
+		{
+			break;
+		}
+		if( result == 2 )
+		{
+			reopen_input = 1;
+		}
+		if( reopen_input != 0 )
+		{
+			/* The file was replaced, for example by log rotation, hence
+			 * the replacement file is opened and all its records are exported
+			 */
+			result = export_handle_reopen_input(
+			          export_handle,
+			          follow_handle->filename,
+			          error );
+
+			if( result == 1 )
+			{
+				reopen_input           = 0;
+				has_last_record_number = 0;
+			}
+		}
+		else
+		{
+			result = libevt_file_refresh(
+			          export_handle->input_file,
+			          error );
+		}
+		if( result != 1 )
+		{
+			if( reopen_input != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to reopen input file.",
+				 function );
+			}
+			else
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to refresh input file.",
+				 function );
+			}
+			/* The replacement file can be empty or partially written and
+			 * a refresh can fail while the file is being written, hence
+			 * the previous input file is kept and the failure is retried
+			 * on the next wait cycle unless it persists
+			 */
+			number_of_retries++;
+
+			if( number_of_retries >= EXPORT_HANDLE_MAXIMUM_NUMBER_OF_FOLLOW_RETRIES )
+			{
+				return( -1 );
+			}
+			fprintf(
+			 export_handle->notify_stream,
+			 "Unable to %s input file, retrying.\n",
+			 ( reopen_input != 0 ) ? "reopen" : "refresh" );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( ( error != NULL )
@@ -2034,36 +5465,138 @@ int export_handle_export_recovered_records(
 #endif
 			libcerror_error_free(
 			 error );
+
+			continue;
 		}
-		if( libevt_record_free(
-		     &record,
+		number_of_retries = 0;
+
+		if( libevt_file_get_number_of_records(
+		     export_handle->input_file,
+		     &number_of_records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record: %d.",
-			 function,
-			 record_index );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of records.",
+			 function );
+
+			return( -1 );
+		}
+		if( number_of_records == 0 )
+		{
+			has_last_record_number = 0;
+
+			continue;
+		}
+		if( export_handle_get_record_identifier_by_index(
+		     export_handle,
+		     number_of_records - 1,
+		     &record_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last record number.",
+			 function );
+
+			return( -1 );
+		}
+		/* The appended records are determined by their record number
+		 * since the offset of the end of file wraps when the file is full.
+		 * If the last record number decreased the log was cleared hence
+		 * all its records are exported.
+		 */
+		first_record_index = number_of_records;
+
+		if( ( has_last_record_number != 0 )
+		 && ( record_number >= last_record_number ) )
+		{
+			while( first_record_index > 0 )
+			{
+				if( export_handle_get_record_identifier_by_index(
+				     export_handle,
+				     first_record_index - 1,
+				     &record_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve record number: %d.",
+					 function,
+					 first_record_index - 1 );
+
+					return( -1 );
+				}
+				if( record_number <= last_record_number )
+				{
+					break;
+				}
+				first_record_index--;
+			}
+		}
+		else
+		{
+			first_record_index = 0;
+		}
+		if( export_handle_export_records(
+		     export_handle,
+		     export_handle->input_file,
+		     first_record_index,
+		     log_handle,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
+
+			return( -1 );
+		}
+		if( export_handle_get_record_identifier_by_index(
+		     export_handle,
+		     number_of_records - 1,
+		     &last_record_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve last record number.",
+			 function );
 
 			return( -1 );
 		}
+		has_last_record_number = 1;
+
+		fflush(
+		 export_handle->notify_stream );
 	}
 	return( 1 );
 }
 
-/* Exports the records from the file
- * Returns the 1 if succesful, 0 if no records are available or -1 on error
+/* Prints the resource file cache statistics of the message handles
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_file(
+int export_handle_resource_file_cache_statistics_fprint(
      export_handle_t *export_handle,
-     log_handle_t *log_handle,
+     FILE *stream,
      libcerror_error_t **error )
 {
-	static char *function        = "export_handle_export_file";
-	int result_recovered_records = 0;
-	int result_records           = 0;
+	message_handle_t *message_handle = NULL;
+	static char *function            = "export_handle_resource_file_cache_statistics_fprint";
+	uint64_t number_of_evictions     = 0;
+	uint64_t number_of_hits          = 0;
+	uint64_t number_of_misses        = 0;
+	int event_log_type               = 0;
 
 	if( export_handle == NULL )
 	{
@@ -2076,51 +5609,92 @@ int export_handle_export_file(
 
 		return( -1 );
 	}
-	if( export_handle->export_mode != EXPORT_MODE_RECOVERED )
+	if( stream == NULL )
 	{
-		result_records = export_handle_export_records(
-				  export_handle,
-				  export_handle->input_file,
-				  log_handle,
-				  error );
-
-		if( result_records == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export records.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
 
-			return( -1 );
-		}
+		return( -1 );
 	}
-	if( export_handle->export_mode != EXPORT_MODE_ITEMS )
+	if( export_handle->message_handle == NULL )
 	{
-		result_recovered_records = export_handle_export_recovered_records(
-					    export_handle,
-					    export_handle->input_file,
-					    log_handle,
-					    error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export handle - missing message handle.",
+		 function );
 
-		if( result_recovered_records == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export recovered records.",
-			 function );
+		return( -1 );
+	}
+	message_handle = export_handle->message_handle;
 
-			return( -1 );
+	for( event_log_type = 0;
+	     event_log_type <= EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES;
+	     event_log_type++ )
+	{
+		/* The message handles per event log type follow the message handle
+		 */
+		if( event_log_type > 0 )
+		{
+			message_handle = export_handle->event_log_message_handles[ event_log_type - 1 ];
+		}
+		if( message_handle == NULL )
+		{
+			continue;
 		}
+		number_of_hits      += message_handle->resource_file_cache->number_of_hits
+		                     + message_handle->mui_resource_file_cache->number_of_hits;
+		number_of_misses    += message_handle->resource_file_cache->number_of_misses
+		                     + message_handle->mui_resource_file_cache->number_of_misses;
+		number_of_evictions += message_handle->resource_file_cache->number_of_evictions
+		                     + message_handle->mui_resource_file_cache->number_of_evictions;
 	}
-	if( ( result_records != 0 )
-	 || ( result_recovered_records != 0 ) )
+	fprintf(
+	 stream,
+	 "Resource file cache statistics:\n" );
+
+	fprintf(
+	 stream,
+	 "\tMaximum number of files\t: %d\n",
+	 export_handle->message_handle->resource_file_cache->maximum_number_of_entries );
+
+	if( export_handle->message_handle->resource_file_cache->maximum_size == 0 )
 	{
-		return( 1 );
+		fprintf(
+		 stream,
+		 "\tMaximum size\t\t: unlimited\n" );
 	}
-	return( 0 );
+	else
+	{
+		fprintf(
+		 stream,
+		 "\tMaximum size\t\t: %" PRIu64 " bytes\n",
+		 export_handle->message_handle->resource_file_cache->maximum_size );
+	}
+	fprintf(
+	 stream,
+	 "\tNumber of hits\t\t: %" PRIu64 "\n",
+	 number_of_hits );
+
+	fprintf(
+	 stream,
+	 "\tNumber of misses\t: %" PRIu64 "\n",
+	 number_of_misses );
+
+	fprintf(
+	 stream,
+	 "\tNumber of evictions\t: %" PRIu64 "\n",
+	 number_of_evictions );
+
+	fprintf(
+	 stream,
+	 "\n" );
+
+	return( 1 );
 }
 
@@ -26,8 +26,10 @@
 #include <file_stream.h>
 #include <types.h>
 
+#include "evtinput.h"
 #include "evttools_libcerror.h"
 #include "evttools_libevt.h"
+#include "follow_handle.h"
 #include "log_handle.h"
 #include "message_handle.h"
 #include "message_string.h"
@@ -43,6 +45,20 @@ enum EXPORT_MODES
 	EXPORT_MODE_RECOVERED			= (int) 'r'
 };
 
+/* The number of event log types
+ */
+#define EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES	( EVTTOOLS_EVENT_LOG_TYPE_WINDOWS_POWERSHELL + 1 )
+
+/* The number of records exported by an export job when the records
+ * of a file are exported by multiple threads
+ */
+#define EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_EXPORT_JOB	512
+
+/* The maximum number of consecutive wait cycles a failure to reopen
+ * or refresh the followed file is retried
+ */
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_FOLLOW_RETRIES	60
+
 typedef struct export_handle export_handle_t;
 
 struct export_handle
@@ -55,10 +71,34 @@ struct export_handle
 	 */
 	libevt_file_t *input_file;
 
+	/* The libevt input files of which the records are merged with those of the input file
+	 */
+	libevt_file_t **merge_input_files;
+
+	/* The number of merge input files
+	 */
+	int number_of_merge_input_files;
+
 	/* The message handle
 	 */
 	message_handle_t *message_handle;
 
+	/* The message handles per event log type, used when exporting the source files
+	 */
+	message_handle_t *event_log_message_handles[ EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES ];
+
+	/* The source filenames
+	 */
+	system_character_t **source_filenames;
+
+	/* The number of source filenames
+	 */
+	int number_of_source_filenames;
+
+	/* The maximum number of threads used to export the source files
+	 */
+	int maximum_number_of_threads;
+
 	/* The event log type
 	 */
 	int event_log_type;
@@ -71,6 +111,26 @@ struct export_handle
 	 */
 	int ascii_codepage;
 
+	/* The record filter
+	 */
+	libevt_filter_t *filter;
+
+	/* The start of the written time range of the record filter
+	 */
+	uint32_t filter_start_time;
+
+	/* The end of the written time range of the record filter
+	 */
+	uint32_t filter_end_time;
+
+	/* The buffer used to print message strings
+	 */
+	system_character_t *message_string_buffer;
+
+	/* The message string buffer size
+	 */
+	size_t message_string_buffer_size;
+
 	/* The notification output stream
 	 */
 	FILE *notify_stream;
@@ -143,11 +203,92 @@ int export_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int export_handle_set_message_catalog_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_set_filter_values(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     int filter_value_type,
+     libcerror_error_t **error );
+
+int export_handle_set_event_identifiers(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_event_categories(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_event_types(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_source_name(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_start_time(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_end_time(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_maximum_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_resource_file_cache_number_of_files(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_set_resource_file_cache_size(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
+int export_handle_compare_source_filenames(
+     const void *first_source_filename,
+     const void *second_source_filename );
+
+int export_handle_append_source(
+     export_handle_t *export_handle,
+     const system_character_t *path,
+     libcerror_error_t **error );
+
+int export_handle_append_source_filename(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     size_t filename_length,
+     libcerror_error_t **error );
+
 int export_handle_open_input(
      export_handle_t *export_handle,
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int export_handle_open_merge_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int export_handle_reopen_input(
+     export_handle_t *export_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int export_handle_close_input(
      export_handle_t *export_handle,
      libcerror_error_t **error );
@@ -185,9 +326,35 @@ int export_handle_export_record(
 
 /* File export functions
  */
+int export_handle_export_record_range(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_export_records_in_parallel(
+     export_handle_t *export_handle,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_export_records(
      export_handle_t *export_handle,
      libevt_file_t *file,
+     int first_record_index,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_merged_records(
+     export_handle_t *export_handle,
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
@@ -202,6 +369,34 @@ int export_handle_export_file(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_get_event_log_message_handle(
+     export_handle_t *export_handle,
+     int event_log_type,
+     message_handle_t **message_handle,
+     libcerror_error_t **error );
+
+int export_handle_export_source_files(
+     export_handle_t *export_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_get_record_identifier_by_index(
+     export_handle_t *export_handle,
+     int record_index,
+     uint32_t *identifier,
+     libcerror_error_t **error );
+
+int export_handle_follow_file(
+     export_handle_t *export_handle,
+     follow_handle_t *follow_handle,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_resource_file_cache_statistics_fprint(
+     export_handle_t *export_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1017 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "evttools_libcnotify.h"
+#include "evttools_libcthreads.h"
+#include "evttools_libevt.h"
+#include "export_handle.h"
+#include "export_job.h"
+#include "log_handle.h"
+#include "message_handle.h"
+
+/* Creates an export job
+ * Make sure the value export_job is referencing, is set to NULL
+ * The export job exports the source file with filename or, if a record range
+ * is set, a range of records of a file that is already open
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_initialize(
+     export_job_t **export_job,
+     export_handle_t *export_handle,
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     uint8_t buffer_output,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_initialize";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	*export_job = memory_allocate_structure(
+	               export_job_t );
+
+	if( *export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_job,
+	     0,
+	     sizeof( export_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export job.",
+		 function );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( ( *export_job )->export_handle ),
+	     export_handle,
+	     sizeof( export_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy export handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The values that are managed by the export handle are not shared with the copy
+	 */
+	( *export_job )->export_handle.input_file                  = NULL;
+	( *export_job )->export_handle.input_is_open               = 0;
+	( *export_job )->export_handle.merge_input_files           = NULL;
+	( *export_job )->export_handle.number_of_merge_input_files = 0;
+	( *export_job )->export_handle.source_filenames            = NULL;
+	( *export_job )->export_handle.number_of_source_filenames  = 0;
+	( *export_job )->export_handle.message_handle              = message_handle;
+	( *export_job )->export_handle.maximum_number_of_threads   = 1;
+	( *export_job )->export_handle.message_string_buffer       = NULL;
+	( *export_job )->export_handle.message_string_buffer_size  = 0;
+	( *export_job )->export_handle.abort                       = 0;
+
+	if( memory_set(
+	     ( *export_job )->export_handle.event_log_message_handles,
+	     0,
+	     sizeof( message_handle_t * ) * EXPORT_HANDLE_NUMBER_OF_EVENT_LOG_TYPES ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear event log message handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( buffer_output != 0 )
+	{
+		/* The output is buffered in memory if supported, otherwise in a temporary file
+		 */
+#if defined( HAVE_OPEN_MEMSTREAM )
+		( *export_job )->output_stream = open_memstream(
+		                                  &( ( *export_job )->output_buffer ),
+		                                  &( ( *export_job )->output_buffer_size ) );
+#else
+		( *export_job )->output_stream = tmpfile();
+#endif
+		if( ( *export_job )->output_stream == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to create buffered output stream.",
+			 function );
+
+			goto on_error;
+		}
+		( *export_job )->output_is_buffered = 1;
+	}
+	else
+	{
+		( *export_job )->output_stream = export_handle->notify_stream;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *export_job )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *export_job )->finished_condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create finished condition.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	( *export_job )->export_handle.notify_stream = ( *export_job )->output_stream;
+	( *export_job )->filename                    = filename;
+	( *export_job )->log_handle                  = log_handle;
+
+	return( 1 );
+
+on_error:
+	if( *export_job != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( *export_job )->mutex != NULL )
+		{
+			libcthreads_mutex_free(
+			 &( ( *export_job )->mutex ),
+			 NULL );
+		}
+#endif
+		if( ( *export_job )->output_is_buffered != 0 )
+		{
+			file_stream_close(
+			 ( *export_job )->output_stream );
+		}
+#if defined( HAVE_OPEN_MEMSTREAM )
+		if( ( *export_job )->output_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_job )->output_buffer );
+		}
+#endif
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_free";
+	int result            = 1;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->export_handle.input_file != NULL )
+		{
+			if( libevt_file_free(
+			     &( ( *export_job )->export_handle.input_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free input file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_job )->export_handle.message_string_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_job )->export_handle.message_string_buffer );
+		}
+		if( ( *export_job )->output_is_buffered != 0 )
+		{
+			if( file_stream_close(
+			     ( *export_job )->output_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close buffered output stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_OPEN_MEMSTREAM )
+		/* The output buffer is only valid after the output stream was closed
+		 */
+		if( ( *export_job )->output_buffer != NULL )
+		{
+			memory_free(
+			 ( *export_job )->output_buffer );
+		}
+#endif
+		if( ( *export_job )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *export_job )->error ) );
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( ( *export_job )->finished_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free finished condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( ( *export_job )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( result );
+}
+
+/* Sets the range of records of a file that is already open to export
+ * The file is not managed by the export job and must remain open
+ * while the export job is in use
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_set_record_range(
+     export_job_t *export_job,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_set_record_range";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_records < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	export_job->file               = file;
+	export_job->first_record_index = first_record_index;
+	export_job->number_of_records  = number_of_records;
+
+	return( 1 );
+}
+
+/* Exports the records of the source file or the range of records
+ * Callback function for the export thread pool
+ * The result of the export is stored in the export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_export(
+     export_job_t *export_job,
+     export_handle_t *export_handle )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "export_job_export";
+	int result               = 0;
+
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	export_job->result = -1;
+
+	/* The export jobs that have not been started when abort was signalled are skipped
+	 */
+	if( ( export_handle != NULL )
+	 && ( export_handle->abort != 0 ) )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+		 "%s: abort requested.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_job->file != NULL )
+	{
+		export_job->result = export_handle_export_record_range(
+		                      &( export_job->export_handle ),
+		                      export_job->file,
+		                      export_job->first_record_index,
+		                      export_job->number_of_records,
+		                      export_job->log_handle,
+		                      &error );
+
+		if( export_job->result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevt_file_initialize(
+		     &( export_job->export_handle.input_file ),
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize input file.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_file_set_ascii_codepage(
+		     export_job->export_handle.input_file,
+		     export_job->export_handle.ascii_codepage,
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set ASCII codepage in input file.",
+			 function );
+
+			goto on_error;
+		}
+	#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libevt_file_open_wide(
+		          export_job->export_handle.input_file,
+		          export_job->filename,
+		          LIBEVT_OPEN_READ,
+		          &error );
+	#else
+		result = libevt_file_open(
+		          export_job->export_handle.input_file,
+		          export_job->filename,
+		          LIBEVT_OPEN_READ,
+		          &error );
+	#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open input file.",
+			 function );
+
+			goto on_error;
+		}
+		fprintf(
+		 export_job->output_stream,
+		 "Source file\t\t\t: %" PRIs_SYSTEM "\n\n",
+		 export_job->filename );
+
+		export_job->result = export_handle_export_file(
+		                      &( export_job->export_handle ),
+		                      export_job->log_handle,
+		                      &error );
+
+		if( export_job->result == -1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export file.",
+			 function );
+		}
+		if( libevt_file_close(
+		     export_job->export_handle.input_file,
+		     &error ) != 0 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close input file.",
+			 function );
+
+			export_job->result = -1;
+		}
+		if( libevt_file_free(
+		     &( export_job->export_handle.input_file ),
+		     &error ) != 1 )
+		{
+			libcerror_error_set(
+			 &error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free input file.",
+			 function );
+
+			export_job->result = -1;
+		}
+		if( export_job->result == -1 )
+		{
+			goto on_error;
+		}
+	}
+	if( export_job_signal_finished(
+	     export_job,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( export_job->export_handle.input_file != NULL )
+	{
+		libevt_file_free(
+		 &( export_job->export_handle.input_file ),
+		 NULL );
+	}
+	export_job->error = error;
+
+	export_job_signal_finished(
+	 export_job,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Signals that the export job has finished
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_signal_finished(
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_signal_finished";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_job->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	export_job->is_finished = 1;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_condition_broadcast(
+	     export_job->finished_condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast finished condition.",
+		 function );
+
+		libcthreads_mutex_release(
+		 export_job->mutex,
+		 NULL );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_release(
+	     export_job->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Waits until the export job has finished
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_wait(
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_wait";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     export_job->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	while( export_job->is_finished == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     export_job->finished_condition,
+		     export_job->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to wait for finished condition.",
+			 function );
+
+			libcthreads_mutex_release(
+			 export_job->mutex,
+			 NULL );
+
+			return( -1 );
+		}
+	}
+	if( libcthreads_mutex_release(
+	     export_job->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	if( export_job->is_finished == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid export job - export has not finished.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Writes the buffered output of the export job to a stream
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_write_output(
+     export_job_t *export_job,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+#if !defined( HAVE_OPEN_MEMSTREAM )
+	uint8_t buffer[ 65536 ];
+
+	size_t read_count     = 0;
+#endif
+	static char *function = "export_job_write_output";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job->output_is_buffered == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_OPEN_MEMSTREAM )
+	/* Flushing the output stream updates the output buffer and its size
+	 */
+	if( fflush(
+	     export_job->output_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush buffered output stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( export_job->output_buffer != NULL )
+	 && ( export_job->output_buffer_size > 0 ) )
+	{
+		if( file_stream_write(
+		     stream,
+		     export_job->output_buffer,
+		     export_job->output_buffer_size ) != export_job->output_buffer_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write output.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#else
+	if( file_stream_seek_offset(
+	     export_job->output_stream,
+	     0,
+	     SEEK_SET ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of buffered output stream.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		read_count = file_stream_read(
+		              export_job->output_stream,
+		              buffer,
+		              65536 );
+
+		if( read_count > 0 )
+		{
+			if( file_stream_write(
+			     stream,
+			     buffer,
+			     read_count ) != read_count )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to write output.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( read_count == 65536 );
+#endif
+	return( 1 );
+}
+
+/* Finishes an export job
+ * Waits for the export job to finish, writes its output to the notification output
+ * stream of the export handle and frees the export job
+ * A source file that could not be exported is reported but does not stop the export
+ * Returns 1 if successful, 0 if no records were exported or -1 on error
+ */
+int export_job_finish(
+     export_job_t **export_job,
+     export_handle_t *export_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_finish";
+	int result            = 0;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job_wait(
+	     *export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to wait for export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *export_job )->result == -1 )
+	{
+		if( ( *export_job )->file != NULL )
+		{
+			/* The records of a file are exported by multiple export jobs
+			 * hence the export of the file fails if one of them fails
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( *export_job )->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 ( *export_job )->error );
+			}
+#endif
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export records: %d to %d.",
+			 function,
+			 ( *export_job )->first_record_index,
+			 ( *export_job )->first_record_index + ( *export_job )->number_of_records - 1 );
+
+			result = -1;
+		}
+		else if( export_handle->abort == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to export: %" PRIs_SYSTEM ".\n",
+			 ( *export_job )->filename );
+
+			if( ( *export_job )->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 ( *export_job )->error );
+			}
+		}
+	}
+	else
+	{
+		if( export_job_write_output(
+		     *export_job,
+		     export_handle->notify_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write output of export job.",
+			 function );
+
+			return( -1 );
+		}
+		result = ( *export_job )->result;
+	}
+	if( export_job_free(
+	     export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free export job.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
@@ -0,0 +1,159 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_JOB_H )
+#define _EXPORT_JOB_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "evttools_libcthreads.h"
+#include "evttools_libevt.h"
+#include "export_handle.h"
+#include "log_handle.h"
+#include "message_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_job export_job_t;
+
+struct export_job
+{
+	/* The export handle
+	 * This is a private copy that shares the settings, filter and message handle
+	 * of the export handle, but has its own input file and notification output stream
+	 */
+	export_handle_t export_handle;
+
+	/* The source filename
+	 */
+	const system_character_t *filename;
+
+	/* The file of which a range of records is exported
+	 */
+	libevt_file_t *file;
+
+	/* The index of the first record of the range
+	 */
+	int first_record_index;
+
+	/* The number of records of the range
+	 */
+	int number_of_records;
+
+	/* The log handle
+	 */
+	log_handle_t *log_handle;
+
+	/* The output stream
+	 */
+	FILE *output_stream;
+
+	/* Value to indicate the output is buffered
+	 */
+	uint8_t output_is_buffered;
+
+#if defined( HAVE_OPEN_MEMSTREAM )
+	/* The output buffer
+	 * The buffer is managed by the output stream and grows with the output
+	 */
+	char *output_buffer;
+
+	/* The output buffer size
+	 */
+	size_t output_buffer_size;
+#endif
+
+	/* The result of the export
+	 */
+	int result;
+
+	/* The error if the export failed
+	 */
+	libcerror_error_t *error;
+
+	/* Value to indicate the export has finished
+	 */
+	int is_finished;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition that is signalled when the export has finished
+	 */
+	libcthreads_condition_t *finished_condition;
+#endif
+};
+
+int export_job_initialize(
+     export_job_t **export_job,
+     export_handle_t *export_handle,
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     uint8_t buffer_output,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+int export_job_set_record_range(
+     export_job_t *export_job,
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libcerror_error_t **error );
+
+int export_job_export(
+     export_job_t *export_job,
+     export_handle_t *export_handle );
+
+int export_job_signal_finished(
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+int export_job_wait(
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+int export_job_write_output(
+     export_job_t *export_job,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int export_job_finish(
+     export_job_t **export_job,
+     export_handle_t *export_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_JOB_H ) */
+
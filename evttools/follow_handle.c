@@ -0,0 +1,512 @@
+/*
+ * Follow handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_POLL_H )
+#include <poll.h>
+#endif
+
+#if defined( HAVE_SYS_INOTIFY_H )
+#include <sys/inotify.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H )
+#include <unistd.h>
+#endif
+
+#include "evttools_libcerror.h"
+#include "follow_handle.h"
+
+/* inotify requires a narrow character filename
+ */
+#if defined( HAVE_SYS_INOTIFY_H ) && defined( HAVE_POLL_H ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER )
+#define FOLLOW_HANDLE_HAVE_INOTIFY
+#endif
+
+/* stat requires a narrow character filename
+ */
+#if defined( HAVE_SYS_STAT_H ) && defined( HAVE_STAT ) && !defined( HAVE_WIDE_SYSTEM_CHARACTER ) && !defined( WINAPI )
+#define FOLLOW_HANDLE_HAVE_STAT
+#endif
+
+/* The inotify events that indicate the file was changed, moved, deleted or replaced
+ */
+#define FOLLOW_HANDLE_INOTIFY_EVENTS \
+	( IN_MODIFY | IN_CLOSE_WRITE | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF )
+
+/* Creates a follow handle
+ * Make sure the value follow_handle is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int follow_handle_initialize(
+     follow_handle_t **follow_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "follow_handle_initialize";
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *follow_handle != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid follow handle value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*follow_handle = memory_allocate_structure(
+	                  follow_handle_t );
+
+	if( *follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create follow handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *follow_handle,
+	     0,
+	     sizeof( follow_handle_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear follow handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *follow_handle )->inotify_file_descriptor  = -1;
+	( *follow_handle )->inotify_watch_descriptor = -1;
+	( *follow_handle )->poll_interval            = FOLLOW_HANDLE_DEFAULT_POLL_INTERVAL;
+
+	return( 1 );
+
+on_error:
+	if( *follow_handle != NULL )
+	{
+		memory_free(
+		 *follow_handle );
+
+		*follow_handle = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a follow handle
+ * Returns 1 if successful or -1 on error
+ */
+int follow_handle_free(
+     follow_handle_t **follow_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "follow_handle_free";
+	int result            = 1;
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( *follow_handle != NULL )
+	{
+		if( follow_handle_close(
+		     *follow_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close follow handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *follow_handle );
+
+		*follow_handle = NULL;
+	}
+	return( result );
+}
+
+/* Signals the follow handle to abort
+ * Returns 1 if successful or -1 on error
+ */
+int follow_handle_signal_abort(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "follow_handle_signal_abort";
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+	follow_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Opens the follow handle
+ * Changes to the file are watched using inotify if available,
+ * otherwise the file is polled
+ * The filename is referenced and must remain available while the follow handle is open
+ * Returns 1 if successful or -1 on error
+ */
+int follow_handle_open(
+     follow_handle_t *follow_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+#if defined( FOLLOW_HANDLE_HAVE_STAT )
+	struct stat file_stat;
+#endif
+
+	static char *function = "follow_handle_open";
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( follow_handle->inotify_file_descriptor != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid follow handle - inotify file descriptor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	follow_handle->filename         = filename;
+	follow_handle->has_inode_number = 0;
+	follow_handle->abort            = 0;
+
+#if defined( FOLLOW_HANDLE_HAVE_STAT )
+	/* The device and inode number are used to detect if the file was replaced
+	 */
+	if( stat(
+	     filename,
+	     &file_stat ) == 0 )
+	{
+		follow_handle->device_number    = (uint64_t) file_stat.st_dev;
+		follow_handle->inode_number     = (uint64_t) file_stat.st_ino;
+		follow_handle->has_inode_number = 1;
+	}
+#endif
+#if defined( FOLLOW_HANDLE_HAVE_INOTIFY )
+	/* If the file cannot be watched the file is polled instead
+	 */
+	follow_handle->inotify_file_descriptor = inotify_init();
+
+	if( follow_handle->inotify_file_descriptor != -1 )
+	{
+		follow_handle->inotify_watch_descriptor = inotify_add_watch(
+		                                           follow_handle->inotify_file_descriptor,
+		                                           filename,
+		                                           FOLLOW_HANDLE_INOTIFY_EVENTS );
+
+		if( follow_handle->inotify_watch_descriptor == -1 )
+		{
+			close(
+			 follow_handle->inotify_file_descriptor );
+
+			follow_handle->inotify_file_descriptor = -1;
+		}
+	}
+#endif
+	return( 1 );
+}
+
+/* Closes the follow handle
+ * Returns the 0 if succesful or -1 on error
+ */
+int follow_handle_close(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "follow_handle_close";
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( FOLLOW_HANDLE_HAVE_INOTIFY )
+	if( follow_handle->inotify_file_descriptor != -1 )
+	{
+		if( close(
+		     follow_handle->inotify_file_descriptor ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close inotify file descriptor.",
+			 function );
+
+			follow_handle->inotify_file_descriptor  = -1;
+			follow_handle->inotify_watch_descriptor = -1;
+
+			return( -1 );
+		}
+		follow_handle->inotify_file_descriptor  = -1;
+		follow_handle->inotify_watch_descriptor = -1;
+	}
+#endif
+	follow_handle->filename = NULL;
+
+	return( 0 );
+}
+
+/* Waits until the file was changed or replaced
+ * The file is also considered changed when no change was signalled within
+ * the poll interval, so that changes that were not signalled are not missed
+ * A file that was moved or deleted is considered replaced once a file with
+ * the same filename but another device or inode number is available
+ * Returns 1 if the file was changed, 2 if the file was replaced,
+ * 0 if abort was signalled or -1 on error
+ */
+int follow_handle_wait(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error )
+{
+#if defined( FOLLOW_HANDLE_HAVE_INOTIFY )
+	uint8_t event_data[ 4096 ];
+
+	struct pollfd poll_descriptor;
+
+	ssize_t read_count    = 0;
+	int result            = 0;
+#endif
+#if defined( FOLLOW_HANDLE_HAVE_STAT )
+	struct stat file_stat;
+#endif
+
+	static char *function = "follow_handle_wait";
+
+	if( follow_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid follow handle.",
+		 function );
+
+		return( -1 );
+	}
+	while( follow_handle->abort == 0 )
+	{
+#if defined( FOLLOW_HANDLE_HAVE_INOTIFY )
+		if( follow_handle->inotify_file_descriptor != -1 )
+		{
+			/* The poll interval is used as time-out so that abort is checked regularly
+			 */
+			poll_descriptor.fd      = follow_handle->inotify_file_descriptor;
+			poll_descriptor.events  = POLLIN;
+			poll_descriptor.revents = 0;
+
+			result = poll(
+			          &poll_descriptor,
+			          1,
+			          follow_handle->poll_interval * 1000 );
+
+			if( result == -1 )
+			{
+				if( errno == EINTR )
+				{
+					continue;
+				}
+				libcerror_system_set_error(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_GENERIC,
+				 errno,
+				 "%s: unable to poll inotify file descriptor.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				/* The events are only read to clear them, which events
+				 * occurred does not matter since the file is checked below
+				 */
+				read_count = read(
+				              follow_handle->inotify_file_descriptor,
+				              event_data,
+				              sizeof( event_data ) );
+
+				if( ( read_count == -1 )
+				 && ( errno != EINTR ) )
+				{
+					libcerror_system_set_error(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 errno,
+					 "%s: unable to read inotify events.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		else
+#endif
+		{
+#if defined( WINAPI ) && !defined( __CYGWIN__ )
+			Sleep(
+			 (DWORD) ( follow_handle->poll_interval * 1000 ) );
+#else
+			sleep(
+			 (unsigned int) follow_handle->poll_interval );
+#endif
+		}
+		if( follow_handle->abort != 0 )
+		{
+			break;
+		}
+#if defined( FOLLOW_HANDLE_HAVE_STAT )
+		if( follow_handle->has_inode_number != 0 )
+		{
+			/* The file can be missing while it is being replaced
+			 */
+			if( stat(
+			     follow_handle->filename,
+			     &file_stat ) != 0 )
+			{
+				continue;
+			}
+			if( ( (uint64_t) file_stat.st_dev != follow_handle->device_number )
+			 || ( (uint64_t) file_stat.st_ino != follow_handle->inode_number ) )
+			{
+				follow_handle->device_number = (uint64_t) file_stat.st_dev;
+				follow_handle->inode_number  = (uint64_t) file_stat.st_ino;
+
+#if defined( FOLLOW_HANDLE_HAVE_INOTIFY )
+				if( follow_handle->inotify_file_descriptor != -1 )
+				{
+					/* The watch of a deleted file was already removed, hence
+					 * an error of removing the watch is ignored
+					 */
+					if( follow_handle->inotify_watch_descriptor != -1 )
+					{
+						inotify_rm_watch(
+						 follow_handle->inotify_file_descriptor,
+						 follow_handle->inotify_watch_descriptor );
+					}
+					follow_handle->inotify_watch_descriptor = inotify_add_watch(
+					                                           follow_handle->inotify_file_descriptor,
+					                                           follow_handle->filename,
+					                                           FOLLOW_HANDLE_INOTIFY_EVENTS );
+
+					/* If the replacement file cannot be watched it is polled instead
+					 */
+					if( follow_handle->inotify_watch_descriptor == -1 )
+					{
+						close(
+						 follow_handle->inotify_file_descriptor );
+
+						follow_handle->inotify_file_descriptor = -1;
+					}
+				}
+#endif
+				return( 2 );
+			}
+		}
+#endif
+		return( 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Follow handle
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+
+#if !defined( _FOLLOW_HANDLE_H )
+#define _FOLLOW_HANDLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default number of seconds between checks for changes
+ */
+#define FOLLOW_HANDLE_DEFAULT_POLL_INTERVAL	1
+
+typedef struct follow_handle follow_handle_t;
+
+struct follow_handle
+{
+	/* The filename of the followed file
+	 */
+	const system_character_t *filename;
+
+	/* The inotify file descriptor or -1 if changes are polled
+	 */
+	int inotify_file_descriptor;
+
+	/* The inotify watch descriptor or -1 if not set
+	 */
+	int inotify_watch_descriptor;
+
+	/* The device number of the followed file
+	 */
+	uint64_t device_number;
+
+	/* The inode number of the followed file
+	 */
+	uint64_t inode_number;
+
+	/* Value to indicate if the device and inode number are set
+	 */
+	uint8_t has_inode_number;
+
+	/* The number of seconds between checks for changes
+	 */
+	int poll_interval;
+
+	/* Value to indicate if abort was signalled
+	 */
+	int abort;
+};
+
+int follow_handle_initialize(
+     follow_handle_t **follow_handle,
+     libcerror_error_t **error );
+
+int follow_handle_free(
+     follow_handle_t **follow_handle,
+     libcerror_error_t **error );
+
+int follow_handle_signal_abort(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error );
+
+int follow_handle_open(
+     follow_handle_t *follow_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
+int follow_handle_close(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error );
+
+int follow_handle_wait(
+     follow_handle_t *follow_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FOLLOW_HANDLE_H ) */
+
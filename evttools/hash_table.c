@@ -0,0 +1,806 @@
+/*
+ * Hash table
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "hash_table.h"
+
+/* Creates a hash table
+ * Make sure the value hash_table is referencing, is set to NULL
+ * The value free function is used to free the values that are replaced or
+ * removed, a value free function of NULL means the values are not managed
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_initialize(
+     hash_table_t **hash_table,
+     int number_of_buckets,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "hash_table_initialize";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid hash table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( hash_table_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*hash_table = memory_allocate_structure(
+	               hash_table_t );
+
+	if( *hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *hash_table,
+	     0,
+	     sizeof( hash_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear hash table.",
+		 function );
+
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+
+		return( -1 );
+	}
+	( *hash_table )->buckets = (hash_table_entry_t **) memory_allocate(
+	                                                    sizeof( hash_table_entry_t * ) * number_of_buckets );
+
+	if( ( *hash_table )->buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *hash_table )->buckets,
+	     0,
+	     sizeof( hash_table_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		goto on_error;
+	}
+	( *hash_table )->number_of_buckets   = number_of_buckets;
+	( *hash_table )->value_free_function = value_free_function;
+
+	return( 1 );
+
+on_error:
+	if( *hash_table != NULL )
+	{
+		if( ( *hash_table )->buckets != NULL )
+		{
+			memory_free(
+			 ( *hash_table )->buckets );
+		}
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a hash table
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_free(
+     hash_table_t **hash_table,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_table_free";
+	int result            = 1;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *hash_table != NULL )
+	{
+		if( hash_table_empty(
+		     *hash_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty hash table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 ( *hash_table )->buckets );
+
+		memory_free(
+		 *hash_table );
+
+		*hash_table = NULL;
+	}
+	return( result );
+}
+
+/* Empties a hash table and frees the values
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_empty(
+     hash_table_t *hash_table,
+     libcerror_error_t **error )
+{
+	hash_table_entry_t *entry      = NULL;
+	hash_table_entry_t *next_entry = NULL;
+	static char *function          = "hash_table_empty";
+	int bucket_index               = 0;
+	int result                     = 1;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < hash_table->number_of_buckets;
+	     bucket_index++ )
+	{
+		entry = hash_table->buckets[ bucket_index ];
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			if( ( hash_table->value_free_function != NULL )
+			 && ( entry->value != NULL ) )
+			{
+				if( hash_table->value_free_function(
+				     &( entry->value ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free value.",
+					 function );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 entry->key );
+
+			memory_free(
+			 entry );
+
+			entry = next_entry;
+		}
+		hash_table->buckets[ bucket_index ] = NULL;
+	}
+	hash_table->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Calculates the hash of a key
+ * The hash is a 32-bit Fowler-Noll-Vo (FNV-1a) hash
+ * Returns the hash
+ */
+uint32_t hash_table_calculate_hash(
+          const uint8_t *key,
+          size_t key_size )
+{
+	size_t key_index = 0;
+	uint32_t hash    = 0x811c9dc5UL;
+
+	if( key == NULL )
+	{
+		return( 0 );
+	}
+	for( key_index = 0;
+	     key_index < key_size;
+	     key_index++ )
+	{
+		hash ^= key[ key_index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Resizes the hash table to a specific number of buckets
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_resize(
+     hash_table_t *hash_table,
+     int number_of_buckets,
+     libcerror_error_t **error )
+{
+	hash_table_entry_t **buckets   = NULL;
+	hash_table_entry_t *entry      = NULL;
+	hash_table_entry_t *next_entry = NULL;
+	static char *function          = "hash_table_resize";
+	int bucket_index               = 0;
+	int entry_bucket_index         = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_buckets <= 0 )
+	 || ( (size_t) number_of_buckets > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( hash_table_entry_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of buckets value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	buckets = (hash_table_entry_t **) memory_allocate(
+	                                   sizeof( hash_table_entry_t * ) * number_of_buckets );
+
+	if( buckets == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buckets.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     buckets,
+	     0,
+	     sizeof( hash_table_entry_t * ) * number_of_buckets ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear buckets.",
+		 function );
+
+		memory_free(
+		 buckets );
+
+		return( -1 );
+	}
+	for( bucket_index = 0;
+	     bucket_index < hash_table->number_of_buckets;
+	     bucket_index++ )
+	{
+		entry = hash_table->buckets[ bucket_index ];
+
+		while( entry != NULL )
+		{
+			next_entry = entry->next_entry;
+
+			entry_bucket_index = (int) ( entry->hash % (uint32_t) number_of_buckets );
+
+			entry->next_entry             = buckets[ entry_bucket_index ];
+			buckets[ entry_bucket_index ] = entry;
+
+			entry = next_entry;
+		}
+	}
+	memory_free(
+	 hash_table->buckets );
+
+	hash_table->buckets           = buckets;
+	hash_table->number_of_buckets = number_of_buckets;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_get_number_of_entries(
+     hash_table_t *hash_table,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "hash_table_get_number_of_entries";
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = hash_table->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the value of a specific key
+ * The value is managed by the hash table, a stored value can be NULL
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int hash_table_get_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     intptr_t **value,
+     libcerror_error_t **error )
+{
+	hash_table_entry_t *entry = NULL;
+	static char *function     = "hash_table_get_value_by_key";
+	uint32_t hash             = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	hash = hash_table_calculate_hash(
+	        key,
+	        key_size );
+
+	entry = hash_table->buckets[ hash % (uint32_t) hash_table->number_of_buckets ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->hash == hash )
+		 && ( entry->key_size == key_size )
+		 && ( memory_compare(
+		       entry->key,
+		       key,
+		       key_size ) == 0 ) )
+		{
+			*value = entry->value;
+
+			return( 1 );
+		}
+		entry = entry->next_entry;
+	}
+	return( 0 );
+}
+
+/* Sets the value of a specific key
+ * The value of an existing key is replaced and freed
+ * The hash table is resized when it contains more than 2 entries per bucket
+ * Returns 1 if successful or -1 on error
+ */
+int hash_table_set_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	hash_table_entry_t *entry = NULL;
+	static char *function     = "hash_table_set_value_by_key";
+	uint32_t hash             = 0;
+	int bucket_index          = 0;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_size == 0 )
+	 || ( key_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid key size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	hash = hash_table_calculate_hash(
+	        key,
+	        key_size );
+
+	bucket_index = (int) ( hash % (uint32_t) hash_table->number_of_buckets );
+
+	entry = hash_table->buckets[ bucket_index ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->hash == hash )
+		 && ( entry->key_size == key_size )
+		 && ( memory_compare(
+		       entry->key,
+		       key,
+		       key_size ) == 0 ) )
+		{
+			break;
+		}
+		entry = entry->next_entry;
+	}
+	if( entry != NULL )
+	{
+		if( ( hash_table->value_free_function != NULL )
+		 && ( entry->value != NULL )
+		 && ( entry->value != value ) )
+		{
+			if( hash_table->value_free_function(
+			     &( entry->value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		entry->value = value;
+
+		return( 1 );
+	}
+	if( hash_table->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid hash table - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry = memory_allocate_structure(
+	         hash_table_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( hash_table_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	entry->key = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * key_size );
+
+	if( entry->key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     entry->key,
+	     key,
+	     key_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		goto on_error;
+	}
+	entry->key_size   = key_size;
+	entry->hash       = hash;
+	entry->value      = value;
+	entry->next_entry = hash_table->buckets[ bucket_index ];
+
+	hash_table->buckets[ bucket_index ] = entry;
+	hash_table->number_of_entries      += 1;
+
+	/* Resizing the hash table is not essential hence a failure is ignored
+	 */
+	if( ( hash_table->number_of_entries / 2 ) > hash_table->number_of_buckets )
+	{
+		if( hash_table->number_of_buckets <= ( INT_MAX / 4 ) )
+		{
+			hash_table_resize(
+			 hash_table,
+			 hash_table->number_of_buckets * 4,
+			 NULL );
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->key != NULL )
+		{
+			memory_free(
+			 entry->key );
+		}
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
+
+/* Removes the value of a specific key
+ * The value is freed if the hash table has a value free function
+ * Returns 1 if successful, 0 if no such key or -1 on error
+ */
+int hash_table_remove_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error )
+{
+	hash_table_entry_t *entry          = NULL;
+	hash_table_entry_t *previous_entry = NULL;
+	static char *function              = "hash_table_remove_value_by_key";
+	uint32_t hash                      = 0;
+	int bucket_index                   = 0;
+	int result                         = 1;
+
+	if( hash_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	hash = hash_table_calculate_hash(
+	        key,
+	        key_size );
+
+	bucket_index = (int) ( hash % (uint32_t) hash_table->number_of_buckets );
+
+	entry = hash_table->buckets[ bucket_index ];
+
+	while( entry != NULL )
+	{
+		if( ( entry->hash == hash )
+		 && ( entry->key_size == key_size )
+		 && ( memory_compare(
+		       entry->key,
+		       key,
+		       key_size ) == 0 ) )
+		{
+			break;
+		}
+		previous_entry = entry;
+		entry          = entry->next_entry;
+	}
+	if( entry == NULL )
+	{
+		return( 0 );
+	}
+	if( previous_entry == NULL )
+	{
+		hash_table->buckets[ bucket_index ] = entry->next_entry;
+	}
+	else
+	{
+		previous_entry->next_entry = entry->next_entry;
+	}
+	hash_table->number_of_entries -= 1;
+
+	if( ( hash_table->value_free_function != NULL )
+	 && ( entry->value != NULL ) )
+	{
+		if( hash_table->value_free_function(
+		     &( entry->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			result = -1;
+		}
+	}
+	memory_free(
+	 entry->key );
+
+	memory_free(
+	 entry );
+
+	return( result );
+}
+
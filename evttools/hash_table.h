@@ -0,0 +1,137 @@
+/*
+ * Hash table
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _HASH_TABLE_H )
+#define _HASH_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct hash_table_entry hash_table_entry_t;
+
+struct hash_table_entry
+{
+	/* The key
+	 */
+	uint8_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The hash of the key
+	 */
+	uint32_t hash;
+
+	/* The value
+	 */
+	intptr_t *value;
+
+	/* The next entry in the same bucket
+	 */
+	hash_table_entry_t *next_entry;
+};
+
+typedef struct hash_table hash_table_t;
+
+struct hash_table
+{
+	/* The buckets
+	 */
+	hash_table_entry_t **buckets;
+
+	/* The number of buckets
+	 */
+	int number_of_buckets;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The value free function
+	 */
+	int (*value_free_function)(
+	       intptr_t **value,
+	       libcerror_error_t **error );
+};
+
+int hash_table_initialize(
+     hash_table_t **hash_table,
+     int number_of_buckets,
+     int (*value_free_function)(
+            intptr_t **value,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int hash_table_free(
+     hash_table_t **hash_table,
+     libcerror_error_t **error );
+
+int hash_table_empty(
+     hash_table_t *hash_table,
+     libcerror_error_t **error );
+
+uint32_t hash_table_calculate_hash(
+          const uint8_t *key,
+          size_t key_size );
+
+int hash_table_resize(
+     hash_table_t *hash_table,
+     int number_of_buckets,
+     libcerror_error_t **error );
+
+int hash_table_get_number_of_entries(
+     hash_table_t *hash_table,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int hash_table_get_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     intptr_t **value,
+     libcerror_error_t **error );
+
+int hash_table_set_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int hash_table_remove_value_by_key(
+     hash_table_t *hash_table,
+     const uint8_t *key,
+     size_t key_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _HASH_TABLE_H ) */
+
@@ -0,0 +1,1770 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <byte_stream.h>
+#include <common.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evt_message_catalog.h"
+#include "evttools_libbfio.h"
+#include "evttools_libcerror.h"
+#include "evttools_libuna.h"
+#include "hash_table.h"
+#include "message_catalog.h"
+#include "message_string.h"
+#include "resource_file_cache.h"
+
+const uint8_t evt_message_catalog_signature[ 8 ] = { 'E', 'V', 'T', 'C', 'A', 'T', 0x00, 0x00 };
+
+/* Creates a message catalog
+ * Make sure the value message_catalog is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_initialize";
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_catalog = memory_allocate_structure(
+	                    message_catalog_t );
+
+	if( *message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_catalog,
+	     0,
+	     sizeof( message_catalog_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message catalog.",
+		 function );
+
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( *message_catalog != NULL )
+	{
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message catalog
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_free";
+	int result            = 1;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_catalog != NULL )
+	{
+		if( message_catalog_close(
+		     *message_catalog,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close message catalog.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *message_catalog );
+
+		*message_catalog = NULL;
+	}
+	return( result );
+}
+
+/* Opens a message catalog
+ * The message catalog file is read into memory and only the event source values
+ * of a specific event log are made available
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_open(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	static char *function            = "message_catalog_open";
+	size64_t file_size               = 0;
+	size_t filename_length           = 0;
+	ssize_t read_count               = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#else
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set file IO handle filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_size < (size64_t) sizeof( evt_message_catalog_header_t ) )
+	 || ( file_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	message_catalog->data = (uint8_t *) memory_allocate(
+	                                     sizeof( uint8_t ) * (size_t) file_size );
+
+	if( message_catalog->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	message_catalog->data_size = (size_t) file_size;
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              message_catalog->data,
+	              message_catalog->data_size,
+	              error );
+
+	if( read_count != (ssize_t) message_catalog->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_catalog_read_data(
+	     message_catalog,
+	     eventlog_key_name,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read message catalog data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	message_catalog_close(
+	 message_catalog,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Closes a message catalog
+ * Returns 0 if successful or -1 on error
+ */
+int message_catalog_close(
+     message_catalog_t *message_catalog,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_close";
+	uint32_t message_index = 0;
+	int result            = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->event_source_values != NULL )
+	{
+		if( hash_table_free(
+		     &( message_catalog->event_source_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event source values hash table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( message_catalog->message_files != NULL )
+	{
+		if( hash_table_free(
+		     &( message_catalog->message_files ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message files hash table.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( message_catalog->message_strings != NULL )
+	{
+		for( message_index = 0;
+		     message_index < message_catalog->number_of_messages;
+		     message_index++ )
+		{
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+			/* The strings are converted from UTF-8 on first use
+			 */
+			if( message_catalog->message_strings[ message_index ].string != NULL )
+			{
+				memory_free(
+				 message_catalog->message_strings[ message_index ].string );
+			}
+#endif
+			if( message_catalog->message_strings[ message_index ].segments != NULL )
+			{
+				memory_free(
+				 message_catalog->message_strings[ message_index ].segments );
+			}
+			if( message_catalog->message_strings[ message_index ].text != NULL )
+			{
+				memory_free(
+				 message_catalog->message_strings[ message_index ].text );
+			}
+		}
+		memory_free(
+		 message_catalog->message_strings );
+
+		message_catalog->message_strings = NULL;
+	}
+	if( message_catalog->data != NULL )
+	{
+		memory_free(
+		 message_catalog->data );
+
+		message_catalog->data = NULL;
+	}
+	message_catalog->data_size            = 0;
+	message_catalog->message_entries_data = NULL;
+	message_catalog->number_of_messages   = 0;
+	message_catalog->strings_data         = NULL;
+	message_catalog->strings_data_size    = 0;
+
+	return( result );
+}
+
+/* Reads the message catalog data
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_read_data(
+     message_catalog_t *message_catalog,
+     const char *eventlog_key_name,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_event_source_value_entry_t *event_source_value_entry = NULL;
+	evt_message_catalog_header_t *header                                     = NULL;
+	evt_message_catalog_message_file_entry_t *message_file_entry             = NULL;
+	system_character_t *event_source                                         = NULL;
+	system_character_t *key                                                  = NULL;
+	system_character_t *resource_filename                                    = NULL;
+	system_character_t *value_name                                           = NULL;
+	const uint8_t *event_log_name                                            = NULL;
+	intptr_t *existing_value                                                 = NULL;
+	static char *function                                                    = "message_catalog_read_data";
+	size64_t expected_data_size                                              = 0;
+	size_t data_offset                                                       = 0;
+	size_t event_log_name_size                                               = 0;
+	size_t event_source_size                                                 = 0;
+	size_t eventlog_key_name_length                                          = 0;
+	size_t key_size                                                          = 0;
+	size_t resource_filename_size                                            = 0;
+	size_t value_name_size                                                   = 0;
+	uint32_t entry_index                                                     = 0;
+	uint32_t first_message_index                                             = 0;
+	uint32_t format_version                                                  = 0;
+	uint32_t number_of_event_source_values                                   = 0;
+	uint32_t number_of_message_files                                         = 0;
+	uint32_t number_of_messages                                              = 0;
+	uint32_t string_offset                                                   = 0;
+	uint32_t strings_data_size                                               = 0;
+	int result                                                               = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message catalog - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_catalog->event_source_values != NULL )
+	 || ( message_catalog->message_files != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message catalog - hash tables already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( eventlog_key_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid eventlog key name.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->data_size < sizeof( evt_message_catalog_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message catalog - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	header = (evt_message_catalog_header_t *) message_catalog->data;
+
+	if( memory_compare(
+	     header->signature,
+	     evt_message_catalog_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_event_source_values,
+	 number_of_event_source_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_message_files,
+	 number_of_message_files );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->number_of_messages,
+	 number_of_messages );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 header->strings_data_size,
+	 strings_data_size );
+
+	if( format_version != MESSAGE_CATALOG_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		goto on_error;
+	}
+	expected_data_size = (size64_t) sizeof( evt_message_catalog_header_t )
+	                   + ( (size64_t) number_of_event_source_values * sizeof( evt_message_catalog_event_source_value_entry_t ) )
+	                   + ( (size64_t) number_of_message_files * sizeof( evt_message_catalog_message_file_entry_t ) )
+	                   + ( (size64_t) number_of_messages * sizeof( evt_message_catalog_message_entry_t ) )
+	                   + strings_data_size;
+
+	if( expected_data_size != (size64_t) message_catalog->data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message catalog - data size does not match number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	data_offset = sizeof( evt_message_catalog_header_t )
+	            + ( (size_t) number_of_event_source_values * sizeof( evt_message_catalog_event_source_value_entry_t ) );
+
+	message_file_entry = (evt_message_catalog_message_file_entry_t *) &( message_catalog->data[ data_offset ] );
+
+	data_offset += (size_t) number_of_message_files * sizeof( evt_message_catalog_message_file_entry_t );
+
+	message_catalog->message_entries_data = &( message_catalog->data[ data_offset ] );
+	message_catalog->number_of_messages   = number_of_messages;
+
+	data_offset += (size_t) number_of_messages * sizeof( evt_message_catalog_message_entry_t );
+
+	message_catalog->strings_data      = &( message_catalog->data[ data_offset ] );
+	message_catalog->strings_data_size = (size_t) strings_data_size;
+
+	/* The last string in the strings data must be terminated by an end-of-string character
+	 */
+	if( ( strings_data_size > 0 )
+	 && ( message_catalog->strings_data[ strings_data_size - 1 ] != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid message catalog - unsupported strings data.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_initialize(
+	     &( message_catalog->event_source_values ),
+	     64,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event source values hash table.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_initialize(
+	     &( message_catalog->message_files ),
+	     64,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create message files hash table.",
+		 function );
+
+		goto on_error;
+	}
+	eventlog_key_name_length = narrow_string_length(
+	                            eventlog_key_name );
+
+	event_source_value_entry = (evt_message_catalog_event_source_value_entry_t *) &( message_catalog->data[ sizeof( evt_message_catalog_header_t ) ] );
+
+	for( entry_index = 0;
+	     entry_index < number_of_event_source_values;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 event_source_value_entry->event_log_name_offset,
+		 string_offset );
+
+		if( message_catalog_get_utf8_string(
+		     message_catalog,
+		     string_offset,
+		     &event_log_name,
+		     &event_log_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value: %" PRIu32 " event log name.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* The event log names are compared case insensitive like the Windows Registry key names
+		 */
+		if( ( event_log_name_size != ( eventlog_key_name_length + 1 ) )
+		 || ( narrow_string_compare_no_case(
+		       (char *) event_log_name,
+		       eventlog_key_name,
+		       eventlog_key_name_length ) != 0 ) )
+		{
+			event_source_value_entry++;
+
+			continue;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 event_source_value_entry->event_source_offset,
+		 string_offset );
+
+		if( message_catalog_get_string(
+		     message_catalog,
+		     string_offset,
+		     &event_source,
+		     &event_source_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value: %" PRIu32 " event source.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 event_source_value_entry->value_name_offset,
+		 string_offset );
+
+		if( message_catalog_get_string(
+		     message_catalog,
+		     string_offset,
+		     &value_name,
+		     &value_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value: %" PRIu32 " value name.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* The value string is validated here so that it can be retrieved without checks later
+		 */
+		byte_stream_copy_to_uint32_little_endian(
+		 event_source_value_entry->value_string_offset,
+		 string_offset );
+
+		if( string_offset >= strings_data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid event source value: %" PRIu32 " value string offset value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( message_catalog_get_event_source_value_key(
+		     event_source,
+		     event_source_size - 1,
+		     value_name,
+		     value_name_size - 1,
+		     &key,
+		     &key_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value: %" PRIu32 " key.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* If the message catalog contains the same event source value more than once the first is used
+		 */
+		result = hash_table_get_value_by_key(
+		          message_catalog->event_source_values,
+		          (uint8_t *) key,
+		          key_size,
+		          &existing_value,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event source value: %" PRIu32 " from hash table.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( hash_table_set_value_by_key(
+			     message_catalog->event_source_values,
+			     (uint8_t *) key,
+			     key_size,
+			     (intptr_t *) event_source_value_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set event source value: %" PRIu32 " in hash table.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+		}
+		memory_free(
+		 key );
+
+		key = NULL;
+
+		memory_free(
+		 value_name );
+
+		value_name = NULL;
+
+		memory_free(
+		 event_source );
+
+		event_source = NULL;
+
+		event_source_value_entry++;
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_message_files;
+	     entry_index++ )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 message_file_entry->first_message_index,
+		 first_message_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 message_file_entry->number_of_messages,
+		 number_of_messages );
+
+		if( ( first_message_index > message_catalog->number_of_messages )
+		 || ( number_of_messages > ( message_catalog->number_of_messages - first_message_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid message file: %" PRIu32 " messages value out of bounds.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 message_file_entry->resource_filename_offset,
+		 string_offset );
+
+		if( message_catalog_get_string(
+		     message_catalog,
+		     string_offset,
+		     &resource_filename,
+		     &resource_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message file: %" PRIu32 " resource filename.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( resource_filename_size > 1 )
+		{
+			if( resource_file_cache_get_key(
+			     resource_filename,
+			     resource_filename_size - 1,
+			     &key,
+			     &key_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message file: %" PRIu32 " key.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			result = hash_table_get_value_by_key(
+			          message_catalog->message_files,
+			          (uint8_t *) key,
+			          key_size,
+			          &existing_value,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve message file: %" PRIu32 " from hash table.",
+				 function,
+				 entry_index );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				if( hash_table_set_value_by_key(
+				     message_catalog->message_files,
+				     (uint8_t *) key,
+				     key_size,
+				     (intptr_t *) message_file_entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set message file: %" PRIu32 " in hash table.",
+					 function,
+					 entry_index );
+
+					goto on_error;
+				}
+			}
+			memory_free(
+			 key );
+
+			key = NULL;
+		}
+		memory_free(
+		 resource_filename );
+
+		resource_filename = NULL;
+
+		message_file_entry++;
+	}
+	if( message_catalog->number_of_messages > 0 )
+	{
+		if( (size_t) message_catalog->number_of_messages > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( message_string_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid message catalog - number of messages value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		message_catalog->message_strings = (message_string_t *) memory_allocate(
+		                                                         sizeof( message_string_t ) * message_catalog->number_of_messages );
+
+		if( message_catalog->message_strings == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create message strings.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     message_catalog->message_strings,
+		     0,
+		     sizeof( message_string_t ) * message_catalog->number_of_messages ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear message strings.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	if( resource_filename != NULL )
+	{
+		memory_free(
+		 resource_filename );
+	}
+	if( value_name != NULL )
+	{
+		memory_free(
+		 value_name );
+	}
+	if( event_source != NULL )
+	{
+		memory_free(
+		 event_source );
+	}
+	if( message_catalog->message_strings != NULL )
+	{
+		memory_free(
+		 message_catalog->message_strings );
+
+		message_catalog->message_strings = NULL;
+	}
+	if( message_catalog->message_files != NULL )
+	{
+		hash_table_free(
+		 &( message_catalog->message_files ),
+		 NULL );
+	}
+	if( message_catalog->event_source_values != NULL )
+	{
+		hash_table_free(
+		 &( message_catalog->event_source_values ),
+		 NULL );
+	}
+	message_catalog->message_entries_data = NULL;
+	message_catalog->number_of_messages   = 0;
+	message_catalog->strings_data         = NULL;
+	message_catalog->strings_data_size    = 0;
+
+	return( -1 );
+}
+
+/* Retrieves an UTF-8 string from the strings data
+ * The UTF-8 string references the strings data
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_get_utf8_string(
+     message_catalog_t *message_catalog,
+     uint32_t string_offset,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_catalog_get_utf8_string";
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog->strings_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message catalog - missing strings data.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) string_offset >= message_catalog->strings_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The strings data is terminated by an end-of-string character
+	 * which is checked when the message catalog is read
+	 */
+	*utf8_string      = &( message_catalog->strings_data[ string_offset ] );
+	*utf8_string_size = narrow_string_length(
+	                     (char *) *utf8_string ) + 1;
+
+	return( 1 );
+}
+
+/* Retrieves a string from the strings data
+ * The string is converted from UTF-8 and must be freed after use
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_get_string(
+     message_catalog_t *message_catalog,
+     uint32_t string_offset,
+     system_character_t **string,
+     size_t *string_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *utf8_string = NULL;
+	static char *function      = "message_catalog_get_string";
+	size_t utf8_string_size    = 0;
+	int result                 = 0;
+
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_get_utf8_string(
+	     message_catalog,
+	     string_offset,
+	     &utf8_string,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libuna_utf16_string_size_from_utf8(
+	          utf8_string,
+	          utf8_string_size,
+	          string_size,
+	          error );
+#else
+	*string_size = utf8_string_size;
+
+	result = 1;
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine string size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( *string_size == 0 )
+	 || ( *string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	*string = system_string_allocate(
+	           *string_size );
+
+	if( *string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create string.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	result = libuna_utf16_string_copy_from_utf8(
+	          (libuna_utf16_character_t *) *string,
+	          *string_size,
+	          utf8_string,
+	          utf8_string_size,
+	          error );
+#else
+	if( memory_copy(
+	     *string,
+	     utf8_string,
+	     utf8_string_size ) == NULL )
+	{
+		result = -1;
+	}
+	else
+	{
+		result = 1;
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy string.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *string != NULL )
+	{
+		memory_free(
+		 *string );
+
+		*string = NULL;
+	}
+	*string_size = 0;
+
+	return( -1 );
+}
+
+/* Determines the key of a specific event source value
+ * The key consists of the value name and the event source in lower case
+ * separated by an end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int message_catalog_get_event_source_value_key(
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **key,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_key = NULL;
+	static char *function        = "message_catalog_get_event_source_value_key";
+	size_t key_index             = 0;
+	size_t key_length            = 0;
+
+	if( event_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event source.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	key_length = value_name_length + 1 + event_source_length;
+
+	safe_key = system_string_allocate(
+	            key_length );
+
+	if( safe_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     safe_key,
+	     value_name,
+	     sizeof( system_character_t ) * value_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value name to key.",
+		 function );
+
+		goto on_error;
+	}
+	safe_key[ value_name_length ] = 0;
+
+	if( memory_copy(
+	     &( safe_key[ value_name_length + 1 ] ),
+	     event_source,
+	     sizeof( system_character_t ) * event_source_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy event source to key.",
+		 function );
+
+		goto on_error;
+	}
+	/* The Windows Registry key and value names are case insensitive
+	 */
+	for( key_index = 0;
+	     key_index < key_length;
+	     key_index++ )
+	{
+		if( ( safe_key[ key_index ] >= (system_character_t) 'A' )
+		 && ( safe_key[ key_index ] <= (system_character_t) 'Z' ) )
+		{
+			safe_key[ key_index ] += (system_character_t) ( 'a' - 'A' );
+		}
+	}
+	*key      = safe_key;
+	*key_size = sizeof( system_character_t ) * key_length;
+
+	return( 1 );
+
+on_error:
+	if( safe_key != NULL )
+	{
+		memory_free(
+		 safe_key );
+	}
+	return( -1 );
+}
+
+/* Retrieves a value for a specific event source
+ * The value string must be freed after use
+ * Returns 1 if successful, 0 if no such event source or value or -1 error
+ */
+int message_catalog_get_value_by_event_source(
+     message_catalog_t *message_catalog,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_event_source_value_entry_t *event_source_value_entry = NULL;
+	system_character_t *key                                                  = NULL;
+	static char *function                                                    = "message_catalog_get_value_by_event_source";
+	size_t key_size                                                          = 0;
+	uint32_t string_offset                                                   = 0;
+	int result                                                               = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_catalog_get_event_source_value_key(
+	     event_source,
+	     event_source_length,
+	     value_name,
+	     value_name_length,
+	     &key,
+	     &key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event source value key.",
+		 function );
+
+		goto on_error;
+	}
+	result = hash_table_get_value_by_key(
+	          message_catalog->event_source_values,
+	          (uint8_t *) key,
+	          key_size,
+	          (intptr_t **) &event_source_value_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event source value from hash table.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 key );
+
+	key = NULL;
+
+	if( result != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 event_source_value_entry->value_string_offset,
+		 string_offset );
+
+		if( message_catalog_get_string(
+		     message_catalog,
+		     string_offset,
+		     value_string,
+		     value_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value string.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific message string of a specific resource file
+ * The message string is managed by the message catalog
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	evt_message_catalog_message_entry_t *message_entry           = NULL;
+	evt_message_catalog_message_file_entry_t *message_file_entry = NULL;
+	message_string_t *safe_message_string                        = NULL;
+	system_character_t *key                                      = NULL;
+	static char *function                                        = "message_catalog_get_message_string";
+	size_t key_size                                              = 0;
+	uint32_t entry_identifier                                    = 0;
+	uint32_t lower_message_index                                 = 0;
+	uint32_t message_index                                       = 0;
+	uint32_t number_of_messages                                  = 0;
+	uint32_t string_offset                                       = 0;
+	uint32_t upper_message_index                                 = 0;
+	int result                                                   = 0;
+
+	if( message_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_get_key(
+	     resource_filename,
+	     resource_filename_length,
+	     &key,
+	     &key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message file key.",
+		 function );
+
+		goto on_error;
+	}
+	result = hash_table_get_value_by_key(
+	          message_catalog->message_files,
+	          (uint8_t *) key,
+	          key_size,
+	          (intptr_t **) &message_file_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message file from hash table.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 key );
+
+	key = NULL;
+
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 message_file_entry->first_message_index,
+	 lower_message_index );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 message_file_entry->number_of_messages,
+	 number_of_messages );
+
+	upper_message_index = lower_message_index + number_of_messages;
+
+	/* The message entries of a message file are sorted by identifier
+	 */
+	result = 0;
+
+	while( lower_message_index < upper_message_index )
+	{
+		message_index = lower_message_index + ( ( upper_message_index - lower_message_index ) / 2 );
+
+		message_entry = (evt_message_catalog_message_entry_t *) &( message_catalog->message_entries_data[ message_index * sizeof( evt_message_catalog_message_entry_t ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 message_entry->identifier,
+		 entry_identifier );
+
+		if( message_identifier == entry_identifier )
+		{
+			result = 1;
+
+			break;
+		}
+		else if( message_identifier < entry_identifier )
+		{
+			upper_message_index = message_index;
+		}
+		else
+		{
+			lower_message_index = message_index + 1;
+		}
+	}
+	if( result == 0 )
+	{
+		return( 0 );
+	}
+	safe_message_string = &( message_catalog->message_strings[ message_index ] );
+
+	if( safe_message_string->string == NULL )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 message_entry->string_offset,
+		 string_offset );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = message_catalog_get_string(
+		          message_catalog,
+		          string_offset,
+		          &( safe_message_string->string ),
+		          &( safe_message_string->string_size ),
+		          error );
+#else
+		/* The message string references the strings data
+		 */
+		result = message_catalog_get_utf8_string(
+		          message_catalog,
+		          string_offset,
+		          (const uint8_t **) &( safe_message_string->string ),
+		          &( safe_message_string->string_size ),
+		          error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+			 function,
+			 message_identifier );
+
+			goto on_error;
+		}
+		safe_message_string->identifier = message_identifier;
+	}
+	*message_string = safe_message_string;
+
+	return( 1 );
+
+on_error:
+	if( key != NULL )
+	{
+		memory_free(
+		 key );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,157 @@
+/*
+ * Message catalog
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_CATALOG_H )
+#define _MESSAGE_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "hash_table.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The message catalog format version
+ */
+#define MESSAGE_CATALOG_FORMAT_VERSION	1
+
+extern const uint8_t evt_message_catalog_signature[ 8 ];
+
+typedef struct message_catalog message_catalog_t;
+
+struct message_catalog
+{
+	/* The data
+	 * Contains the entire message catalog file
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The message entries data
+	 */
+	uint8_t *message_entries_data;
+
+	/* The number of message entries
+	 */
+	uint32_t number_of_messages;
+
+	/* The strings data
+	 */
+	uint8_t *strings_data;
+
+	/* The strings data size
+	 */
+	size_t strings_data_size;
+
+	/* The event source values hash table
+	 * Maps the (lower case) value name and event source to the event source value entry
+	 * of the event log the message catalog was opened for
+	 */
+	hash_table_t *event_source_values;
+
+	/* The message files hash table
+	 * Maps the (normalized) resource filename to the message file entry
+	 */
+	hash_table_t *message_files;
+
+	/* The message strings
+	 * Contains a message string per message entry, which is set on first use
+	 */
+	message_string_t *message_strings;
+};
+
+int message_catalog_initialize(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_free(
+     message_catalog_t **message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_open(
+     message_catalog_t *message_catalog,
+     const system_character_t *filename,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
+int message_catalog_close(
+     message_catalog_t *message_catalog,
+     libcerror_error_t **error );
+
+int message_catalog_read_data(
+     message_catalog_t *message_catalog,
+     const char *eventlog_key_name,
+     libcerror_error_t **error );
+
+int message_catalog_get_utf8_string(
+     message_catalog_t *message_catalog,
+     uint32_t string_offset,
+     const uint8_t **utf8_string,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_string(
+     message_catalog_t *message_catalog,
+     uint32_t string_offset,
+     system_character_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_event_source_value_key(
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **key,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_value_by_event_source(
+     message_catalog_t *message_catalog,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int message_catalog_get_message_string(
+     message_catalog_t *message_catalog,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     uint32_t message_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_CATALOG_H ) */
+
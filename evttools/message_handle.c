@@ -39,17 +39,19 @@
 #include "evttools_libcerror.h"
 #include "evttools_libcpath.h"
 #include "evttools_libcsplit.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libevt.h"
-#include "evttools_libfcache.h"
 #include "evttools_libregf.h"
 #include "evttools_libwrc.h"
 #include "evttools_system_split_string.h"
 #include "evttools_wide_string.h"
+#include "message_catalog.h"
 #include "message_handle.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 /* Creates a message handle
  * Make sure the value message_handle is referencing, is set to NULL
@@ -129,9 +131,23 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( hash_table_initialize(
+	     &( ( *message_handle )->event_source_value_cache ),
+	     64,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &message_handle_free_value_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create event source value cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->resource_file_cache ),
-	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -143,9 +159,8 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( resource_file_cache_initialize(
 	     &( ( *message_handle )->mui_resource_file_cache ),
-	     16,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -157,6 +172,21 @@ int message_handle_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *message_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	( *message_handle )->ascii_codepage                = LIBREGF_CODEPAGE_WINDOWS_1252;
 	( *message_handle )->preferred_language_identifier = 0x00000409UL;
 
@@ -165,12 +195,24 @@ int message_handle_initialize(
 on_error:
 	if( *message_handle != NULL )
 	{
+		if( ( *message_handle )->mui_resource_file_cache != NULL )
+		{
+			resource_file_cache_free(
+			 &( ( *message_handle )->mui_resource_file_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->resource_file_cache != NULL )
 		{
-			libfcache_cache_free(
+			resource_file_cache_free(
 			 &( ( *message_handle )->resource_file_cache ),
 			 NULL );
 		}
+		if( ( *message_handle )->event_source_value_cache != NULL )
+		{
+			hash_table_free(
+			 &( ( *message_handle )->event_source_value_cache ),
+			 NULL );
+		}
 		if( ( *message_handle )->path_handle != NULL )
 		{
 			path_handle_free(
@@ -223,6 +265,27 @@ int message_handle_free(
 			memory_free(
 			 ( *message_handle )->registry_directory_name );
 		}
+		if( ( *message_handle )->message_catalog_filename != NULL )
+		{
+			memory_free(
+			 ( *message_handle )->message_catalog_filename );
+		}
+		if( ( *message_handle )->message_catalog != NULL )
+		{
+			if( message_catalog_free(
+			     &( ( *message_handle )->message_catalog ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message catalog.",
+				 function );
+
+				result = -1;
+			}
+		}
 		if( ( *message_handle )->software_registry_file != NULL )
 		{
 			if( registry_file_free(
@@ -249,6 +312,11 @@ int message_handle_free(
 			memory_free(
 			 ( *message_handle )->windows_directory_path );
 		}
+		if( ( *message_handle )->event_source_value_key != NULL )
+		{
+			memory_free(
+			 ( *message_handle )->event_source_value_key );
+		}
 		if( ( *message_handle )->system_registry_file != NULL )
 		{
 			if( registry_file_free(
@@ -278,7 +346,20 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( hash_table_free(
+		     &( ( *message_handle )->event_source_value_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free event source value cache.",
+			 function );
+
+			result = -1;
+		}
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -291,7 +372,7 @@ int message_handle_free(
 
 			result = -1;
 		}
-		if( libfcache_cache_free(
+		if( resource_file_cache_free(
 		     &( ( *message_handle )->mui_resource_file_cache ),
 		     error ) != 1 )
 		{
@@ -352,6 +433,21 @@ int message_handle_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *message_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *message_handle );
 
@@ -415,41 +511,46 @@ int message_handle_signal_abort(
 	return( 1 );
 }
 
-/* Sets the ascii codepage
+/* Frees a value string
  * Returns 1 if successful or -1 on error
  */
-int message_handle_set_ascii_codepage(
-     message_handle_t *message_handle,
-     int ascii_codepage,
+int message_handle_free_value_string(
+     system_character_t **value_string,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_set_ascii_codepage";
+	static char *function = "message_handle_free_value_string";
 
-	if( message_handle == NULL )
+	if( value_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
+		 "%s: invalid value string.",
 		 function );
 
 		return( -1 );
 	}
-	message_handle->ascii_codepage = ascii_codepage;
+	if( *value_string != NULL )
+	{
+		memory_free(
+		 *value_string );
 
+		*value_string = NULL;
+	}
 	return( 1 );
 }
 
-/* Sets the preferred language identifier
+/* Grabs the message handle for exclusive use by the calling thread
+ * The message strings retrieved from the message handle are stored in its caches,
+ * therefore the message handle should remain grabbed while a message string is used
  * Returns 1 if successful or -1 on error
  */
-int message_handle_set_preferred_language_identifier(
+int message_handle_grab(
      message_handle_t *message_handle,
-     uint32_t preferred_language_identifier,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_set_preferred_language_identifier";
+	static char *function = "message_handle_grab";
 
 	if( message_handle == NULL )
 	{
@@ -462,21 +563,32 @@ int message_handle_set_preferred_language_identifier(
 
 		return( -1 );
 	}
-	message_handle->preferred_language_identifier = preferred_language_identifier;
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     message_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
 
+		return( -1 );
+	}
+#endif
 	return( 1 );
 }
 
-/* Sets the name of the software registry file
- * Returns 1 if successful or -1 error
+/* Releases the message handle
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_set_software_registry_filename(
+int message_handle_release(
      message_handle_t *message_handle,
-     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	static char *function  = "message_handle_set_software_registry_filename";
-	size_t filename_length = 0;
+	static char *function = "message_handle_release";
 
 	if( message_handle == NULL )
 	{
@@ -489,95 +601,157 @@ int message_handle_set_software_registry_filename(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     message_handle->mutex,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
 		 function );
 
 		return( -1 );
 	}
-	filename_length = system_string_length(
-	                   filename );
+#endif
+	return( 1 );
+}
 
-	if( filename_length > (size_t) SSIZE_MAX )
+/* Copies the settings, such as the codepage, the registry and resource files paths
+ * and the resource file cache maximum values, from the source to the destination message handle
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_copy_settings(
+     message_handle_t *destination_message_handle,
+     message_handle_t *source_message_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_copy_settings";
+
+	if( destination_message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filename length value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination message handle.",
 		 function );
 
-		goto on_error;
-	}
-	if( message_handle->software_registry_filename != NULL )
-	{
-		memory_free(
-		 message_handle->software_registry_filename );
-
-		message_handle->software_registry_filename = NULL;
+		return( -1 );
 	}
-	message_handle->software_registry_filename_size = filename_length + 1;
-
-	message_handle->software_registry_filename = system_string_allocate(
-	                                              message_handle->software_registry_filename_size );
-
-	if( message_handle->software_registry_filename == NULL )
+	if( source_message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create software registry filename.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source message handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( system_string_copy(
-	     message_handle->software_registry_filename,
-	     filename,
-	     filename_length ) == NULL )
+	destination_message_handle->ascii_codepage                = source_message_handle->ascii_codepage;
+	destination_message_handle->preferred_language_identifier = source_message_handle->preferred_language_identifier;
+	destination_message_handle->resource_files_path           = source_message_handle->resource_files_path;
+
+	if( message_handle_set_resource_file_cache_maximum_values(
+	     destination_message_handle,
+	     source_message_handle->resource_file_cache->maximum_number_of_entries,
+	     source_message_handle->resource_file_cache->maximum_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy software registry filename.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file cache maximum values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	( message_handle->software_registry_filename )[ filename_length ] = 0;
 
-	return( 1 );
+	if( source_message_handle->software_registry_filename != NULL )
+	{
+		if( message_handle_set_software_registry_filename(
+		     destination_message_handle,
+		     source_message_handle->software_registry_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set software registry filename.",
+			 function );
 
-on_error:
-	if( message_handle->software_registry_filename != NULL )
+			return( -1 );
+		}
+	}
+	if( source_message_handle->system_registry_filename != NULL )
 	{
-		memory_free(
-		 message_handle->software_registry_filename );
+		if( message_handle_set_system_registry_filename(
+		     destination_message_handle,
+		     source_message_handle->system_registry_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set system registry filename.",
+			 function );
 
-		message_handle->software_registry_filename = NULL;
+			return( -1 );
+		}
 	}
-	message_handle->software_registry_filename_size = 0;
+	if( source_message_handle->registry_directory_name != NULL )
+	{
+		if( message_handle_set_registry_directory_name(
+		     destination_message_handle,
+		     source_message_handle->registry_directory_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set registry directory name.",
+			 function );
 
-	return( -1 );
+			return( -1 );
+		}
+	}
+	if( source_message_handle->message_catalog_filename != NULL )
+	{
+		if( message_handle_set_message_catalog_filename(
+		     destination_message_handle,
+		     source_message_handle->message_catalog_filename,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set message catalog filename.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
 }
 
-/* Sets the name of the system registry file
- * Returns 1 if successful or -1 error
+/* Sets the ascii codepage
+ * Returns 1 if successful or -1 on error
  */
-int message_handle_set_system_registry_filename(
+int message_handle_set_ascii_codepage(
      message_handle_t *message_handle,
-     const system_character_t *filename,
+     int ascii_codepage,
      libcerror_error_t **error )
 {
-	static char *function  = "message_handle_set_system_registry_filename";
-	size_t filename_length = 0;
+	static char *function = "message_handle_set_ascii_codepage";
 
 	if( message_handle == NULL )
 	{
@@ -590,28 +764,239 @@ int message_handle_set_system_registry_filename(
 
 		return( -1 );
 	}
-	if( filename == NULL )
+	message_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the preferred language identifier
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_preferred_language_identifier(
+     message_handle_t *message_handle,
+     uint32_t preferred_language_identifier,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_preferred_language_identifier";
+
+	if( message_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid filename.",
+		 "%s: invalid message handle.",
 		 function );
 
 		return( -1 );
 	}
-	filename_length = system_string_length(
-	                   filename );
-
-	if( filename_length > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid filename length value out of bounds.",
-		 function );
+	message_handle->preferred_language_identifier = preferred_language_identifier;
+
+	return( 1 );
+}
+
+/* Sets the maximum number of resource files and the maximum size of their resource sections
+ * of the resource file caches
+ * A maximum size of 0 represents no maximum
+ * Returns 1 if successful or -1 on error
+ */
+int message_handle_set_resource_file_cache_maximum_values(
+     message_handle_t *message_handle,
+     int maximum_number_of_resource_files,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_set_resource_file_cache_maximum_values";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_values(
+	     message_handle->resource_file_cache,
+	     maximum_number_of_resource_files,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum values of resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_set_maximum_values(
+	     message_handle->mui_resource_file_cache,
+	     maximum_number_of_resource_files,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set maximum values of MUI resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the name of the software registry file
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_set_software_registry_filename(
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "message_handle_set_software_registry_filename";
+	size_t filename_length = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( message_handle->software_registry_filename != NULL )
+	{
+		memory_free(
+		 message_handle->software_registry_filename );
+
+		message_handle->software_registry_filename = NULL;
+	}
+	message_handle->software_registry_filename_size = filename_length + 1;
+
+	message_handle->software_registry_filename = system_string_allocate(
+	                                              message_handle->software_registry_filename_size );
+
+	if( message_handle->software_registry_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create software registry filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     message_handle->software_registry_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy software registry filename.",
+		 function );
+
+		goto on_error;
+	}
+	( message_handle->software_registry_filename )[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( message_handle->software_registry_filename != NULL )
+	{
+		memory_free(
+		 message_handle->software_registry_filename );
+
+		message_handle->software_registry_filename = NULL;
+	}
+	message_handle->software_registry_filename_size = 0;
+
+	return( -1 );
+}
+
+/* Sets the name of the system registry file
+ * Returns 1 if successful or -1 error
+ */
+int message_handle_set_system_registry_filename(
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error )
+{
+	static char *function  = "message_handle_set_system_registry_filename";
+	size_t filename_length = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
+
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
 
 		goto on_error;
 	}
@@ -807,23 +1192,16 @@ int message_handle_set_resource_files_path(
 	return( 1 );
 }
 
-/* Opens the software registry file
- * Returns 1 if successful, 0 if not available or -1 on error
+/* Sets the message catalog filename
+ * Returns 1 if successful or -1 error
  */
-int message_handle_open_software_registry_file(
+int message_handle_set_message_catalog_filename(
      message_handle_t *message_handle,
+     const system_character_t *filename,
      libcerror_error_t **error )
 {
-	system_character_t *key_path          = NULL;
-	system_character_t *software_filename = NULL;
-	libregf_key_t *sub_key                = NULL;
-	libregf_value_t *value                = NULL;
-	const char *sub_key_path              = NULL;
-	const char *value_name                = NULL;
-	static char *function                 = "message_handle_open_software_registry_file";
-	size_t key_path_length                = 0;
-	size_t value_name_length              = 0;
-	int result                            = 0;
+	static char *function  = "message_handle_set_message_catalog_filename";
+	size_t filename_length = 0;
 
 	if( message_handle == NULL )
 	{
@@ -836,40 +1214,148 @@ int message_handle_open_software_registry_file(
 
 		return( -1 );
 	}
-	if( ( message_handle->software_registry_filename == NULL )
-	 && ( message_handle->registry_directory_name != NULL ) )
+	if( filename == NULL )
 	{
-		software_filename = system_string_allocate(
-		                     9 );
-
-		if( software_filename == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create software filename.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
 
-			goto on_error;
-		}
-		if( system_string_copy(
-		     software_filename,
-		     _SYSTEM_STRING( "SOFTWARE" ),
-		     8 ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to set software filename.",
-			 function );
+		return( -1 );
+	}
+	filename_length = system_string_length(
+	                   filename );
 
-			goto on_error;
-		}
-		software_filename[ 8 ] = 0;
+	if( filename_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid filename length value out of bounds.",
+		 function );
 
-		result = path_handle_get_directory_entry_name_by_name_no_case(
+		goto on_error;
+	}
+	if( message_handle->message_catalog_filename != NULL )
+	{
+		memory_free(
+		 message_handle->message_catalog_filename );
+
+		message_handle->message_catalog_filename = NULL;
+	}
+	message_handle->message_catalog_filename_size = filename_length + 1;
+
+	message_handle->message_catalog_filename = system_string_allocate(
+	                                            message_handle->message_catalog_filename_size );
+
+	if( message_handle->message_catalog_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message catalog filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     message_handle->message_catalog_filename,
+	     filename,
+	     filename_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy message catalog filename.",
+		 function );
+
+		goto on_error;
+	}
+	( message_handle->message_catalog_filename )[ filename_length ] = 0;
+
+	return( 1 );
+
+on_error:
+	if( message_handle->message_catalog_filename != NULL )
+	{
+		memory_free(
+		 message_handle->message_catalog_filename );
+
+		message_handle->message_catalog_filename = NULL;
+	}
+	message_handle->message_catalog_filename_size = 0;
+
+	return( -1 );
+}
+
+/* Opens the software registry file
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int message_handle_open_software_registry_file(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	system_character_t *key_path          = NULL;
+	system_character_t *software_filename = NULL;
+	libregf_key_t *sub_key                = NULL;
+	libregf_value_t *value                = NULL;
+	const char *sub_key_path              = NULL;
+	const char *value_name                = NULL;
+	static char *function                 = "message_handle_open_software_registry_file";
+	size_t key_path_length                = 0;
+	size_t value_name_length              = 0;
+	int result                            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( message_handle->software_registry_filename == NULL )
+	 && ( message_handle->registry_directory_name != NULL ) )
+	{
+		software_filename = system_string_allocate(
+		                     9 );
+
+		if( software_filename == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create software filename.",
+			 function );
+
+			goto on_error;
+		}
+		if( system_string_copy(
+		     software_filename,
+		     _SYSTEM_STRING( "SOFTWARE" ),
+		     8 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to set software filename.",
+			 function );
+
+			goto on_error;
+		}
+		software_filename[ 8 ] = 0;
+
+		result = path_handle_get_directory_entry_name_by_name_no_case(
 		          message_handle->path_handle,
 			  message_handle->registry_directory_name,
 			  message_handle->registry_directory_name_size - 1,
@@ -1623,6 +2109,41 @@ int message_handle_open_input(
 
 		return( -1 );
 	}
+	if( message_handle->message_catalog_filename != NULL )
+	{
+		/* The message catalog replaces the registry files and resource files
+		 */
+		if( message_catalog_initialize(
+		     &( message_handle->message_catalog ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create message catalog.",
+			 function );
+
+			goto on_error;
+		}
+		if( message_catalog_open(
+		     message_handle->message_catalog,
+		     message_handle->message_catalog_filename,
+		     eventlog_key_name,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open message catalog: %" PRIs_SYSTEM ".",
+			 function,
+			 message_handle->message_catalog_filename );
+
+			goto on_error;
+		}
+		return( 1 );
+	}
 	result = message_handle_open_software_registry_file(
 	          message_handle,
 	          error );
@@ -1636,114 +2157,419 @@ int message_handle_open_input(
 		 "%s: unable to open software registry file.",
 		 function );
 
-		return( -1 );
+		return( -1 );
+	}
+	result = message_handle_open_system_registry_file(
+	          message_handle,
+	          eventlog_key_name,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open system registry file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+
+on_error:
+	if( message_handle->message_catalog != NULL )
+	{
+		message_catalog_free(
+		 &( message_handle->message_catalog ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the input
+ * Returns the 0 if succesful or -1 on error
+ */
+int message_handle_close_input(
+     message_handle_t *message_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_close_input";
+	int result            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_handle->message_catalog != NULL )
+	{
+		if( message_catalog_free(
+		     &( message_handle->message_catalog ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free message catalog.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( message_handle->software_registry_file != NULL )
+	{
+		if( registry_file_close(
+		     message_handle->software_registry_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close software registry file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( message_handle->system_registry_file != NULL )
+	{
+		if( registry_file_close(
+		     message_handle->system_registry_file,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close system registry file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( hash_table_empty(
+	     message_handle->event_source_value_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty event source value cache.",
+		 function );
+
+		result = -1;
+	}
+	if( resource_file_cache_empty(
+	     message_handle->resource_file_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty resource file cache.",
+		 function );
+
+		result = -1;
+	}
+	if( resource_file_cache_empty(
+	     message_handle->mui_resource_file_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty MUI resource file cache.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Retrieves a value for a specific event source
+ * The value is retrieved from the event source value cache, the message catalog if set
+ * or from the event source key in the SYSTEM Windows Registry File if available
+ * The value string is owned by the event source value cache and is only valid
+ * while the message handle is grabbed
+ * Returns 1 if successful, 0 if such event source or -1 error
+ */
+int message_handle_get_value_by_event_source(
+     message_handle_t *message_handle,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error )
+{
+	system_character_t *cached_value_string   = NULL;
+	system_character_t *key                   = NULL;
+	system_character_t *registry_value_string = NULL;
+	static char *function                     = "message_handle_get_value_by_event_source";
+	size_t key_size                           = 0;
+	size_t registry_value_string_size         = 0;
+	int result                                = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_source == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event source.",
+		 function );
+
+		return( -1 );
+	}
+	if( event_source_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid event source length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value name.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_name_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value name length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string.",
+		 function );
+
+		return( -1 );
+	}
+	if( *value_string != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid value string value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value string size.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key consists of the value name and the event source separated by an end-of-string character
+	 */
+	key_size = value_name_length + 1 + event_source_length;
+
+	/* The key buffer is only resized if the key does not fit
+	 */
+	if( key_size > message_handle->event_source_value_key_size )
+	{
+		key = (system_character_t *) memory_reallocate(
+		                              message_handle->event_source_value_key,
+		                              sizeof( system_character_t ) * key_size );
+
+		if( key == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize key.",
+			 function );
+
+			goto on_error;
+		}
+		message_handle->event_source_value_key      = key;
+		message_handle->event_source_value_key_size = key_size;
+	}
+	key = message_handle->event_source_value_key;
+
+	if( memory_copy(
+	     key,
+	     value_name,
+	     sizeof( system_character_t ) * value_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy value name to key.",
+		 function );
+
+		goto on_error;
 	}
-	result = message_handle_open_system_registry_file(
-	          message_handle,
-	          eventlog_key_name,
-	          error );
+	key[ value_name_length ] = 0;
 
-	if( result == -1 )
+	if( memory_copy(
+	     &( key[ value_name_length + 1 ] ),
+	     event_source,
+	     sizeof( system_character_t ) * event_source_length ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open system registry file.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy event source to key.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	return( 1 );
-}
-
-/* Closes the input
- * Returns the 0 if succesful or -1 on error
- */
-int message_handle_close_input(
-     message_handle_t *message_handle,
-     libcerror_error_t **error )
-{
-	static char *function = "message_handle_close_input";
-	int result            = 0;
+	result = hash_table_get_value_by_key(
+	          message_handle->event_source_value_cache,
+	          (uint8_t *) key,
+	          sizeof( system_character_t ) * key_size,
+	          (intptr_t **) &cached_value_string,
+	          error );
 
-	if( message_handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message handle.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value from event source value cache.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( message_handle->software_registry_file != NULL )
+	else if( result == 0 )
 	{
-		if( registry_file_close(
-		     message_handle->software_registry_file,
-		     error ) != 0 )
+		if( message_handle->message_catalog != NULL )
+		{
+			result = message_catalog_get_value_by_event_source(
+			          message_handle->message_catalog,
+			          event_source,
+			          event_source_length,
+			          value_name,
+			          value_name_length,
+			          &registry_value_string,
+			          &registry_value_string_size,
+			          error );
+		}
+		else
+		{
+			result = message_handle_get_value_by_event_source_from_registry(
+			          message_handle,
+			          event_source,
+			          event_source_length,
+			          value_name,
+			          value_name_length,
+			          &registry_value_string,
+			          &registry_value_string_size,
+			          error );
+		}
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close software registry file.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-	}
-	if( message_handle->system_registry_file != NULL )
-	{
-		if( registry_file_close(
-		     message_handle->system_registry_file,
-		     error ) != 0 )
+		/* An event source or value that is not available is cached as NULL
+		 * so that it is not searched for again
+		 */
+		if( hash_table_set_value_by_key(
+		     message_handle->event_source_value_cache,
+		     (uint8_t *) key,
+		     sizeof( system_character_t ) * key_size,
+		     (intptr_t *) registry_value_string,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close system registry file.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set value in event source value cache.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
+		cached_value_string   = registry_value_string;
+		registry_value_string = NULL;
 	}
-	if( libfcache_cache_empty(
-	     message_handle->resource_file_cache,
-	     error ) != 1 )
+	if( cached_value_string == NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty resource file cache.",
-		 function );
-
-		result = -1;
+		return( 0 );
 	}
-	if( libfcache_cache_empty(
-	     message_handle->mui_resource_file_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty MUI resource file cache.",
-		 function );
+	*value_string      = cached_value_string;
+	*value_string_size = system_string_length(
+	                      cached_value_string ) + 1;
 
-		result = -1;
+	return( 1 );
+
+on_error:
+	if( registry_value_string != NULL )
+	{
+		memory_free(
+		 registry_value_string );
 	}
-	return( result );
+	return( -1 );
 }
 
-/* Retrieves a value for a specific event source
+/* Retrieves a value for a specific event source from the registry
  * The value is retrieved from the event source key in the SYSTEM Windows Registry File if available
  * Returns 1 if successful, 0 if such event source or -1 error
  */
-int message_handle_get_value_by_event_source(
+int message_handle_get_value_by_event_source_from_registry(
      message_handle_t *message_handle,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -1755,7 +2581,7 @@ int message_handle_get_value_by_event_source(
 {
 	libregf_key_t *key     = NULL;
 	libregf_value_t *value = NULL;
-	static char *function  = "message_handle_get_value_by_event_source";
+	static char *function  = "message_handle_get_value_by_event_source_from_registry";
 	int result             = 0;
 
 	if( message_handle == NULL )
@@ -2942,17 +3768,181 @@ on_error:
 		memory_free(
 		 *resource_file_path );
 
-		*resource_file_path = NULL;
+		*resource_file_path = NULL;
+	}
+	*resource_file_path_size = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific resource file and adds it to the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ */
+int message_handle_get_resource_file(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     const system_character_t *resource_file_path,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file";
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_initialize(
+	     resource_file,
+	     message_handle->preferred_language_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create resource file.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_set_name(
+	     *resource_file,
+	     resource_filename,
+	     resource_filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name in resource file.",
+		 function );
+
+		goto on_error;
+	}
+	if( resource_file_open(
+	     *resource_file,
+	     resource_file_path,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
+		 function,
+		 resource_file_path );
+
+		goto on_error;
+	}
+	if( resource_file_cache_set_resource_file(
+	     message_handle->resource_file_cache,
+	     resource_filename,
+	     resource_filename_length,
+	     *resource_file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set resource file in cache.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *resource_file != NULL )
+	{
+		resource_file_free(
+		 resource_file,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific resource file from the cache
+ * Returns 1 if successful, 0 if not available or -1 error
+ * If successful a resource file of NULL indicates the resource file is known not to be available
+ */
+int message_handle_get_resource_file_from_cache(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	static char *function = "message_handle_get_resource_file_from_cache";
+	int result            = 0;
+
+	if( message_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	result = resource_file_cache_get_resource_file(
+	          message_handle->resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
+		 function );
+
+		return( -1 );
 	}
-	*resource_file_path_size = 0;
-
-	return( -1 );
+	return( result );
 }
 
-/* Retrieves a specific resource file and adds it to the cache
+/* Retrieves a specific MUI resource file and adds it to the cache
  * Returns 1 if successful, 0 if resource file was not found or -1 error
  */
-int message_handle_get_resource_file(
+int message_handle_get_mui_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
@@ -2960,8 +3950,7 @@ int message_handle_get_resource_file(
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_resource_file";
-	time_t timestamp      = 0;
+	static char *function = "message_handle_get_mui_resource_file";
 
 	if( message_handle == NULL )
 	{
@@ -3029,50 +4018,26 @@ int message_handle_get_resource_file(
 
 		goto on_error;
 	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->resource_file_cache,
-	     message_handle->next_resource_file_cache_index,
-	     0,
-	     message_handle->next_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
+	if( resource_file_cache_set_resource_file(
+	     message_handle->mui_resource_file_cache,
+	     resource_filename,
+	     resource_filename_length,
+	     *resource_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_resource_file_cache_index );
+		 "%s: unable to set resource file in cache.",
+		 function );
 
 		goto on_error;
 	}
-	message_handle->next_resource_file_cache_index++;
-
-	if( message_handle->next_resource_file_cache_index == 16 )
-	{
-		message_handle->next_resource_file_cache_index = 0;
-	}
 	return( 1 );
 
 on_error:
-	if( *resource_file != NULL )
+	if( resource_file != NULL )
 	{
 		resource_file_free(
 		 resource_file,
@@ -3081,20 +4046,19 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a specific resource file from the cache
- * Returns 1 if successful, 0 if not available or -1 error
+/* Retrieves a specific MUI resource file from the cache
+ * Returns 1 if successful, 0 if resource file was not found or -1 error
+ * If successful a resource file of NULL indicates the resource file is known not to be available
  */
-int message_handle_get_resource_file_from_cache(
+int message_handle_get_mui_resource_file_from_cache(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	static char *function = "message_handle_get_mui_resource_file_from_cache";
+	int result            = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3118,85 +4082,43 @@ int message_handle_get_resource_file_from_cache(
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
-			{
-				*resource_file = NULL;
-			}
-		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+	result = resource_file_cache_get_resource_file(
+	          message_handle->mui_resource_file_cache,
+	          resource_filename,
+	          resource_filename_length,
+	          resource_file,
+	          error );
 
-			break;
-		}
-	}
-	if( result == 0 )
+	if( result == -1 )
 	{
-		*resource_file = NULL;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI resource file from cache.",
+		 function );
+
+		return( -1 );
 	}
 	return( result );
 }
 
-/* Retrieves a specific MUI resource file and adds it to the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
+/* Retrieves a specific resource file by name
+ * The resource file is retrieved from the resource file cache or opened and added to the cache
+ * The resource file is managed by the resource file cache
+ * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_mui_resource_file(
+int message_handle_get_resource_file_by_name(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
-     const system_character_t *resource_file_path,
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	static char *function = "message_handle_get_mui_resource_file";
-	time_t timestamp      = 0;
+	system_character_t *resource_file_path = NULL;
+	static char *function                  = "message_handle_get_resource_file_by_name";
+	size_t resource_file_path_size         = 0;
+	int result                             = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3220,116 +4142,129 @@ int message_handle_get_mui_resource_file(
 
 		return( -1 );
 	}
-	if( resource_file_initialize(
-	     resource_file,
-	     message_handle->preferred_language_identifier,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create resource file.",
-		 function );
+	*resource_file = NULL;
 
-		goto on_error;
-	}
-	if( resource_file_set_name(
-	     *resource_file,
-	     resource_filename,
-	     resource_filename_length,
-	     error ) != 1 )
+	result = message_handle_get_resource_file_from_cache(
+		  message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  resource_file,
+		  error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name in resource file.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource file from cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( resource_file_open(
-	     *resource_file,
-	     resource_file_path,
-	     error ) != 1 )
+	else if( result == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to open resource file: %" PRIs_SYSTEM ".",
-		 function,
-		 resource_file_path );
+		result = message_handle_get_resource_file_path(
+		          message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          NULL,
+		          0,
+		          &resource_file_path,
+		          &resource_file_path_size,
+		          error );
 
-		goto on_error;
-	}
-	if( libfcache_date_time_get_timestamp(
-	     &timestamp,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve cache timestamp.",
-		 function );
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve resource file path.",
+			 function );
 
-		return( -1 );
-	}
-	if( libfcache_cache_set_value_by_index(
-	     message_handle->mui_resource_file_cache,
-	     message_handle->next_mui_resource_file_cache_index,
-	     0,
-	     message_handle->next_mui_resource_file_cache_index,
-	     timestamp,
-	     (intptr_t *) *resource_file,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &resource_file_free,
-	     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set resource file in cache entry: %d.",
-		 function,
-		 message_handle->next_mui_resource_file_cache_index );
+			goto on_error;
+		}
+		else if( result != 0 )
+		{
+			if( message_handle_get_resource_file(
+			     message_handle,
+			     resource_filename,
+			     resource_filename_length,
+			     resource_file_path,
+			     resource_file,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
+				 function,
+				 resource_file_path );
 
-		goto on_error;
-	}
-	message_handle->next_mui_resource_file_cache_index++;
+				goto on_error;
+			}
+			memory_free(
+			 resource_file_path );
+
+			resource_file_path = NULL;
+		}
+		else
+		{
+			/* Cache that the resource file is not available
+			 */
+			if( resource_file_cache_set_resource_file(
+			     message_handle->resource_file_cache,
+			     resource_filename,
+			     resource_filename_length,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set resource file in cache.",
+				 function );
 
-	if( message_handle->next_mui_resource_file_cache_index == 16 )
+				goto on_error;
+			}
+		}
+	}
+	if( *resource_file == NULL )
 	{
-		message_handle->next_mui_resource_file_cache_index = 0;
+		return( 0 );
 	}
 	return( 1 );
 
 on_error:
-	if( resource_file != NULL )
+	if( resource_file_path != NULL )
 	{
-		resource_file_free(
-		 resource_file,
-		 NULL );
+		memory_free(
+		 resource_file_path );
 	}
+	*resource_file = NULL;
+
 	return( -1 );
 }
 
-/* Retrieves a specific MUI resource file from the cache
- * Returns 1 if successful, 0 if resource file was not found or -1 error
+/* Retrieves a specific MUI resource file by name
+ * The MUI resource file is retrieved from the MUI resource file cache or opened and added to the cache
+ * The MUI resource file is managed by the MUI resource file cache
+ * Returns 1 if successful, 0 if not available or -1 error
  */
-int message_handle_get_mui_resource_file_from_cache(
+int message_handle_get_mui_resource_file_by_name(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
      size_t resource_filename_length,
      resource_file_t **resource_file,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "message_handle_get_mui_resource_file_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
+	system_character_t *mui_resource_file_path = NULL;
+	static char *function                      = "message_handle_get_mui_resource_file_by_name";
+	size_t mui_resource_file_path_size         = 0;
+	int result                                 = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3353,66 +4288,114 @@ int message_handle_get_mui_resource_file_from_cache(
 
 		return( -1 );
 	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
+	*resource_file = NULL;
+
+	result = message_handle_get_mui_resource_file_from_cache(
+		  message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  resource_file,
+		  error );
+
+	if( result == -1 )
 	{
-		if( libfcache_cache_get_value_by_index(
-		     message_handle->mui_resource_file_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI resource file from cache.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+/* TODO add support to determine language string */
+		/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
+		 */
+		result = message_handle_get_resource_file_path(
+			  message_handle,
+		          resource_filename,
+		          resource_filename_length,
+		          _SYSTEM_STRING( "en-US" ),
+		          5,
+			  &mui_resource_file_path,
+			  &mui_resource_file_path_size,
+			  error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
+			 "%s: unable to retrieve MUI resource file path.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		if( cache_value != NULL )
+		else if( result != 0 )
 		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) resource_file,
+			if( message_handle_get_mui_resource_file(
+			     message_handle,
+			     resource_filename,
+			     resource_filename_length,
+			     mui_resource_file_path,
+			     resource_file,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file from cache value: %d.",
+				 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
 				 function,
-				 cache_index );
+				 mui_resource_file_path );
 
-				return( -1 );
+				goto on_error;
 			}
+			memory_free(
+			 mui_resource_file_path );
+
+			mui_resource_file_path = NULL;
 		}
-		if( *resource_file != NULL )
+		else
 		{
-			if( ( resource_filename_length + 1 ) != ( *resource_file )->name_size )
-			{
-				*resource_file = NULL;
-			}
-			else if( system_string_compare(
-				  resource_filename,
-				  ( *resource_file )->name,
-				  resource_filename_length ) != 0 )
+			/* Cache that the MUI resource file is not available
+			 */
+			if( resource_file_cache_set_resource_file(
+			     message_handle->mui_resource_file_cache,
+			     resource_filename,
+			     resource_filename_length,
+			     NULL,
+			     error ) != 1 )
 			{
-				*resource_file = NULL;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set MUI resource file in cache.",
+				 function );
+
+				goto on_error;
 			}
 		}
-		if( *resource_file != NULL )
-		{
-			result = 1;
+	}
+	if( *resource_file == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
 
-			break;
-		}
+on_error:
+	if( mui_resource_file_path != NULL )
+	{
+		memory_free(
+		 mui_resource_file_path );
 	}
-	return( result );
+	*resource_file = NULL;
+
+	return( -1 );
 }
 
 /* Retrieves the message string from a specific resource file
@@ -3426,14 +4409,10 @@ int message_handle_get_message_string_from_resource_file(
      message_string_t **message_string,
      libcerror_error_t **error )
 {
-	system_character_t *resource_file_path     = NULL;
-	system_character_t *mui_resource_file_path = NULL;
-	resource_file_t *resource_file             = NULL;
-	static char *function                      = "message_handle_get_message_string_from_resource_file";
-	size_t resource_file_path_size             = 0;
-	size_t mui_resource_file_path_size         = 0;
-	uint32_t mui_file_type                     = 0;
-	int result                                 = 0;
+	resource_file_t *resource_file = NULL;
+	static char *function          = "message_handle_get_message_string_from_resource_file";
+	uint32_t mui_file_type         = 0;
+	int result                     = 0;
 
 	if( message_handle == NULL )
 	{
@@ -3480,7 +4459,31 @@ int message_handle_get_message_string_from_resource_file(
 
 		return( -1 );
 	}
-	result = message_handle_get_resource_file_from_cache(
+	if( message_handle->message_catalog != NULL )
+	{
+		result = message_catalog_get_message_string(
+		          message_handle->message_catalog,
+		          resource_filename,
+		          resource_filename_length,
+		          message_identifier,
+		          message_string,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: 0x%08" PRIx32 " from message catalog.",
+			 function,
+			 message_identifier );
+
+			goto on_error;
+		}
+		return( result );
+	}
+	result = message_handle_get_resource_file_by_name(
 		  message_handle,
 		  resource_filename,
 		  resource_filename_length,
@@ -3493,228 +4496,114 @@ int message_handle_get_message_string_from_resource_file(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve resource file from cache.",
+		 "%s: unable to retrieve resource file.",
 		 function );
 
 		goto on_error;
 	}
-	if( result == 0 )
+	else if( result == 0 )
 	{
-		result = message_handle_get_resource_file_path(
-		          message_handle,
-		          resource_filename,
-		          resource_filename_length,
-		          NULL,
-		          0,
-		          &resource_file_path,
-		          &resource_file_path_size,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve resource file path.",
-			 function );
+		return( 0 );
+	}
+	result = resource_file_get_message_string(
+		  resource_file,
+		  message_identifier,
+		  message_string,
+		  error );
 
-			goto on_error;
-		}
-		else if( result != 0 )
-		{
-			if( message_handle_get_resource_file(
-			     message_handle,
-			     resource_filename,
-			     resource_filename_length,
-			     resource_file_path,
-			     &resource_file,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve resource file: %" PRIs_SYSTEM ".",
-				 function,
-				 resource_file_path );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_identifier );
 
-				goto on_error;
-			}
-		}
+		goto on_error;
 	}
-	if( resource_file != NULL )
+	else if( result != 0 )
 	{
-		result = resource_file_get_message_string(
-			  resource_file,
-			  message_identifier,
-			  message_string,
-			  error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-			 function,
-			 message_identifier );
-
-			goto on_error;
-		}
-		else if( result == 0 )
-		{
-			result = resource_file_get_mui_file_type(
-				  resource_file,
-				  &mui_file_type,
-				  error );
-
-			if( result == -1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve MUI file type.",
-				 function );
-
-				goto on_error;
-			}
-			else if( result != 0 )
-			{
-				if( mui_file_type != 0x00000011UL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
-					 function,
-					 mui_file_type );
-				}
-				resource_file = NULL;
-
-				result = message_handle_get_mui_resource_file_from_cache(
-					  message_handle,
-					  resource_filename,
-					  resource_filename_length,
-					  &resource_file,
-					  error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve MUI resource file from cache.",
-					 function );
-
-					goto on_error;
-				}
-				else if( result == 0 )
-				{
-/* TODO add support to determine language string */
-					/* The MUI resource file path is: %PATH%/%LANGUAGE%/%FILENAME%.mui
-					 */
-					result = message_handle_get_resource_file_path(
-						  message_handle,
-					          resource_filename,
-					          resource_filename_length,
-					          _SYSTEM_STRING( "en-US" ),
-					          5,
-						  &mui_resource_file_path,
-						  &mui_resource_file_path_size,
-						  error );
-
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve MUI resource file path.",
-						 function );
-
-						goto on_error;
-					}
-					else if( result != 0 )
-					{
-						if( message_handle_get_mui_resource_file(
-						     message_handle,
-						     resource_filename,
-						     resource_filename_length,
-						     mui_resource_file_path,
-						     &resource_file,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-							 "%s: unable to retrieve MUI resource file: %" PRIs_SYSTEM ".",
-							 function,
-							 mui_resource_file_path );
-
-							goto on_error;
-						}
-						memory_free(
-						 mui_resource_file_path );
-
-						mui_resource_file_path = NULL;
-					}
-				}
-				if( resource_file != NULL )
-				{
-					result = resource_file_get_message_string(
-						  resource_file,
-						  message_identifier,
-						  message_string,
-						  error );
+		return( 1 );
+	}
+	result = resource_file_get_mui_file_type(
+		  resource_file,
+		  &mui_file_type,
+		  error );
 
-					if( result == -1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-						 function,
-						 message_identifier );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI file type.",
+		 function );
 
-						goto on_error;
-					}
-				}
-			}
-		}
+		goto on_error;
 	}
-	if( resource_file_path != NULL )
+	else if( result == 0 )
 	{
-		memory_free(
-		 resource_file_path );
-
-		resource_file_path = NULL;
+		return( 0 );
 	}
-	return( result );
+	if( mui_file_type != 0x00000011UL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported MUI file type: 0x%08" PRIx32 ".",
+		 function,
+		 mui_file_type );
+	}
+	result = message_handle_get_mui_resource_file_by_name(
+		  message_handle,
+		  resource_filename,
+		  resource_filename_length,
+		  &resource_file,
+		  error );
 
-on_error:
-	if( mui_resource_file_path != NULL )
+	if( result == -1 )
 	{
-		memory_free(
-		 mui_resource_file_path );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve MUI resource file.",
+		 function );
+
+		goto on_error;
 	}
-	if( resource_file_path != NULL )
+	else if( result == 0 )
 	{
-		memory_free(
-		 resource_file_path );
+		return( 0 );
 	}
-	if( *message_string != NULL )
+	result = resource_file_get_message_string(
+		  resource_file,
+		  message_identifier,
+		  message_string,
+		  error );
+
+	if( result == -1 )
 	{
-		message_string_free(
-		 message_string,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_identifier );
+
+		goto on_error;
 	}
+	return( result );
+
+on_error:
+	/* The message string is managed by the resource file
+	 */
+	*message_string = NULL;
+
 	return( -1 );
 }
 
@@ -3872,12 +4761,10 @@ on_error:
 		 &resource_filename_split_string,
 		 NULL );
 	}
-	if( *message_string != NULL )
-	{
-		message_string_free(
-		 message_string,
-		 NULL );
-	}
+	/* The message string is managed by the resource file
+	 */
+	*message_string = NULL;
+
 	return( -1 );
 }
 
@@ -26,12 +26,15 @@
 #include <types.h>
 
 #include "evttools_libcerror.h"
-#include "evttools_libfcache.h"
+#include "evttools_libcthreads.h"
 #include "evttools_libregf.h"
+#include "hash_table.h"
+#include "message_catalog.h"
 #include "message_string.h"
 #include "path_handle.h"
 #include "registry_file.h"
 #include "resource_file.h"
+#include "resource_file_cache.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -113,21 +116,42 @@ struct message_handle
 	 */
 	const system_character_t *resource_files_path;
 
-	/* The resource file cache
+	/* The message catalog filename
 	 */
-	libfcache_cache_t *resource_file_cache;
+	system_character_t *message_catalog_filename;
 
-	/* The next available resource file cache index
+	/* The message catalog filename size
 	 */
-	int next_resource_file_cache_index;
+	size_t message_catalog_filename_size;
 
-	/* The MUI resource file cache
+	/* The message catalog
+	 * If set the event source values and message strings are retrieved
+	 * from the message catalog instead of the registry and resource files
+	 */
+	message_catalog_t *message_catalog;
+
+	/* The event source value cache
+	 * Maps an event source and value name to the value string,
+	 * or to NULL if the event source or value is not available
+	 */
+	hash_table_t *event_source_value_cache;
+
+	/* The event source value cache key
+	 * The key is reused so that a cached value can be retrieved without allocating memory
+	 */
+	system_character_t *event_source_value_key;
+
+	/* The event source value cache key size
 	 */
-	libfcache_cache_t *mui_resource_file_cache;
+	size_t event_source_value_key_size;
 
-	/* The next available MUI resource file cache index
+	/* The resource file cache
 	 */
-	int next_mui_resource_file_cache_index;
+	resource_file_cache_t *resource_file_cache;
+
+	/* The MUI resource file cache
+	 */
+	resource_file_cache_t *mui_resource_file_cache;
 
 	/* The ascii codepage
 	 */
@@ -136,6 +160,12 @@ struct message_handle
 	/* The preferred language identifier
 	 */
 	uint32_t preferred_language_identifier;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex that serializes the use of the message handle by multiple threads
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int message_handle_initialize(
@@ -150,6 +180,23 @@ int message_handle_signal_abort(
      message_handle_t *message_handle,
      libcerror_error_t **error );
 
+int message_handle_free_value_string(
+     system_character_t **value_string,
+     libcerror_error_t **error );
+
+int message_handle_grab(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
+int message_handle_release(
+     message_handle_t *message_handle,
+     libcerror_error_t **error );
+
+int message_handle_copy_settings(
+     message_handle_t *destination_message_handle,
+     message_handle_t *source_message_handle,
+     libcerror_error_t **error );
+
 int message_handle_set_ascii_codepage(
      message_handle_t *message_handle,
      int ascii_codepage,
@@ -160,6 +207,12 @@ int message_handle_set_preferred_language_identifier(
      uint32_t preferred_language_identifier,
      libcerror_error_t **error );
 
+int message_handle_set_resource_file_cache_maximum_values(
+     message_handle_t *message_handle,
+     int maximum_number_of_resource_files,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
 int message_handle_set_event_log_type_from_filename(
      message_handle_t *message_handle,
      const system_character_t *filename,
@@ -185,6 +238,11 @@ int message_handle_set_resource_files_path(
      const system_character_t *path,
      libcerror_error_t **error );
 
+int message_handle_set_message_catalog_filename(
+     message_handle_t *message_handle,
+     const system_character_t *filename,
+     libcerror_error_t **error );
+
 int message_handle_open_software_registry_file(
      message_handle_t *message_handle,
      libcerror_error_t **error );
@@ -204,6 +262,16 @@ int message_handle_close_input(
      libcerror_error_t **error );
 
 int message_handle_get_value_by_event_source(
+     message_handle_t *message_handle,
+     const system_character_t *event_source,
+     size_t event_source_length,
+     const system_character_t *value_name,
+     size_t value_name_length,
+     const system_character_t **value_string,
+     size_t *value_string_size,
+     libcerror_error_t **error );
+
+int message_handle_get_value_by_event_source_from_registry(
      message_handle_t *message_handle,
      const system_character_t *event_source,
      size_t event_source_length,
@@ -271,6 +339,20 @@ int message_handle_get_mui_resource_file_from_cache(
      resource_file_t **resource_file,
      libcerror_error_t **error );
 
+int message_handle_get_resource_file_by_name(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int message_handle_get_mui_resource_file_by_name(
+     message_handle_t *message_handle,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
 int message_handle_get_message_string_from_resource_file(
      message_handle_t *message_handle,
      const system_character_t *resource_filename,
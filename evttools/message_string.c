@@ -31,6 +31,7 @@
 #include "evttools_libevt.h"
 #include "evttools_libwrc.h"
 #include "message_string.h"
+#include "message_string_table.h"
 
 /* Creates a message string
  * Make sure the value message_string is referencing, is set to NULL
@@ -141,6 +142,16 @@ int message_string_free(
 			memory_free(
 			 ( *message_string )->string );
 		}
+		if( ( *message_string )->segments != NULL )
+		{
+			memory_free(
+			 ( *message_string )->segments );
+		}
+		if( ( *message_string )->text != NULL )
+		{
+			memory_free(
+			 ( *message_string )->text );
+		}
 		memory_free(
 		 *message_string );
 
@@ -149,6 +160,89 @@ int message_string_free(
 	return( result );
 }
 
+/* Pins the message string
+ * The resource file that contains the message string table of a pinned message string
+ * is not removed from the resource file cache, so that the message string can be used
+ * after the message handle was released. The message handle must be grabbed while
+ * the message string is pinned or unpinned
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_pin(
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_pin";
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Message strings that are not stored in a message string table, such as those
+	 * of a message catalog, remain available until the message handle is closed
+	 */
+	if( message_string->message_string_table != NULL )
+	{
+		if( message_string->message_string_table->number_of_pins == INT_MAX )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid message string - number of pins value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		message_string->message_string_table->number_of_pins += 1;
+	}
+	return( 1 );
+}
+
+/* Unpins the message string
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_unpin(
+     message_string_t *message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_unpin";
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string->message_string_table != NULL )
+	{
+		if( message_string->message_string_table->number_of_pins == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid message string - message string is not pinned.",
+			 function );
+
+			return( -1 );
+		}
+		message_string->message_string_table->number_of_pins -= 1;
+	}
+	return( 1 );
+}
+
 /* Retrieve the message string from the message table resource
  * Returns 1 if successful, 0 if not available or -1 on error
  */
@@ -291,25 +385,29 @@ on_error:
 	return( -1 );
 }
 
-/* Prints the message string to a FILE stream
+/* Compiles the message string
+ * The format string is parsed into segments of literal text and inserted value strings,
+ * so that it does not need to be parsed again every time the message string is printed
  * Returns 1 if successful or -1 on error
  */
-int message_string_fprint(
+int message_string_compile(
      message_string_t *message_string,
-     libevt_record_t *record,
-     FILE *stream,
      libcerror_error_t **error )
 {
-	system_character_t *value_string   = NULL;
-	static char *function              = "message_string_fprint";
-	size_t conversion_specifier_length = 0;
-	size_t message_string_length       = 0;
-	size_t message_string_index        = 0;
-	size_t value_string_size           = 0;
-	system_character_t last_character  = 0;
-	int number_of_strings              = 0;
-	int result                         = 0;
-	int value_string_index             = 0;
+	message_string_segment_t *literal_segment = NULL;
+	message_string_segment_t *segments        = NULL;
+	system_character_t *text                  = NULL;
+	static char *function                     = "message_string_compile";
+	size_t conversion_specifier_length        = 0;
+	size_t message_string_index               = 0;
+	size_t message_string_length              = 0;
+	size_t number_of_conversion_specifiers    = 0;
+	size_t text_length                        = 0;
+	system_character_t character              = 0;
+	system_character_t last_character         = 0;
+	uint8_t follows_conversion_specifier      = 0;
+	int number_of_segments                    = 0;
+	int value_string_index                    = 0;
 
 	if( message_string == NULL )
 	{
@@ -322,42 +420,93 @@ int message_string_fprint(
 
 		return( -1 );
 	}
-	if( libevt_record_get_number_of_strings(
-	     record,
-	     &number_of_strings,
-	     error ) != 1 )
+	if( message_string->segments != NULL )
+	{
+		return( 1 );
+	}
+	if( message_string->string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of strings in record.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid message string - missing string.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	fprintf(
-	 stream,
-	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
-	 message_string->string );
-#endif
-	fprintf(
-	 stream,
-	 "Message string\t\t\t: " );
+	if( ( message_string->string_size == 0 )
+	 || ( message_string->string_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( message_string_segment_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid message string - string size value out of bounds.",
+		 function );
 
+		return( -1 );
+	}
 	message_string_length = message_string->string_size - 1;
-	message_string_index  = 0;
+
+	for( message_string_index = 0;
+	     message_string_index < message_string_length;
+	     message_string_index++ )
+	{
+		if( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
+		{
+			number_of_conversion_specifiers++;
+		}
+	}
+	/* Every conversion specifier results in at most an inserted value string segment
+	 * and the literal text segment that follows it
+	 */
+	segments = (message_string_segment_t *) memory_allocate(
+	                                         sizeof( message_string_segment_t ) * ( ( 2 * number_of_conversion_specifiers ) + 1 ) );
+
+	if( segments == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create segments.",
+		 function );
+
+		goto on_error;
+	}
+	/* The compiled text is never larger than the format string
+	 */
+	text = system_string_allocate(
+	        message_string->string_size );
+
+	if( text == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create text.",
+		 function );
+
+		goto on_error;
+	}
+	message_string_index = 0;
 
 	while( message_string_index < message_string_length )
 	{
-		if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '%' )
+		character                   = ( message_string->string )[ message_string_index ];
+		conversion_specifier_length = 0;
+
+		if( ( character == (system_character_t) '%' )
 		 && ( ( message_string_index + 1 ) < message_string_length ) )
 		{
+			character = ( message_string->string )[ message_string_index + 1 ];
+
 /* TODO add support for more conversion specifiers */
 			/* Ignore %0 = end of string, %r = cariage return */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '0' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'r' ) )
+			if( ( character == (system_character_t) '0' )
+			 || ( character == (system_character_t) 'r' ) )
 			{
 				message_string_index += 2;
 
@@ -369,68 +518,41 @@ int message_string_fprint(
 			 *  %% = %
 			 *  %. = .
 			 */
-			if( ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) ' ' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '!' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '%' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) '.' ) )
+			if( ( character == (system_character_t) ' ' )
+			 || ( character == (system_character_t) '!' )
+			 || ( character == (system_character_t) '%' )
+			 || ( character == (system_character_t) '.' ) )
 			{
-				last_character = ( message_string->string )[ message_string_index + 1 ];
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
-
 				message_string_index += 2;
-
-				continue;
 			}
 			/* Replace %b = space */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'b' )
+			else if( character == (system_character_t) 'b' )
 			{
-				last_character = (system_character_t) ' ';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				character = (system_character_t) ' ';
 
 				message_string_index += 2;
-
-				continue;
 			}
 			/* Replace %n = new line */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 'n' )
+			else if( character == (system_character_t) 'n' )
 			{
-				if( last_character != (system_character_t) '\n' )
-				{
-					last_character = (system_character_t) '\n';
-
-					fprintf(
-					 stream,
-					 "%c",
-					 last_character );
-				}
 				message_string_index += 2;
 
-				continue;
+				if( ( last_character == (system_character_t) '\n' )
+				 && ( follows_conversion_specifier == 0 ) )
+				{
+					continue;
+				}
+				character = (system_character_t) '\n';
 			}
 			/* Replace %t = tab */
-			if( ( message_string->string )[ message_string_index + 1 ] == (system_character_t) 't' )
+			else if( character == (system_character_t) 't' )
 			{
-				last_character = (system_character_t) '\t';
-
-				fprintf(
-				 stream,
-				 "%c",
-				 last_character );
+				character = (system_character_t) '\t';
 
 				message_string_index += 2;
-
-				continue;
 			}
-			if( ( ( message_string->string )[ message_string_index + 1 ] < (system_character_t) '1' )
-			 || ( ( message_string->string )[ message_string_index + 1 ] > (system_character_t) '9' ) )
+			else if( ( character < (system_character_t) '1' )
+			      || ( character > (system_character_t) '9' ) )
 			{
 				libcerror_error_set(
 				 error,
@@ -442,176 +564,503 @@ int message_string_fprint(
 
 				goto on_error;
 			}
-			value_string_index = (int) ( message_string->string )[ message_string_index + 1 ] - (int) '0';
+			else
+			{
+				value_string_index = (int) character - (int) '0';
 
-			conversion_specifier_length = 2;
+				conversion_specifier_length = 2;
 
-		 	if( ( ( message_string_index + 3 ) < message_string_length )
-			 && ( ( message_string->string )[ message_string_index + 2 ] >= (system_character_t) '0' )
-			 && ( ( message_string->string )[ message_string_index + 2 ] <= (system_character_t) '9' ) )
-			{
-				value_string_index *= 10;
-				value_string_index += (int) ( message_string->string )[ message_string_index + 2 ] - (int) '0';
+			 	if( ( ( message_string_index + 3 ) < message_string_length )
+				 && ( ( message_string->string )[ message_string_index + 2 ] >= (system_character_t) '0' )
+				 && ( ( message_string->string )[ message_string_index + 2 ] <= (system_character_t) '9' ) )
+				{
+					value_string_index *= 10;
+					value_string_index += (int) ( message_string->string )[ message_string_index + 2 ] - (int) '0';
+
+					conversion_specifier_length += 1;
+				}
+				value_string_index -= 1;
+
+			 	if( ( ( message_string_index + conversion_specifier_length + 3 ) < message_string_length )
+				 && ( ( message_string->string )[ message_string_index + conversion_specifier_length ] == (system_character_t) '!' ) )
+				{
+					if( ( ( message_string->string )[ message_string_index + conversion_specifier_length + 1 ] != (system_character_t) 's' )
+					 || ( ( message_string->string )[ message_string_index + conversion_specifier_length + 2 ] != (system_character_t) '!' ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+						 "%s: unsupported conversion specifier: %" PRIs_SYSTEM ".",
+						 function,
+						 &( ( message_string->string )[ message_string_index ] ) );
 
-				conversion_specifier_length += 1;
+						goto on_error;
+					}
+					conversion_specifier_length += 3;
+				}
 			}
-			value_string_index -= 1;
+		}
+		else
+		{
+			message_string_index += 1;
 
-		 	if( ( ( message_string_index + conversion_specifier_length + 3 ) < message_string_length )
-			 && ( ( message_string->string )[ message_string_index + conversion_specifier_length ] == (system_character_t) '!' ) )
+			/* Ignore end-of-string and \r characters and multiple \n characters
+			 */
+			if( ( character == 0 )
+			 || ( character == (system_character_t) '\r' )
+			 || ( ( character == (system_character_t) '\n' )
+			  && ( last_character == (system_character_t) '\n' )
+			  && ( follows_conversion_specifier == 0 ) ) )
+			{
+				continue;
+			}
+		}
+		if( conversion_specifier_length == 0 )
+		{
+			if( literal_segment == NULL )
 			{
-				if( ( ( message_string->string )[ message_string_index + conversion_specifier_length + 1 ] != (system_character_t) 's' )
-				 || ( ( message_string->string )[ message_string_index + conversion_specifier_length + 2 ] != (system_character_t) '!' ) )
+				literal_segment = &( segments[ number_of_segments++ ] );
+
+				literal_segment->value_string_index       = -1;
+				literal_segment->text_offset              = text_length;
+				literal_segment->text_length              = 0;
+				literal_segment->is_followed_by_new_line  = 0;
+				literal_segment->has_conditional_new_line = 0;
+				literal_segment->follows_new_line         = 0;
+
+				/* A conversion specifier that is printed as-is, because its value string
+				 * is not available, sets the last character to the character that
+				 * follows it in the format string. Hence whether a new line directly
+				 * following conversion specifiers is printed is determined when the
+				 * message string is printed.
+				 */
+				if( ( follows_conversion_specifier != 0 )
+				 && ( character == (system_character_t) '\n' ) )
 				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported conversion specifier: %" PRIs_SYSTEM ".",
-					 function,
-					 &( ( message_string->string )[ message_string_index ] ) );
-
-					goto on_error;
+					literal_segment->has_conditional_new_line = 1;
+					literal_segment->follows_new_line         = (uint8_t) ( last_character == (system_character_t) '\n' );
 				}
-				conversion_specifier_length += 3;
 			}
-/* TODO remove index check after user data support */
-			if( value_string_index < number_of_strings )
+			text[ text_length++ ] = character;
+
+			literal_segment->text_length += 1;
+
+			last_character               = character;
+			follows_conversion_specifier = 0;
+		}
+		else
+		{
+			/* The conversion specifier is stored so that it can be printed
+			 * when the value string is not available
+			 */
+			if( memory_copy(
+			     &( text[ text_length ] ),
+			     &( ( message_string->string )[ message_string_index ] ),
+			     sizeof( system_character_t ) * conversion_specifier_length ) == NULL )
 			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy conversion specifier.",
+				 function );
+
+				goto on_error;
+			}
+			segments[ number_of_segments ].value_string_index       = value_string_index;
+			segments[ number_of_segments ].text_offset              = text_length;
+			segments[ number_of_segments ].text_length              = conversion_specifier_length;
+			segments[ number_of_segments ].is_followed_by_new_line  = 0;
+			segments[ number_of_segments ].has_conditional_new_line = 0;
+			segments[ number_of_segments ].follows_new_line         = 0;
+
+			if( ( ( message_string_index + conversion_specifier_length ) < message_string_length )
+			 && ( ( message_string->string )[ message_string_index + conversion_specifier_length ] == (system_character_t) '\n' ) )
+			{
+				segments[ number_of_segments ].is_followed_by_new_line = 1;
+			}
+			number_of_segments   += 1;
+			text_length          += conversion_specifier_length;
+			message_string_index += conversion_specifier_length;
+
+			literal_segment              = NULL;
+			follows_conversion_specifier = 1;
+		}
+	}
+	text[ text_length ] = 0;
+
+	message_string->segments           = segments;
+	message_string->number_of_segments = number_of_segments;
+	message_string->text               = text;
+	message_string->text_size          = text_length + 1;
+
+	return( 1 );
+
+on_error:
+	if( text != NULL )
+	{
+		memory_free(
+		 text );
+	}
+	if( segments != NULL )
+	{
+		memory_free(
+		 segments );
+	}
+	return( -1 );
+}
+
+/* Resizes a buffer used to print the message string
+ * The buffer is only resized if it is smaller than the required buffer size
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_resize_buffer(
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error )
+{
+	system_character_t *reallocation = NULL;
+	static char *function            = "message_string_resize_buffer";
+	size_t new_buffer_size           = 0;
+
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid required buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *buffer != NULL )
+	 && ( required_buffer_size <= *buffer_size ) )
+	{
+		return( 1 );
+	}
+	/* Grow the buffer by at least a factor 2 to limit the number of reallocations
+	 */
+	new_buffer_size = 256;
+
+	while( new_buffer_size < required_buffer_size )
+	{
+		new_buffer_size *= 2;
+	}
+	if( new_buffer_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) )
+	{
+		new_buffer_size = required_buffer_size;
+	}
+	reallocation = (system_character_t *) memory_reallocate(
+	                                       *buffer,
+	                                       sizeof( system_character_t ) * new_buffer_size );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	*buffer      = reallocation;
+	*buffer_size = new_buffer_size;
+
+	return( 1 );
+}
+
+/* Prints the message string to a FILE stream
+ * The message string is compiled if needed and rendered into the buffer,
+ * which is resized when needed and can be reused for successive calls
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_fprint(
+     message_string_t *message_string,
+     libevt_record_t *record,
+     system_character_t **buffer,
+     size_t *buffer_size,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	message_string_segment_t *segment = NULL;
+	static char *function             = "message_string_fprint";
+	size_t buffer_offset              = 0;
+	size_t text_length                = 0;
+	size_t text_offset                = 0;
+	size_t value_string_size          = 0;
+	uint8_t has_unavailable_value     = 0;
+	uint8_t last_character_is_newline = 0;
+	int number_of_strings             = 0;
+	int result                        = 0;
+	int segment_index                 = 0;
+
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer size.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_compile(
+	     message_string,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to compile message string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_get_number_of_strings(
+	     record,
+	     &number_of_strings,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of strings in record.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_resize_buffer(
+	     buffer,
+	     buffer_size,
+	     message_string->text_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize buffer.",
+		 function );
+
+		return( -1 );
+	}
+	for( segment_index = 0;
+	     segment_index < message_string->number_of_segments;
+	     segment_index++ )
+	{
+		segment = &( ( message_string->segments )[ segment_index ] );
+
+/* TODO remove index check after user data support */
+		if( ( segment->value_string_index >= 0 )
+		 && ( segment->value_string_index < number_of_strings ) )
+		{
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-				result = libevt_record_get_utf16_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
+			result = libevt_record_get_utf16_string_size(
+				  record,
+				  segment->value_string_index,
+				  &value_string_size,
+				  error );
 #else
-				result = libevt_record_get_utf8_string_size(
-					  record,
-					  value_string_index,
-					  &value_string_size,
-					  error );
+			result = libevt_record_get_utf8_string_size(
+				  record,
+				  segment->value_string_index,
+				  &value_string_size,
+				  error );
 #endif
-				if( result != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve string: %d size.",
-					 function,
-					 value_string_index );
-
-					goto on_error;
-				}
-				if( value_string_size > 0 )
-				{
-					value_string = system_string_allocate(
-							value_string_size );
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d size.",
+				 function,
+				 segment->value_string_index );
 
-					if( value_string == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create value string.",
-						 function );
+				return( -1 );
+			}
+			if( value_string_size == 0 )
+			{
+				continue;
+			}
+			if( message_string_resize_buffer(
+			     buffer,
+			     buffer_size,
+			     buffer_offset + value_string_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize buffer.",
+				 function );
 
-						goto on_error;
-					}
+				return( -1 );
+			}
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-					result = libevt_record_get_utf16_string(
-						  record,
-						  value_string_index,
-						  (uint16_t *) value_string,
-						  value_string_size,
-						  error );
+			result = libevt_record_get_utf16_string(
+				  record,
+				  segment->value_string_index,
+				  (uint16_t *) &( ( *buffer )[ buffer_offset ] ),
+				  value_string_size,
+				  error );
 #else
-					result = libevt_record_get_utf8_string(
-						  record,
-						  value_string_index,
-						  (uint8_t *) value_string,
-						  value_string_size,
-						  error );
+			result = libevt_record_get_utf8_string(
+				  record,
+				  segment->value_string_index,
+				  (uint8_t *) &( ( *buffer )[ buffer_offset ] ),
+				  value_string_size,
+				  error );
 #endif
-					if( result != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve string: %d.",
-						 function,
-						 value_string_index );
-
-						goto on_error;
-					}
-					fprintf(
-					 stream,
-					 "%" PRIs_SYSTEM "",
-					 value_string );
-
-					memory_free(
-					 value_string );
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve string: %d.",
+				 function,
+				 segment->value_string_index );
 
-					value_string = NULL;
-				}
-				message_string_index += conversion_specifier_length;
+				return( -1 );
 			}
-			else
-			{
-				do
-				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index++ ] );
+			/* The value string is printed up to the first end-of-string character
+			 */
+			buffer_offset += system_string_length(
+			                  &( ( *buffer )[ buffer_offset ] ) );
 
-					conversion_specifier_length--;
-				}
-				while( conversion_specifier_length > 0 );
+			continue;
+		}
+		text_offset = segment->text_offset;
+		text_length = segment->text_length;
 
-				last_character = ( message_string->string )[ message_string_index ];
-			}
+		if( segment->value_string_index >= 0 )
+		{
+			/* The value string is not available hence the conversion specifier is printed
+			 * as-is, which sets the last character to the character that follows
+			 * the conversion specifier in the format string
+			 */
+			has_unavailable_value     = 1;
+			last_character_is_newline = segment->is_followed_by_new_line;
 		}
 		else
 		{
-			if( ( message_string->string )[ message_string_index ] != 0 )
+			/* Multiple new lines are printed as a single new line
+			 */
+			if( segment->has_conditional_new_line != 0 )
 			{
-				if( ( message_string->string )[ message_string_index ] == (system_character_t) '\r' )
+				if( has_unavailable_value == 0 )
 				{
-					/* Ignore \r characters */
+					last_character_is_newline = segment->follows_new_line;
 				}
-				else if( ( ( message_string->string )[ message_string_index ] == (system_character_t) '\n' )
-				      && ( last_character == (system_character_t) '\n' ) )
+				if( last_character_is_newline != 0 )
 				{
-					/* Ignore multiple \n characters */
+					text_offset += 1;
+					text_length -= 1;
 				}
-				else
-				{
-					fprintf(
-					 stream,
-					 "%" PRIc_SYSTEM "",
-					 ( message_string->string )[ message_string_index ] );
+			}
+			has_unavailable_value = 0;
+		}
+		if( text_length > 0 )
+		{
+			if( message_string_resize_buffer(
+			     buffer,
+			     buffer_size,
+			     buffer_offset + text_length + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize buffer.",
+				 function );
 
-					last_character = ( message_string->string )[ message_string_index ];
-				}
+				return( -1 );
 			}
-			message_string_index += 1;
+			if( memory_copy(
+			     &( ( *buffer )[ buffer_offset ] ),
+			     &( ( message_string->text )[ text_offset ] ),
+			     sizeof( system_character_t ) * text_length ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy text.",
+				 function );
+
+				return( -1 );
+			}
+			buffer_offset += text_length;
 		}
 	}
+	( *buffer )[ buffer_offset ] = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	fprintf(
+	 stream,
+	 "Message format string\t\t: %" PRIs_SYSTEM "\n",
+	 message_string->string );
+#endif
 	fprintf(
 	 stream,
-	 "\n" );
+	 "Message string\t\t\t: %" PRIs_SYSTEM "\n",
+	 *buffer );
 
 	return( 1 );
-
-on_error:
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	return( -1 );
 }
 
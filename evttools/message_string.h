@@ -34,6 +34,42 @@
 extern "C" {
 #endif
 
+typedef struct message_string_segment message_string_segment_t;
+
+struct message_string_segment
+{
+	/* The index of the value string that is inserted
+	 * -1 if the segment contains literal text
+	 */
+	int value_string_index;
+
+	/* The offset of the segment in the compiled text
+	 */
+	size_t text_offset;
+
+	/* The length of the segment in the compiled text
+	 * For an inserted value string this is the conversion specifier,
+	 * which is printed when the value string is not available
+	 */
+	size_t text_length;
+
+	/* Value to indicate the conversion specifier is directly followed
+	 * by a new line character in the format string
+	 */
+	uint8_t is_followed_by_new_line;
+
+	/* Value to indicate the literal text starts with a new line that follows
+	 * conversion specifiers, which is printed depending on which value strings
+	 * are available
+	 */
+	uint8_t has_conditional_new_line;
+
+	/* Value to indicate the last character printed before the conversion specifiers
+	 * that precede the conditional new line is a new line
+	 */
+	uint8_t follows_new_line;
+};
+
 typedef struct message_string message_string_t;
 
 struct message_string
@@ -49,6 +85,27 @@ struct message_string
 	/* The string size
 	 */
 	size_t string_size;
+
+	/* The segments of the compiled string
+	 */
+	message_string_segment_t *segments;
+
+	/* The number of segments
+	 */
+	int number_of_segments;
+
+	/* The text of the compiled string
+	 */
+	system_character_t *text;
+
+	/* The text size
+	 */
+	size_t text_size;
+
+	/* The message string table that contains the message string
+	 * NULL if the message string is not stored in a message string table
+	 */
+	struct message_string_table *message_string_table;
 };
 
 int message_string_initialize(
@@ -60,15 +117,35 @@ int message_string_free(
      message_string_t **message_string,
      libcerror_error_t **error );
 
+int message_string_pin(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_string_unpin(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
 int message_string_get_from_message_table_resource(
      message_string_t *message_string,
      libwrc_resource_t *message_table_resource,
      uint32_t language_identifier,
      libcerror_error_t **error );
 
+int message_string_compile(
+     message_string_t *message_string,
+     libcerror_error_t **error );
+
+int message_string_resize_buffer(
+     system_character_t **buffer,
+     size_t *buffer_size,
+     size_t required_buffer_size,
+     libcerror_error_t **error );
+
 int message_string_fprint(
      message_string_t *message_string,
      libevt_record_t *record,
+     system_character_t **buffer,
+     size_t *buffer_size,
      FILE *stream,
      libcerror_error_t **error );
 
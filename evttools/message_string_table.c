@@ -0,0 +1,561 @@
+/*
+ * Message string table
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "evttools_libwrc.h"
+#include "message_string.h"
+#include "message_string_table.h"
+
+/* Determines the slot of a message string identifier
+ */
+#define message_string_table_get_slot_index( message_string_table, message_string_identifier ) \
+	(int) ( ( (uint32_t) ( (uint32_t) ( message_string_identifier ) * 0x9e3779b1UL ) >> 7 ) & (uint32_t) ( ( message_string_table )->number_of_slots - 1 ) )
+
+/* Creates a message string table
+ * Make sure the value message_string_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_table_initialize(
+     message_string_table_t **message_string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_table_initialize";
+
+	if( message_string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string_table = memory_allocate_structure(
+	                         message_string_table_t );
+
+	if( *message_string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message string table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *message_string_table,
+	     0,
+	     sizeof( message_string_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message string table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *message_string_table != NULL )
+	{
+		memory_free(
+		 *message_string_table );
+
+		*message_string_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a message string table
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_table_free(
+     message_string_table_t **message_string_table,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_table_free";
+	int message_index     = 0;
+
+	if( message_string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *message_string_table != NULL )
+	{
+		/* The strings of the message strings are stored in the strings data
+		 */
+		if( ( *message_string_table )->slots != NULL )
+		{
+			memory_free(
+			 ( *message_string_table )->slots );
+		}
+		if( ( *message_string_table )->strings_data != NULL )
+		{
+			memory_free(
+			 ( *message_string_table )->strings_data );
+		}
+		if( ( *message_string_table )->message_strings != NULL )
+		{
+			/* The compiled message strings are stored per message string
+			 */
+			for( message_index = 0;
+			     message_index < ( *message_string_table )->number_of_message_strings;
+			     message_index++ )
+			{
+				if( ( *message_string_table )->message_strings[ message_index ].segments != NULL )
+				{
+					memory_free(
+					 ( *message_string_table )->message_strings[ message_index ].segments );
+				}
+				if( ( *message_string_table )->message_strings[ message_index ].text != NULL )
+				{
+					memory_free(
+					 ( *message_string_table )->message_strings[ message_index ].text );
+				}
+			}
+			memory_free(
+			 ( *message_string_table )->message_strings );
+		}
+		memory_free(
+		 *message_string_table );
+
+		*message_string_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Reads all the message strings of a specific language from the message table resource
+ * The strings are stored consecutively in a single strings data buffer
+ * Returns 1 if successful or -1 on error
+ */
+int message_string_table_read_message_table_resource(
+     message_string_table_t *message_string_table,
+     libwrc_resource_t *message_table_resource,
+     uint32_t language_identifier,
+     libcerror_error_t **error )
+{
+	message_string_t *message_string = NULL;
+	static char *function            = "message_string_table_read_message_table_resource";
+	size_t strings_data_offset       = 0;
+	int message_index                = 0;
+	int number_of_messages           = 0;
+	int slot_index                   = 0;
+	int result                       = 0;
+
+	if( message_string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string_table->message_strings != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid message string table - message strings value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libwrc_message_table_get_number_of_messages(
+	     message_table_resource,
+	     language_identifier,
+	     &number_of_messages,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of messages.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_messages == 0 )
+	{
+		return( 1 );
+	}
+	if( ( number_of_messages < 0 )
+	 || ( (size_t) number_of_messages > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / ( 2 * sizeof( message_string_t ) ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of messages value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	message_string_table->message_strings = (message_string_t *) memory_allocate(
+	                                                               sizeof( message_string_t ) * number_of_messages );
+
+	if( message_string_table->message_strings == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create message strings.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     message_string_table->message_strings,
+	     0,
+	     sizeof( message_string_t ) * number_of_messages ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear message strings.",
+		 function );
+
+		goto on_error;
+	}
+	/* Determine the identifiers and the size of the strings data
+	 */
+	for( message_index = 0;
+	     message_index < number_of_messages;
+	     message_index++ )
+	{
+		message_string = &( message_string_table->message_strings[ message_index ] );
+
+		message_string->message_string_table = message_string_table;
+
+		if( libwrc_message_table_get_identifier(
+		     message_table_resource,
+		     language_identifier,
+		     message_index,
+		     &( message_string->identifier ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message: %d identifier.",
+			 function,
+			 message_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libwrc_message_table_get_utf16_string_size(
+			  message_table_resource,
+			  language_identifier,
+			  message_index,
+			  &( message_string->string_size ),
+			  error );
+#else
+		result = libwrc_message_table_get_utf8_string_size(
+			  message_table_resource,
+			  language_identifier,
+			  message_index,
+			  &( message_string->string_size ),
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message: %d size.",
+			 function,
+			 message_index );
+
+			goto on_error;
+		}
+		if( message_string->string_size > ( (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) - message_string_table->strings_data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid strings data size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		message_string_table->strings_data_size += message_string->string_size;
+	}
+	message_string_table->number_of_message_strings = number_of_messages;
+
+	if( message_string_table->strings_data_size > 0 )
+	{
+		message_string_table->strings_data = system_string_allocate(
+		                                      message_string_table->strings_data_size );
+
+		if( message_string_table->strings_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create strings data.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* Read the strings into the strings data
+	 */
+	for( message_index = 0;
+	     message_index < number_of_messages;
+	     message_index++ )
+	{
+		message_string = &( message_string_table->message_strings[ message_index ] );
+
+		if( message_string->string_size == 0 )
+		{
+			continue;
+		}
+		message_string->string = &( message_string_table->strings_data[ strings_data_offset ] );
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+		result = libwrc_message_table_get_utf16_string(
+			  message_table_resource,
+			  language_identifier,
+			  message_index,
+			  (uint16_t *) message_string->string,
+			  message_string->string_size,
+			  error );
+#else
+		result = libwrc_message_table_get_utf8_string(
+			  message_table_resource,
+			  language_identifier,
+			  message_index,
+			  (uint8_t *) message_string->string,
+			  message_string->string_size,
+			  error );
+#endif
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve message string: %d.",
+			 function,
+			 message_index );
+
+			goto on_error;
+		}
+		strings_data_offset += message_string->string_size;
+	}
+	/* Use at least twice the number of slots as message strings to keep the probe sequences short
+	 */
+	message_string_table->number_of_slots = 16;
+
+	while( message_string_table->number_of_slots < ( 2 * number_of_messages ) )
+	{
+		message_string_table->number_of_slots *= 2;
+	}
+	message_string_table->slots = (int *) memory_allocate(
+	                                       sizeof( int ) * message_string_table->number_of_slots );
+
+	if( message_string_table->slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     message_string_table->slots,
+	     0,
+	     sizeof( int ) * message_string_table->number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		goto on_error;
+	}
+	for( message_index = 0;
+	     message_index < number_of_messages;
+	     message_index++ )
+	{
+		message_string = &( message_string_table->message_strings[ message_index ] );
+
+		slot_index = message_string_table_get_slot_index(
+		              message_string_table,
+		              message_string->identifier );
+
+		/* If the message table contains the same identifier more than once the first message is used
+		 */
+		while( message_string_table->slots[ slot_index ] != 0 )
+		{
+			if( message_string_table->message_strings[ message_string_table->slots[ slot_index ] - 1 ].identifier == message_string->identifier )
+			{
+				break;
+			}
+			slot_index = ( slot_index + 1 ) & ( message_string_table->number_of_slots - 1 );
+		}
+		if( message_string_table->slots[ slot_index ] == 0 )
+		{
+			message_string_table->slots[ slot_index ] = message_index + 1;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( message_string_table->slots != NULL )
+	{
+		memory_free(
+		 message_string_table->slots );
+
+		message_string_table->slots = NULL;
+	}
+	if( message_string_table->strings_data != NULL )
+	{
+		memory_free(
+		 message_string_table->strings_data );
+
+		message_string_table->strings_data = NULL;
+	}
+	if( message_string_table->message_strings != NULL )
+	{
+		memory_free(
+		 message_string_table->message_strings );
+
+		message_string_table->message_strings = NULL;
+	}
+	message_string_table->number_of_message_strings = 0;
+	message_string_table->strings_data_size         = 0;
+	message_string_table->number_of_slots           = 0;
+
+	return( -1 );
+}
+
+/* Retrieves a specific message string
+ * The message string is managed by the message string table
+ * Returns 1 if successful, 0 if no such message string or -1 on error
+ */
+int message_string_table_get_message_string_by_identifier(
+     message_string_table_t *message_string_table,
+     uint32_t message_string_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	static char *function = "message_string_table_get_message_string_by_identifier";
+	int message_index     = 0;
+	int slot_index        = 0;
+
+	if( message_string_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string table.",
+		 function );
+
+		return( -1 );
+	}
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
+
+		return( -1 );
+	}
+	*message_string = NULL;
+
+	if( message_string_table->slots == NULL )
+	{
+		return( 0 );
+	}
+	slot_index = message_string_table_get_slot_index(
+	              message_string_table,
+	              message_string_identifier );
+
+	while( message_string_table->slots[ slot_index ] != 0 )
+	{
+		message_index = message_string_table->slots[ slot_index ] - 1;
+
+		if( message_string_table->message_strings[ message_index ].identifier == message_string_identifier )
+		{
+			if( message_string_table->message_strings[ message_index ].string == NULL )
+			{
+				return( 0 );
+			}
+			*message_string = &( message_string_table->message_strings[ message_index ] );
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( message_string_table->number_of_slots - 1 );
+	}
+	return( 0 );
+}
+
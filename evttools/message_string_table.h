@@ -0,0 +1,98 @@
+/*
+ * Message string table
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _MESSAGE_STRING_TABLE_H )
+#define _MESSAGE_STRING_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "evttools_libwrc.h"
+#include "message_string.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct message_string_table message_string_table_t;
+
+struct message_string_table
+{
+	/* The message strings
+	 */
+	message_string_t *message_strings;
+
+	/* The number of message strings
+	 */
+	int number_of_message_strings;
+
+	/* The strings data
+	 * Contains the strings of all message strings
+	 */
+	system_character_t *strings_data;
+
+	/* The strings data size
+	 */
+	size_t strings_data_size;
+
+	/* The slots
+	 * Contains the index of a message string + 1 or 0 if the slot is empty
+	 */
+	int *slots;
+
+	/* The number of slots, which is a power of 2
+	 */
+	int number_of_slots;
+
+	/* The number of pinned message strings
+	 * The resource file of a message string table with pinned message strings
+	 * is not removed from the resource file cache
+	 */
+	int number_of_pins;
+};
+
+int message_string_table_initialize(
+     message_string_table_t **message_string_table,
+     libcerror_error_t **error );
+
+int message_string_table_free(
+     message_string_table_t **message_string_table,
+     libcerror_error_t **error );
+
+int message_string_table_read_message_table_resource(
+     message_string_table_t *message_string_table,
+     libwrc_resource_t *message_table_resource,
+     uint32_t language_identifier,
+     libcerror_error_t **error );
+
+int message_string_table_get_message_string_by_identifier(
+     message_string_table_t *message_string_table,
+     uint32_t message_string_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _MESSAGE_STRING_TABLE_H ) */
+
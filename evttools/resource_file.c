@@ -26,21 +26,12 @@
 #include <types.h>
 #include <wide_string.h>
 
-#if defined( TIME_WITH_SYS_TIME )
-#include <sys/time.h>
-#include <time.h>
-#elif defined( HAVE_SYS_TIME_H )
-#include <sys/time.h>
-#else
-#include <time.h>
-#endif
-
 #include "evttools_libbfio.h"
 #include "evttools_libcerror.h"
 #include "evttools_libexe.h"
-#include "evttools_libfcache.h"
 #include "evttools_libwrc.h"
 #include "message_string.h"
+#include "message_string_table.h"
 #include "resource_file.h"
 
 /* Creates a resource file
@@ -135,20 +126,6 @@ int resource_file_initialize(
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( ( *resource_file )->message_string_cache ),
-	     16,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create message string cache.",
-		 function );
-
-		goto on_error;
-	}
 	( *resource_file )->preferred_language_identifier = preferred_language_identifier;
 
 	return( 1 );
@@ -215,19 +192,6 @@ int resource_file_free(
 				result = -1;
 			}
 		}
-		if( libfcache_cache_free(
-		     &( ( *resource_file )->message_string_cache ),
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free message string cache.",
-			 function );
-
-			result = -1;
-		}
 		if( libwrc_stream_free(
 		     &( ( *resource_file )->resource_stream ),
 		     error ) != 1 )
@@ -367,6 +331,20 @@ int resource_file_open(
 
 		goto on_error;
 	}
+	if( libbfio_handle_get_size(
+	     resource_file->resource_section_file_io_handle,
+	     &( resource_file->resource_section_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve resource section size.",
+		 function );
+
+		goto on_error;
+	}
 	if( libwrc_stream_set_virtual_address(
 	     resource_file->resource_stream,
 	     virtual_address,
@@ -443,18 +421,21 @@ int resource_file_close(
 	}
 	if( resource_file->is_open != 0 )
 	{
-		if( libfcache_cache_empty(
-		     resource_file->message_string_cache,
-		     error ) != 1 )
+		if( resource_file->message_string_table != NULL )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to empty message string cache.",
-			 function );
+			if( message_string_table_free(
+			     &( resource_file->message_string_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free message string table.",
+				 function );
 
-			result = -1;
+				result = -1;
+			}
 		}
 		if( resource_file->message_table_resource != NULL )
 		{
@@ -773,107 +754,18 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves a message string from the cache
- * Returns 1 if successful, 0 if not available or -1 error
+/* Retrieves the message string table
+ * The message strings of the message table are read into the message string table on first use
+ * The message string table is managed by the resource file
+ * Returns 1 if successful, 0 if no message table or -1 error
  */
-int resource_file_get_message_string_from_cache(
+int resource_file_get_message_string_table(
      resource_file_t *resource_file,
-     uint32_t message_string_identifier,
-     message_string_t **message_string,
+     message_string_table_t **message_string_table,
      libcerror_error_t **error )
 {
-	libfcache_cache_value_t *cache_value = NULL;
-	static char *function                = "resource_file_get_message_string_from_cache";
-	int cache_index                      = 0;
-	int result                           = 0;
-
-	if( resource_file == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid resource file.",
-		 function );
-
-		return( -1 );
-	}
-	if( message_string == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
-		 function );
-
-		return( -1 );
-	}
-	for( cache_index = 0;
-	     cache_index < 16;
-	     cache_index++ )
-	{
-		if( libfcache_cache_get_value_by_index(
-		     resource_file->message_string_cache,
-		     cache_index,
-		     &cache_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve cache value: %d.",
-			 function,
-			 cache_index );
-
-			return( -1 );
-		}
-		if( cache_value != NULL )
-		{
-			if( libfcache_cache_value_get_value(
-			     cache_value,
-			     (intptr_t **) message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve message string from cache value: %d.",
-				 function,
-				 cache_index );
-
-				return( -1 );
-			}
-		}
-		if( ( *message_string != NULL )
-		 && ( message_string_identifier == ( *message_string )->identifier ) )
-		{
-			result = 1;
-
-			break;
-		}
-	}
-	if( result == 0 )
-	{
-		*message_string = NULL;
-	}
-	return( result );
-}
-
-/* Retrieves a specific message string
- * Returns 1 if successful, 0 if no such message string or -1 error
- */
-int resource_file_get_message_string(
-     resource_file_t *resource_file,
-     uint32_t message_string_identifier,
-     message_string_t **message_string,
-     libcerror_error_t **error )
-{
-	static char *function        = "resource_file_get_message_string";
+	static char *function        = "resource_file_get_message_string_table";
 	uint32_t language_identifier = 0;
-	time_t timestamp             = 0;
 	int result                   = 0;
 
 	if( resource_file == NULL )
@@ -887,13 +779,13 @@ int resource_file_get_message_string(
 
 		return( -1 );
 	}
-	if( message_string == NULL )
+	if( message_string_table == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid message string.",
+		 "%s: invalid message string table.",
 		 function );
 
 		return( -1 );
@@ -922,24 +814,7 @@ int resource_file_get_message_string(
 			return( 0 );
 		}
 	}
-	result = resource_file_get_message_string_from_cache(
-	          resource_file,
-	          message_string_identifier,
-	          message_string,
-	          error );
-
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve message string from cache.",
-		 function );
-
-		return( -1 );
-	}
-	else if( result == 0 )
+	if( resource_file->message_string_table == NULL )
 	{
 		if( resource_file_get_resource_available_languague_identifier(
 		     resource_file,
@@ -954,114 +829,113 @@ int resource_file_get_message_string(
 			 "%s: unable to retrieve an available language identifier.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		*message_string = NULL;
-
-		if( message_string_initialize(
-		     message_string,
-		     message_string_identifier,
+		if( message_string_table_initialize(
+		     &( resource_file->message_string_table ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create message string.",
+			 "%s: unable to create message string table.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		result = message_string_get_from_message_table_resource(
-		          *message_string,
-		          resource_file->message_table_resource,
-		          language_identifier,
-		          error );
-
-		if( result == -1 )
+		if( message_string_table_read_message_table_resource(
+		     resource_file->message_string_table,
+		     resource_file->message_table_resource,
+		     language_identifier,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
-			 function,
-			 message_string_identifier );
-
-			message_string_free(
-			 message_string,
-			 NULL );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read message string table.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		else if( result != 0 )
-		{
-			if( libfcache_date_time_get_timestamp(
-			     &timestamp,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve cache timestamp.",
-				 function );
+	}
+	*message_string_table = resource_file->message_string_table;
 
-				message_string_free(
-				 message_string,
-				 NULL );
+	return( 1 );
 
-				return( -1 );
-			}
-			if( libfcache_cache_set_value_by_index(
-			     resource_file->message_string_cache,
-			     resource_file->next_message_string_cache_index,
-			     0,
-			     resource_file->next_message_string_cache_index,
-			     timestamp,
-			     (intptr_t *) *message_string,
-			     (int (*)(intptr_t **, libcerror_error_t **)) &message_string_free,
-			     LIBFCACHE_CACHE_VALUE_FLAG_MANAGED,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set message string in cache entry: %d.",
-				 function,
-				 resource_file->next_message_string_cache_index );
+on_error:
+	if( resource_file->message_string_table != NULL )
+	{
+		message_string_table_free(
+		 &( resource_file->message_string_table ),
+		 NULL );
+	}
+	return( -1 );
+}
 
-				message_string_free(
-				 message_string,
-				 NULL );
+/* Retrieves a specific message string
+ * The message string is managed by the resource file
+ * Returns 1 if successful, 0 if no such message string or -1 error
+ */
+int resource_file_get_message_string(
+     resource_file_t *resource_file,
+     uint32_t message_string_identifier,
+     message_string_t **message_string,
+     libcerror_error_t **error )
+{
+	message_string_table_t *message_string_table = NULL;
+	static char *function                        = "resource_file_get_message_string";
+	int result                                   = 0;
 
-				return( -1 );
-			}
-			resource_file->next_message_string_cache_index++;
+	if( message_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid message string.",
+		 function );
 
-			if( resource_file->next_message_string_cache_index == 16 )
-			{
-				resource_file->next_message_string_cache_index = 0;
-			}
-			message_string = NULL;
-		}
-		if( message_string != NULL )
-		{
-			if( message_string_free(
-			     message_string,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free message string.",
-				 function );
+		return( -1 );
+	}
+	result = resource_file_get_message_string_table(
+	          resource_file,
+	          &message_string_table,
+	          error );
 
-				return( -1 );
-			}
-		}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string table.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = message_string_table_get_message_string_by_identifier(
+	          message_string_table,
+	          message_string_identifier,
+	          message_string,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve message string: 0x%08" PRIx32 ".",
+		 function,
+		 message_string_identifier );
+
+		return( -1 );
 	}
 	return( result );
 }
@@ -28,9 +28,9 @@
 #include "evttools_libbfio.h"
 #include "evttools_libcerror.h"
 #include "evttools_libexe.h"
-#include "evttools_libfcache.h"
 #include "evttools_libwrc.h"
 #include "message_string.h"
+#include "message_string_table.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -60,6 +60,10 @@ struct resource_file
 	 */
 	libbfio_handle_t *resource_section_file_io_handle;
 
+	/* The resource (.rsrc) section size
+	 */
+	size64_t resource_section_size;
+
 	/* The libwrc resource stream
 	 */
 	libwrc_stream_t *resource_stream;
@@ -80,13 +84,10 @@ struct resource_file
 	 */
 	libwrc_resource_t *wevt_template_resource;
 
-	/* The message string cache
-	 */
-	libfcache_cache_t *message_string_cache;
-
-	/* The next available message string cache index
+	/* The message string table
+	 * Contains the message strings of the MESSAGETABLE resource, read on first use
 	 */
-	int next_message_string_cache_index;
+	message_string_table_t *message_string_table;
 
 	/* Value to indicate if the message file is open
 	 */
@@ -123,10 +124,9 @@ int resource_file_set_name(
      size_t name_length,
      libcerror_error_t **error );
 
-int resource_file_get_message_string_from_cache(
+int resource_file_get_message_string_table(
      resource_file_t *resource_file,
-     uint32_t message_string_identifier,
-     message_string_t **message_string,
+     message_string_table_t **message_string_table,
      libcerror_error_t **error );
 
 int resource_file_get_message_string(
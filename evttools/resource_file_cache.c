@@ -0,0 +1,982 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "hash_table.h"
+#include "resource_file.h"
+#include "resource_file_cache.h"
+
+/* Creates a resource file cache
+ * Make sure the value resource_file_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_initialize";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*resource_file_cache = memory_allocate_structure(
+	                        resource_file_cache_t );
+
+	if( *resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create resource file cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *resource_file_cache,
+	     0,
+	     sizeof( resource_file_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear resource file cache.",
+		 function );
+
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+
+		return( -1 );
+	}
+	/* The entries are managed by the resource file cache
+	 */
+	if( hash_table_initialize(
+	     &( ( *resource_file_cache )->hash_table ),
+	     RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create hash table.",
+		 function );
+
+		goto on_error;
+	}
+	( *resource_file_cache )->maximum_number_of_entries = RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES;
+	( *resource_file_cache )->maximum_size              = RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_SIZE;
+
+	return( 1 );
+
+on_error:
+	if( *resource_file_cache != NULL )
+	{
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a resource file cache
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_free";
+	int result            = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *resource_file_cache != NULL )
+	{
+		if( resource_file_cache_empty(
+		     *resource_file_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty resource file cache.",
+			 function );
+
+			result = -1;
+		}
+		if( hash_table_free(
+		     &( ( *resource_file_cache )->hash_table ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free hash table.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *resource_file_cache )->lookup_key != NULL )
+		{
+			memory_free(
+			 ( *resource_file_cache )->lookup_key );
+		}
+		memory_free(
+		 *resource_file_cache );
+
+		*resource_file_cache = NULL;
+	}
+	return( result );
+}
+
+/* Frees a resource file cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_entry_free(
+     resource_file_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_entry_free";
+	int result            = 1;
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *entry != NULL )
+	{
+		if( ( *entry )->resource_file != NULL )
+		{
+			if( resource_file_free(
+			     &( ( *entry )->resource_file ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free resource file.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *entry )->key != NULL )
+		{
+			memory_free(
+			 ( *entry )->key );
+		}
+		memory_free(
+		 *entry );
+
+		*entry = NULL;
+	}
+	return( result );
+}
+
+/* Empties a resource file cache and frees the resource files
+ * The statistics are not reset
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *entry      = NULL;
+	resource_file_cache_entry_t *next_entry = NULL;
+	static char *function                   = "resource_file_cache_empty";
+	int result                              = 1;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( hash_table_empty(
+	     resource_file_cache->hash_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty hash table.",
+		 function );
+
+		result = -1;
+	}
+	entry = resource_file_cache->first_entry;
+
+	while( entry != NULL )
+	{
+		next_entry = entry->next_entry;
+
+		if( resource_file_cache_entry_free(
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entry.",
+			 function );
+
+			result = -1;
+		}
+		entry = next_entry;
+	}
+	resource_file_cache->first_entry       = NULL;
+	resource_file_cache->last_entry        = NULL;
+	resource_file_cache->number_of_entries = 0;
+	resource_file_cache->size              = 0;
+
+	return( result );
+}
+
+/* Copies the key of a specific resource filename
+ * The key is the resource filename in lower case with '/' replaced by '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_copy_key(
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     system_character_t *key,
+     size_t key_length,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_copy_key";
+	size_t string_index   = 0;
+
+	if( resource_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_length < resource_filename_length )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid key length value too small.",
+		 function );
+
+		return( -1 );
+	}
+	for( string_index = 0;
+	     string_index < resource_filename_length;
+	     string_index++ )
+	{
+		key[ string_index ] = resource_filename[ string_index ];
+
+		if( key[ string_index ] == (system_character_t) '/' )
+		{
+			key[ string_index ] = (system_character_t) '\\';
+		}
+		else if( ( key[ string_index ] >= (system_character_t) 'A' )
+		      && ( key[ string_index ] <= (system_character_t) 'Z' ) )
+		{
+			key[ string_index ] += (system_character_t) ( 'a' - 'A' );
+		}
+	}
+	return( 1 );
+}
+
+/* Determines the key of a specific resource filename
+ * The key is the resource filename in lower case with '/' replaced by '\\'
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_get_key(
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     system_character_t **key,
+     size_t *key_size,
+     libcerror_error_t **error )
+{
+	system_character_t *safe_key = NULL;
+	static char *function        = "resource_file_cache_get_key";
+
+	if( resource_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_filename_length == 0 )
+	 || ( resource_filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key.",
+		 function );
+
+		return( -1 );
+	}
+	if( key_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid key size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_key = system_string_allocate(
+	            resource_filename_length );
+
+	if( safe_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create key.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache_copy_key(
+	     resource_filename,
+	     resource_filename_length,
+	     safe_key,
+	     resource_filename_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy key.",
+		 function );
+
+		memory_free(
+		 safe_key );
+
+		return( -1 );
+	}
+	*key      = safe_key;
+	*key_size = sizeof( system_character_t ) * resource_filename_length;
+
+	return( 1 );
+}
+
+/* Removes the least recently used entry that can be removed
+ * The most recently used entry and the entries of resource files with pinned
+ * message strings are not removed
+ * Returns 1 if successful, 0 if no entry can be removed or -1 on error
+ */
+int resource_file_cache_remove_last_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *entry = NULL;
+	static char *function              = "resource_file_cache_remove_last_entry";
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	entry = resource_file_cache->last_entry;
+
+	while( entry != NULL )
+	{
+		if( entry == resource_file_cache->first_entry )
+		{
+			return( 0 );
+		}
+		if( ( entry->resource_file == NULL )
+		 || ( entry->resource_file->message_string_table == NULL )
+		 || ( entry->resource_file->message_string_table->number_of_pins == 0 ) )
+		{
+			break;
+		}
+		entry = entry->previous_entry;
+	}
+	if( entry == NULL )
+	{
+		return( 0 );
+	}
+	if( hash_table_remove_value_by_key(
+	     resource_file_cache->hash_table,
+	     (uint8_t *) entry->key,
+	     entry->key_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+		 "%s: unable to remove entry from hash table.",
+		 function );
+
+		return( -1 );
+	}
+	/* The entry is never the first entry, hence it always has a previous entry
+	 */
+	entry->previous_entry->next_entry = entry->next_entry;
+
+	if( entry->next_entry != NULL )
+	{
+		entry->next_entry->previous_entry = entry->previous_entry;
+	}
+	else
+	{
+		resource_file_cache->last_entry = entry->previous_entry;
+	}
+	resource_file_cache->number_of_entries   -= 1;
+	resource_file_cache->size                -= entry->size;
+	resource_file_cache->number_of_evictions += 1;
+
+	if( resource_file_cache_entry_free(
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the maximum number of entries and the maximum size
+ * A maximum size of 0 represents no maximum
+ * Entries are removed when the cache exceeds the new maximum values, except for
+ * the most recently used entry and entries that are in use
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_maximum_values(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "resource_file_cache_set_maximum_values";
+	int result            = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	resource_file_cache->maximum_number_of_entries = maximum_number_of_entries;
+	resource_file_cache->maximum_size              = maximum_size;
+
+	while( ( resource_file_cache->number_of_entries > resource_file_cache->maximum_number_of_entries )
+	    || ( ( resource_file_cache->maximum_size != 0 )
+	     &&  ( resource_file_cache->size > resource_file_cache->maximum_size ) ) )
+	{
+		result = resource_file_cache_remove_last_entry(
+		          resource_file_cache,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The remaining entries cannot be removed
+			 */
+			break;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific resource file
+ * On a hit the entry becomes the most recently used entry
+ * Returns 1 if successful, 0 if not available or -1 on error
+ * If successful a resource file of NULL indicates the resource file is known not to be available
+ */
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *entry = NULL;
+	system_character_t *key            = NULL;
+	static char *function              = "resource_file_cache_get_resource_file";
+	int result                         = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( resource_filename_length == 0 )
+	 || ( resource_filename_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( system_character_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid resource filename length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The lookup key is only resized if the key does not fit
+	 */
+	if( resource_filename_length > resource_file_cache->lookup_key_length )
+	{
+		key = (system_character_t *) memory_reallocate(
+		                              resource_file_cache->lookup_key,
+		                              sizeof( system_character_t ) * resource_filename_length );
+
+		if( key == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize lookup key.",
+			 function );
+
+			return( -1 );
+		}
+		resource_file_cache->lookup_key        = key;
+		resource_file_cache->lookup_key_length = resource_filename_length;
+	}
+	if( resource_file_cache_copy_key(
+	     resource_filename,
+	     resource_filename_length,
+	     resource_file_cache->lookup_key,
+	     resource_file_cache->lookup_key_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy lookup key.",
+		 function );
+
+		return( -1 );
+	}
+	result = hash_table_get_value_by_key(
+	          resource_file_cache->hash_table,
+	          (uint8_t *) resource_file_cache->lookup_key,
+	          sizeof( system_character_t ) * resource_filename_length,
+	          (intptr_t **) &entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from hash table.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		resource_file_cache->number_of_misses += 1;
+
+		*resource_file = NULL;
+
+		return( 0 );
+	}
+	/* Move the entry to the front of the list
+	 */
+	if( entry->previous_entry != NULL )
+	{
+		entry->previous_entry->next_entry = entry->next_entry;
+
+		if( entry->next_entry != NULL )
+		{
+			entry->next_entry->previous_entry = entry->previous_entry;
+		}
+		else
+		{
+			resource_file_cache->last_entry = entry->previous_entry;
+		}
+		entry->previous_entry = NULL;
+		entry->next_entry     = resource_file_cache->first_entry;
+
+		resource_file_cache->first_entry->previous_entry = entry;
+		resource_file_cache->first_entry                 = entry;
+	}
+	resource_file_cache->number_of_hits += 1;
+
+	*resource_file = entry->resource_file;
+
+	return( 1 );
+}
+
+/* Sets a specific resource file
+ * The resource file is managed by the cache if successful, a resource file of NULL
+ * indicates the resource file is not available
+ * The least recently used entries are removed when the cache exceeds its maximum values
+ * Returns 1 if successful or -1 on error
+ */
+int resource_file_cache_set_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t *resource_file,
+     libcerror_error_t **error )
+{
+	resource_file_cache_entry_t *existing_entry = NULL;
+	resource_file_cache_entry_t *entry          = NULL;
+	static char *function                       = "resource_file_cache_set_resource_file";
+	int result                                  = 0;
+
+	if( resource_file_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid resource file cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( resource_file_cache->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid resource file cache - number of entries value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	entry = memory_allocate_structure(
+	         resource_file_cache_entry_t );
+
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     entry,
+	     0,
+	     sizeof( resource_file_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear entry.",
+		 function );
+
+		memory_free(
+		 entry );
+
+		return( -1 );
+	}
+	if( resource_file_cache_get_key(
+	     resource_filename,
+	     resource_filename_length,
+	     &( entry->key ),
+	     &( entry->key_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine key.",
+		 function );
+
+		goto on_error;
+	}
+	result = hash_table_get_value_by_key(
+	          resource_file_cache->hash_table,
+	          (uint8_t *) entry->key,
+	          entry->key_size,
+	          (intptr_t **) &existing_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from hash table.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid resource file cache - entry already set.",
+		 function );
+
+		goto on_error;
+	}
+	if( hash_table_set_value_by_key(
+	     resource_file_cache->hash_table,
+	     (uint8_t *) entry->key,
+	     entry->key_size,
+	     (intptr_t *) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set entry in hash table.",
+		 function );
+
+		goto on_error;
+	}
+	entry->resource_file = resource_file;
+
+	if( resource_file != NULL )
+	{
+		entry->size = resource_file->resource_section_size;
+	}
+	entry->next_entry = resource_file_cache->first_entry;
+
+	if( resource_file_cache->first_entry != NULL )
+	{
+		resource_file_cache->first_entry->previous_entry = entry;
+	}
+	else
+	{
+		resource_file_cache->last_entry = entry;
+	}
+	resource_file_cache->first_entry        = entry;
+	resource_file_cache->number_of_entries += 1;
+	resource_file_cache->size              += entry->size;
+
+	/* The new entry is the most recently used entry and is not removed
+	 * even if it exceeds the maximum size by itself
+	 */
+	while( ( resource_file_cache->number_of_entries > resource_file_cache->maximum_number_of_entries )
+	    || ( ( resource_file_cache->maximum_size != 0 )
+	     &&  ( resource_file_cache->size > resource_file_cache->maximum_size ) ) )
+	{
+		result = resource_file_cache_remove_last_entry(
+		          resource_file_cache,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove last entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			/* The remaining entries cannot be removed
+			 */
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( entry != NULL )
+	{
+		if( entry->key != NULL )
+		{
+			memory_free(
+			 entry->key );
+		}
+		memory_free(
+		 entry );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,188 @@
+/*
+ * Resource file cache
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _RESOURCE_FILE_CACHE_H )
+#define _RESOURCE_FILE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "evttools_libcerror.h"
+#include "hash_table.h"
+#include "resource_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The default maximum number of resource files in the cache
+ */
+#define RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_NUMBER_OF_ENTRIES	64
+
+/* The default maximum size of the resource sections of the resource files in the cache
+ */
+#define RESOURCE_FILE_CACHE_DEFAULT_MAXIMUM_SIZE		( 256 * 1024 * 1024 )
+
+typedef struct resource_file_cache_entry resource_file_cache_entry_t;
+
+struct resource_file_cache_entry
+{
+	/* The key, the normalized resource filename
+	 */
+	system_character_t *key;
+
+	/* The key size
+	 */
+	size_t key_size;
+
+	/* The resource file
+	 * NULL if the resource file is not available
+	 */
+	resource_file_t *resource_file;
+
+	/* The size of the resource section of the resource file
+	 */
+	size64_t size;
+
+	/* The previous (more recently used) entry
+	 */
+	resource_file_cache_entry_t *previous_entry;
+
+	/* The next (less recently used) entry
+	 */
+	resource_file_cache_entry_t *next_entry;
+};
+
+typedef struct resource_file_cache resource_file_cache_t;
+
+struct resource_file_cache
+{
+	/* The hash table that maps a key to an entry
+	 */
+	hash_table_t *hash_table;
+
+	/* The first (most recently used) entry
+	 */
+	resource_file_cache_entry_t *first_entry;
+
+	/* The last (least recently used) entry
+	 */
+	resource_file_cache_entry_t *last_entry;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The size of the resource sections of the cached resource files
+	 */
+	size64_t size;
+
+	/* The maximum size of the resource sections of the cached resource files
+	 * 0 represents no maximum
+	 */
+	size64_t maximum_size;
+
+	/* The number of hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of misses
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of evictions
+	 */
+	uint64_t number_of_evictions;
+
+	/* The lookup key
+	 * The key is reused so that a resource file can be retrieved without allocating memory
+	 */
+	system_character_t *lookup_key;
+
+	/* The number of characters that fit in the lookup key
+	 */
+	size_t lookup_key_length;
+};
+
+int resource_file_cache_initialize(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_free(
+     resource_file_cache_t **resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_entry_free(
+     resource_file_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int resource_file_cache_empty(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_copy_key(
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     system_character_t *key,
+     size_t key_length,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_key(
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     system_character_t **key,
+     size_t *key_size,
+     libcerror_error_t **error );
+
+int resource_file_cache_remove_last_entry(
+     resource_file_cache_t *resource_file_cache,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_maximum_values(
+     resource_file_cache_t *resource_file_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int resource_file_cache_get_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t **resource_file,
+     libcerror_error_t **error );
+
+int resource_file_cache_set_resource_file(
+     resource_file_cache_t *resource_file_cache,
+     const system_character_t *resource_filename,
+     size_t resource_filename_length,
+     resource_file_t *resource_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _RESOURCE_FILE_CACHE_H ) */
+
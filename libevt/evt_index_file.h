@@ -0,0 +1,115 @@
+/*
+ * Index file of the Windows Event Log (EVT) format
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EVT_INDEX_FILE_H )
+#define _EVT_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The index file is not part of the EVT format, it is created by libevt
+ * to store the result of reading the records of an EVT file.
+ * The header is followed by the record entries and the recovered record entries.
+ */
+typedef struct evt_index_file_header evt_index_file_header_t;
+
+struct evt_index_file_header
+{
+	/* Signature
+	 * Consists of 8 bytes
+	 * "EVTIDX\x00\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* Format version
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The IO handle flags
+	 */
+	uint8_t io_handle_flags[ 4 ];
+
+	/* The size of the EVT file
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The data of the EVT file header
+	 */
+	uint8_t file_header_data[ 48 ];
+
+	/* The data of the end of file record
+	 * at the end of file record offset in the EVT file header
+	 */
+	uint8_t end_of_file_record_data[ 40 ];
+
+	/* The number of record entries
+	 */
+	uint8_t number_of_records[ 4 ];
+
+	/* The number of recovered record entries
+	 */
+	uint8_t number_of_recovered_records[ 4 ];
+};
+
+typedef struct evt_index_file_record_entry evt_index_file_record_entry_t;
+
+struct evt_index_file_record_entry
+{
+	/* The record offset
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The record size
+	 */
+	uint8_t size[ 4 ];
+
+	/* The record number
+	 */
+	uint8_t record_number[ 4 ];
+
+	/* The last written time
+	 */
+	uint8_t written_time[ 4 ];
+};
+
+typedef struct evt_index_file_recovered_record_entry evt_index_file_recovered_record_entry_t;
+
+struct evt_index_file_recovered_record_entry
+{
+	/* The record offset
+	 */
+	uint8_t offset[ 4 ];
+
+	/* The record size
+	 */
+	uint8_t size[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EVT_INDEX_FILE_H ) */
+
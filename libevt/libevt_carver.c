@@ -0,0 +1,973 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_carver.h"
+#include "libevt_codepage.h"
+#include "libevt_definitions.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcnotify.h"
+#include "libevt_record.h"
+#include "libevt_record_values.h"
+#include "libevt_signature_scanner.h"
+
+#include "evt_record.h"
+
+/* Creates a carver
+ * Make sure the value carver is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_carver_initialize(
+     libevt_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	static char *function                     = "libevt_carver_initialize";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid carver value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = memory_allocate_structure(
+	                   libevt_internal_carver_t );
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create carver.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_carver,
+	     0,
+	     sizeof( libevt_internal_carver_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear carver.",
+		 function );
+
+		memory_free(
+		 internal_carver );
+
+		return( -1 );
+	}
+	if( libevt_io_handle_initialize(
+	     &( internal_carver->io_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	internal_carver->scan_block_size = LIBEVT_CARVER_SCAN_BLOCK_SIZE;
+
+	*carver = (libevt_carver_t *) internal_carver;
+
+	return( 1 );
+
+on_error:
+	if( internal_carver != NULL )
+	{
+		memory_free(
+		 internal_carver );
+	}
+	return( -1 );
+}
+
+/* Frees a carver
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_carver_free(
+     libevt_carver_t **carver,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	static char *function                     = "libevt_carver_free";
+	int result                                = 1;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( *carver != NULL )
+	{
+		internal_carver = (libevt_internal_carver_t *) *carver;
+		*carver         = NULL;
+
+		if( libevt_io_handle_free(
+		     &( internal_carver->io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_carver );
+	}
+	return( result );
+}
+
+/* Signals the carver to abort its current activity
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_carver_signal_abort(
+     libevt_carver_t *carver,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	static char *function                     = "libevt_carver_signal_abort";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevt_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->abort = 1;
+
+	return( 1 );
+}
+
+/* Retrieves the carver ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_carver_get_ascii_codepage(
+     libevt_carver_t *carver,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	static char *function                     = "libevt_carver_get_ascii_codepage";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevt_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	*ascii_codepage = internal_carver->io_handle->ascii_codepage;
+
+	return( 1 );
+}
+
+/* Sets the carver ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_carver_set_ascii_codepage(
+     libevt_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	static char *function                     = "libevt_carver_set_ascii_codepage";
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevt_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVT_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver->io_handle->ascii_codepage = ascii_codepage;
+
+	return( 1 );
+}
+
+/* Reads the record values of a candidate event record
+ * The record data must contain the entire record, including the copy of the record size
+ * Returns 1 if successful, 0 if the data does not contain a valid event record or -1 on error
+ */
+int libevt_carver_read_record_values(
+     libevt_internal_carver_t *internal_carver,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevt_record_values_t *safe_record_values = NULL;
+	static char *function                      = "libevt_carver_read_record_values";
+
+	if( internal_carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid record data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data_size < ( sizeof( evt_record_event_header_t ) + 4 ) )
+	{
+		return( 0 );
+	}
+	if( libevt_record_values_initialize(
+	     &safe_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	/* Strict mode is used so that the copy of the record size at the end
+	 * of the record is validated, which rules out most false positives
+	 */
+	if( libevt_record_values_read_data(
+	     safe_record_values,
+	     record_data,
+	     record_data_size,
+	     1,
+	     error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to read candidate record at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+		libcerror_error_free(
+		 error );
+
+		libevt_record_values_free(
+		 &safe_record_values,
+		 NULL );
+
+		return( 0 );
+	}
+	if( safe_record_values->type != LIBEVT_RECORD_TYPE_EVENT )
+	{
+		if( libevt_record_values_free(
+		     &safe_record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
+	}
+	safe_record_values->offset = record_offset;
+
+	*record_values = safe_record_values;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &safe_record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Scans a range of a Basic File IO (bfio) handle for event records
+ * The data in the range does not need to be an EVT file, for example a pagefile,
+ * memory image or unallocated space. Only 32-bit aligned offsets relative to the
+ * start of the range are considered. The range is read sequentially in large blocks
+ * and only the records that extend beyond the end of a block are read separately.
+ * If the range size is 0 the range extends to the end of the file IO handle.
+ *
+ * The record callback is called for every event record that was found. The record
+ * is only valid for the duration of the callback. The callback returns 1 to continue
+ * the scan, 0 to stop the scan or -1 on error.
+ *
+ * Returns 1 if successful, 0 if the scan was stopped or aborted or -1 on error
+ */
+int libevt_carver_scan_file_io_handle(
+     libevt_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*record_callback)(
+            libevt_record_t *record,
+            off64_t record_offset,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libevt_internal_carver_t *internal_carver = NULL;
+	libevt_record_t *record                   = NULL;
+	libevt_record_values_t *record_values     = NULL;
+	uint8_t *record_data                      = NULL;
+	uint8_t *scan_block                       = NULL;
+	static char *function                     = "libevt_carver_scan_file_io_handle";
+	size64_t file_size                        = 0;
+	size_t read_size                          = 0;
+	size_t record_block_offset                = 0;
+	size_t scan_block_offset                  = 0;
+	size_t signature_offset                   = 0;
+	ssize_t read_count                        = 0;
+	off64_t block_offset                      = 0;
+	off64_t range_end_offset                  = 0;
+	off64_t record_offset                     = 0;
+	uint32_t record_size                      = 0;
+	uint8_t signature_flag                    = 0;
+	int callback_result                       = 1;
+	int result                                = 0;
+
+	if( carver == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid carver.",
+		 function );
+
+		return( -1 );
+	}
+	internal_carver = (libevt_internal_carver_t *) carver;
+
+	if( internal_carver->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid carver - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_carver->scan_block_size < 8 )
+	 || ( internal_carver->scan_block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid carver - scan block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( range_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid range offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size64_t) range_offset > file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid range offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( range_size == 0 )
+	 || ( range_size > ( file_size - range_offset ) ) )
+	{
+		range_size = file_size - range_offset;
+	}
+	internal_carver->io_handle->abort     = 0;
+	internal_carver->io_handle->file_size = file_size;
+
+	scan_block = (uint8_t *) memory_allocate(
+	                          sizeof( uint8_t ) * internal_carver->scan_block_size );
+
+	if( scan_block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan block.",
+		 function );
+
+		goto on_error;
+	}
+	block_offset     = range_offset;
+	range_end_offset = range_offset + (off64_t) range_size;
+
+	/* Every block starts with the 4 bytes of the record size that precede
+	 * the first signature that is considered in the block
+	 */
+	while( ( range_end_offset - block_offset ) >= 8 )
+	{
+		if( internal_carver->io_handle->abort != 0 )
+		{
+			callback_result = 0;
+
+			break;
+		}
+		read_size = internal_carver->scan_block_size;
+
+		if( (size64_t) read_size > (size64_t) ( range_end_offset - block_offset ) )
+		{
+			read_size = (size_t) ( range_end_offset - block_offset );
+		}
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     block_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek scan block offset: %" PRIi64 ".",
+			 function,
+			 block_offset );
+
+			goto on_error;
+		}
+		read_count = libbfio_handle_read_buffer(
+			      file_io_handle,
+			      scan_block,
+			      read_size,
+			      error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read scan block at offset: %" PRIi64 ".",
+			 function,
+			 block_offset );
+
+			goto on_error;
+		}
+		scan_block_offset = 4;
+
+		while( ( scan_block_offset + 4 ) <= read_size )
+		{
+			result = libevt_signature_scanner_scan(
+			          scan_block,
+			          read_size,
+			          scan_block_offset,
+			          LIBEVT_SIGNATURE_FLAG_RECORD,
+			          internal_carver->io_handle->scan_method,
+			          &signature_offset,
+			          &signature_flag,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan block at offset: %" PRIi64 " for signature.",
+				 function,
+				 block_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				/* Continue at the first 32-bit value that was not scanned
+				 */
+				scan_block_offset += ( ( read_size - scan_block_offset ) / 4 ) * 4;
+
+				break;
+			}
+			record_block_offset = signature_offset - 4;
+			record_offset       = block_offset + record_block_offset;
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( scan_block[ record_block_offset ] ),
+			 record_size );
+
+			if( ( record_size < ( sizeof( evt_record_event_header_t ) + 4 ) )
+			 || ( record_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			 || ( (size64_t) record_size > (size64_t) ( range_end_offset - record_offset ) ) )
+			{
+				scan_block_offset = signature_offset + 4;
+
+				continue;
+			}
+			if( (size_t) record_size > ( read_size - record_block_offset ) )
+			{
+				/* Continue with a block that starts at the record, unless
+				 * the record is larger than the block size
+				 */
+				if( ( record_block_offset > 0 )
+				 && ( (size_t) record_size <= internal_carver->scan_block_size ) )
+				{
+					scan_block_offset = signature_offset;
+
+					break;
+				}
+				record_data = (uint8_t *) memory_allocate(
+				                           sizeof( uint8_t ) * record_size );
+
+				if( record_data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create record data.",
+					 function );
+
+					goto on_error;
+				}
+				if( libbfio_handle_seek_offset(
+				     file_io_handle,
+				     record_offset,
+				     SEEK_SET,
+				     error ) == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_SEEK_FAILED,
+					 "%s: unable to seek record offset: %" PRIi64 ".",
+					 function,
+					 record_offset );
+
+					goto on_error;
+				}
+				read_count = libbfio_handle_read_buffer(
+					      file_io_handle,
+					      record_data,
+					      (size_t) record_size,
+					      error );
+
+				if( read_count != (ssize_t) record_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read record data at offset: %" PRIi64 ".",
+					 function,
+					 record_offset );
+
+					goto on_error;
+				}
+				result = libevt_carver_read_record_values(
+				          internal_carver,
+				          record_data,
+				          (size_t) record_size,
+				          record_offset,
+				          &record_values,
+				          error );
+
+				memory_free(
+				 record_data );
+
+				record_data = NULL;
+			}
+			else
+			{
+				result = libevt_carver_read_record_values(
+				          internal_carver,
+				          &( scan_block[ record_block_offset ] ),
+				          (size_t) record_size,
+				          record_offset,
+				          &record_values,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record values at offset: %" PRIi64 ".",
+				 function,
+				 record_offset );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				scan_block_offset = signature_offset + 4;
+
+				continue;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: carved record at offset: %" PRIi64 " (0x%08" PRIx64 ") of size: %" PRIu32 "\n",
+				 function,
+				 record_offset,
+				 record_offset,
+				 record_size );
+			}
+#endif
+			if( libevt_record_initialize(
+			     &record,
+			     internal_carver->io_handle,
+			     file_io_handle,
+			     record_values,
+			     NULL,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create record.",
+				 function );
+
+				goto on_error;
+			}
+			callback_result = record_callback(
+			                   record,
+			                   record_offset,
+			                   callback_data,
+			                   error );
+
+			if( callback_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: record callback failed for record at offset: %" PRIi64 ".",
+				 function,
+				 record_offset );
+
+				goto on_error;
+			}
+			if( libevt_record_free(
+			     &record,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_record_values_free(
+			     &record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record values.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( callback_result == 0 )
+			 || ( internal_carver->io_handle->abort != 0 ) )
+			{
+				callback_result = 0;
+
+				break;
+			}
+			/* Continue at the first 32-bit value after the record, since the
+			 * copy of the record size was validated when the record values were
+			 * read. The record size is not necessarily a multitude of 4 and the
+			 * scan block offset can be beyond the read size if the record was
+			 * read separately
+			 */
+			scan_block_offset = record_block_offset + (size_t) record_size;
+
+			if( ( scan_block_offset % 4 ) != 0 )
+			{
+				scan_block_offset += 4 - ( scan_block_offset % 4 );
+			}
+		}
+		if( callback_result == 0 )
+		{
+			break;
+		}
+		block_offset += (off64_t) scan_block_offset - 4;
+	}
+	memory_free(
+	 scan_block );
+
+	return( callback_result );
+
+on_error:
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	if( scan_block != NULL )
+	{
+		memory_free(
+		 scan_block );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,106 @@
+/*
+ * Carver functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_CARVER_H )
+#define _LIBEVT_CARVER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_record_values.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_carver libevt_internal_carver_t;
+
+struct libevt_internal_carver
+{
+	/* The IO handle
+	 */
+	libevt_io_handle_t *io_handle;
+
+	/* The scan block size
+	 */
+	size_t scan_block_size;
+};
+
+LIBEVT_EXTERN \
+int libevt_carver_initialize(
+     libevt_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_carver_free(
+     libevt_carver_t **carver,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_carver_signal_abort(
+     libevt_carver_t *carver,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_carver_get_ascii_codepage(
+     libevt_carver_t *carver,
+     int *ascii_codepage,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_carver_set_ascii_codepage(
+     libevt_carver_t *carver,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libevt_carver_read_record_values(
+     libevt_internal_carver_t *internal_carver,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_carver_scan_file_io_handle(
+     libevt_carver_t *carver,
+     libbfio_handle_t *file_io_handle,
+     off64_t range_offset,
+     size64_t range_size,
+     int (*record_callback)(
+            libevt_record_t *record,
+            off64_t record_offset,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_CARVER_H ) */
+
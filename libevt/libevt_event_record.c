@@ -131,16 +131,9 @@ int libevt_event_record_free(
 	}
 	if( *event_record != NULL )
 	{
-		if( ( *event_record )->source_name != NULL )
-		{
-			memory_free(
-			 ( *event_record )->source_name );
-		}
-		if( ( *event_record )->computer_name != NULL )
-		{
-			memory_free(
-			 ( *event_record )->computer_name );
-		}
+		/* The source name, computer name and data values reference
+		 * the record data and are not freed separately
+		 */
 		if( ( *event_record )->user_security_identifier != NULL )
 		{
 			if( libfwnt_security_identifier_free(
@@ -173,10 +166,10 @@ int libevt_event_record_free(
 				result = -1;
 			}
 		}
-		if( ( *event_record )->data != NULL )
+		if( ( *event_record )->record_data != NULL )
 		{
 			memory_free(
-			 ( *event_record )->data );
+			 ( *event_record )->record_data );
 		}
 		memory_free(
 		 *event_record );
@@ -198,6 +191,7 @@ int libevt_event_record_read_data(
 	const uint8_t *computer_name             = NULL;
 	const uint8_t *event_data                = NULL;
 	const uint8_t *event_strings             = NULL;
+	const uint8_t *record_data               = NULL;
 	const uint8_t *source_name               = NULL;
 	const uint8_t *user_security_identifier  = NULL;
 	static char *function                    = "libevt_event_record_read_data";
@@ -230,24 +224,13 @@ int libevt_event_record_read_data(
 
 		return( -1 );
 	}
-	if( event_record->source_name != NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid event record - source name value already set.",
-		 function );
-
-		return( -1 );
-	}
-	if( event_record->computer_name != NULL )
+	if( event_record->record_data != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid event record - computer name value already set.",
+		 "%s: invalid event record - record data value already set.",
 		 function );
 
 		return( -1 );
@@ -296,13 +279,13 @@ int libevt_event_record_read_data(
 
 		return( -1 );
 	}
-	if( data_size > (size_t) SSIZE_MAX )
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid data size value exceeds maximum.",
+		 "%s: invalid data size value exceeds maximum allocation size.",
 		 function );
 
 		return( -1 );
@@ -335,6 +318,41 @@ int libevt_event_record_read_data(
 
 		goto on_error;
 	}
+	/* The record data is copied once, the source name, computer name,
+	 * strings and data values reference this copy
+	 */
+	event_record->record_data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * data_size );
+
+	if( event_record->record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     event_record->record_data,
+	     data,
+	     sizeof( uint8_t ) * data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy record data.",
+		 function );
+
+		goto on_error;
+	}
+	event_record->record_data_size = data_size;
+
+	record_data = event_record->record_data;
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (evt_event_record_t *) data )->size,
 	 event_record->record_size );
@@ -511,7 +529,7 @@ int libevt_event_record_read_data(
 
 	data_offset = sizeof( evt_event_record_t );
 
-	source_name      = &( data[ data_offset ] );
+	source_name      = &( record_data[ data_offset ] );
 	source_name_size = 0;
 
 	while( ( data_offset + 1 ) < maximum_data_size )
@@ -552,48 +570,10 @@ int libevt_event_record_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( source_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid source name size value exceeds maximum allocation size.",
-			 function );
-
-			goto on_error;
-		}
-		event_record->source_name = (uint8_t *) memory_allocate(
-		                                         sizeof( uint8_t ) * source_name_size );
-
-		if( event_record->source_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create source name.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     event_record->source_name,
-		     source_name,
-		     sizeof( uint8_t ) * source_name_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy source name.",
-			 function );
-
-			goto on_error;
-		}
+		event_record->source_name      = source_name;
 		event_record->source_name_size = source_name_size;
 	}
-	computer_name      = &( data[ data_offset ] );
+	computer_name      = &( record_data[ data_offset ] );
 	computer_name_size = 0;
 
 	while( ( data_offset + 1 ) < maximum_data_size )
@@ -634,45 +614,7 @@ int libevt_event_record_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( computer_name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid computer name size value exceeds maximum allocation size.",
-			 function );
-
-			goto on_error;
-		}
-		event_record->computer_name = (uint8_t *) memory_allocate(
-		                                           sizeof( uint8_t ) * computer_name_size );
-
-		if( event_record->computer_name == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create computer name.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     event_record->computer_name,
-		     computer_name,
-		     sizeof( uint8_t ) * computer_name_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy computer name.",
-			 function );
-
-			goto on_error;
-		}
+		event_record->computer_name      = computer_name;
 		event_record->computer_name_size = computer_name_size;
 	}
 /* TODO use dtFabric condition rules to generate code below */
@@ -795,7 +737,7 @@ int libevt_event_record_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		event_strings      = &( data[ event_strings_offset ] );
+		event_strings      = &( record_data[ event_strings_offset ] );
 		event_strings_size = maximum_strings_data_size - event_strings_offset;
 
 		if( libevt_strings_array_initialize(
@@ -854,7 +796,7 @@ int libevt_event_record_read_data(
 
 			goto on_error;
 		}
-		event_data = &( data[ data_offset ] );
+		event_data = &( record_data[ data_offset ] );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
@@ -869,45 +811,7 @@ int libevt_event_record_read_data(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-		if( event_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-			 "%s: invalid event data size value exceeds maximum allocation size.",
-			 function );
-
-			goto on_error;
-		}
-		event_record->data = (uint8_t *) memory_allocate(
-		                                  sizeof( uint8_t ) * event_data_size );
-
-		if( event_record->data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-			 "%s: unable to create data.",
-			 function );
-
-			goto on_error;
-		}
-		if( memory_copy(
-		     event_record->data,
-		     event_data,
-		     sizeof( uint8_t ) * event_data_size ) == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-			 "%s: unable to copy data.",
-			 function );
-
-			goto on_error;
-		}
+		event_record->data      = event_data;
 		event_record->data_size = event_data_size;
 
 		data_offset += event_data_size;
@@ -948,15 +852,6 @@ int libevt_event_record_read_data(
 	return( 1 );
 
 on_error:
-	if( event_record->data != NULL )
-	{
-		memory_free(
-		 event_record->data );
-
-		event_record->data = NULL;
-	}
-	event_record->data_size = 0;
-
 	if( event_record->strings != NULL )
 	{
 		libevt_strings_array_free(
@@ -969,23 +864,20 @@ on_error:
 		 &( event_record->user_security_identifier ),
 		 NULL );
 	}
-	if( event_record->computer_name != NULL )
+	if( event_record->record_data != NULL )
 	{
 		memory_free(
-		 event_record->computer_name );
+		 event_record->record_data );
 
-		event_record->computer_name = NULL;
+		event_record->record_data = NULL;
 	}
+	event_record->record_data_size   = 0;
+	event_record->source_name        = NULL;
+	event_record->source_name_size   = 0;
+	event_record->computer_name      = NULL;
 	event_record->computer_name_size = 0;
-
-	if( event_record->source_name != NULL )
-	{
-		memory_free(
-		 event_record->source_name );
-
-		event_record->source_name = NULL;
-	}
-	event_record->source_name_size = 0;
+	event_record->data               = NULL;
+	event_record->data_size          = 0;
 
 	return( -1 );
 }
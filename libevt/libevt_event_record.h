@@ -37,6 +37,14 @@ typedef struct libevt_event_record libevt_event_record_t;
 
 struct libevt_event_record
 {
+	/* The record data
+	 */
+	uint8_t *record_data;
+
+	/* The record data size
+	 */
+	size_t record_data_size;
+
 	/* Record size
 	 */
 	uint32_t record_size;
@@ -66,16 +74,18 @@ struct libevt_event_record
 	uint16_t event_category;
 
 	/* Source name
+	 * This is a reference into the record data
 	 */
-	uint8_t *source_name;
+	const uint8_t *source_name;
 
 	/* Source name size
 	 */
 	size_t source_name_size;
 
 	/* Computer name
+	 * This is a reference into the record data
 	 */
-	uint8_t *computer_name;
+	const uint8_t *computer_name;
 
 	/* Computer name size
 	 */
@@ -90,8 +100,9 @@ struct libevt_event_record
 	libevt_strings_array_t *strings;
 
 	/* Data
+	 * This is a reference into the record data
 	 */
-	uint8_t *data;
+	const uint8_t *data;
 
 	/* Data size
 	 */
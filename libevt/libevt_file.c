@@ -31,15 +31,21 @@
 #include "libevt_io_handle.h"
 #include "libevt_file.h"
 #include "libevt_file_header.h"
+#include "libevt_index_file.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
 #include "libevt_libcthreads.h"
-#include "libevt_libfcache.h"
-#include "libevt_libfdata.h"
+#include "libevt_mapped_file.h"
+#include "libevt_offset_table.h"
 #include "libevt_record.h"
+#include "libevt_record_number_index.h"
 #include "libevt_record_values.h"
+#include "libevt_records_cache.h"
+#include "libevt_scan_context.h"
+#include "libevt_timestamp_index.h"
 
+#include "evt_end_of_file_record.h"
 #include "evt_file_header.h"
 
 /* Creates a file
@@ -119,47 +125,62 @@ int libevt_file_initialize(
 
 		goto on_error;
 	}
-	if( libfdata_list_initialize(
-	     &( internal_file->records_list ),
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevt_record_values_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libevt_offset_table_initialize(
+	     &( internal_file->records_table ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create records list.",
+		 "%s: unable to create records table.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_list_initialize(
-	     &( internal_file->recovered_records_list ),
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_list_element_t *, libfdata_cache_t *, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libevt_record_values_read_element_data,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libevt_offset_table_initialize(
+	     &( internal_file->recovered_records_table ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create recovered records list.",
+		 "%s: unable to create recovered records table.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
+	if( libevt_record_number_index_initialize(
+	     &( internal_file->record_number_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_timestamp_index_initialize(
+	     &( internal_file->timestamp_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_records_cache_initialize(
 	     &( internal_file->records_cache ),
 	     LIBEVT_MAXIMUM_CACHE_ENTRIES_RECORDS,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -185,6 +206,19 @@ int libevt_file_initialize(
 
 		goto on_error;
 	}
+	if( libcthreads_mutex_initialize(
+	     &( internal_file->file_io_handle_mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize file IO handle mutex.",
+		 function );
+
+		goto on_error;
+	}
 #endif
 	*file = (libevt_file_t *) internal_file;
 
@@ -193,16 +227,42 @@ int libevt_file_initialize(
 on_error:
 	if( internal_file != NULL )
 	{
-		if( internal_file->recovered_records_list != NULL )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( internal_file->read_write_lock != NULL )
 		{
-			libfdata_list_free(
-			 &( internal_file->recovered_records_list ),
+			libcthreads_read_write_lock_free(
+			 &( internal_file->read_write_lock ),
 			 NULL );
 		}
-		if( internal_file->records_list != NULL )
+#endif
+		if( internal_file->records_cache != NULL )
+		{
+			libevt_records_cache_free(
+			 &( internal_file->records_cache ),
+			 NULL );
+		}
+		if( internal_file->timestamp_index != NULL )
+		{
+			libevt_timestamp_index_free(
+			 &( internal_file->timestamp_index ),
+			 NULL );
+		}
+		if( internal_file->record_number_index != NULL )
+		{
+			libevt_record_number_index_free(
+			 &( internal_file->record_number_index ),
+			 NULL );
+		}
+		if( internal_file->recovered_records_table != NULL )
+		{
+			libevt_offset_table_free(
+			 &( internal_file->recovered_records_table ),
+			 NULL );
+		}
+		if( internal_file->records_table != NULL )
 		{
-			libfdata_list_free(
-			 &( internal_file->records_list ),
+			libevt_offset_table_free(
+			 &( internal_file->records_table ),
 			 NULL );
 		}
 		if( internal_file->io_handle != NULL )
@@ -261,6 +321,23 @@ int libevt_file_free(
 		}
 		*file = NULL;
 
+		if( internal_file->index_file_io_handle != NULL )
+		{
+			if( libbfio_handle_free(
+			     &( internal_file->index_file_io_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free index file IO handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 		if( libcthreads_read_write_lock_free(
 		     &( internal_file->read_write_lock ),
@@ -275,8 +352,21 @@ int libevt_file_free(
 
 			result = -1;
 		}
+		if( libcthreads_mutex_free(
+		     &( internal_file->file_io_handle_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle mutex.",
+			 function );
+
+			result = -1;
+		}
 #endif
-		if( libfcache_cache_free(
+		if( libevt_records_cache_free(
 		     &( internal_file->records_cache ),
 		     error ) != 1 )
 		{
@@ -289,28 +379,54 @@ int libevt_file_free(
 
 			result = -1;
 		}
-		if( libfdata_list_free(
-		     &( internal_file->recovered_records_list ),
+		if( libevt_timestamp_index_free(
+		     &( internal_file->timestamp_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timestamp index.",
+			 function );
+
+			result = -1;
+		}
+		if( libevt_record_number_index_free(
+		     &( internal_file->record_number_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record number index.",
+			 function );
+
+			result = -1;
+		}
+		if( libevt_offset_table_free(
+		     &( internal_file->recovered_records_table ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free recovered records list.",
+			 "%s: unable to free recovered records table.",
 			 function );
 
 			result = -1;
 		}
-		if( libfdata_list_free(
-		     &( internal_file->records_list ),
+		if( libevt_offset_table_free(
+		     &( internal_file->records_table ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free records list.",
+			 "%s: unable to free records table.",
 			 function );
 
 			result = -1;
@@ -717,20 +833,20 @@ on_error:
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
-/* Opens a file using a Basic File IO (bfio) handle
+/* Opens a file using a memory mapping of the file
+ * The records are read directly from the mapped data
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_open_file_io_handle(
+int libevt_file_open_mapped(
      libevt_file_t *file,
-     libbfio_handle_t *file_io_handle,
+     const char *filename,
      int access_flags,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle      = NULL;
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_open_file_io_handle";
-	int bfio_access_flags                 = 0;
-	int file_io_handle_is_open            = 0;
-	int file_io_handle_opened_in_library  = 0;
+	libevt_mapped_file_t *mapped_file     = NULL;
+	static char *function                 = "libevt_file_open_mapped";
 
 	if( file == NULL )
 	{
@@ -745,24 +861,24 @@ int libevt_file_open_file_io_handle(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_io_handle != NULL )
+	if( internal_file->mapped_file != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file IO handle already set.",
+		 "%s: invalid file - mapped file already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( file_io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file IO handle.",
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
@@ -790,54 +906,80 @@ int libevt_file_open_file_io_handle(
 
 		return( -1 );
 	}
-	if( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) != 0 )
+	if( libevt_mapped_file_initialize(
+	     &mapped_file,
+	     error ) != 1 )
 	{
-		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
-	}
-	file_io_handle_is_open = libbfio_handle_is_open(
-	                          file_io_handle,
-	                          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create mapped file.",
+		 function );
 
-	if( file_io_handle_is_open == -1 )
+		goto on_error;
+	}
+	if( libevt_mapped_file_open(
+	     mapped_file,
+	     filename,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
 		 LIBCERROR_IO_ERROR_OPEN_FAILED,
-		 "%s: unable to determine if file IO handle is open.",
+		 "%s: unable to map file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	/* The file header and record scans use the file IO handle
+	 * which reads from the mapped data without system calls
+	 */
+	if( libbfio_memory_range_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	else if( file_io_handle_is_open == 0 )
+	if( libbfio_memory_range_set(
+	     file_io_handle,
+	     mapped_file->data,
+	     mapped_file->data_size,
+	     error ) != 1 )
 	{
-		if( libbfio_handle_open(
-		     file_io_handle,
-		     bfio_access_flags,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_OPEN_FAILED,
-			 "%s: unable to open file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set memory range of file IO handle.",
+		 function );
 
-			goto on_error;
-		}
-		file_io_handle_opened_in_library = 1;
+		goto on_error;
 	}
-	if( libevt_file_open_read(
-	     internal_file,
+	internal_file->io_handle->mapped_data = mapped_file->data;
+
+	if( libevt_file_open_file_io_handle(
+	     file,
 	     file_io_handle,
+	     access_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read from file handle.",
-		 function );
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
 
 		goto on_error;
 	}
@@ -856,8 +998,8 @@ int libevt_file_open_file_io_handle(
 		goto on_error;
 	}
 #endif
-	internal_file->file_io_handle                   = file_io_handle;
-	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+	internal_file->file_io_handle_created_in_library = 1;
+	internal_file->mapped_file                       = mapped_file;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_write(
@@ -871,8 +1013,8 @@ int libevt_file_open_file_io_handle(
 		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		internal_file->file_io_handle                   = NULL;
-		internal_file->file_io_handle_opened_in_library = 0;
+		internal_file->file_io_handle_created_in_library = 0;
+		internal_file->mapped_file                       = NULL;
 
 		goto on_error;
 	}
@@ -880,25 +1022,37 @@ int libevt_file_open_file_io_handle(
 	return( 1 );
 
 on_error:
-	if( file_io_handle_opened_in_library != 0 )
+	internal_file->io_handle->mapped_data = NULL;
+
+	if( file_io_handle != NULL )
 	{
-		libbfio_handle_close(
-		 file_io_handle,
-		 error );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( mapped_file != NULL )
+	{
+		libevt_mapped_file_free(
+		 &mapped_file,
+		 NULL );
 	}
 	return( -1 );
 }
 
-/* Closes a file
- * Returns 0 if successful or -1 on error
+/* Opens a file using a Basic File IO (bfio) handle
+ * Returns 1 if successful or -1 on error
  */
-int libevt_file_close(
+int libevt_file_open_file_io_handle(
      libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_close";
-	int result                            = 0;
+	static char *function                 = "libevt_file_open_file_io_handle";
+	int bfio_access_flags                 = 0;
+	int file_io_handle_is_open            = 0;
+	int file_io_handle_opened_in_library  = 0;
 
 	if( file == NULL )
 	{
@@ -913,187 +1067,279 @@ int libevt_file_close(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_io_handle == NULL )
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
-	     internal_file->read_write_lock,
-	     error ) != 1 )
+	if( file_io_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
 		 function );
 
 		return( -1 );
 	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) == 0 )
+	 && ( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) == 0 ) )
 	{
-		if( internal_file->file_io_handle_created_in_library != 0 )
-		{
-			if( libevt_debug_print_read_offsets(
-			     internal_file->file_io_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print the read offsets.",
-				 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported access flags.",
+		 function );
 
-				result = -1;
-			}
-		}
+		return( -1 );
 	}
-#endif
-	if( internal_file->file_io_handle_opened_in_library != 0 )
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_WRITE ) != 0 )
 	{
-		if( libbfio_handle_close(
-		     internal_file->file_io_handle,
-		     error ) != 0 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close file IO handle.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: write access currently not supported.",
+		 function );
 
-			result = -1;
-		}
-		internal_file->file_io_handle_opened_in_library = 0;
+		return( -1 );
 	}
-	if( internal_file->file_io_handle_created_in_library != 0 )
+	if( ( access_flags & LIBEVT_ACCESS_FLAG_READ ) != 0 )
 	{
-		if( libbfio_handle_free(
-		     &( internal_file->file_io_handle ),
+		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
+	}
+	file_io_handle_is_open = libbfio_handle_is_open(
+	                          file_io_handle,
+	                          error );
+
+	if( file_io_handle_is_open == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( file_io_handle_is_open == 0 )
+	{
+		if( libbfio_handle_open(
+		     file_io_handle,
+		     bfio_access_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free file IO handle.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
 			 function );
 
-			result = -1;
+			goto on_error;
 		}
-		internal_file->file_io_handle_created_in_library = 0;
+		file_io_handle_opened_in_library = 1;
 	}
-	internal_file->file_io_handle = NULL;
-
-	if( libevt_io_handle_clear(
-	     internal_file->io_handle,
+	if( libevt_file_open_read(
+	     internal_file,
+	     file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to clear IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read from file handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libevt_file_header_free(
-	     &( internal_file->file_header ),
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-	if( libfdata_list_empty(
-	     internal_file->records_list,
+#endif
+	internal_file->file_io_handle                   = file_io_handle;
+	internal_file->file_io_handle_opened_in_library = file_io_handle_opened_in_library;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty records list.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
-		result = -1;
+		internal_file->file_io_handle                   = NULL;
+		internal_file->file_io_handle_opened_in_library = 0;
+
+		goto on_error;
 	}
-	if( libfdata_list_empty(
-	     internal_file->recovered_records_list,
-	     error ) != 1 )
+#endif
+	return( 1 );
+
+on_error:
+	if( file_io_handle_opened_in_library != 0 )
+	{
+		libbfio_handle_close(
+		 file_io_handle,
+		 error );
+	}
+	return( -1 );
+}
+
+/* Sets the path of the index file
+ * The index file stores the records tables and indexes of the file. It is used
+ * on open if it matches the file otherwise it is (re)created after the records are read
+ * The path must be set before the file is opened
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_index_path(
+     libevt_file_t *file,
+     const char *index_path,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevt_internal_file_t *internal_file  = NULL;
+	static char *function                  = "libevt_file_set_index_path";
+	size_t index_path_length               = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty recovered records list.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
-		result = -1;
+		return( -1 );
 	}
-	if( libfcache_cache_empty(
-	     internal_file->records_cache,
+	if( index_path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index path.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to empty records cache.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
-		result = -1;
+		goto on_error;
 	}
-#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
-	     internal_file->read_write_lock,
+	index_path_length = narrow_string_length(
+	                     index_path );
+
+	if( libbfio_file_set_name(
+	     index_file_io_handle,
+	     index_path,
+	     index_path_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to set filename in index file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#endif
-	return( result );
+	if( internal_file->index_file_io_handle != NULL )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->index_file_io_handle = index_file_io_handle;
+
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Opens a file for reading
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Sets the path of the index file
+ * The path must be set before the file is opened
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_open_read(
-     libevt_internal_file_t *internal_file,
-     libbfio_handle_t *file_io_handle,
+int libevt_file_set_index_path_wide(
+     libevt_file_t *file,
+     const wchar_t *index_path,
      libcerror_error_t **error )
 {
-	static char *function      = "libevt_file_open_read";
-	off64_t last_record_offset = 0;
-	uint32_t header_size       = 0;
-	int result_record_read     = 0;
-	int result_record_recovery = 0;
+	libbfio_handle_t *index_file_io_handle = NULL;
+	libevt_internal_file_t *internal_file  = NULL;
+	static char *function                  = "libevt_file_set_index_path_wide";
+	size_t index_path_length               = 0;
 
-	if( internal_file == NULL )
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1104,228 +1350,3835 @@ int libevt_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->io_handle == NULL )
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file IO handle already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->file_header != NULL )
+	if( index_path == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - file header already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index path.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
-
-	if( libbfio_handle_get_size(
-	     file_io_handle,
-	     &( internal_file->io_handle->file_size ),
+	if( libbfio_file_initialize(
+	     &index_file_io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve file size.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "Reading file header:\n" );
-	}
-#endif
-	if( libevt_file_header_initialize(
-	     &( internal_file->file_header ),
+	index_path_length = wide_string_length(
+	                     index_path );
+
+	if( libbfio_file_set_name_wide(
+	     index_file_io_handle,
+	     index_path,
+	     index_path_length + 1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create file header.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in index file IO handle.",
 		 function );
 
 		goto on_error;
 	}
-	if( libevt_file_header_read_file_io_handle(
-	     internal_file->file_header,
-	     file_io_handle,
-	     0,
-	     error ) != 1 )
+	if( internal_file->index_file_io_handle != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read file header.",
-		 function );
+		if( libbfio_handle_free(
+		     &( internal_file->index_file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index file IO handle.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
-	header_size = internal_file->file_header->size;
+	internal_file->index_file_io_handle = index_file_io_handle;
 
-	if( header_size != internal_file->file_header->copy_of_size )
+	return( 1 );
+
+on_error:
+	if( index_file_io_handle != NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: value mismatch for size and copy of size ( %" PRIu32 " != %" PRIu32 " ).\n",
-			 function,
-			 header_size,
-			 internal_file->file_header->copy_of_size );
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Closes a file
+ * Returns 0 if successful or -1 on error
+ */
+int libevt_file_close(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_close";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( internal_file->file_io_handle_created_in_library != 0 )
+		{
+			if( libevt_debug_print_read_offsets(
+			     internal_file->file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print the read offsets.",
+				 function );
+
+				result = -1;
+			}
 		}
+	}
 #endif
-		/* If the size does not match the header size assume size copy contains
-		 * the correct value for the next validation check
-		 */
-		if( header_size != sizeof( evt_file_header_t ) )
+	if( internal_file->file_io_handles_context != NULL )
+	{
+		if( libevt_scan_context_free(
+		     &( internal_file->file_io_handles_context ),
+		     error ) != 1 )
 		{
-			header_size = internal_file->file_header->copy_of_size;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handles context.",
+			 function );
+
+			result = -1;
 		}
-		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
 	}
-	if( (size_t) header_size != sizeof( evt_file_header_t ) )
+	if( internal_file->file_io_handle_opened_in_library != 0 )
+	{
+		if( libbfio_handle_close(
+		     internal_file->file_io_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_opened_in_library = 0;
+	}
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		if( libbfio_handle_free(
+		     &( internal_file->file_io_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handle.",
+			 function );
+
+			result = -1;
+		}
+		internal_file->file_io_handle_created_in_library = 0;
+	}
+	internal_file->file_io_handle = NULL;
+
+	/* The mapped file is freed after the file IO handle that references its data
+	 */
+	if( internal_file->mapped_file != NULL )
+	{
+		if( libevt_mapped_file_free(
+		     &( internal_file->mapped_file ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mapped file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libevt_io_handle_clear(
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_file_header_free(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file header.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_offset_table_empty(
+	     internal_file->records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records table.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_offset_table_empty(
+	     internal_file->recovered_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty recovered records table.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_record_number_index_empty(
+	     internal_file->record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty record number index.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_timestamp_index_empty(
+	     internal_file->timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty timestamp index.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_records_cache_empty(
+	     internal_file->records_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records cache.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_records_cache_set_pin_all(
+	     internal_file->records_cache,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to unpin records cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Refreshes the records of a file that is being written to
+ * Only the records written since the file was opened or last refreshed are read,
+ * unless the event log was cleared or re-collected, in which case all records are read again.
+ * Records that were overwritten are removed, hence record indexes can change
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_refresh(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_refresh";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of a memory mapped file is fixed when it is opened
+	 */
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported memory mapped file.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_file_refresh_read(
+	     internal_file,
+	     internal_file->file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to refresh records.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Opens a file for reading
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_open_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_open_read";
+	uint32_t header_size  = 0;
+	int result_index_read = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file - file header already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->abort = 0;
+
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &( internal_file->io_handle->file_size ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libevt_file_header_initialize(
+	     &( internal_file->file_header ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_read_file_io_handle(
+	     internal_file->file_header,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	header_size = internal_file->file_header->size;
+
+	if( header_size != internal_file->file_header->copy_of_size )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: value mismatch for size and copy of size ( %" PRIu32 " != %" PRIu32 " ).\n",
+			 function,
+			 header_size,
+			 internal_file->file_header->copy_of_size );
+		}
+#endif
+		/* If the size does not match the header size assume size copy contains
+		 * the correct value for the next validation check
+		 */
+		if( header_size != sizeof( evt_file_header_t ) )
+		{
+			header_size = internal_file->file_header->copy_of_size;
+		}
+		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	if( (size_t) header_size != sizeof( evt_file_header_t ) )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: header size: %" PRIu32 " does not match known value.\n",
+			 function,
+			 header_size );
+		}
+#endif
+		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+	}
+	if( internal_file->index_file_io_handle != NULL )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading index file:\n" );
+		}
+#endif
+		result_index_read = libevt_file_read_index_file(
+		                     internal_file,
+		                     file_io_handle,
+		                     error );
+
+		if( result_index_read == -1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+
+			result_index_read = 0;
+		}
+	}
+	/* The records are only read if no matching index file is available
+	 */
+	if( result_index_read == 0 )
+	{
+		if( libevt_file_read_records(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	/* The unused entries of the records tables are released, the records tables
+	 * are only extended again when the file is refreshed
+	 */
+	if( libevt_offset_table_resize(
+	     internal_file->records_table,
+	     internal_file->records_table->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_offset_table_resize(
+	     internal_file->recovered_records_table,
+	     internal_file->recovered_records_table->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize recovered records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_number_index_finalize(
+	     internal_file->record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_timestamp_index_finalize(
+	     internal_file->timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index file is (re)created if it could not be used, unless the read was aborted
+	 * since the records tables would be incomplete
+	 */
+	if( ( internal_file->index_file_io_handle != NULL )
+	 && ( result_index_read == 0 )
+	 && ( internal_file->io_handle->abort == 0 ) )
+	{
+		if( libevt_file_write_index_file(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	/* Records are read concurrently using clones of the file IO handle
+	 * if the file is not memory mapped and multiple threads are allowed.
+	 * If the file IO handle cannot be cloned the reads are serialized.
+	 */
+	if( ( internal_file->io_handle->mapped_data == NULL )
+	 && ( internal_file->io_handle->maximum_number_of_threads > 1 ) )
+	{
+		if( libevt_scan_context_initialize(
+		     &( internal_file->file_io_handles_context ),
+		     file_io_handle,
+		     internal_file->io_handle->maximum_number_of_threads,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	/* All records are kept in the records cache if the file does not exceed
+	 * the pin size
+	 */
+	if( ( internal_file->records_cache_pin_size > 0 )
+	 && ( internal_file->io_handle->file_size <= internal_file->records_cache_pin_size ) )
+	{
+		if( libevt_records_cache_set_pin_all(
+		     internal_file->records_cache,
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to pin records cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( 1 );
+
+on_error:
+	if( internal_file->file_header != NULL )
+	{
+		libevt_file_header_free(
+		 &( internal_file->file_header ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the records and recovers the records that are no longer part of the event log
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_read_records(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevt_file_read_records";
+	off64_t last_record_offset = 0;
+	int result_record_read     = 0;
+	int result_record_recovery = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading records:\n" );
+	}
+#endif
+	result_record_read = libevt_io_handle_read_records(
+	                      internal_file->io_handle,
+	                      file_io_handle,
+	                      internal_file->file_header->first_record_offset,
+	                      internal_file->file_header->end_of_file_record_offset,
+	                      internal_file->records_table,
+	                      internal_file->record_number_index,
+	                      internal_file->timestamp_index,
+	                      &last_record_offset,
+	                      error );
+
+	if( result_record_read != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read records.",
+		 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			if( ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+		}
+#endif
+	}
+	if( internal_file->io_handle->abort == 0 )
+	{
+		result_record_recovery = libevt_io_handle_recover_records(
+		                          internal_file->io_handle,
+		                          file_io_handle,
+		                          internal_file->file_header->first_record_offset,
+		                          internal_file->file_header->end_of_file_record_offset,
+		                          last_record_offset,
+		                          internal_file->records_table,
+		                          internal_file->record_number_index,
+		                          internal_file->timestamp_index,
+		                          internal_file->recovered_records_table,
+		                          error );
+
+		if( result_record_recovery != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( result_record_read != 1 )
+			{
+				libcerror_error_free(
+				 error );
+			}
+#endif
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to recover records.",
+			 function );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+		}
+	}
+	if( ( result_record_read != 1 )
+	 && ( result_record_recovery != 1 ) )
+	{
+		return( -1 );
+	}
+	if( ( error != NULL )
+	 && ( *error != NULL ) )
+	{
+		libcerror_error_free(
+		 error );
+	}
+	return( 1 );
+}
+
+/* Retrieves the current size of the file
+ * The file IO handle caches the size once it was retrieved, hence the size is
+ * retrieved from a newly opened clone of the file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_current_file_size(
+     libbfio_handle_t *file_io_handle,
+     size64_t *file_size,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *size_file_io_handle = NULL;
+	static char *function                 = "libevt_file_get_current_file_size";
+	int result                            = 0;
+
+	if( file_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_clone(
+	     &size_file_io_handle,
+	     file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	result = libbfio_handle_is_open(
+	          size_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to determine if file IO handle is open.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		if( libbfio_handle_open(
+		     size_file_io_handle,
+		     LIBBFIO_OPEN_READ,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_get_size(
+	     size_file_io_handle,
+	     file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( libbfio_handle_free(
+	     &size_file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( size_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &size_file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the records written since the records were last read
+ * The records tables and indexes are rebuilt in new instances that replace
+ * the current ones only on success, on error the previous state is retained
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_refresh_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libevt_file_header_t *file_header                          = NULL;
+	libevt_file_header_t *previous_file_header                 = NULL;
+	libevt_offset_table_t *new_records_table                   = NULL;
+	libevt_offset_table_t *new_recovered_records_table         = NULL;
+	libevt_offset_table_t *previous_records_table              = NULL;
+	libevt_offset_table_t *previous_recovered_records_table    = NULL;
+	libevt_offset_table_t *records_table                       = NULL;
+	libevt_record_number_index_t *new_record_number_index      = NULL;
+	libevt_record_number_index_t *previous_record_number_index = NULL;
+	libevt_record_number_index_t *record_number_index          = NULL;
+	libevt_timestamp_index_t *new_timestamp_index              = NULL;
+	libevt_timestamp_index_t *previous_timestamp_index         = NULL;
+	libevt_timestamp_index_t *timestamp_index                  = NULL;
+	uint32_t *new_record_numbers                               = NULL;
+	uint32_t *record_numbers                                   = NULL;
+	uint32_t *timestamps                                       = NULL;
+	static char *function                                      = "libevt_file_refresh_read";
+	size64_t file_size                                         = 0;
+	size64_t previous_file_size                                = 0;
+	off64_t last_record_offset                                 = 0;
+	uint32_t data_size                                         = 0;
+	uint32_t end_of_file_record_offset                         = 0;
+	uint32_t record_offset                                     = 0;
+	uint32_t record_position                                   = 0;
+	uint32_t written_size                                      = 0;
+	uint8_t previous_flags                                     = 0;
+	uint8_t previous_has_wrapped                               = 0;
+	uint8_t read_all_records                                   = 0;
+	int entry_index                                            = 0;
+	int number_of_new_records                                  = 0;
+	int number_of_records                                      = 0;
+	int record_index                                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file->io_handle->abort = 0;
+
+	previous_file_header             = internal_file->file_header;
+	previous_records_table           = internal_file->records_table;
+	previous_recovered_records_table = internal_file->recovered_records_table;
+	previous_record_number_index     = internal_file->record_number_index;
+	previous_timestamp_index         = internal_file->timestamp_index;
+	previous_file_size               = internal_file->io_handle->file_size;
+	previous_has_wrapped             = internal_file->io_handle->has_wrapped;
+	previous_flags                   = internal_file->io_handle->flags;
+
+	if( libevt_file_get_current_file_size(
+	     file_io_handle,
+	     &file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current file size.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_size <= (size64_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "Reading file header:\n" );
+	}
+#endif
+	if( libevt_file_header_initialize(
+	     &file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_file_header_read_file_io_handle(
+	     file_header,
+	     file_io_handle,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header.",
+		 function );
+
+		goto on_error;
+	}
+	end_of_file_record_offset = previous_file_header->end_of_file_record_offset;
+
+	if( ( file_header->end_of_file_record_offset == end_of_file_record_offset )
+	 && ( file_header->last_record_number == previous_file_header->last_record_number )
+	 && ( file_size == previous_file_size ) )
+	{
+		/* Nothing was written since the records were last read
+		 */
+		internal_file->file_header = file_header;
+
+		if( libevt_file_header_free(
+		     &previous_file_header,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file header.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* A file that shrunk or record numbers that decreased indicate the event log
+	 * was cleared or re-collected
+	 */
+	if( ( file_size < previous_file_size )
+	 || ( file_header->first_record_number < previous_file_header->first_record_number )
+	 || ( file_header->last_record_number < previous_file_header->last_record_number ) )
+	{
+		read_all_records = 1;
+	}
+	internal_file->io_handle->file_size = file_size;
+
+	number_of_records = previous_records_table->number_of_entries;
+
+	if( read_all_records == 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "Reading records from offset: 0x%08" PRIx32 ":\n",
+			 end_of_file_record_offset );
+		}
+#endif
+		if( libevt_offset_table_initialize(
+		     &records_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create records table.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_record_number_index_initialize(
+		     &record_number_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record number index.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_timestamp_index_initialize(
+		     &timestamp_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create timestamp index.",
+			 function );
+
+			goto on_error;
+		}
+		/* The records written since the records were last read start
+		 * at the previous end-of-file record offset and can wrap once
+		 */
+		internal_file->io_handle->has_wrapped = 0;
+
+		if( libevt_io_handle_read_records(
+		     internal_file->io_handle,
+		     file_io_handle,
+		     end_of_file_record_offset,
+		     file_header->end_of_file_record_offset,
+		     records_table,
+		     record_number_index,
+		     timestamp_index,
+		     &last_record_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records.",
+			 function );
+
+			goto on_error;
+		}
+		internal_file->io_handle->has_wrapped |= previous_has_wrapped;
+
+		number_of_new_records = records_table->number_of_entries;
+
+		if( number_of_records > 0 )
+		{
+			record_numbers = (uint32_t *) memory_allocate(
+			                               sizeof( uint32_t ) * number_of_records );
+
+			if( record_numbers == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create record numbers.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_record_number_index_get_record_numbers(
+			     previous_record_number_index,
+			     record_numbers,
+			     number_of_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record numbers.",
+				 function );
+
+				goto on_error;
+			}
+			timestamps = previous_timestamp_index->timestamps;
+		}
+		if( number_of_new_records > 0 )
+		{
+			new_record_numbers = (uint32_t *) memory_allocate(
+			                                   sizeof( uint32_t ) * number_of_new_records );
+
+			if( new_record_numbers == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create new record numbers.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_record_number_index_get_record_numbers(
+			     record_number_index,
+			     new_record_numbers,
+			     number_of_new_records,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve new record numbers.",
+				 function );
+
+				goto on_error;
+			}
+			/* Records that do not continue the record numbers of the previously read records
+			 * indicate the event log was re-collected
+			 */
+			if( ( number_of_records > 0 )
+			 && ( new_record_numbers[ 0 ] != ( record_numbers[ number_of_records - 1 ] + 1 ) ) )
+			{
+				read_all_records = 1;
+			}
+		}
+	}
+	if( libevt_offset_table_initialize(
+	     &new_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create new records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_offset_table_initialize(
+	     &new_recovered_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create new recovered records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_number_index_initialize(
+	     &new_record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create new record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_timestamp_index_initialize(
+	     &new_timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create new timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The new records tables and indexes are read into while the previous
+	 * ones are kept to be restored on error
+	 */
+	internal_file->file_header             = file_header;
+	internal_file->records_table           = new_records_table;
+	internal_file->recovered_records_table = new_recovered_records_table;
+	internal_file->record_number_index     = new_record_number_index;
+	internal_file->timestamp_index         = new_timestamp_index;
+
+	if( read_all_records != 0 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: event log was cleared or re-collected, reading all records.\n",
+			 function );
+		}
+#endif
+		internal_file->io_handle->has_wrapped = 0;
+
+		if( libevt_file_read_records(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read records.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		if( libevt_offset_table_resize(
+		     new_records_table,
+		     number_of_records + number_of_new_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize new records table.",
+			 function );
+
+			goto on_error;
+		}
+		/* The records that start in the area written since the records were last read,
+		 * including the new end-of-file record, were overwritten
+		 */
+		data_size = (uint32_t) ( file_size - sizeof( evt_file_header_t ) );
+
+		if( file_header->end_of_file_record_offset >= end_of_file_record_offset )
+		{
+			written_size = file_header->end_of_file_record_offset - end_of_file_record_offset;
+		}
+		else
+		{
+			written_size = data_size - ( end_of_file_record_offset - file_header->end_of_file_record_offset );
+		}
+		written_size += (uint32_t) sizeof( evt_end_of_file_record_t );
+
+		for( entry_index = 0;
+		     entry_index < number_of_records;
+		     entry_index++ )
+		{
+			record_offset = previous_records_table->entries[ entry_index ].offset;
+
+			if( record_offset >= end_of_file_record_offset )
+			{
+				record_position = record_offset - end_of_file_record_offset;
+			}
+			else
+			{
+				record_position = data_size - ( end_of_file_record_offset - record_offset );
+			}
+			if( ( record_position < written_size )
+			 || ( record_numbers[ entry_index ] < file_header->first_record_number ) )
+			{
+				continue;
+			}
+			if( libevt_offset_table_append_entry(
+			     new_records_table,
+			     &record_index,
+			     (off64_t) record_offset,
+			     (size64_t) previous_records_table->entries[ entry_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record to records table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_record_number_index_append_record_number(
+			     new_record_number_index,
+			     record_index,
+			     record_numbers[ entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record number to record number index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_timestamp_index_append_timestamp(
+			     new_timestamp_index,
+			     record_index,
+			     timestamps[ entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append written time to timestamp index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( entry_index = 0;
+		     entry_index < number_of_new_records;
+		     entry_index++ )
+		{
+			if( libevt_offset_table_append_entry(
+			     new_records_table,
+			     &record_index,
+			     (off64_t) records_table->entries[ entry_index ].offset,
+			     (size64_t) records_table->entries[ entry_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record to records table.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_record_number_index_append_record_number(
+			     new_record_number_index,
+			     record_index,
+			     new_record_numbers[ entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record number to record number index.",
+				 function );
+
+				goto on_error;
+			}
+			if( libevt_timestamp_index_append_timestamp(
+			     new_timestamp_index,
+			     record_index,
+			     timestamp_index->timestamps[ entry_index ],
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append written time to timestamp index.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		for( entry_index = 0;
+		     entry_index < previous_recovered_records_table->number_of_entries;
+		     entry_index++ )
+		{
+			record_offset = previous_recovered_records_table->entries[ entry_index ].offset;
+
+			if( record_offset >= end_of_file_record_offset )
+			{
+				record_position = record_offset - end_of_file_record_offset;
+			}
+			else
+			{
+				record_position = data_size - ( end_of_file_record_offset - record_offset );
+			}
+			if( record_position < written_size )
+			{
+				continue;
+			}
+			if( libevt_offset_table_append_entry(
+			     new_recovered_records_table,
+			     &record_index,
+			     (off64_t) record_offset,
+			     (size64_t) previous_recovered_records_table->entries[ entry_index ].size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append recovered record to recovered records table.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libevt_offset_table_resize(
+	     new_records_table,
+	     new_records_table->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_offset_table_resize(
+	     new_recovered_records_table,
+	     new_recovered_records_table->number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize recovered records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_number_index_finalize(
+	     new_record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_timestamp_index_finalize(
+	     new_timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to finalize timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The cached records of overwritten areas are no longer valid
+	 */
+	if( libevt_records_cache_empty(
+	     internal_file->records_cache,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records cache.",
+		 function );
+
+		goto on_error;
+	}
+	/* The new records tables and indexes replace the previous ones
+	 */
+	file_header                 = NULL;
+	new_records_table           = NULL;
+	new_recovered_records_table = NULL;
+	new_record_number_index     = NULL;
+	new_timestamp_index         = NULL;
+
+	if( libevt_file_header_free(
+	     &previous_file_header,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous file header.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_offset_table_free(
+	     &previous_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_offset_table_free(
+	     &previous_recovered_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous recovered records table.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_number_index_free(
+	     &previous_record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_timestamp_index_free(
+	     &previous_timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free previous timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	/* The file IO handle clones are recreated since they can have cached
+	 * the previous file size
+	 */
+	if( internal_file->file_io_handles_context != NULL )
+	{
+		if( libevt_scan_context_free(
+		     &( internal_file->file_io_handles_context ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file IO handles context.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_scan_context_initialize(
+		     &( internal_file->file_io_handles_context ),
+		     file_io_handle,
+		     internal_file->io_handle->maximum_number_of_threads,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( ( internal_file->index_file_io_handle != NULL )
+	 && ( internal_file->io_handle->abort == 0 ) )
+	{
+		if( libevt_file_write_index_file(
+		     internal_file,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				if( ( error != NULL )
+				 && ( *error != NULL ) )
+				{
+					libcnotify_print_error_backtrace(
+					 *error );
+				}
+			}
+#endif
+			libcerror_error_free(
+			 error );
+		}
+	}
+	if( new_record_numbers != NULL )
+	{
+		memory_free(
+		 new_record_numbers );
+	}
+	if( record_numbers != NULL )
+	{
+		memory_free(
+		 record_numbers );
+	}
+	if( timestamp_index != NULL )
+	{
+		if( libevt_timestamp_index_free(
+		     &timestamp_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free timestamp index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( record_number_index != NULL )
+	{
+		if( libevt_record_number_index_free(
+		     &record_number_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record number index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( records_table != NULL )
+	{
+		if( libevt_offset_table_free(
+		     &records_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free records table.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	internal_file->io_handle->abort = 0;
+
+	return( 1 );
+
+on_error:
+	/* Restore the previous state if it was not yet replaced
+	 */
+	if( new_timestamp_index != NULL )
+	{
+		internal_file->timestamp_index = previous_timestamp_index;
+
+		libevt_timestamp_index_free(
+		 &new_timestamp_index,
+		 NULL );
+	}
+	if( new_record_number_index != NULL )
+	{
+		internal_file->record_number_index = previous_record_number_index;
+
+		libevt_record_number_index_free(
+		 &new_record_number_index,
+		 NULL );
+	}
+	if( new_recovered_records_table != NULL )
+	{
+		internal_file->recovered_records_table = previous_recovered_records_table;
+
+		libevt_offset_table_free(
+		 &new_recovered_records_table,
+		 NULL );
+	}
+	if( new_records_table != NULL )
+	{
+		internal_file->records_table = previous_records_table;
+
+		libevt_offset_table_free(
+		 &new_records_table,
+		 NULL );
+	}
+	if( file_header != NULL )
+	{
+		internal_file->file_header = previous_file_header;
+
+		libevt_file_header_free(
+		 &file_header,
+		 NULL );
+
+		internal_file->io_handle->file_size   = previous_file_size;
+		internal_file->io_handle->has_wrapped = previous_has_wrapped;
+		internal_file->io_handle->flags       = previous_flags;
+	}
+	if( new_record_numbers != NULL )
+	{
+		memory_free(
+		 new_record_numbers );
+	}
+	if( record_numbers != NULL )
+	{
+		memory_free(
+		 record_numbers );
+	}
+	if( timestamp_index != NULL )
+	{
+		libevt_timestamp_index_free(
+		 &timestamp_index,
+		 NULL );
+	}
+	if( record_number_index != NULL )
+	{
+		libevt_record_number_index_free(
+		 &record_number_index,
+		 NULL );
+	}
+	if( records_table != NULL )
+	{
+		libevt_offset_table_free(
+		 &records_table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the records tables and indexes from the index file
+ * Returns 1 if successful, 0 if no matching index file is available or -1 on error
+ */
+int libevt_file_read_index_file(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function   = "libevt_file_read_index_file";
+	uint8_t io_handle_flags = 0;
+	int result              = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	result = libbfio_handle_exists(
+	          internal_file->index_file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if index file exists.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     internal_file->index_file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file.",
+		 function );
+
+		return( -1 );
+	}
+	result = libevt_index_file_read_file_io_handle(
+	          internal_file->index_file_io_handle,
+	          file_io_handle,
+	          internal_file->io_handle->file_size,
+	          internal_file->file_header->end_of_file_record_offset,
+	          internal_file->records_table,
+	          internal_file->recovered_records_table,
+	          internal_file->record_number_index,
+	          internal_file->timestamp_index,
+	          &io_handle_flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file.",
+		 function );
+	}
+	if( libbfio_handle_close(
+	     internal_file->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		result = -1;
+	}
+	if( result == 1 )
+	{
+		internal_file->io_handle->flags |= io_handle_flags;
+
+		return( 1 );
+	}
+	/* The records tables and indexes can be partially filled by an index file
+	 * that does not match
+	 */
+	if( libevt_offset_table_empty(
+	     internal_file->records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty records table.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_offset_table_empty(
+	     internal_file->recovered_records_table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty recovered records table.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_record_number_index_empty(
+	     internal_file->record_number_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty record number index.",
+		 function );
+
+		result = -1;
+	}
+	if( libevt_timestamp_index_empty(
+	     internal_file->timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty timestamp index.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes the records tables and indexes to the index file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_write_index_file(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_file_write_index_file";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_open(
+	     internal_file->index_file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open index file for writing.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_index_file_write_file_io_handle(
+	     internal_file->index_file_io_handle,
+	     file_io_handle,
+	     internal_file->io_handle->file_size,
+	     internal_file->file_header->end_of_file_record_offset,
+	     internal_file->io_handle->flags,
+	     internal_file->records_table,
+	     internal_file->recovered_records_table,
+	     internal_file->record_number_index,
+	     internal_file->timestamp_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file.",
+		 function );
+
+		result = -1;
+	}
+	if( libbfio_handle_close(
+	     internal_file->index_file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close index file.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Reads the record values at a specific offset
+ * This function does not change the state of the file and can be called
+ * by multiple threads concurrently
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_read_record_values(
+     libevt_internal_file_t *internal_file,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle     = NULL;
+	static char *function                = "libevt_file_read_record_values";
+	off64_t file_offset                  = 0;
+	ssize_t read_count                   = 0;
+	uint8_t file_io_handle_mutex_grabbed = 0;
+	uint8_t has_wrapped                  = 0;
+	int result                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_values != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record values value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_values_initialize(
+	     record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	file_offset = record_offset;
+
+	if( internal_file->io_handle->mapped_data != NULL )
+	{
+		read_count = libevt_record_values_read_mapped_data(
+		              *record_values,
+		              internal_file->io_handle,
+		              &file_offset,
+		              &has_wrapped,
+		              0,
+		              error );
+	}
+	else
+	{
+		if( internal_file->file_io_handles_context != NULL )
+		{
+			result = libevt_scan_context_grab_file_io_handle(
+			          internal_file->file_io_handles_context,
+			          &file_io_handle,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to grab file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* Fall back to the file IO handle of the file if no clone is available
+		 */
+		if( file_io_handle == NULL )
+		{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_grab(
+			     internal_file->file_io_handle_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to grab file IO handle mutex.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+			file_io_handle_mutex_grabbed = 1;
+			file_io_handle               = internal_file->file_io_handle;
+		}
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     record_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek record offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			read_count = -1;
+		}
+		else
+		{
+			read_count = libevt_record_values_read_file_io_handle(
+			              *record_values,
+			              file_io_handle,
+			              internal_file->io_handle,
+			              &file_offset,
+			              &has_wrapped,
+			              0,
+			              error );
+		}
+		if( file_io_handle_mutex_grabbed != 0 )
+		{
+			file_io_handle_mutex_grabbed = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_release(
+			     internal_file->file_io_handle_mutex,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release file IO handle mutex.",
+				 function );
+
+				goto on_error;
+			}
+#endif
+		}
+		else
+		{
+			if( libevt_scan_context_release_file_io_handle(
+			     internal_file->file_io_handles_context,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to release file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( read_count == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 record_offset,
+		 record_offset );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_values != NULL )
+	{
+		libevt_record_values_free(
+		 record_values,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads data at a specific offset
+ * This function does not change the state of the file and can be called
+ * by multiple threads concurrently
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libevt_file_read_buffer_at_offset(
+         libevt_internal_file_t *internal_file,
+         off64_t file_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle     = NULL;
+	static char *function                = "libevt_file_read_buffer_at_offset";
+	ssize_t read_count                   = 0;
+	uint8_t file_io_handle_mutex_grabbed = 0;
+	int result                           = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( buffer_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid buffer size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_io_handles_context != NULL )
+	{
+		result = libevt_scan_context_grab_file_io_handle(
+		          internal_file->file_io_handles_context,
+		          &file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to grab file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* Fall back to the file IO handle of the file if no clone is available
+	 */
+	if( file_io_handle == NULL )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     internal_file->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab file IO handle mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		file_io_handle_mutex_grabbed = 1;
+		file_io_handle               = internal_file->file_io_handle;
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek offset: %" PRIi64 " (0x%08" PRIx64 ").",
+		 function,
+		 file_offset,
+		 file_offset );
+
+		read_count = -1;
+	}
+	else
+	{
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              buffer,
+		              buffer_size,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read buffer at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 file_offset,
+			 file_offset );
+		}
+	}
+	if( file_io_handle_mutex_grabbed != 0 )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     internal_file->file_io_handle_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	else
+	{
+		if( libevt_scan_context_release_file_io_handle(
+		     internal_file->file_io_handles_context,
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release file IO handle.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( read_count );
+}
+
+/* Retrieves the record values of a specific record in a records table
+ * The record values are read if not cached. The caller must hold the read/write lock
+ * for reading and release the returned record values to the records cache.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_record_values_by_index(
+     libevt_internal_file_t *internal_file,
+     libevt_offset_table_t *records_table,
+     int record_index,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevt_record_values_t *read_record_values = NULL;
+	static char *function                      = "libevt_file_get_record_values_by_index";
+	size64_t record_size                       = 0;
+	off64_t record_offset                      = 0;
+	int result                                 = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_offset_table_get_entry_by_index(
+	     records_table,
+	     record_index,
+	     &record_offset,
+	     &record_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	result = libevt_records_cache_get_record_values_by_offset(
+	          internal_file->records_cache,
+	          record_offset,
+	          record_values,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve cached record values of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 1 );
+	}
+	/* The records cache is not locked while the record values are read
+	 * so that other threads can retrieve cached records in the meantime
+	 */
+	if( libevt_file_read_record_values(
+	     internal_file,
+	     record_offset,
+	     &read_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values of record: %d.",
+		 function,
+		 record_index );
+
+		return( -1 );
+	}
+	if( libevt_records_cache_set_record_values_by_offset(
+	     internal_file->records_cache,
+	     record_offset,
+	     &read_record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cached record values of record: %d.",
+		 function,
+		 record_index );
+
+		if( read_record_values != NULL )
+		{
+			libevt_record_values_free(
+			 &read_record_values,
+			 NULL );
+		}
+		return( -1 );
+	}
+	*record_values = read_record_values;
+
+	return( 1 );
+}
+
+/* Determine if the file corrupted
+ * Returns 1 if corrupted, 0 if not or -1 on error
+ */
+int libevt_file_is_corrupted(
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_is_corrupted";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( internal_file->io_handle->flags & LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
+	{
+		result = 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_ascii_codepage(
+     libevt_file_t *file,
+     int *ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ascii_codepage == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the file ASCII codepage
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_ascii_codepage(
+     libevt_file_t *file,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_ascii_codepage";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ascii_codepage != LIBEVT_CODEPAGE_ASCII )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_874 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_932 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_936 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_949 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_950 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1250 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1251 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1252 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1253 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1254 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1255 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1256 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1257 )
+	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1258 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported ASCII codepage.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->ascii_codepage = ascii_codepage;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the maximum number of threads
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_maximum_number_of_threads(
+     libevt_file_t *file,
+     int *maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_maximum_number_of_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of threads.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_threads = internal_file->io_handle->maximum_number_of_threads;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the maximum number of threads
+ * The threads are used to scan for recoverable records when the file is opened
+ * A value of 0 or 1 scans single threaded, which is the default
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_maximum_number_of_threads(
+     libevt_file_t *file,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_maximum_number_of_threads";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( maximum_number_of_threads < 0 )
+	 || ( maximum_number_of_threads > LIBEVT_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->io_handle->maximum_number_of_threads = maximum_number_of_threads;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the records cache size
+ * A maximum size of 0 represents no maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_records_cache_size(
+     libevt_file_t *file,
+     int *maximum_number_of_entries,
+     size64_t *maximum_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_records_cache_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid maximum size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*maximum_number_of_entries = internal_file->records_cache->maximum_number_of_entries;
+	*maximum_size              = internal_file->records_cache->maximum_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the records cache size
+ * The maximum size is the estimated memory size of the cached records in bytes,
+ * a maximum size of 0 represents no maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_records_cache_size(
+     libevt_file_t *file,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_records_cache_size";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_records_cache_resize(
+	     internal_file->records_cache,
+	     maximum_number_of_entries,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize records cache.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the records cache pin size
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_records_cache_pin_size(
+     libevt_file_t *file,
+     size64_t *pin_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_records_cache_pin_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( pin_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid pin size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*pin_size = internal_file->records_cache_pin_size;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Sets the records cache pin size
+ * All records are kept in the records cache, regardless of the records cache size,
+ * if the file size does not exceed the pin size. A pin size of 0, which is the default,
+ * represents records are not pinned
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_set_records_cache_pin_size(
+     libevt_file_t *file,
+     size64_t pin_size,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_set_records_cache_pin_size";
+	uint8_t pin_all                       = 0;
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	internal_file->records_cache_pin_size = pin_size;
+
+	/* If the file is open the pin size applies immediately
+	 */
+	if( internal_file->file_header != NULL )
+	{
+		if( ( pin_size > 0 )
+		 && ( internal_file->io_handle->file_size <= pin_size ) )
+		{
+			pin_all = 1;
+		}
+		if( libevt_records_cache_set_pin_all(
+		     internal_file->records_cache,
+		     pin_all,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set pin all in records cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the records cache statistics
+ * The statistics are reset when the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_records_cache_statistics(
+     libevt_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_records_cache_statistics";
+	int result                            = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_records_cache_get_statistics(
+	     internal_file->records_cache,
+	     number_of_hits,
+	     number_of_misses,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records cache statistics.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the format version
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_format_version(
+     libevt_file_t *file,
+     uint32_t *major_format_version,
+     uint32_t *minor_format_version,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_format_version";
+
+	if( file == NULL )
 	{
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: header size: %" PRIu32 " does not match known value.\n",
-			 function,
-			 header_size );
-		}
-#endif
-		internal_file->io_handle->flags |= LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
 	{
-		libcnotify_printf(
-		 "Reading records:\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
 	}
-#endif
-	result_record_read = libevt_io_handle_read_records(
-	                      internal_file->io_handle,
-	                      file_io_handle,
-	                      internal_file->file_header->first_record_offset,
-	                      internal_file->file_header->end_of_file_record_offset,
-	                      internal_file->records_list,
-	                      &last_record_offset,
-	                      error );
+	if( major_format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major format version.",
+		 function );
 
-	if( result_record_read != 1 )
+		return( -1 );
+	}
+	if( minor_format_version == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read records.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor format version.",
 		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( ( error != NULL )
-			 && ( *error != NULL ) )
-			{
-				libcnotify_print_error_backtrace(
-				 *error );
-			}
-		}
-#endif
+		return( -1 );
 	}
-	if( internal_file->io_handle->abort == 0 )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		result_record_recovery = libevt_io_handle_recover_records(
-		                          internal_file->io_handle,
-		                          file_io_handle,
-		                          internal_file->file_header->first_record_offset,
-		                          internal_file->file_header->end_of_file_record_offset,
-		                          last_record_offset,
-		                          internal_file->records_list,
-		                          internal_file->recovered_records_list,
-		                          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-		if( result_record_recovery != 1 )
-		{
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( result_record_read != 1 )
-			{
-				libcerror_error_free(
-				 error );
-			}
+		return( -1 );
+	}
 #endif
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to recover records.",
-			 function );
+	*major_format_version = internal_file->file_header->major_format_version;
+	*minor_format_version = internal_file->file_header->minor_format_version;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				if( ( error != NULL )
-				 && ( *error != NULL ) )
-				{
-					libcnotify_print_error_backtrace(
-					 *error );
-				}
-			}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
 #endif
-		}
+	return( 1 );
+}
+
+/* Retrieves the version
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_version(
+     libevt_file_t *file,
+     uint32_t *major_version,
+     uint32_t *minor_version,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( result_record_read != 1 )
-	 && ( result_record_recovery != 1 ) )
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->file_header == NULL )
 	{
-		goto on_error;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
 	}
-	if( ( error != NULL )
-	 && ( *error != NULL ) )
+	if( major_version == NULL )
 	{
-		libcerror_error_free(
-		 error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid major version.",
+		 function );
+
+		return( -1 );
 	}
-	internal_file->io_handle->abort = 0;
+	if( minor_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid minor version.",
+		 function );
 
-	return( 1 );
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
 
-on_error:
-	if( internal_file->file_header != NULL )
+		return( -1 );
+	}
+#endif
+	*major_version = internal_file->file_header->major_format_version;
+	*minor_version = internal_file->file_header->minor_format_version;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
-		libevt_file_header_free(
-		 &( internal_file->file_header ),
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
 	}
-	return( -1 );
+#endif
+	return( 1 );
 }
 
-/* Determine if the file corrupted
- * Returns 1 if corrupted, 0 if not or -1 on error
+/* Retrieves the flags
+ * Returns 1 if successful or -1 on error
  */
-int libevt_file_is_corrupted(
+int libevt_file_get_flags(
      libevt_file_t *file,
+     uint32_t *flags,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_is_corrupted";
-	int result                            = 0;
+	static char *function                 = "libevt_file_get_flags";
 
 	if( file == NULL )
 	{
@@ -1340,13 +5193,24 @@ int libevt_file_is_corrupted(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( flags == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid flags.",
 		 function );
 
 		return( -1 );
@@ -1366,10 +5230,8 @@ int libevt_file_is_corrupted(
 		return( -1 );
 	}
 #endif
-	if( ( internal_file->io_handle->flags & LIBEVT_IO_HANDLE_FLAG_IS_CORRUPTED ) != 0 )
-	{
-		result = 1;
-	}
+	*flags = internal_file->file_header->file_flags;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1385,19 +5247,19 @@ int libevt_file_is_corrupted(
 		return( -1 );
 	}
 #endif
-	return( result );
+	return( 1 );
 }
 
-/* Retrieves the file ASCII codepage
+/* Retrieves the first (oldest) record number
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_ascii_codepage(
+int libevt_file_get_first_record_number(
      libevt_file_t *file,
-     int *ascii_codepage,
+     uint32_t *first_record_number,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_ascii_codepage";
+	static char *function                 = "libevt_file_get_first_record_number";
 
 	if( file == NULL )
 	{
@@ -1412,24 +5274,24 @@ int libevt_file_get_ascii_codepage(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ascii_codepage == NULL )
+	if( first_record_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid ASCII codepage.",
+		 "%s: invalid first record number.",
 		 function );
 
 		return( -1 );
@@ -1449,7 +5311,7 @@ int libevt_file_get_ascii_codepage(
 		return( -1 );
 	}
 #endif
-	*ascii_codepage = internal_file->io_handle->ascii_codepage;
+	*first_record_number = internal_file->file_header->first_record_number;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1469,16 +5331,16 @@ int libevt_file_get_ascii_codepage(
 	return( 1 );
 }
 
-/* Sets the file ASCII codepage
+/* Retrieves the last (newest) record number
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_set_ascii_codepage(
+int libevt_file_get_last_record_number(
      libevt_file_t *file,
-     int ascii_codepage,
+     uint32_t *last_record_number,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_set_ascii_codepage";
+	static char *function                 = "libevt_file_get_last_record_number";
 
 	if( file == NULL )
 	{
@@ -1493,44 +5355,30 @@ int libevt_file_set_ascii_codepage(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( internal_file->file_header == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing file header.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ascii_codepage != LIBEVT_CODEPAGE_ASCII )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_874 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_932 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_936 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_949 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_950 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1250 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1251 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1252 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1253 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1254 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1255 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1256 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1257 )
-	 && ( ascii_codepage != LIBEVT_CODEPAGE_WINDOWS_1258 ) )
+	if( last_record_number == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported ASCII codepage.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last record number.",
 		 function );
 
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1538,16 +5386,16 @@ int libevt_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	internal_file->io_handle->ascii_codepage = ascii_codepage;
+	*last_record_number = internal_file->file_header->last_record_number;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1555,7 +5403,7 @@ int libevt_file_set_ascii_codepage(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1564,17 +5412,16 @@ int libevt_file_set_ascii_codepage(
 	return( 1 );
 }
 
-/* Retrieves the format version
+/* Retrieves the maximum file size
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_format_version(
+int libevt_file_get_maximum_file_size(
      libevt_file_t *file,
-     uint32_t *major_format_version,
-     uint32_t *minor_format_version,
+     uint32_t *maximum_file_size,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_format_version";
+	static char *function                 = "libevt_file_get_maximum_file_size";
 
 	if( file == NULL )
 	{
@@ -1600,24 +5447,13 @@ int libevt_file_get_format_version(
 
 		return( -1 );
 	}
-	if( major_format_version == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major format version.",
-		 function );
-
-		return( -1 );
-	}
-	if( minor_format_version == NULL )
+	if( maximum_file_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor format version.",
+		 "%s: invalid maximum file size.",
 		 function );
 
 		return( -1 );
@@ -1637,8 +5473,7 @@ int libevt_file_get_format_version(
 		return( -1 );
 	}
 #endif
-	*major_format_version = internal_file->file_header->major_format_version;
-	*minor_format_version = internal_file->file_header->minor_format_version;
+	*maximum_file_size = internal_file->file_header->maximum_file_size;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
@@ -1658,17 +5493,16 @@ int libevt_file_get_format_version(
 	return( 1 );
 }
 
-/* Retrieves the version
+/* Retrieves the retention
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_version(
+int libevt_file_get_retention(
      libevt_file_t *file,
-     uint32_t *major_version,
-     uint32_t *minor_version,
+     uint32_t *retention,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_version";
+	static char *function                 = "libevt_file_get_retention";
 
 	if( file == NULL )
 	{
@@ -1694,30 +5528,79 @@ int libevt_file_get_version(
 
 		return( -1 );
 	}
-	if( major_version == NULL )
+	if( retention == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid major version.",
+		 "%s: invalid retention.",
 		 function );
 
 		return( -1 );
 	}
-	if( minor_version == NULL )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*retention = internal_file->file_header->retention;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of records
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_file_get_number_of_records(
+     libevt_file_t *file,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_number_of_records";
+	int result                            = 1;
+
+	if( file == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid minor version.",
+		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
+	internal_file = (libevt_internal_file_t *) file;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
+	if( libcthreads_read_write_lock_grab_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1725,17 +5608,28 @@ int libevt_file_get_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
+		 "%s: unable to grab read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	*major_version = internal_file->file_header->major_format_version;
-	*minor_version = internal_file->file_header->minor_format_version;
+	if( libevt_offset_table_get_number_of_entries(
+	     internal_file->records_table,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from records table.",
+		 function );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
+	if( libcthreads_read_write_lock_release_for_write(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1743,25 +5637,28 @@ int libevt_file_get_version(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the flags
+/* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_flags(
+int libevt_file_get_record(
      libevt_file_t *file,
-     uint32_t *flags,
+     int record_index,
+     libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_flags";
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_record";
+	int result                            = 1;
 
 	if( file == NULL )
 	{
@@ -1776,24 +5673,24 @@ int libevt_file_get_flags(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( internal_file->file_header == NULL )
+	if( record == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing file header.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
 		 function );
 
 		return( -1 );
 	}
-	if( flags == NULL )
+	if( *record != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid flags.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
 		 function );
 
 		return( -1 );
@@ -1813,8 +5710,46 @@ int libevt_file_get_flags(
 		return( -1 );
 	}
 #endif
-	*flags = internal_file->file_header->file_flags;
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_table,
+	     record_index,
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          internal_file->records_cache,
+	          0,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
+		 function );
+
+		libevt_records_cache_release_record_values(
+		 internal_file->records_cache,
+		 record_values,
+		 NULL );
 
+		result = -1;
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
@@ -1830,36 +5765,60 @@ int libevt_file_get_flags(
 		return( -1 );
 	}
 #endif
-	return( 1 );
+	return( result );
 }
 
-/* Retrieves the number of records
+/* Retrieves a specific record
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_number_of_records(
+int libevt_file_get_record_by_index(
      libevt_file_t *file,
-     int *number_of_records,
+     int record_index,
+     libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
-	static char *function                 = "libevt_file_get_number_of_records";
+	libevt_record_values_t *record_values = NULL;
+	static char *function                 = "libevt_file_get_record_by_index";
 	int result                            = 1;
 
-	if( file == NULL )
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libevt_internal_file_t *) file;
-
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1867,28 +5826,54 @@ int libevt_file_get_number_of_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->records_list,
-	     number_of_records,
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->records_table,
+	     record_index,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from records list.",
+		 "%s: unable to retrieve record values: %d.",
+		 function,
+		 record_index );
+
+		result = -1;
+	}
+	else if( libevt_record_initialize(
+	          record,
+	          internal_file->io_handle,
+	          internal_file->file_io_handle,
+	          record_values,
+	          internal_file->records_cache,
+	          0,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record.",
 		 function );
 
+		libevt_records_cache_release_record_values(
+		 internal_file->records_cache,
+		 record_values,
+		 NULL );
+
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1896,7 +5881,7 @@ int libevt_file_get_number_of_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -1905,19 +5890,20 @@ int libevt_file_get_number_of_records(
 	return( result );
 }
 
-/* Retrieves a specific record
- * Returns 1 if successful or -1 on error
+/* Retrieves a specific record by its event record number
+ * Returns 1 if successful, 0 if no such record or -1 on error
  */
-int libevt_file_get_record(
+int libevt_file_get_record_by_record_number(
      libevt_file_t *file,
-     int record_index,
+     uint32_t record_number,
      libevt_record_t **record,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
 	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_record";
-	int result                            = 1;
+	static char *function                 = "libevt_file_get_record_by_record_number";
+	int record_index                      = 0;
+	int result                            = 0;
 
 	if( file == NULL )
 	{
@@ -1955,7 +5941,7 @@ int libevt_file_get_record(
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -1963,49 +5949,123 @@ int libevt_file_get_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
-	     error ) != 1 )
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          internal_file->record_number_index,
+	          record_number,
+	          &record_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
+		 "%s: unable to retrieve record index for record number: %" PRIu32 ".",
 		 function,
-		 record_index );
+		 record_number );
+	}
+	else if( result != 0 )
+	{
+		if( libevt_file_get_record_values_by_index(
+		     internal_file,
+		     internal_file->records_table,
+		     record_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d.",
+			 function,
+			 record_index );
 
-		result = -1;
+			result = -1;
+		}
+		else if( libevt_record_initialize(
+		          record,
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          record_values,
+		          internal_file->records_cache,
+		          0,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			libevt_records_cache_release_record_values(
+			 internal_file->records_cache,
+			 record_values,
+			 NULL );
+
+			result = -1;
+		}
 	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
-		result = -1;
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the range of record indexes of the records written within a specific time range
+ * The start and end time are inclusive and contain a POSIX timestamp
+ * The range is determined from the written times read on open, without reading the records
+ * If the written times are not in chronological order, for example after the system clock
+ * was changed, the range can contain records written outside the time range
+ * Returns 1 if successful, 0 if no records were written within the time range or -1 on error
+ */
+int libevt_file_get_record_index_range_by_time(
+     libevt_file_t *file,
+     uint32_t start_time,
+     uint32_t end_time,
+     int *first_record_index,
+     int *last_record_index,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file = NULL;
+	static char *function                 = "libevt_file_get_record_index_range_by_time";
+	int result                            = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
 	}
+	internal_file = (libevt_internal_file_t *) file;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2013,7 +6073,39 @@ int libevt_file_get_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libevt_timestamp_index_get_index_range(
+	          internal_file->timestamp_index,
+	          start_time,
+	          end_time,
+	          first_record_index,
+	          last_record_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record index range from timestamp index.",
+		 function );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2022,18 +6114,26 @@ int libevt_file_get_record(
 	return( result );
 }
 
-/* Retrieves a specific record
+/* Retrieves a range of records
+ * The records are retrieved holding the file lock only once, the records
+ * array must contain number of records elements that are set to NULL
+ * The retrieved records reference the cached record values and are created
+ * without a read/write lock, hence a record should not be shared between threads
+ * Each of the retrieved records must be freed with libevt_record_free
  * Returns 1 if successful or -1 on error
  */
-int libevt_file_get_record_by_index(
+int libevt_file_get_records_range(
      libevt_file_t *file,
-     int record_index,
-     libevt_record_t **record,
+     int first_record_index,
+     int number_of_records,
+     libevt_record_t **records,
      libcerror_error_t **error )
 {
 	libevt_internal_file_t *internal_file = NULL;
 	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_file_get_record_by_index";
+	static char *function                 = "libevt_file_get_records_range";
+	int array_index                       = 0;
+	int number_of_elements                = 0;
 	int result                            = 1;
 
 	if( file == NULL )
@@ -2049,30 +6149,58 @@ int libevt_file_get_record_by_index(
 	}
 	internal_file = (libevt_internal_file_t *) file;
 
-	if( record == NULL )
+	if( first_record_index < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid first record index value less than zero.",
 		 function );
 
 		return( -1 );
 	}
-	if( *record != NULL )
+	if( number_of_records < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of records value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
 		 function );
 
 		return( -1 );
 	}
+	for( array_index = 0;
+	     array_index < number_of_records;
+	     array_index++ )
+	{
+		if( records[ array_index ] != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+			 "%s: invalid record: %d value already set.",
+			 function,
+			 array_index );
+
+			return( -1 );
+		}
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2080,49 +6208,97 @@ int libevt_file_get_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
-	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	if( libevt_offset_table_get_number_of_entries(
+	     internal_file->records_table,
+	     &number_of_elements,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve record values: %d.",
-		 function,
-		 record_index );
+		 "%s: unable to retrieve number of entries from records table.",
+		 function );
 
 		result = -1;
 	}
-	else if( libevt_record_initialize(
-	          record,
-	          internal_file->io_handle,
-	          internal_file->file_io_handle,
-	          record_values,
-	          error ) != 1 )
+	else if( number_of_records > ( number_of_elements - first_record_index ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
 		 function );
 
 		result = -1;
 	}
+	for( array_index = 0;
+	     ( result == 1 ) && ( array_index < number_of_records );
+	     array_index++ )
+	{
+		if( libevt_file_get_record_values_by_index(
+		     internal_file,
+		     internal_file->records_table,
+		     first_record_index + array_index,
+		     &record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record values: %d.",
+			 function,
+			 first_record_index + array_index );
+
+			result = -1;
+		}
+		else if( libevt_record_initialize(
+		          &( records[ array_index ] ),
+		          internal_file->io_handle,
+		          internal_file->file_io_handle,
+		          record_values,
+		          internal_file->records_cache,
+		          LIBEVT_RECORD_FLAG_WITHOUT_LOCK,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 first_record_index + array_index );
+
+			libevt_records_cache_release_record_values(
+			 internal_file->records_cache,
+			 record_values,
+			 NULL );
+
+			result = -1;
+		}
+		record_values = NULL;
+	}
+	if( result != 1 )
+	{
+		while( array_index > 0 )
+		{
+			array_index--;
+
+			libevt_record_free(
+			 &( records[ array_index ] ),
+			 NULL );
+		}
+	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2130,7 +6306,7 @@ int libevt_file_get_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2179,8 +6355,8 @@ int libevt_file_get_number_of_recovered_records(
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_number_of_elements(
-	     internal_file->recovered_records_list,
+	if( libevt_offset_table_get_number_of_entries(
+	     internal_file->recovered_records_table,
 	     number_of_records,
 	     error ) != 1 )
 	{
@@ -2188,7 +6364,7 @@ int libevt_file_get_number_of_recovered_records(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of elements from recovered records list.",
+		 "%s: unable to retrieve number of entries from recovered records table.",
 		 function );
 
 		result = -1;
@@ -2261,7 +6437,7 @@ int libevt_file_get_recovered_record(
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2269,26 +6445,24 @@ int libevt_file_get_recovered_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_table,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered record values: %d.",
+		 "%s: unable to retrieve record values: %d.",
 		 function,
 		 record_index );
 
@@ -2299,6 +6473,8 @@ int libevt_file_get_recovered_record(
 	          internal_file->io_handle,
 	          internal_file->file_io_handle,
 	          record_values,
+	          internal_file->records_cache,
+	          0,
 	          error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2308,10 +6484,15 @@ int libevt_file_get_recovered_record(
 		 "%s: unable to create record.",
 		 function );
 
+		libevt_records_cache_release_record_values(
+		 internal_file->records_cache,
+		 record_values,
+		 NULL );
+
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2319,7 +6500,7 @@ int libevt_file_get_recovered_record(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
@@ -2367,7 +6548,7 @@ int libevt_file_get_recovered_record_by_index(
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_write(
+	if( libcthreads_read_write_lock_grab_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2375,26 +6556,24 @@ int libevt_file_get_recovered_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for writing.",
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
 #endif
-	if( libfdata_list_get_element_value_by_index(
-	     internal_file->recovered_records_list,
-	     (intptr_t *) internal_file->file_io_handle,
-	     (libfdata_cache_t *) internal_file->records_cache,
+	if( libevt_file_get_record_values_by_index(
+	     internal_file,
+	     internal_file->recovered_records_table,
 	     record_index,
-	     (intptr_t **) &record_values,
-	     0,
+	     &record_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve recovered record values: %d.",
+		 "%s: unable to retrieve record values: %d.",
 		 function,
 		 record_index );
 
@@ -2405,6 +6584,8 @@ int libevt_file_get_recovered_record_by_index(
 	          internal_file->io_handle,
 	          internal_file->file_io_handle,
 	          record_values,
+	          internal_file->records_cache,
+	          0,
 	          error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2414,10 +6595,15 @@ int libevt_file_get_recovered_record_by_index(
 		 "%s: unable to create record.",
 		 function );
 
+		libevt_records_cache_release_record_values(
+		 internal_file->records_cache,
+		 record_values,
+		 NULL );
+
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_write(
+	if( libcthreads_read_write_lock_release_for_read(
 	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
@@ -2425,7 +6611,7 @@ int libevt_file_get_recovered_record_by_index(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for writing.",
+		 "%s: unable to release read/write lock for reading.",
 		 function );
 
 		return( -1 );
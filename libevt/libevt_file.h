@@ -31,8 +31,13 @@
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcthreads.h"
-#include "libevt_libfcache.h"
-#include "libevt_libfdata.h"
+#include "libevt_mapped_file.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_number_index.h"
+#include "libevt_record_values.h"
+#include "libevt_records_cache.h"
+#include "libevt_scan_context.h"
+#include "libevt_timestamp_index.h"
 #include "libevt_types.h"
 
 #if defined( __cplusplus )
@@ -59,26 +64,56 @@ struct libevt_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
+	/* The mapped file
+	 */
+	libevt_mapped_file_t *mapped_file;
+
 	/* The file header
 	 */
 	libevt_file_header_t *file_header;
 
-	/* The records list
+	/* The records table
+	 */
+	libevt_offset_table_t *records_table;
+
+	/* The recovered records table
 	 */
-	libfdata_list_t *records_list;
+	libevt_offset_table_t *recovered_records_table;
 
-	/* The recovered records list
+	/* The record number index
 	 */
-	libfdata_list_t *recovered_records_list;
+	libevt_record_number_index_t *record_number_index;
+
+	/* The timestamp index
+	 */
+	libevt_timestamp_index_t *timestamp_index;
 
 	/* The records cache
 	 */
-	libfcache_cache_t *records_cache;
+	libevt_records_cache_t *records_cache;
+
+	/* The file size up to which all records are kept in the records cache
+	 * 0 represents records are not pinned
+	 */
+	size64_t records_cache_pin_size;
+
+	/* The context of the cloned file IO handles used to read records
+	 * concurrently or NULL if not available
+	 */
+	libevt_scan_context_t *file_io_handles_context;
+
+	/* The index file IO handle or NULL if no index file is used
+	 */
+	libbfio_handle_t *index_file_io_handle;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
 	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The mutex that serializes reads from the file IO handle
+	 */
+	libcthreads_mutex_t *file_io_handle_mutex;
 #endif
 };
 
@@ -115,6 +150,13 @@ int libevt_file_open_wide(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+LIBEVT_EXTERN \
+int libevt_file_open_mapped(
+     libevt_file_t *file,
+     const char *filename,
+     int access_flags,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_open_file_io_handle(
      libevt_file_t *file,
@@ -122,16 +164,82 @@ int libevt_file_open_file_io_handle(
      int access_flags,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_set_index_path(
+     libevt_file_t *file,
+     const char *index_path,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBEVT_EXTERN \
+int libevt_file_set_index_path_wide(
+     libevt_file_t *file,
+     const wchar_t *index_path,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBEVT_EXTERN \
 int libevt_file_close(
      libevt_file_t *file,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_refresh(
+     libevt_file_t *file,
+     libcerror_error_t **error );
+
 int libevt_file_open_read(
      libevt_internal_file_t *internal_file,
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libevt_file_read_records(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_get_current_file_size(
+     libbfio_handle_t *file_io_handle,
+     size64_t *file_size,
+     libcerror_error_t **error );
+
+int libevt_file_refresh_read(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_read_index_file(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_write_index_file(
+     libevt_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_file_read_record_values(
+     libevt_internal_file_t *internal_file,
+     off64_t record_offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
+ssize_t libevt_file_read_buffer_at_offset(
+         libevt_internal_file_t *internal_file,
+         off64_t file_offset,
+         uint8_t *buffer,
+         size_t buffer_size,
+         libcerror_error_t **error );
+
+int libevt_file_get_record_values_by_index(
+     libevt_internal_file_t *internal_file,
+     libevt_offset_table_t *records_table,
+     int record_index,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_is_corrupted(
      libevt_file_t *file,
@@ -149,6 +257,51 @@ int libevt_file_set_ascii_codepage(
      int ascii_codepage,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_get_maximum_number_of_threads(
+     libevt_file_t *file,
+     int *maximum_number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_maximum_number_of_threads(
+     libevt_file_t *file,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_records_cache_size(
+     libevt_file_t *file,
+     int *maximum_number_of_entries,
+     size64_t *maximum_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_records_cache_size(
+     libevt_file_t *file,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_records_cache_pin_size(
+     libevt_file_t *file,
+     size64_t *pin_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_set_records_cache_pin_size(
+     libevt_file_t *file,
+     size64_t pin_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_records_cache_statistics(
+     libevt_file_t *file,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_get_format_version(
      libevt_file_t *file,
@@ -169,6 +322,30 @@ int libevt_file_get_flags(
      uint32_t *flags,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_get_first_record_number(
+     libevt_file_t *file,
+     uint32_t *first_record_number,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_last_record_number(
+     libevt_file_t *file,
+     uint32_t *last_record_number,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_maximum_file_size(
+     libevt_file_t *file,
+     uint32_t *maximum_file_size,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_retention(
+     libevt_file_t *file,
+     uint32_t *retention,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_get_number_of_records(
      libevt_file_t *file,
@@ -189,6 +366,30 @@ int libevt_file_get_record_by_index(
      libevt_record_t **record,
      libcerror_error_t **error );
 
+LIBEVT_EXTERN \
+int libevt_file_get_record_by_record_number(
+     libevt_file_t *file,
+     uint32_t record_number,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_record_index_range_by_time(
+     libevt_file_t *file,
+     uint32_t start_time,
+     uint32_t end_time,
+     int *first_record_index,
+     int *last_record_index,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_file_get_records_range(
+     libevt_file_t *file,
+     int first_record_index,
+     int number_of_records,
+     libevt_record_t **records,
+     libcerror_error_t **error );
+
 LIBEVT_EXTERN \
 int libevt_file_get_number_of_recovered_records(
      libevt_file_t *file,
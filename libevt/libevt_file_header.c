@@ -145,10 +145,6 @@ int libevt_file_header_read_data(
 {
 	static char *function = "libevt_file_header_read_data";
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit  = 0;
-#endif
-
 	if( file_header == NULL )
 	{
 		libcerror_error_set(
@@ -239,10 +235,26 @@ int libevt_file_header_read_data(
 	 ( (evt_file_header_t *) data )->end_of_file_record_offset,
 	 file_header->end_of_file_record_offset );
 
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_file_header_t *) data )->last_record_number,
+	 file_header->last_record_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_file_header_t *) data )->first_record_number,
+	 file_header->first_record_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_file_header_t *) data )->maximum_file_size,
+	 file_header->maximum_file_size );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (evt_file_header_t *) data )->file_flags,
 	 file_header->file_flags );
 
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (evt_file_header_t *) data )->retention,
+	 file_header->retention );
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (evt_file_header_t *) data )->copy_of_size,
 	 file_header->copy_of_size );
@@ -283,42 +295,30 @@ int libevt_file_header_read_data(
 		 function,
 		 file_header->end_of_file_record_offset );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evt_file_header_t *) data )->last_record_number,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: last (newest) record number\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 file_header->last_record_number );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evt_file_header_t *) data )->first_record_number,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: first (oldest) record number\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 file_header->first_record_number );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evt_file_header_t *) data )->maximum_file_size,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: maximum file size\t\t\t\t: %" PRIu32 "\n",
 		 function,
-		 value_32bit );
+		 file_header->maximum_file_size );
 
 		libcnotify_printf(
 		 "%s: file flags\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
 		 file_header->file_flags );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 ( (evt_file_header_t *) data )->retention,
-		 value_32bit );
 		libcnotify_printf(
 		 "%s: retention\t\t\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 value_32bit );
+		 file_header->retention );
 
 		libcnotify_printf(
 		 "%s: copy of (header) size\t\t\t: %" PRIu32 "\n",
@@ -56,10 +56,26 @@ struct libevt_file_header
 	 */
 	uint32_t end_of_file_record_offset;
 
+	/* Last (newest) record number
+	 */
+	uint32_t last_record_number;
+
+	/* First (oldest) record number
+	 */
+	uint32_t first_record_number;
+
+	/* Maximum file size
+	 */
+	uint32_t maximum_file_size;
+
 	/* File flags
 	 */
 	uint32_t file_flags;
 
+	/* Retention
+	 */
+	uint32_t retention;
+
 	/* Copy of (header) size
 	 */
 	uint32_t copy_of_size;
@@ -0,0 +1,824 @@
+/*
+ * Filter functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_filter.h"
+#include "libevt_libcerror.h"
+#include "libevt_libuna.h"
+
+#include "evt_event_record.h"
+
+/* Creates a filter
+ * Make sure the value filter is referencing, is set to NULL
+ * An empty filter matches every record
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_initialize(
+     libevt_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_initialize";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = memory_allocate_structure(
+	                   libevt_internal_filter_t );
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_filter,
+	     0,
+	     sizeof( libevt_internal_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear filter.",
+		 function );
+
+		goto on_error;
+	}
+	*filter = (libevt_filter_t *) internal_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_filter != NULL )
+	{
+		memory_free(
+		 internal_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_free(
+     libevt_filter_t **filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_free";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *filter != NULL )
+	{
+		internal_filter = (libevt_internal_filter_t *) *filter;
+		*filter         = NULL;
+
+		if( internal_filter->source_name != NULL )
+		{
+			memory_free(
+			 internal_filter->source_name );
+		}
+		if( internal_filter->event_categories != NULL )
+		{
+			memory_free(
+			 internal_filter->event_categories );
+		}
+		if( internal_filter->event_identifiers != NULL )
+		{
+			memory_free(
+			 internal_filter->event_identifiers );
+		}
+		memory_free(
+		 internal_filter );
+	}
+	return( 1 );
+}
+
+/* Appends an event identifier to the filter
+ * A record matches when its event identifier is one of the appended event identifiers
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_append_event_identifier(
+     libevt_filter_t *filter,
+     uint32_t event_identifier,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	uint32_t *event_identifiers_reallocation  = NULL;
+	static char *function                     = "libevt_filter_append_event_identifier";
+	int entry_index                           = 0;
+	int first_entry_index                     = 0;
+	int last_entry_index                      = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	/* The event identifiers are kept sorted so that matching can use a binary search
+	 */
+	first_entry_index = 0;
+	last_entry_index  = internal_filter->number_of_event_identifiers;
+
+	while( first_entry_index < last_entry_index )
+	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		if( internal_filter->event_identifiers[ entry_index ] == event_identifier )
+		{
+			return( 1 );
+		}
+		else if( internal_filter->event_identifiers[ entry_index ] < event_identifier )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else
+		{
+			last_entry_index = entry_index;
+		}
+	}
+	if( (size_t) ( internal_filter->number_of_event_identifiers + 1 ) > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of event identifiers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	event_identifiers_reallocation = (uint32_t *) memory_reallocate(
+	                                               internal_filter->event_identifiers,
+	                                               sizeof( uint32_t ) * ( internal_filter->number_of_event_identifiers + 1 ) );
+
+	if( event_identifiers_reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize event identifiers.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->event_identifiers = event_identifiers_reallocation;
+
+	for( entry_index = internal_filter->number_of_event_identifiers;
+	     entry_index > first_entry_index;
+	     entry_index-- )
+	{
+		internal_filter->event_identifiers[ entry_index ] = internal_filter->event_identifiers[ entry_index - 1 ];
+	}
+	internal_filter->event_identifiers[ first_entry_index ] = event_identifier;
+
+	internal_filter->number_of_event_identifiers += 1;
+
+	internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_EVENT_IDENTIFIERS;
+
+	return( 1 );
+}
+
+/* Appends an event category to the filter
+ * A record matches when its event category is one of the appended event categories
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_append_event_category(
+     libevt_filter_t *filter,
+     uint16_t event_category,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	uint16_t *event_categories_reallocation   = NULL;
+	static char *function                     = "libevt_filter_append_event_category";
+	int entry_index                           = 0;
+	int first_entry_index                     = 0;
+	int last_entry_index                      = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	first_entry_index = 0;
+	last_entry_index  = internal_filter->number_of_event_categories;
+
+	while( first_entry_index < last_entry_index )
+	{
+		entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		if( internal_filter->event_categories[ entry_index ] == event_category )
+		{
+			return( 1 );
+		}
+		else if( internal_filter->event_categories[ entry_index ] < event_category )
+		{
+			first_entry_index = entry_index + 1;
+		}
+		else
+		{
+			last_entry_index = entry_index;
+		}
+	}
+	/* There are at most 65536 distinct event categories
+	 */
+	event_categories_reallocation = (uint16_t *) memory_reallocate(
+	                                              internal_filter->event_categories,
+	                                              sizeof( uint16_t ) * ( internal_filter->number_of_event_categories + 1 ) );
+
+	if( event_categories_reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize event categories.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->event_categories = event_categories_reallocation;
+
+	for( entry_index = internal_filter->number_of_event_categories;
+	     entry_index > first_entry_index;
+	     entry_index-- )
+	{
+		internal_filter->event_categories[ entry_index ] = internal_filter->event_categories[ entry_index - 1 ];
+	}
+	internal_filter->event_categories[ first_entry_index ] = event_category;
+
+	internal_filter->number_of_event_categories += 1;
+
+	internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_EVENT_CATEGORIES;
+
+	return( 1 );
+}
+
+/* Sets the event types of the filter
+ * The event types are a combination of LIBEVT_EVENT_TYPE values
+ * A record matches when its event type shares a bit with the event types,
+ * as such records with event type 0 are not matched
+ * An event types value of 0 removes the event types from the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_event_types(
+     libevt_filter_t *filter,
+     uint16_t event_types,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_set_event_types";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	internal_filter->event_types = event_types;
+
+	if( event_types != 0 )
+	{
+		internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_EVENT_TYPES;
+	}
+	else
+	{
+		internal_filter->flags &= ~( LIBEVT_FILTER_FLAG_HAS_EVENT_TYPES );
+	}
+	return( 1 );
+}
+
+/* Sets the time range of the filter
+ * A record matches when its last written time, in number of seconds since
+ * January 1, 1970 00:00:00 UTC, is within the range, including the start and end time
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_time_range(
+     libevt_filter_t *filter,
+     uint32_t start_time,
+     uint32_t end_time,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	static char *function                     = "libevt_filter_set_time_range";
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( start_time > end_time )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start time value exceeds end time.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter->start_time = start_time;
+	internal_filter->end_time   = end_time;
+
+	internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_TIME_RANGE;
+
+	return( 1 );
+}
+
+/* Sets the source name of the filter
+ * The source name is matched case sensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_utf8_source_name(
+     libevt_filter_t *filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	uint16_t *source_name                     = NULL;
+	static char *function                     = "libevt_filter_set_utf8_source_name";
+	size_t source_name_size                   = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf8(
+	     utf8_string,
+	     utf8_string_length,
+	     &source_name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine source name size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( source_name_size == 0 )
+	 || ( source_name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid source name size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	source_name = (uint16_t *) memory_allocate(
+	                            sizeof( uint16_t ) * source_name_size );
+
+	if( source_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libuna_utf16_string_copy_from_utf8(
+	     source_name,
+	     source_name_size,
+	     utf8_string,
+	     utf8_string_length,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set source name.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_filter->source_name != NULL )
+	{
+		memory_free(
+		 internal_filter->source_name );
+	}
+	internal_filter->source_name      = source_name;
+	internal_filter->source_name_size = source_name_size;
+
+	internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME;
+
+	return( 1 );
+
+on_error:
+	if( source_name != NULL )
+	{
+		memory_free(
+		 source_name );
+	}
+	return( -1 );
+}
+
+/* Sets the source name of the filter
+ * The source name is matched case sensitive
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_filter_set_utf16_source_name(
+     libevt_filter_t *filter,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libevt_internal_filter_t *internal_filter = NULL;
+	uint16_t *source_name                     = NULL;
+	static char *function                     = "libevt_filter_set_utf16_source_name";
+	size_t source_name_size                   = 0;
+
+	if( filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_filter = (libevt_internal_filter_t *) filter;
+
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Strip a trailing end-of-string character, it is added below
+	 */
+	if( ( utf16_string_length > 0 )
+	 && ( utf16_string[ utf16_string_length - 1 ] == 0 ) )
+	{
+		utf16_string_length -= 1;
+	}
+	if( utf16_string_length >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	source_name_size = utf16_string_length + 1;
+
+	source_name = (uint16_t *) memory_allocate(
+	                            sizeof( uint16_t ) * source_name_size );
+
+	if( source_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create source name.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > 0 )
+	{
+		if( memory_copy(
+		     source_name,
+		     utf16_string,
+		     sizeof( uint16_t ) * utf16_string_length ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy source name.",
+			 function );
+
+			memory_free(
+			 source_name );
+
+			return( -1 );
+		}
+	}
+	source_name[ utf16_string_length ] = 0;
+
+	if( internal_filter->source_name != NULL )
+	{
+		memory_free(
+		 internal_filter->source_name );
+	}
+	internal_filter->source_name      = source_name;
+	internal_filter->source_name_size = source_name_size;
+
+	internal_filter->flags |= LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME;
+
+	return( 1 );
+}
+
+/* Determines if the record data matches the filter
+ * The fixed-size event record header values are checked before the source name
+ * so that a rejected record only costs a few reads of the record data
+ * Returns 1 if the record data matches, 0 if not or -1 on error
+ */
+int libevt_filter_match_record_data(
+     libevt_internal_filter_t *internal_filter,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     libcerror_error_t **error )
+{
+	static char *function      = "libevt_filter_match_record_data";
+	size_t data_offset         = 0;
+	size_t maximum_data_size   = 0;
+	size_t source_name_index   = 0;
+	uint32_t event_identifier  = 0;
+	uint32_t last_written_time = 0;
+	uint16_t event_category    = 0;
+	uint16_t event_type        = 0;
+	uint16_t value_16bit       = 0;
+	int entry_index            = 0;
+	int first_entry_index      = 0;
+	int last_entry_index       = 0;
+	int result                 = 0;
+
+	if( internal_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < sizeof( evt_event_record_t ) )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_EVENT_TYPES ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_type,
+		 event_type );
+
+		if( ( event_type & internal_filter->event_types ) == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_TIME_RANGE ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_event_record_t *) record_data )->last_written_time,
+		 last_written_time );
+
+		if( ( last_written_time < internal_filter->start_time )
+		 || ( last_written_time > internal_filter->end_time ) )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_EVENT_IDENTIFIERS ) != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_identifier,
+		 event_identifier );
+
+		first_entry_index = 0;
+		last_entry_index  = internal_filter->number_of_event_identifiers;
+		result            = 0;
+
+		while( first_entry_index < last_entry_index )
+		{
+			entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+			if( internal_filter->event_identifiers[ entry_index ] == event_identifier )
+			{
+				result = 1;
+
+				break;
+			}
+			else if( internal_filter->event_identifiers[ entry_index ] < event_identifier )
+			{
+				first_entry_index = entry_index + 1;
+			}
+			else
+			{
+				last_entry_index = entry_index;
+			}
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_EVENT_CATEGORIES ) != 0 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 ( (evt_event_record_t *) record_data )->event_category,
+		 event_category );
+
+		first_entry_index = 0;
+		last_entry_index  = internal_filter->number_of_event_categories;
+		result            = 0;
+
+		while( first_entry_index < last_entry_index )
+		{
+			entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+			if( internal_filter->event_categories[ entry_index ] == event_category )
+			{
+				result = 1;
+
+				break;
+			}
+			else if( internal_filter->event_categories[ entry_index ] < event_category )
+			{
+				first_entry_index = entry_index + 1;
+			}
+			else
+			{
+				last_entry_index = entry_index;
+			}
+		}
+		if( result == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( ( internal_filter->flags & LIBEVT_FILTER_FLAG_HAS_SOURCE_NAME ) != 0 )
+	{
+		/* The source name is compared in place, including the end-of-string character,
+		 * the last 4 bytes of the record data contain the copy of the size
+		 */
+		maximum_data_size = record_data_size - 4;
+		data_offset       = sizeof( evt_event_record_t );
+
+		for( source_name_index = 0;
+		     source_name_index < internal_filter->source_name_size;
+		     source_name_index++ )
+		{
+			if( ( data_offset + 1 ) >= maximum_data_size )
+			{
+				return( 0 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( record_data[ data_offset ] ),
+			 value_16bit );
+
+			if( value_16bit != internal_filter->source_name[ source_name_index ] )
+			{
+				return( 0 );
+			}
+			data_offset += 2;
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,912 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_index_file.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcnotify.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_number_index.h"
+#include "libevt_timestamp_index.h"
+
+#include "evt_end_of_file_record.h"
+#include "evt_file_header.h"
+#include "evt_index_file.h"
+
+/* The size of the buffer used to read and write the index file entries
+ */
+#define LIBEVT_INDEX_FILE_ENTRIES_DATA_SIZE	4096
+
+const uint8_t evt_index_file_signature[ 8 ] = { 'E', 'V', 'T', 'I', 'D', 'X', 0x00, 0x00 };
+
+/* Reads the data of the EVT file the index file is created for
+ * The EVT file header and the end of file record change whenever records are
+ * written hence together with the file size they identify the state of the EVT file
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_index_file_read_fingerprint(
+     evt_index_file_header_t *index_file_header,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_index_file_read_fingerprint";
+	size_t read_size      = 0;
+	ssize_t read_count    = 0;
+
+	if( index_file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     index_file_header->file_header_data,
+	     0,
+	     sizeof( evt_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file header data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     index_file_header->end_of_file_record_data,
+	     0,
+	     sizeof( evt_end_of_file_record_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear end of file record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek file header offset: 0.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              index_file_header->file_header_data,
+	              sizeof( evt_file_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( evt_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read file header data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end of file record can be truncated or the offset can be
+	 * beyond the end of the file, the missing data is left zero
+	 */
+	if( (size64_t) end_of_file_record_offset < file_size )
+	{
+		read_size = sizeof( evt_end_of_file_record_t );
+
+		if( (size64_t) read_size > ( file_size - end_of_file_record_offset ) )
+		{
+			read_size = (size_t) ( file_size - end_of_file_record_offset );
+		}
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     (off64_t) end_of_file_record_offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek end of file record offset: %" PRIu32 " (0x%08" PRIx32 ").",
+			 function,
+			 end_of_file_record_offset,
+			 end_of_file_record_offset );
+
+			return( -1 );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              index_file_header->end_of_file_record_data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read end of file record data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the index file
+ * The index file is only used if it was created for the current state of the EVT file
+ * The records tables and indexes must be empty and can be partially filled if 0 is returned
+ * Returns 1 if successful, 0 if the index file does not match the EVT file or -1 on error
+ */
+int libevt_index_file_read_file_io_handle(
+     libbfio_handle_t *index_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     libevt_offset_table_t *records_table,
+     libevt_offset_table_t *recovered_records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     uint8_t *io_handle_flags,
+     libcerror_error_t **error )
+{
+	evt_index_file_header_t fingerprint_header;
+	evt_index_file_header_t index_file_header;
+	uint8_t entries_data[ LIBEVT_INDEX_FILE_ENTRIES_DATA_SIZE ];
+
+	static char *function                = "libevt_index_file_read_file_io_handle";
+	size64_t expected_index_file_size    = 0;
+	size64_t index_file_size             = 0;
+	size64_t stored_file_size            = 0;
+	size_t entries_data_offset           = 0;
+	size_t entries_data_size             = 0;
+	size_t entry_size                    = 0;
+	ssize_t read_count                   = 0;
+	uint32_t format_version              = 0;
+	uint32_t number_of_recovered_records = 0;
+	uint32_t number_of_records           = 0;
+	uint32_t record_number               = 0;
+	uint32_t record_offset               = 0;
+	uint32_t record_size                 = 0;
+	uint32_t stored_io_handle_flags      = 0;
+	uint32_t written_time                = 0;
+	uint32_t entry_index                 = 0;
+	uint32_t number_of_entries           = 0;
+	int table_entry_index                = 0;
+	int table_index                      = 0;
+
+	if( records_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records table.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( records_table->number_of_entries != 0 )
+	 || ( recovered_records_table->number_of_entries != 0 )
+	 || ( record_number_index->number_of_records != 0 )
+	 || ( timestamp_index->number_of_timestamps != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records tables or indexes - values already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle_flags == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     index_file_io_handle,
+	     &index_file_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve index file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_file_size < (size64_t) sizeof( evt_index_file_header_t ) )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_seek_offset(
+	     index_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek index file header offset: 0.",
+		 function );
+
+		return( -1 );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              index_file_io_handle,
+	              (uint8_t *) &index_file_header,
+	              sizeof( evt_index_file_header_t ),
+	              error );
+
+	if( read_count != (ssize_t) sizeof( evt_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     index_file_header.signature,
+	     evt_index_file_signature,
+	     8 ) != 0 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.io_handle_flags,
+	 stored_io_handle_flags );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 index_file_header.file_size,
+	 stored_file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_records,
+	 number_of_records );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 index_file_header.number_of_recovered_records,
+	 number_of_recovered_records );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu64 "\n",
+		 function,
+		 stored_file_size );
+
+		libcnotify_printf(
+		 "%s: number of records\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_records );
+
+		libcnotify_printf(
+		 "%s: number of recovered records\t: %" PRIu32 "\n",
+		 function,
+		 number_of_recovered_records );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( ( format_version != 1 )
+	 || ( stored_file_size != file_size ) )
+	{
+		return( 0 );
+	}
+	if( ( number_of_records > (uint32_t) INT_MAX )
+	 || ( number_of_recovered_records > (uint32_t) INT_MAX ) )
+	{
+		return( 0 );
+	}
+	expected_index_file_size = sizeof( evt_index_file_header_t )
+	                         + ( (size64_t) number_of_records * sizeof( evt_index_file_record_entry_t ) )
+	                         + ( (size64_t) number_of_recovered_records * sizeof( evt_index_file_recovered_record_entry_t ) );
+
+	if( index_file_size != expected_index_file_size )
+	{
+		return( 0 );
+	}
+	if( libevt_index_file_read_fingerprint(
+	     &fingerprint_header,
+	     file_io_handle,
+	     file_size,
+	     end_of_file_record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fingerprint.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     index_file_header.file_header_data,
+	     fingerprint_header.file_header_data,
+	     sizeof( evt_file_header_t ) ) != 0 )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     index_file_header.end_of_file_record_data,
+	     fingerprint_header.end_of_file_record_data,
+	     sizeof( evt_end_of_file_record_t ) ) != 0 )
+	{
+		return( 0 );
+	}
+	/* The records table is read first followed by the recovered records table
+	 */
+	for( table_index = 0;
+	     table_index < 2;
+	     table_index++ )
+	{
+		if( table_index == 0 )
+		{
+			entry_size        = sizeof( evt_index_file_record_entry_t );
+			number_of_entries = number_of_records;
+		}
+		else
+		{
+			entry_size        = sizeof( evt_index_file_recovered_record_entry_t );
+			number_of_entries = number_of_recovered_records;
+		}
+		entries_data_offset = 0;
+		entries_data_size   = 0;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( entries_data_offset >= entries_data_size )
+			{
+				entries_data_size = ( LIBEVT_INDEX_FILE_ENTRIES_DATA_SIZE / entry_size ) * entry_size;
+
+				if( (size64_t) entries_data_size > ( (size64_t) ( number_of_entries - entry_index ) * entry_size ) )
+				{
+					entries_data_size = (size_t) ( number_of_entries - entry_index ) * entry_size;
+				}
+				read_count = libbfio_handle_read_buffer(
+				              index_file_io_handle,
+				              entries_data,
+				              entries_data_size,
+				              error );
+
+				if( read_count != (ssize_t) entries_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read index file entries.",
+					 function );
+
+					return( -1 );
+				}
+				entries_data_offset = 0;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entries_data[ entries_data_offset ] ),
+			 record_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 &( entries_data[ entries_data_offset + 4 ] ),
+			 record_size );
+
+			/* An entry that does not fit the EVT file indicates the index file is corrupted
+			 */
+			if( ( record_size == 0 )
+			 || ( (size64_t) record_offset >= file_size )
+			 || ( (size64_t) record_size > file_size ) )
+			{
+				return( 0 );
+			}
+			if( table_index == 0 )
+			{
+				byte_stream_copy_to_uint32_little_endian(
+				 &( entries_data[ entries_data_offset + 8 ] ),
+				 record_number );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 &( entries_data[ entries_data_offset + 12 ] ),
+				 written_time );
+
+				if( libevt_offset_table_append_entry(
+				     records_table,
+				     &table_entry_index,
+				     (off64_t) record_offset,
+				     (size64_t) record_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %" PRIu32 " to records table.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+				if( libevt_record_number_index_append_record_number(
+				     record_number_index,
+				     table_entry_index,
+				     record_number,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %" PRIu32 " to record number index.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+				if( libevt_timestamp_index_append_timestamp(
+				     timestamp_index,
+				     table_entry_index,
+				     written_time,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %" PRIu32 " to timestamp index.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( libevt_offset_table_append_entry(
+				     recovered_records_table,
+				     &table_entry_index,
+				     (off64_t) record_offset,
+				     (size64_t) record_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append record: %" PRIu32 " to recovered records table.",
+					 function,
+					 entry_index );
+
+					return( -1 );
+				}
+			}
+			entries_data_offset += entry_size;
+		}
+	}
+	*io_handle_flags = (uint8_t) stored_io_handle_flags;
+
+	return( 1 );
+}
+
+/* Writes the index file
+ * The record number index and timestamp index must contain an entry for every record
+ * in the records table
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_index_file_write_file_io_handle(
+     libbfio_handle_t *index_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     uint8_t io_handle_flags,
+     libevt_offset_table_t *records_table,
+     libevt_offset_table_t *recovered_records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error )
+{
+	evt_index_file_header_t index_file_header;
+	uint8_t entries_data[ LIBEVT_INDEX_FILE_ENTRIES_DATA_SIZE ];
+
+	libevt_offset_table_entry_t *table_entry = NULL;
+	uint32_t *record_numbers                 = NULL;
+	static char *function                    = "libevt_index_file_write_file_io_handle";
+	size_t entries_data_offset               = 0;
+	size_t entry_size                        = 0;
+	ssize_t write_count                      = 0;
+	int entry_index                          = 0;
+	int number_of_entries                    = 0;
+	int table_index                          = 0;
+
+	if( records_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records table.",
+		 function );
+
+		return( -1 );
+	}
+	if( recovered_records_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid recovered records table.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_number_index->number_of_records != records_table->number_of_entries )
+	 || ( timestamp_index->number_of_timestamps != records_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record number index or timestamp index - number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &index_file_header,
+	     0,
+	     sizeof( evt_index_file_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index file header.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_index_file_read_fingerprint(
+	     &index_file_header,
+	     file_io_handle,
+	     file_size,
+	     end_of_file_record_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fingerprint.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     index_file_header.signature,
+	     evt_index_file_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.format_version,
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.io_handle_flags,
+	 io_handle_flags );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 index_file_header.file_size,
+	 file_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_records,
+	 records_table->number_of_entries );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 index_file_header.number_of_recovered_records,
+	 recovered_records_table->number_of_entries );
+
+	if( records_table->number_of_entries > 0 )
+	{
+		if( (size_t) records_table->number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid records table - number of entries value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		record_numbers = (uint32_t *) memory_allocate(
+		                               sizeof( uint32_t ) * records_table->number_of_entries );
+
+		if( record_numbers == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record numbers.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_record_number_index_get_record_numbers(
+		     record_number_index,
+		     record_numbers,
+		     records_table->number_of_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record numbers.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libbfio_handle_seek_offset(
+	     index_file_io_handle,
+	     0,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek index file header offset: 0.",
+		 function );
+
+		goto on_error;
+	}
+	write_count = libbfio_handle_write_buffer(
+	               index_file_io_handle,
+	               (uint8_t *) &index_file_header,
+	               sizeof( evt_index_file_header_t ),
+	               error );
+
+	if( write_count != (ssize_t) sizeof( evt_index_file_header_t ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write index file header.",
+		 function );
+
+		goto on_error;
+	}
+	/* The records table is written first followed by the recovered records table
+	 */
+	for( table_index = 0;
+	     table_index < 2;
+	     table_index++ )
+	{
+		if( table_index == 0 )
+		{
+			entry_size        = sizeof( evt_index_file_record_entry_t );
+			number_of_entries = records_table->number_of_entries;
+		}
+		else
+		{
+			entry_size        = sizeof( evt_index_file_recovered_record_entry_t );
+			number_of_entries = recovered_records_table->number_of_entries;
+		}
+		entries_data_offset = 0;
+
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( table_index == 0 )
+			{
+				table_entry = &( records_table->entries[ entry_index ] );
+			}
+			else
+			{
+				table_entry = &( recovered_records_table->entries[ entry_index ] );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entries_data[ entries_data_offset ] ),
+			 table_entry->offset );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 &( entries_data[ entries_data_offset + 4 ] ),
+			 table_entry->size );
+
+			if( table_index == 0 )
+			{
+				byte_stream_copy_from_uint32_little_endian(
+				 &( entries_data[ entries_data_offset + 8 ] ),
+				 record_numbers[ entry_index ] );
+
+				byte_stream_copy_from_uint32_little_endian(
+				 &( entries_data[ entries_data_offset + 12 ] ),
+				 timestamp_index->timestamps[ entry_index ] );
+			}
+			entries_data_offset += entry_size;
+
+			if( ( ( entries_data_offset + entry_size ) > LIBEVT_INDEX_FILE_ENTRIES_DATA_SIZE )
+			 || ( ( entry_index + 1 ) == number_of_entries ) )
+			{
+				write_count = libbfio_handle_write_buffer(
+				               index_file_io_handle,
+				               entries_data,
+				               entries_data_offset,
+				               error );
+
+				if( write_count != (ssize_t) entries_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_WRITE_FAILED,
+					 "%s: unable to write index file entries.",
+					 function );
+
+					goto on_error;
+				}
+				entries_data_offset = 0;
+			}
+		}
+	}
+	if( record_numbers != NULL )
+	{
+		memory_free(
+		 record_numbers );
+	}
+	return( 1 );
+
+on_error:
+	if( record_numbers != NULL )
+	{
+		memory_free(
+		 record_numbers );
+	}
+	return( -1 );
+}
+
@@ -0,0 +1,78 @@
+/*
+ * Index file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_INDEX_FILE_H )
+#define _LIBEVT_INDEX_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_number_index.h"
+#include "libevt_timestamp_index.h"
+
+#include "evt_index_file.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t evt_index_file_signature[ 8 ];
+
+int libevt_index_file_read_fingerprint(
+     evt_index_file_header_t *index_file_header,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     libcerror_error_t **error );
+
+int libevt_index_file_read_file_io_handle(
+     libbfio_handle_t *index_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     libevt_offset_table_t *records_table,
+     libevt_offset_table_t *recovered_records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     uint8_t *io_handle_flags,
+     libcerror_error_t **error );
+
+int libevt_index_file_write_file_io_handle(
+     libbfio_handle_t *index_file_io_handle,
+     libbfio_handle_t *file_io_handle,
+     size64_t file_size,
+     uint32_t end_of_file_record_offset,
+     uint8_t io_handle_flags,
+     libevt_offset_table_t *records_table,
+     libevt_offset_table_t *recovered_records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_INDEX_FILE_H ) */
+
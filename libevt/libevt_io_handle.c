@@ -32,7 +32,14 @@
 #include "libevt_libcdata.h"
 #include "libevt_libcerror.h"
 #include "libevt_libcnotify.h"
+#include "libevt_libcthreads.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_number_index.h"
 #include "libevt_record_values.h"
+#include "libevt_scan_chunk.h"
+#include "libevt_scan_context.h"
+#include "libevt_signature_scanner.h"
+#include "libevt_timestamp_index.h"
 #include "libevt_unused.h"
 
 #include "evt_file_header.h"
@@ -103,7 +110,11 @@ int libevt_io_handle_initialize(
 
 		goto on_error;
 	}
+	/* The scan method is determined once since the signature scanner relies
+	 * on it being supported by the CPU
+	 */
 	( *io_handle )->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
+	( *io_handle )->scan_method    = libevt_signature_scanner_get_supported_scan_method();
 
 	return( 1 );
 
@@ -155,7 +166,9 @@ int libevt_io_handle_clear(
      libevt_io_handle_t *io_handle,
      libcerror_error_t **error )
 {
-	static char *function = "libevt_io_handle_clear";
+	static char *function         = "libevt_io_handle_clear";
+	int maximum_number_of_threads = 0;
+	int scan_method               = 0;
 
 	if( io_handle == NULL )
 	{
@@ -168,6 +181,12 @@ int libevt_io_handle_clear(
 
 		return( -1 );
 	}
+	/* The maximum number of threads is a setting and the scan method is determined once,
+	 * both are retained when the file is closed
+	 */
+	maximum_number_of_threads = io_handle->maximum_number_of_threads;
+	scan_method               = io_handle->scan_method;
+
 	if( memory_set(
 	     io_handle,
 	     0,
@@ -182,12 +201,15 @@ int libevt_io_handle_clear(
 
 		return( -1 );
 	}
-	io_handle->ascii_codepage = LIBEVT_CODEPAGE_WINDOWS_1252;
+	io_handle->ascii_codepage            = LIBEVT_CODEPAGE_WINDOWS_1252;
+	io_handle->maximum_number_of_threads = maximum_number_of_threads;
+	io_handle->scan_method               = scan_method;
 
 	return( 1 );
 }
 
-/* Reads the records into the records array
+/* Reads the records into the records table
+ * Only the record headers are read, the records are parsed when accessed
  * Returns 1 if successful or -1 on error
  */
 int libevt_io_handle_read_records(
@@ -195,7 +217,9 @@ int libevt_io_handle_read_records(
      libbfio_handle_t *file_io_handle,
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
-     libfdata_list_t *records_list,
+     libevt_offset_table_t *records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
      off64_t *last_record_offset,
      libcerror_error_t **error )
 {
@@ -260,6 +284,19 @@ int libevt_io_handle_read_records(
 
 		goto on_error;
 	}
+	if( libevt_record_values_initialize(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
 	do
 	{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -273,28 +310,17 @@ int libevt_io_handle_read_records(
 			 file_offset );
 		}
 #endif
-		if( libevt_record_values_initialize(
-		     &record_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record values.",
-			 function );
-
-			goto on_error;
-		}
 		safe_last_record_offset = file_offset;
 
-		read_count = libevt_record_values_read_file_io_handle(
+		/* Only the record header is read here, the event record data
+		 * is read by libevt_file_read_record_values on demand
+		 */
+		read_count = libevt_record_values_read_header_file_io_handle(
 		              record_values,
 		              file_io_handle,
 		              io_handle,
 		              &file_offset,
 		              &( io_handle->has_wrapped ),
-		              1,
 		              error );
 
 		if( read_count == -1 )
@@ -313,37 +339,52 @@ int libevt_io_handle_read_records(
 
 		if( record_type == LIBEVT_RECORD_TYPE_EVENT )
 		{
-			if( libfdata_list_append_element(
-			     records_list,
+			if( libevt_offset_table_append_entry(
+			     records_table,
 			     &element_index,
-			     0,
 			     safe_last_record_offset,
 			     (size64_t) read_count,
-			     0,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append record to records list.",
+				 "%s: unable to append record to records table.",
 				 function );
 
 				goto on_error;
 			}
-		}
-		if( libevt_record_values_free(
-		     &record_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record values.",
-			 function );
+			if( libevt_record_number_index_append_record_number(
+			     record_number_index,
+			     element_index,
+			     record_values->number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append record number to record number index.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libevt_timestamp_index_append_timestamp(
+			     timestamp_index,
+			     element_index,
+			     record_values->written_time,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append written time to timestamp index.",
+				 function );
+
+				goto on_error;
+			}
 		}
 		if( record_type == LIBEVT_RECORD_TYPE_END_OF_FILE )
 		{
@@ -377,6 +418,19 @@ int libevt_io_handle_read_records(
 	}
 	while( record_type != LIBEVT_RECORD_TYPE_END_OF_FILE );
 
+	if( libevt_record_values_free(
+	     &record_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record values.",
+		 function );
+
+		goto on_error;
+	}
 	if( record_type == LIBEVT_RECORD_TYPE_END_OF_FILE )
 	{
 		if( safe_last_record_offset != (off64_t) end_of_file_record_offset )
@@ -441,9 +495,12 @@ int libevt_io_handle_end_of_file_record_scan(
 	size_t read_size            = 0;
 	size_t scan_block_offset    = 0;
 	size_t scan_block_size      = 8192;
+	size_t signature_offset     = 0;
 	ssize_t read_count          = 0;
 	uint8_t scan_state          = LIBEVT_RECOVER_SCAN_STATE_START;
 	uint8_t scan_has_wrapped    = 0;
+	uint8_t signature_flag      = 0;
+	int result                  = 0;
 
 	if( io_handle == NULL )
 	{
@@ -551,19 +608,56 @@ int libevt_io_handle_end_of_file_record_scan(
 
 		if( read_size >= 4 )
 		{
-			for( scan_block_offset = 0;
-			     scan_block_offset < ( read_size - 4 );
-			     scan_block_offset += 4 )
+			scan_block_offset = 0;
+
+			while( scan_block_offset <= ( read_size - 4 ) )
 			{
-				if( scan_state == LIBEVT_RECOVER_SCAN_STATE_START )
+				if( ( scan_state == LIBEVT_RECOVER_SCAN_STATE_START )
+				 || ( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4 ) )
 				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_end_of_file_record_signature1,
-					     4 ) == 0 )
+					/* Skip ahead to the next candidate of the first end-of-file record signature
+					 * or of the record signature that follows the end-of-file record
+					 */
+					result = libevt_signature_scanner_scan(
+					          scan_block,
+					          read_size,
+					          scan_block_offset,
+					          ( scan_state == LIBEVT_RECOVER_SCAN_STATE_START ) ? LIBEVT_SIGNATURE_FLAG_END_OF_FILE : LIBEVT_SIGNATURE_FLAG_RECORD,
+					          io_handle->scan_method,
+					          &signature_offset,
+					          &signature_flag,
+					          error );
+
+					if( result == -1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to scan block at offset: %" PRIi64 " for signature.",
+						 function,
+						 file_offset - read_count );
+
+						goto on_error;
+					}
+					else if( result == 0 )
+					{
+						break;
+					}
+					scan_block_offset = signature_offset;
+
+					if( scan_state == LIBEVT_RECOVER_SCAN_STATE_START )
 					{
 						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1;
 					}
+					else
+					{
+						*first_record_offset = (uint32_t) ( file_offset - read_count + scan_block_offset - 4 );
+
+						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE;
+
+						break;
+					}
 				}
 				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE1 )
 				{
@@ -609,20 +703,7 @@ int libevt_io_handle_end_of_file_record_scan(
 						scan_state = LIBEVT_RECOVER_SCAN_STATE_START;
 					}
 				}
-				else if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_EOF_SIGNATURE4 )
-				{
-					if( memory_compare(
-					     &( scan_block[ scan_block_offset ] ),
-					     evt_file_signature,
-					     4 ) == 0 )
-					{
-						*first_record_offset = (uint32_t) ( file_offset - read_count + scan_block_offset - 4 );
-
-						scan_state = LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE;
-
-						break;
-					}
-				}
+				scan_block_offset += 4;
 			}
 		}
 		if( scan_state == LIBEVT_RECOVER_SCAN_STATE_FOUND_RECORD_SIGNATURE )
@@ -677,6 +758,11 @@ on_error:
 }
 
 /* Scans for the event record and adds them to the recovered records array
+ * If skip_record_data is 0 the scan continues directly after the signature of
+ * a record that was found, otherwise it continues after the record
+ * The wrap state of the records read is stored in has_wrapped, which allows
+ * concurrent scans to share the IO handle
+ * The scan stops when abort is signalled in the IO handle
  * Returns 1 if successful, 0 if not or -1 on error
  */
 int libevt_io_handle_event_record_scan(
@@ -684,7 +770,9 @@ int libevt_io_handle_event_record_scan(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      size64_t size,
-     libfdata_list_t *recovered_records_list,
+     uint8_t skip_record_data,
+     uint8_t *has_wrapped,
+     libevt_offset_table_t *recovered_records_table,
      libcerror_error_t **error )
 {
 	libevt_record_values_t *record_values = NULL;
@@ -694,8 +782,11 @@ int libevt_io_handle_event_record_scan(
 	size_t read_size                      = 0;
 	size_t scan_block_offset              = 0;
 	size_t scan_block_size                = 8192;
+	size_t signature_offset               = 0;
 	ssize_t read_count                    = 0;
+	uint8_t signature_flag                = 0;
 	int element_index                     = 0;
+	int result                            = 0;
 
 	if( io_handle == NULL )
 	{
@@ -730,6 +821,17 @@ int libevt_io_handle_event_record_scan(
 
 		return( -1 );
 	}
+	if( has_wrapped == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has wrapped.",
+		 function );
+
+		return( -1 );
+	}
 	scan_block = (uint8_t *) memory_allocate(
 				  sizeof( uint8_t ) * scan_block_size );
 
@@ -746,6 +848,10 @@ int libevt_io_handle_event_record_scan(
 	}
 	while( size >= 4 )
 	{
+		if( io_handle->abort != 0 )
+		{
+			break;
+		}
 		if( libbfio_handle_seek_offset(
 		     file_io_handle,
 		     file_offset,
@@ -792,16 +898,38 @@ int libevt_io_handle_event_record_scan(
 
 		while( scan_block_offset <= ( read_size - 4 ) )
 		{
-			if( memory_compare(
-			     &( scan_block[ scan_block_offset ] ),
-			     evt_file_signature,
-			     4 ) != 0 )
+			result = libevt_signature_scanner_scan(
+			          scan_block,
+			          read_size,
+			          scan_block_offset,
+			          LIBEVT_SIGNATURE_FLAG_RECORD,
+			          io_handle->scan_method,
+			          &signature_offset,
+			          &signature_flag,
+			          error );
+
+			if( result == -1 )
 			{
-				scan_block_offset += 4;
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to scan block at offset: %" PRIi64 " for signature.",
+				 function,
+				 file_offset );
 
-				continue;
+				goto on_error;
 			}
-			record_offset = file_offset + scan_block_offset - 4;
+			else if( result == 0 )
+			{
+				/* Continue after the last 32-bit value in the scan block
+				 */
+				scan_block_offset = read_size - ( read_size % 4 );
+
+				break;
+			}
+			scan_block_offset = signature_offset;
+			record_offset     = file_offset + scan_block_offset - 4;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 			if( libcnotify_verbose != 0 )
@@ -850,7 +978,7 @@ int libevt_io_handle_event_record_scan(
 				      file_io_handle,
 				      io_handle,
 				      &record_offset,
-			              &( io_handle->has_wrapped ),
+				      has_wrapped,
 				      0,
 				      error );
 
@@ -884,20 +1012,18 @@ int libevt_io_handle_event_record_scan(
 			}
 			if( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
 			{
-				if( libfdata_list_append_element(
-				     recovered_records_list,
+				if( libevt_offset_table_append_entry(
+				     recovered_records_table,
 				     &element_index,
-				     0,
 				     file_offset + scan_block_offset - 4,
 				     (size64_t) read_count,
-				     0,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append recovered record to records list.",
+					 "%s: unable to append recovered record to records table.",
 					 function );
 
 					goto on_error;
@@ -916,7 +1042,14 @@ int libevt_io_handle_event_record_scan(
 
 				goto on_error;
 			}
-			scan_block_offset += read_count - 4;
+			if( skip_record_data != 0 )
+			{
+				scan_block_offset += read_count - 4;
+			}
+			else
+			{
+				scan_block_offset += 4;
+			}
 		}
 		file_offset += scan_block_offset;
 		size        -= scan_block_offset;
@@ -959,6 +1092,392 @@ on_error:
 	return( -1 );
 }
 
+/* Scans for the event records in a region and adds them to the recovered records table
+ * If multiple threads are allowed the region is partitioned into chunks that are
+ * scanned by a thread pool, where every thread uses its own clone of the file IO handle
+ * Records can extend beyond the end of the chunk they were found in, therefore the
+ * candidate records of the chunks are merged in offset order, skipping candidates that
+ * overlap with a preceding record, which matches the result of scanning the region at once
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_io_handle_event_record_parallel_scan(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libevt_offset_table_t *recovered_records_table,
+     libcerror_error_t **error )
+{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_pool_t *thread_pool = NULL;
+	libevt_scan_chunk_t **scan_chunks      = NULL;
+	libevt_scan_context_t *scan_context    = NULL;
+	libcerror_error_t *scan_context_error  = NULL;
+	size64_t chunk_size                    = 0;
+	size64_t record_size                   = 0;
+	off64_t chunk_offset                   = 0;
+	off64_t next_record_offset             = 0;
+	off64_t record_offset                  = 0;
+	int chunk_index                        = 0;
+	int element_index                      = 0;
+	int number_of_chunks                   = 0;
+	int number_of_records                  = 0;
+	int number_of_threads                  = 0;
+	int record_index                       = 0;
+#endif
+	static char *function                  = "libevt_io_handle_event_record_parallel_scan";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( ( io_handle->maximum_number_of_threads <= 1 )
+	 || ( size < ( 2 * LIBEVT_RECOVER_SCAN_CHUNK_SIZE ) )
+	 || ( ( size / LIBEVT_RECOVER_SCAN_CHUNK_SIZE ) >= (size64_t) INT_MAX ) )
+#endif
+	{
+		return( libevt_io_handle_event_record_scan(
+		         io_handle,
+		         file_io_handle,
+		         file_offset,
+		         size,
+		         1,
+		         &( io_handle->has_wrapped ),
+		         recovered_records_table,
+		         error ) );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	number_of_chunks = (int) ( size / LIBEVT_RECOVER_SCAN_CHUNK_SIZE );
+
+	if( ( size % LIBEVT_RECOVER_SCAN_CHUNK_SIZE ) != 0 )
+	{
+		number_of_chunks++;
+	}
+	number_of_threads = io_handle->maximum_number_of_threads;
+
+	if( number_of_threads > number_of_chunks )
+	{
+		number_of_threads = number_of_chunks;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: scanning %d chunks using %d threads.\n",
+		 function,
+		 number_of_chunks,
+		 number_of_threads );
+	}
+#endif
+	/* If the file IO handle cannot be cloned fall back to a single threaded scan
+	 * The error of the parallel attempt is discarded but an error that was
+	 * already set by the caller is preserved
+	 */
+	if( libevt_scan_context_initialize(
+	     &scan_context,
+	     file_io_handle,
+	     number_of_threads,
+	     &scan_context_error ) != 1 )
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: unable to create scan context falling back to single threaded scan.\n",
+			 function );
+		}
+#endif
+		libcerror_error_free(
+		 &scan_context_error );
+
+		return( libevt_io_handle_event_record_scan(
+		         io_handle,
+		         file_io_handle,
+		         file_offset,
+		         size,
+		         1,
+		         &( io_handle->has_wrapped ),
+		         recovered_records_table,
+		         error ) );
+	}
+	scan_chunks = (libevt_scan_chunk_t **) memory_allocate(
+	                                        sizeof( libevt_scan_chunk_t * ) * number_of_chunks );
+
+	if( scan_chunks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan chunks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     scan_chunks,
+	     0,
+	     sizeof( libevt_scan_chunk_t * ) * number_of_chunks ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan chunks.",
+		 function );
+
+		memory_free(
+		 scan_chunks );
+
+		scan_chunks = NULL;
+
+		goto on_error;
+	}
+	chunk_offset = file_offset;
+
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		chunk_size = LIBEVT_RECOVER_SCAN_CHUNK_SIZE;
+
+		if( chunk_size > size )
+		{
+			chunk_size = size;
+		}
+		if( libevt_scan_chunk_initialize(
+		     &( scan_chunks[ chunk_index ] ),
+		     io_handle,
+		     chunk_offset,
+		     chunk_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		chunk_offset += chunk_size;
+		size         -= chunk_size;
+	}
+	if( libcthreads_thread_pool_create(
+	     &thread_pool,
+	     NULL,
+	     number_of_threads,
+	     number_of_chunks,
+	     (int (*)(intptr_t *, void *)) &libevt_scan_chunk_scan,
+	     (void *) scan_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libcthreads_thread_pool_push(
+		     thread_pool,
+		     (intptr_t *) scan_chunks[ chunk_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push scan chunk: %d onto thread pool.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	if( libcthreads_thread_pool_join(
+	     &thread_pool,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to join thread pool.",
+		 function );
+
+		goto on_error;
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( scan_chunks[ chunk_index ]->result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to scan chunk: %d for event records.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		if( scan_chunks[ chunk_index ]->has_wrapped != 0 )
+		{
+			io_handle->has_wrapped = 1;
+		}
+		if( libevt_offset_table_get_number_of_entries(
+		     scan_chunks[ chunk_index ]->records_table,
+		     &number_of_records,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of candidate records of scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			if( libevt_offset_table_get_entry_by_index(
+			     scan_chunks[ chunk_index ]->records_table,
+			     record_index,
+			     &record_offset,
+			     &record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve candidate record: %d of scan chunk: %d.",
+				 function,
+				 record_index,
+				 chunk_index );
+
+				goto on_error;
+			}
+			/* Skip candidates that are part of the data of a preceding record
+			 */
+			if( record_offset < next_record_offset )
+			{
+				continue;
+			}
+			if( libevt_offset_table_append_entry(
+			     recovered_records_table,
+			     &element_index,
+			     record_offset,
+			     record_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append recovered record to records table.",
+				 function );
+
+				goto on_error;
+			}
+			next_record_offset = record_offset + (off64_t) record_size;
+		}
+	}
+	for( chunk_index = 0;
+	     chunk_index < number_of_chunks;
+	     chunk_index++ )
+	{
+		if( libevt_scan_chunk_free(
+		     &( scan_chunks[ chunk_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scan chunk: %d.",
+			 function,
+			 chunk_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 scan_chunks );
+
+	scan_chunks = NULL;
+
+	if( libevt_scan_context_free(
+	     &scan_context,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free scan context.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	if( scan_chunks != NULL )
+	{
+		for( chunk_index = 0;
+		     chunk_index < number_of_chunks;
+		     chunk_index++ )
+		{
+			if( scan_chunks[ chunk_index ] != NULL )
+			{
+				libevt_scan_chunk_free(
+				 &( scan_chunks[ chunk_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 scan_chunks );
+	}
+	if( scan_context != NULL )
+	{
+		libevt_scan_context_free(
+		 &scan_context,
+		 NULL );
+	}
+	return( -1 );
+#endif /* defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT ) */
+}
+
 /* Tries to recover records
  * Returns 1 if successful or -1 on error
  */
@@ -968,8 +1487,10 @@ int libevt_io_handle_recover_records(
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
      off64_t last_record_offset,
-     libfdata_list_t *records_list,
-     libfdata_list_t *recovered_records_list,
+     libevt_offset_table_t *records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     libevt_offset_table_t *recovered_records_table,
      libcerror_error_t **error )
 {
 	static char *function  = "libevt_io_handle_recover_records";
@@ -1032,7 +1553,9 @@ int libevt_io_handle_recover_records(
 			          file_io_handle,
 			          first_record_offset,
 			          end_of_file_record_offset,
-			          records_list,
+			          records_table,
+			          record_number_index,
+			          timestamp_index,
 			          &last_record_offset,
 			          error );
 
@@ -1091,12 +1614,12 @@ int libevt_io_handle_recover_records(
 				 first_record_offset );
 			}
 #endif
-			if( libevt_io_handle_event_record_scan(
+			if( libevt_io_handle_event_record_parallel_scan(
 			     io_handle,
 			     file_io_handle,
 			     (off64_t) sizeof( evt_file_header_t ),
 			     (size64_t) ( first_record_offset - sizeof( evt_file_header_t ) ),
-			     recovered_records_list,
+			     recovered_records_table,
 			     error ) != 1 )
 			{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1155,12 +1678,12 @@ int libevt_io_handle_recover_records(
 				}
 			}
 #endif
-			if( libevt_io_handle_event_record_scan(
+			if( libevt_io_handle_event_record_parallel_scan(
 			     io_handle,
 			     file_io_handle,
 			     last_record_offset,
 			     io_handle->file_size - last_record_offset,
-			     recovered_records_list,
+			     recovered_records_table,
 			     error ) != 1 )
 			{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -1211,12 +1734,12 @@ int libevt_io_handle_recover_records(
 				 first_record_offset );
 			}
 #endif
-			if( libevt_io_handle_event_record_scan(
+			if( libevt_io_handle_event_record_parallel_scan(
 			     io_handle,
 			     file_io_handle,
 			     last_record_offset,
 			     (size64_t) first_record_offset - last_record_offset,
-			     recovered_records_list,
+			     recovered_records_table,
 			     error ) != 1 )
 			{
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -27,8 +27,9 @@
 
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
-#include "libevt_libfcache.h"
-#include "libevt_libfdata.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_number_index.h"
+#include "libevt_timestamp_index.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -45,6 +46,11 @@ struct libevt_io_handle
 	 */
 	size64_t file_size;
 
+	/* The memory mapped file data or NULL if the file is not memory mapped
+	 * the size of the data is the file size
+	 */
+	const uint8_t *mapped_data;
+
 	/* Value to indicate the record data has wrapped
 	 */
 	uint8_t has_wrapped;
@@ -57,6 +63,15 @@ struct libevt_io_handle
 	 */
 	int ascii_codepage;
 
+	/* The maximum number of threads used to scan for recoverable records
+	 * and to read records concurrently
+	 */
+	int maximum_number_of_threads;
+
+	/* The signature scan method, determined once when the IO handle is created
+	 */
+	int scan_method;
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -79,7 +94,9 @@ int libevt_io_handle_read_records(
      libbfio_handle_t *file_io_handle,
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
-     libfdata_list_t *records_list,
+     libevt_offset_table_t *records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
      off64_t *last_record_offset,
      libcerror_error_t **error );
 
@@ -95,7 +112,17 @@ int libevt_io_handle_event_record_scan(
      libbfio_handle_t *file_io_handle,
      off64_t file_offset,
      size64_t size,
-     libfdata_list_t *recovered_records_list,
+     uint8_t skip_record_data,
+     uint8_t *has_wrapped,
+     libevt_offset_table_t *recovered_records_table,
+     libcerror_error_t **error );
+
+int libevt_io_handle_event_record_parallel_scan(
+     libevt_io_handle_t *io_handle,
+     libbfio_handle_t *file_io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libevt_offset_table_t *recovered_records_table,
      libcerror_error_t **error );
 
 int libevt_io_handle_recover_records(
@@ -104,8 +131,10 @@ int libevt_io_handle_recover_records(
      uint32_t first_record_offset,
      uint32_t end_of_file_record_offset,
      off64_t last_record_offset,
-     libfdata_list_t *records_list,
-     libfdata_list_t *recovered_records_list,
+     libevt_offset_table_t *records_table,
+     libevt_record_number_index_t *record_number_index,
+     libevt_timestamp_index_t *timestamp_index,
+     libevt_offset_table_t *recovered_records_table,
      libcerror_error_t **error );
 
 #if defined( __cplusplus )
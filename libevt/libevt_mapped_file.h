@@ -0,0 +1,88 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_MAPPED_FILE_H )
+#define _LIBEVT_MAPPED_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( WINAPI )
+#include <windows.h>
+#endif
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_mapped_file libevt_mapped_file_t;
+
+struct libevt_mapped_file
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+
+#if defined( WINAPI )
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+#endif
+};
+
+int libevt_mapped_file_initialize(
+     libevt_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+int libevt_mapped_file_free(
+     libevt_mapped_file_t **mapped_file,
+     libcerror_error_t **error );
+
+#if defined( WINAPI )
+
+int libevt_mapped_file_map_handle(
+     libevt_mapped_file_t *mapped_file,
+     HANDLE file_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( WINAPI ) */
+
+int libevt_mapped_file_open(
+     libevt_mapped_file_t *mapped_file,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libevt_mapped_file_close(
+     libevt_mapped_file_t *mapped_file,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_MAPPED_FILE_H ) */
+
@@ -0,0 +1,943 @@
+/*
+ * Multi file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libcdata.h"
+#include "libevt_libcerror.h"
+#include "libevt_multi_file.h"
+#include "libevt_record.h"
+#include "libevt_record_iterator.h"
+
+/* Creates a multi file
+ * Make sure the value multi_file is referencing, is set to NULL
+ * The multi file merges the records of multiple files in order of their
+ * last written time
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_initialize(
+     libevt_multi_file_t **multi_file,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	static char *function                             = "libevt_multi_file_initialize";
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *multi_file != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid multi file value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_file = memory_allocate_structure(
+	                       libevt_internal_multi_file_t );
+
+	if( internal_multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     internal_multi_file,
+	     0,
+	     sizeof( libevt_internal_multi_file_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear multi file.",
+		 function );
+
+		memory_free(
+		 internal_multi_file );
+
+		return( -1 );
+	}
+	internal_multi_file->retrieved_file_index = -1;
+
+	*multi_file = (libevt_multi_file_t *) internal_multi_file;
+
+	return( 1 );
+}
+
+/* Frees a multi file
+ * The files are not managed by the multi file and are not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_free(
+     libevt_multi_file_t **multi_file,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	static char *function                             = "libevt_multi_file_free";
+	int file_index                                    = 0;
+	int result                                        = 1;
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( *multi_file != NULL )
+	{
+		internal_multi_file = (libevt_internal_multi_file_t *) *multi_file;
+		*multi_file         = NULL;
+
+		/* The pending records are managed by the record iterators
+		 */
+		for( file_index = 0;
+		     file_index < internal_multi_file->number_of_files;
+		     file_index++ )
+		{
+			if( libevt_record_iterator_free(
+			     &( internal_multi_file->record_iterators[ file_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record iterator: %d.",
+				 function,
+				 file_index );
+
+				result = -1;
+			}
+		}
+		if( internal_multi_file->heap != NULL )
+		{
+			memory_free(
+			 internal_multi_file->heap );
+		}
+		if( internal_multi_file->written_times != NULL )
+		{
+			memory_free(
+			 internal_multi_file->written_times );
+		}
+		if( internal_multi_file->records != NULL )
+		{
+			memory_free(
+			 internal_multi_file->records );
+		}
+		if( internal_multi_file->record_iterators != NULL )
+		{
+			memory_free(
+			 internal_multi_file->record_iterators );
+		}
+		memory_free(
+		 internal_multi_file );
+	}
+	return( result );
+}
+
+/* Appends a file
+ * The file must be opened and is not managed by the multi file, it must
+ * remain open until the multi file is freed
+ * Files cannot be appended after the first record was retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_append_file(
+     libevt_multi_file_t *multi_file,
+     libevt_file_t *file,
+     int *file_index,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	libevt_record_iterator_t **record_iterators       = NULL;
+	libevt_record_iterator_t *record_iterator         = NULL;
+	libevt_record_t **records                         = NULL;
+	static char *function                             = "libevt_multi_file_append_file";
+	uint32_t *written_times                           = NULL;
+	int *heap                                         = NULL;
+	int number_of_allocated_files                     = 0;
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_file = (libevt_internal_multi_file_t *) multi_file;
+
+	if( internal_multi_file->is_merging != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid multi file - records are already being merged.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_multi_file->number_of_files == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid multi file - number of files value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_iterator_initialize(
+	     &record_iterator,
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( libevt_record_iterator_set_filter(
+	     record_iterator,
+	     internal_multi_file->filter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filter in record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_multi_file->number_of_files >= internal_multi_file->number_of_allocated_files )
+	{
+		if( internal_multi_file->number_of_allocated_files > ( INT_MAX - 8 ) )
+		{
+			number_of_allocated_files = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_files = internal_multi_file->number_of_allocated_files + 8;
+		}
+		if( (size_t) number_of_allocated_files > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_record_iterator_t * ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated files value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		record_iterators = (libevt_record_iterator_t **) memory_reallocate(
+		                                                  internal_multi_file->record_iterators,
+		                                                  sizeof( libevt_record_iterator_t * ) * number_of_allocated_files );
+
+		if( record_iterators == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record iterators.",
+			 function );
+
+			goto on_error;
+		}
+		internal_multi_file->record_iterators = record_iterators;
+
+		records = (libevt_record_t **) memory_reallocate(
+		                                internal_multi_file->records,
+		                                sizeof( libevt_record_t * ) * number_of_allocated_files );
+
+		if( records == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize records.",
+			 function );
+
+			goto on_error;
+		}
+		internal_multi_file->records = records;
+
+		written_times = (uint32_t *) memory_reallocate(
+		                              internal_multi_file->written_times,
+		                              sizeof( uint32_t ) * number_of_allocated_files );
+
+		if( written_times == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize written times.",
+			 function );
+
+			goto on_error;
+		}
+		internal_multi_file->written_times = written_times;
+
+		heap = (int *) memory_reallocate(
+		                internal_multi_file->heap,
+		                sizeof( int ) * number_of_allocated_files );
+
+		if( heap == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize heap.",
+			 function );
+
+			goto on_error;
+		}
+		internal_multi_file->heap                      = heap;
+		internal_multi_file->number_of_allocated_files = number_of_allocated_files;
+	}
+	*file_index = internal_multi_file->number_of_files;
+
+	internal_multi_file->record_iterators[ *file_index ] = record_iterator;
+	internal_multi_file->records[ *file_index ]          = NULL;
+	internal_multi_file->written_times[ *file_index ]    = 0;
+
+	internal_multi_file->number_of_files += 1;
+
+	return( 1 );
+
+on_error:
+	if( record_iterator != NULL )
+	{
+		libevt_record_iterator_free(
+		 &record_iterator,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the number of files
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_get_number_of_files(
+     libevt_multi_file_t *multi_file,
+     int *number_of_files,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	static char *function                             = "libevt_multi_file_get_number_of_files";
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_file = (libevt_internal_multi_file_t *) multi_file;
+
+	if( number_of_files == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of files.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_files = internal_multi_file->number_of_files;
+
+	return( 1 );
+}
+
+/* Sets the filter
+ * The filter is set in the record iterators of all the files
+ * The filter is not managed by the multi file and must remain valid
+ * while it is set, a filter value of NULL removes the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_set_filter(
+     libevt_multi_file_t *multi_file,
+     libevt_filter_t *filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	static char *function                             = "libevt_multi_file_set_filter";
+	int file_index                                    = 0;
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_file = (libevt_internal_multi_file_t *) multi_file;
+
+	for( file_index = 0;
+	     file_index < internal_multi_file->number_of_files;
+	     file_index++ )
+	{
+		if( libevt_record_iterator_set_filter(
+		     internal_multi_file->record_iterators[ file_index ],
+		     filter,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set filter in record iterator: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	internal_multi_file->filter = filter;
+
+	return( 1 );
+}
+
+/* Compares the pending records of two files
+ * Pending records with the same last written time are ordered by file index
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libevt_multi_file_compare_pending_records(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int first_file_index,
+     int second_file_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_multi_file_compare_pending_records";
+
+	if( internal_multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_multi_file->written_times[ first_file_index ] < internal_multi_file->written_times[ second_file_index ] )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( internal_multi_file->written_times[ first_file_index ] > internal_multi_file->written_times[ second_file_index ] )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_file_index < second_file_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_file_index > second_file_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Moves a heap entry towards the top of the heap until the heap is ordered
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_heap_sift_up(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int heap_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_multi_file_heap_sift_up";
+	int compare_result    = 0;
+	int file_index        = 0;
+	int parent_index      = 0;
+
+	if( internal_multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( heap_index < 0 )
+	 || ( heap_index >= internal_multi_file->heap_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid heap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_index = internal_multi_file->heap[ heap_index ];
+
+	while( heap_index > 0 )
+	{
+		parent_index = ( heap_index - 1 ) / 2;
+
+		compare_result = libevt_multi_file_compare_pending_records(
+		                  internal_multi_file,
+		                  file_index,
+		                  internal_multi_file->heap[ parent_index ],
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare pending records.",
+			 function );
+
+			return( -1 );
+		}
+		else if( compare_result != LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+		internal_multi_file->heap[ heap_index ] = internal_multi_file->heap[ parent_index ];
+
+		heap_index = parent_index;
+	}
+	internal_multi_file->heap[ heap_index ] = file_index;
+
+	return( 1 );
+}
+
+/* Moves a heap entry towards the bottom of the heap until the heap is ordered
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_multi_file_heap_sift_down(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int heap_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_multi_file_heap_sift_down";
+	int child_index       = 0;
+	int compare_result    = 0;
+	int file_index        = 0;
+
+	if( internal_multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( heap_index < 0 )
+	 || ( heap_index >= internal_multi_file->heap_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid heap index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_index = internal_multi_file->heap[ heap_index ];
+
+	while( heap_index < ( internal_multi_file->heap_size / 2 ) )
+	{
+		child_index = ( heap_index * 2 ) + 1;
+
+		if( ( child_index + 1 ) < internal_multi_file->heap_size )
+		{
+			compare_result = libevt_multi_file_compare_pending_records(
+			                  internal_multi_file,
+			                  internal_multi_file->heap[ child_index + 1 ],
+			                  internal_multi_file->heap[ child_index ],
+			                  error );
+
+			if( compare_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare pending records.",
+				 function );
+
+				return( -1 );
+			}
+			else if( compare_result == LIBCDATA_COMPARE_LESS )
+			{
+				child_index += 1;
+			}
+		}
+		compare_result = libevt_multi_file_compare_pending_records(
+		                  internal_multi_file,
+		                  internal_multi_file->heap[ child_index ],
+		                  file_index,
+		                  error );
+
+		if( compare_result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare pending records.",
+			 function );
+
+			return( -1 );
+		}
+		else if( compare_result != LIBCDATA_COMPARE_LESS )
+		{
+			break;
+		}
+		internal_multi_file->heap[ heap_index ] = internal_multi_file->heap[ child_index ];
+
+		heap_index = child_index;
+	}
+	internal_multi_file->heap[ heap_index ] = file_index;
+
+	return( 1 );
+}
+
+/* Reads the pending record of a specific file
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevt_multi_file_read_pending_record(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int file_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_multi_file_read_pending_record";
+	int result            = 0;
+
+	if( internal_multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( file_index < 0 )
+	 || ( file_index >= internal_multi_file->number_of_files ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The record of the record iterator is reused hence the previous
+	 * pending record of the file is no longer valid
+	 */
+	internal_multi_file->records[ file_index ] = NULL;
+
+	result = libevt_record_iterator_get_next_record(
+	          internal_multi_file->record_iterators[ file_index ],
+	          &( internal_multi_file->records[ file_index ] ),
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve next record of file: %d.",
+		 function,
+		 file_index );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libevt_record_get_written_time(
+		     internal_multi_file->records[ file_index ],
+		     &( internal_multi_file->written_times[ file_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve written time of record of file: %d.",
+			 function,
+			 file_index );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the next record in order of last written time
+ * Only one pending record per file is kept, the record is managed by the
+ * multi file and remains valid until the next record is retrieved or the
+ * multi file is freed, it must not be freed
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevt_multi_file_get_next_record(
+     libevt_multi_file_t *multi_file,
+     int *file_index,
+     int *record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_internal_multi_file_t *internal_multi_file = NULL;
+	static char *function                             = "libevt_multi_file_get_next_record";
+	int next_file_index                               = 0;
+	int result                                        = 0;
+
+	if( multi_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_file = (libevt_internal_multi_file_t *) multi_file;
+
+	if( file_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_multi_file->is_merging == 0 )
+	{
+		internal_multi_file->heap_size = 0;
+
+		for( next_file_index = 0;
+		     next_file_index < internal_multi_file->number_of_files;
+		     next_file_index++ )
+		{
+			result = libevt_multi_file_read_pending_record(
+			          internal_multi_file,
+			          next_file_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to read pending record of file: %d.",
+				 function,
+				 next_file_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				internal_multi_file->heap[ internal_multi_file->heap_size ] = next_file_index;
+
+				internal_multi_file->heap_size += 1;
+
+				if( libevt_multi_file_heap_sift_up(
+				     internal_multi_file,
+				     internal_multi_file->heap_size - 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to sift up heap entry.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		internal_multi_file->is_merging = 1;
+	}
+	/* The file of the previously retrieved record is at the top of the heap
+	 * and is advanced only now since its record remained valid until this call
+	 */
+	else if( internal_multi_file->retrieved_file_index != -1 )
+	{
+		result = libevt_multi_file_read_pending_record(
+		          internal_multi_file,
+		          internal_multi_file->retrieved_file_index,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to read pending record of file: %d.",
+			 function,
+			 internal_multi_file->retrieved_file_index );
+
+			return( -1 );
+		}
+		internal_multi_file->retrieved_file_index = -1;
+
+		if( result == 0 )
+		{
+			internal_multi_file->heap_size -= 1;
+
+			internal_multi_file->heap[ 0 ] = internal_multi_file->heap[ internal_multi_file->heap_size ];
+		}
+		if( internal_multi_file->heap_size > 0 )
+		{
+			if( libevt_multi_file_heap_sift_down(
+			     internal_multi_file,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to sift down heap entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( internal_multi_file->heap_size == 0 )
+	{
+		return( 0 );
+	}
+	next_file_index = internal_multi_file->heap[ 0 ];
+
+	/* The record index of the record iterator refers to the record after the pending record
+	 */
+	*file_index   = next_file_index;
+	*record_index = ( (libevt_internal_record_iterator_t *) internal_multi_file->record_iterators[ next_file_index ] )->record_index - 1;
+	*record       = internal_multi_file->records[ next_file_index ];
+
+	internal_multi_file->retrieved_file_index = next_file_index;
+
+	return( 1 );
+}
+
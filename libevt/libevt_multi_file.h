@@ -0,0 +1,146 @@
+/*
+ * Multi file functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_MULTI_FILE_H )
+#define _LIBEVT_MULTI_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_libcerror.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_multi_file libevt_internal_multi_file_t;
+
+struct libevt_internal_multi_file
+{
+	/* The record iterators, one per file
+	 */
+	libevt_record_iterator_t **record_iterators;
+
+	/* The pending records, one per file
+	 */
+	libevt_record_t **records;
+
+	/* The last written times of the pending records, one per file
+	 */
+	uint32_t *written_times;
+
+	/* The number of files
+	 */
+	int number_of_files;
+
+	/* The number of allocated files
+	 */
+	int number_of_allocated_files;
+
+	/* The heap of the indexes of the files with a pending record
+	 * ordered by the last written time of the pending record
+	 */
+	int *heap;
+
+	/* The number of entries in the heap
+	 */
+	int heap_size;
+
+	/* The index of the file of which the pending record was retrieved last
+	 * or -1 if not set
+	 */
+	int retrieved_file_index;
+
+	/* Value to indicate the records are being merged
+	 */
+	uint8_t is_merging;
+
+	/* The filter
+	 */
+	libevt_filter_t *filter;
+};
+
+LIBEVT_EXTERN \
+int libevt_multi_file_initialize(
+     libevt_multi_file_t **multi_file,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_multi_file_free(
+     libevt_multi_file_t **multi_file,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_multi_file_append_file(
+     libevt_multi_file_t *multi_file,
+     libevt_file_t *file,
+     int *file_index,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_multi_file_get_number_of_files(
+     libevt_multi_file_t *multi_file,
+     int *number_of_files,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_multi_file_set_filter(
+     libevt_multi_file_t *multi_file,
+     libevt_filter_t *filter,
+     libcerror_error_t **error );
+
+int libevt_multi_file_compare_pending_records(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int first_file_index,
+     int second_file_index,
+     libcerror_error_t **error );
+
+int libevt_multi_file_heap_sift_up(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int heap_index,
+     libcerror_error_t **error );
+
+int libevt_multi_file_heap_sift_down(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int heap_index,
+     libcerror_error_t **error );
+
+int libevt_multi_file_read_pending_record(
+     libevt_internal_multi_file_t *internal_multi_file,
+     int file_index,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_multi_file_get_next_record(
+     libevt_multi_file_t *multi_file,
+     int *file_index,
+     int *record_index,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_MULTI_FILE_H ) */
+
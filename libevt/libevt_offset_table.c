@@ -0,0 +1,446 @@
+/*
+ * Record offset table functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_offset_table.h"
+
+/* Creates an offset table
+ * Make sure the value offset_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_initialize(
+     libevt_offset_table_t **offset_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_offset_table_initialize";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid offset table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*offset_table = memory_allocate_structure(
+	                 libevt_offset_table_t );
+
+	if( *offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create offset table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *offset_table,
+	     0,
+	     sizeof( libevt_offset_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear offset table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *offset_table != NULL )
+	{
+		memory_free(
+		 *offset_table );
+
+		*offset_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an offset table
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_free(
+     libevt_offset_table_t **offset_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_offset_table_free";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *offset_table != NULL )
+	{
+		if( ( *offset_table )->entries != NULL )
+		{
+			memory_free(
+			 ( *offset_table )->entries );
+		}
+		memory_free(
+		 *offset_table );
+
+		*offset_table = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties an offset table and frees the entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_empty(
+     libevt_offset_table_t *offset_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_offset_table_empty";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_table->entries != NULL )
+	{
+		memory_free(
+		 offset_table->entries );
+
+		offset_table->entries = NULL;
+	}
+	offset_table->number_of_entries           = 0;
+	offset_table->number_of_allocated_entries = 0;
+
+	return( 1 );
+}
+
+/* Resizes the allocated entries of an offset table
+ * The number of allocated entries cannot be smaller than the number of entries,
+ * which allows to release unused entries after the table has been filled
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_resize(
+     libevt_offset_table_t *offset_table,
+     int number_of_allocated_entries,
+     libcerror_error_t **error )
+{
+	libevt_offset_table_entry_t *reallocation = NULL;
+	static char *function                     = "libevt_offset_table_resize";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_allocated_entries < offset_table->number_of_entries )
+	 || ( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_offset_table_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of allocated entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_allocated_entries == offset_table->number_of_allocated_entries )
+	{
+		return( 1 );
+	}
+	if( number_of_allocated_entries == 0 )
+	{
+		return( libevt_offset_table_empty(
+		         offset_table,
+		         error ) );
+	}
+	reallocation = (libevt_offset_table_entry_t *) memory_reallocate(
+	                                                offset_table->entries,
+	                                                sizeof( libevt_offset_table_entry_t ) * number_of_allocated_entries );
+
+	if( reallocation == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize entries.",
+		 function );
+
+		return( -1 );
+	}
+	offset_table->entries                     = reallocation;
+	offset_table->number_of_allocated_entries = number_of_allocated_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_get_number_of_entries(
+     libevt_offset_table_t *offset_table,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_offset_table_get_number_of_entries";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = offset_table->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_get_entry_by_index(
+     libevt_offset_table_t *offset_table,
+     int entry_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_offset_table_get_entry_by_index";
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= offset_table->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid size.",
+		 function );
+
+		return( -1 );
+	}
+	*offset = (off64_t) offset_table->entries[ entry_index ].offset;
+	*size   = (size64_t) offset_table->entries[ entry_index ].size;
+
+	return( 1 );
+}
+
+/* Appends an entry
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_offset_table_append_entry(
+     libevt_offset_table_t *offset_table,
+     int *entry_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function           = "libevt_offset_table_append_entry";
+	int number_of_allocated_entries = 0;
+
+	if( offset_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid offset table.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( offset < 0 )
+	 || ( offset > (off64_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( size > (size64_t) UINT32_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_table->number_of_entries == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset table - number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset_table->number_of_entries >= offset_table->number_of_allocated_entries )
+	{
+		/* The allocation grows exponentially to keep the number of reallocations low
+		 */
+		if( offset_table->number_of_allocated_entries < 256 )
+		{
+			number_of_allocated_entries = 256;
+		}
+		else if( offset_table->number_of_allocated_entries > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_entries = offset_table->number_of_allocated_entries * 2;
+		}
+		if( libevt_offset_table_resize(
+		     offset_table,
+		     number_of_allocated_entries,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize offset table.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*entry_index = offset_table->number_of_entries;
+
+	offset_table->entries[ *entry_index ].offset = (uint32_t) offset;
+	offset_table->entries[ *entry_index ].size   = (uint32_t) size;
+
+	offset_table->number_of_entries += 1;
+
+	return( 1 );
+}
+
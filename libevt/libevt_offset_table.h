@@ -0,0 +1,105 @@
+/*
+ * Record offset table functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_OFFSET_TABLE_H )
+#define _LIBEVT_OFFSET_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_offset_table_entry libevt_offset_table_entry_t;
+
+struct libevt_offset_table_entry
+{
+	/* The record offset
+	 */
+	uint32_t offset;
+
+	/* The record size
+	 */
+	uint32_t size;
+};
+
+typedef struct libevt_offset_table libevt_offset_table_t;
+
+struct libevt_offset_table
+{
+	/* The entries
+	 */
+	libevt_offset_table_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+};
+
+int libevt_offset_table_initialize(
+     libevt_offset_table_t **offset_table,
+     libcerror_error_t **error );
+
+int libevt_offset_table_free(
+     libevt_offset_table_t **offset_table,
+     libcerror_error_t **error );
+
+int libevt_offset_table_empty(
+     libevt_offset_table_t *offset_table,
+     libcerror_error_t **error );
+
+int libevt_offset_table_resize(
+     libevt_offset_table_t *offset_table,
+     int number_of_allocated_entries,
+     libcerror_error_t **error );
+
+int libevt_offset_table_get_number_of_entries(
+     libevt_offset_table_t *offset_table,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libevt_offset_table_get_entry_by_index(
+     libevt_offset_table_t *offset_table,
+     int entry_index,
+     off64_t *offset,
+     size64_t *size,
+     libcerror_error_t **error );
+
+int libevt_offset_table_append_entry(
+     libevt_offset_table_t *offset_table,
+     int *entry_index,
+     off64_t offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_OFFSET_TABLE_H ) */
+
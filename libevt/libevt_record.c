@@ -30,9 +30,14 @@
 #include "libevt_libcthreads.h"
 #include "libevt_record.h"
 #include "libevt_record_values.h"
+#include "libevt_records_cache.h"
 
 /* Creates record
  * Make sure the value record is referencing, is set to NULL
+ * If records_cache is set the record takes over the reference to the record values
+ * and releases it to the records cache when freed
+ * If LIBEVT_RECORD_FLAG_WITHOUT_LOCK is set the record is created without
+ * a read/write lock, this is only safe if the record is not shared between threads
  * Returns 1 if successful or -1 on error
  */
 int libevt_record_initialize(
@@ -40,6 +45,8 @@ int libevt_record_initialize(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libevt_record_values_t *record_values,
+     libevt_records_cache_t *records_cache,
+     uint8_t flags,
      libcerror_error_t **error )
 {
 	libevt_internal_record_t *internal_record = NULL;
@@ -78,6 +85,18 @@ int libevt_record_initialize(
 
 		return( -1 );
 	}
+	if( ( flags & ~( LIBEVT_RECORD_FLAG_WITHOUT_LOCK ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
+
+		return( -1 );
+	}
 	internal_record = memory_allocate_structure(
 	                   libevt_internal_record_t );
 
@@ -110,23 +129,27 @@ int libevt_record_initialize(
 		return( -1 );
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_initialize(
-	     &( internal_record->read_write_lock ),
-	     error ) != 1 )
+	if( ( flags & LIBEVT_RECORD_FLAG_WITHOUT_LOCK ) == 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to initialize read/write lock.",
-		 function );
+		if( libcthreads_read_write_lock_initialize(
+		     &( internal_record->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize read/write lock.",
+			 function );
 
-		goto on_error;
+			goto on_error;
+		}
 	}
 #endif
 	internal_record->file_io_handle = file_io_handle;
 	internal_record->io_handle      = io_handle;
 	internal_record->record_values  = record_values;
+	internal_record->records_cache  = records_cache;
 
 	*record = (libevt_record_t *) internal_record;
 
@@ -183,7 +206,25 @@ int libevt_record_free(
 			result = -1;
 		}
 #endif
-		/* The file_io_handle, io_handle and record_values references are freed elsewhere
+		if( internal_record->records_cache != NULL )
+		{
+			if( libevt_records_cache_release_record_values(
+			     internal_record->records_cache,
+			     internal_record->record_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release record values.",
+				 function );
+
+				result = -1;
+			}
+		}
+		/* The file_io_handle and io_handle references are freed elsewhere
+		 * the record_values reference is released to the records cache if set
 		 */
 		memory_free(
 		 internal_record );
@@ -217,18 +258,21 @@ int libevt_record_get_offset(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_offset(
@@ -246,18 +290,21 @@ int libevt_record_get_offset(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -289,18 +336,21 @@ int libevt_record_get_identifier(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_number(
@@ -318,18 +368,21 @@ int libevt_record_get_identifier(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -362,18 +415,21 @@ int libevt_record_get_creation_time(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_creation_time(
@@ -391,18 +447,21 @@ int libevt_record_get_creation_time(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -435,18 +494,21 @@ int libevt_record_get_written_time(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_written_time(
@@ -464,18 +526,21 @@ int libevt_record_get_written_time(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -507,18 +572,21 @@ int libevt_record_get_event_identifier(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_event_identifier(
@@ -536,18 +604,21 @@ int libevt_record_get_event_identifier(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -579,18 +650,21 @@ int libevt_record_get_event_type(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_event_type(
@@ -608,18 +682,21 @@ int libevt_record_get_event_type(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -651,18 +728,21 @@ int libevt_record_get_event_category(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_event_category(
@@ -680,18 +760,21 @@ int libevt_record_get_event_category(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -724,18 +807,21 @@ int libevt_record_get_utf8_source_name_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_source_name_size(
@@ -755,18 +841,21 @@ int libevt_record_get_utf8_source_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -800,18 +889,21 @@ int libevt_record_get_utf8_source_name(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_source_name(
@@ -832,21 +924,24 @@ int libevt_record_get_utf8_source_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
-
-		return( -1 );
-	}
-#endif
-	return( result );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif
+	return( result );
 }
 
 /* Retrieves the size of the UTF-16 encoded source name
@@ -876,18 +971,21 @@ int libevt_record_get_utf16_source_name_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_source_name_size(
@@ -907,18 +1005,21 @@ int libevt_record_get_utf16_source_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -952,18 +1053,21 @@ int libevt_record_get_utf16_source_name(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_source_name(
@@ -984,18 +1088,21 @@ int libevt_record_get_utf16_source_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1028,18 +1135,21 @@ int libevt_record_get_utf8_computer_name_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_computer_name_size(
@@ -1059,18 +1169,21 @@ int libevt_record_get_utf8_computer_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1104,18 +1217,21 @@ int libevt_record_get_utf8_computer_name(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_computer_name(
@@ -1136,18 +1252,21 @@ int libevt_record_get_utf8_computer_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1180,18 +1299,21 @@ int libevt_record_get_utf16_computer_name_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_computer_name_size(
@@ -1211,18 +1333,21 @@ int libevt_record_get_utf16_computer_name_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1256,18 +1381,21 @@ int libevt_record_get_utf16_computer_name(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_computer_name(
@@ -1288,18 +1416,21 @@ int libevt_record_get_utf16_computer_name(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1332,18 +1463,21 @@ int libevt_record_get_utf8_user_security_identifier_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_user_security_identifier_size(
@@ -1363,18 +1497,21 @@ int libevt_record_get_utf8_user_security_identifier_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1408,18 +1545,21 @@ int libevt_record_get_utf8_user_security_identifier(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf8_user_security_identifier(
@@ -1440,18 +1580,21 @@ int libevt_record_get_utf8_user_security_identifier(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1484,18 +1627,21 @@ int libevt_record_get_utf16_user_security_identifier_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_user_security_identifier_size(
@@ -1515,18 +1661,21 @@ int libevt_record_get_utf16_user_security_identifier_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1560,18 +1709,21 @@ int libevt_record_get_utf16_user_security_identifier(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_utf16_user_security_identifier(
@@ -1592,18 +1744,21 @@ int libevt_record_get_utf16_user_security_identifier(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1635,18 +1790,21 @@ int libevt_record_get_number_of_strings(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_number_of_strings(
@@ -1664,18 +1822,21 @@ int libevt_record_get_number_of_strings(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1709,18 +1870,21 @@ int libevt_record_get_utf8_string_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_utf8_string_size(
@@ -1740,18 +1904,21 @@ int libevt_record_get_utf8_string_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1786,18 +1953,21 @@ int libevt_record_get_utf8_string(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_utf8_string(
@@ -1818,18 +1988,21 @@ int libevt_record_get_utf8_string(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1863,18 +2036,21 @@ int libevt_record_get_utf16_string_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_utf16_string_size(
@@ -1894,18 +2070,21 @@ int libevt_record_get_utf16_string_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -1940,18 +2119,21 @@ int libevt_record_get_utf16_string(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	if( libevt_record_values_get_utf16_string(
@@ -1972,18 +2154,21 @@ int libevt_record_get_utf16_string(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -2015,18 +2200,21 @@ int libevt_record_get_data_size(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_data_size(
@@ -2046,18 +2234,21 @@ int libevt_record_get_data_size(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -2090,18 +2281,21 @@ int libevt_record_get_data(
 	internal_record = (libevt_internal_record_t *) record;
 
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_grab_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to grab read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_grab_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	result = libevt_record_values_get_data(
@@ -2122,18 +2316,21 @@ int libevt_record_get_data(
 		result = -1;
 	}
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
-	if( libcthreads_read_write_lock_release_for_read(
-	     internal_record->read_write_lock,
-	     error ) != 1 )
+	if( internal_record->read_write_lock != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to release read/write lock for reading.",
-		 function );
+		if( libcthreads_read_write_lock_release_for_read(
+		     internal_record->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for reading.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
 	}
 #endif
 	return( result );
@@ -31,6 +31,7 @@
 #include "libevt_libcerror.h"
 #include "libevt_libcthreads.h"
 #include "libevt_record_values.h"
+#include "libevt_records_cache.h"
 #include "libevt_types.h"
 
 #if defined( __cplusplus )
@@ -53,6 +54,11 @@ struct libevt_internal_record
 	 */
 	libevt_record_values_t *record_values;
 
+	/* The records cache that holds the reference to the record values
+	 * or NULL if the record values are managed elsewhere
+	 */
+	libevt_records_cache_t *records_cache;
+
 #if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
 	/* The read/write lock
 	 */
@@ -65,6 +71,8 @@ int libevt_record_initialize(
      libevt_io_handle_t *io_handle,
      libbfio_handle_t *file_io_handle,
      libevt_record_values_t *record_values,
+     libevt_records_cache_t *records_cache,
+     uint8_t flags,
      libcerror_error_t **error );
 
 LIBEVT_EXTERN \
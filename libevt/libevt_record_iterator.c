@@ -0,0 +1,889 @@
+/*
+ * Record iterator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_event_record.h"
+#include "libevt_file.h"
+#include "libevt_filter.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_offset_table.h"
+#include "libevt_record.h"
+#include "libevt_record_iterator.h"
+#include "libevt_record_values.h"
+
+#include "evt_file_header.h"
+
+/* Creates a record iterator
+ * Make sure the value record_iterator is referencing, is set to NULL
+ * The record iterator retrieves the records of the file in order and must be
+ * freed before the file is closed
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_initialize(
+     libevt_record_iterator_t **record_iterator,
+     libevt_file_t *file,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file                       = NULL;
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	static char *function                                       = "libevt_record_iterator_initialize";
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_iterator != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record iterator value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libevt_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->file_header == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing file header.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator = memory_allocate_structure(
+	                            libevt_internal_record_iterator_t );
+
+	if( internal_record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record iterator.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_record_iterator,
+	     0,
+	     sizeof( libevt_internal_record_iterator_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record iterator.",
+		 function );
+
+		memory_free(
+		 internal_record_iterator );
+
+		return( -1 );
+	}
+	/* Memory mapped files are read without a read-ahead buffer
+	 */
+	if( internal_file->io_handle->mapped_data == NULL )
+	{
+		internal_record_iterator->buffer = (uint8_t *) memory_allocate(
+		                                                sizeof( uint8_t ) * LIBEVT_RECORD_ITERATOR_READ_AHEAD_SIZE );
+
+		if( internal_record_iterator->buffer == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create read-ahead buffer.",
+			 function );
+
+			goto on_error;
+		}
+		internal_record_iterator->buffer_size = LIBEVT_RECORD_ITERATOR_READ_AHEAD_SIZE;
+	}
+	if( libevt_record_values_initialize(
+	     &( internal_record_iterator->record_values ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record values.",
+		 function );
+
+		goto on_error;
+	}
+	internal_record_iterator->internal_file    = internal_file;
+	internal_record_iterator->end_record_index = -1;
+
+	*record_iterator = (libevt_record_iterator_t *) internal_record_iterator;
+
+	return( 1 );
+
+on_error:
+	if( internal_record_iterator != NULL )
+	{
+		if( internal_record_iterator->buffer != NULL )
+		{
+			memory_free(
+			 internal_record_iterator->buffer );
+		}
+		memory_free(
+		 internal_record_iterator );
+	}
+	return( -1 );
+}
+
+/* Frees a record iterator
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_free(
+     libevt_record_iterator_t **record_iterator,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	static char *function                                       = "libevt_record_iterator_free";
+	int result                                                  = 1;
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_iterator != NULL )
+	{
+		internal_record_iterator = (libevt_internal_record_iterator_t *) *record_iterator;
+		*record_iterator         = NULL;
+
+		/* The internal_file reference is freed elsewhere
+		 */
+		if( internal_record_iterator->record != NULL )
+		{
+			if( libevt_record_free(
+			     &( internal_record_iterator->record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libevt_record_values_free(
+		     &( internal_record_iterator->record_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_record_iterator->record_data != NULL )
+		{
+			memory_free(
+			 internal_record_iterator->record_data );
+		}
+		if( internal_record_iterator->buffer != NULL )
+		{
+			memory_free(
+			 internal_record_iterator->buffer );
+		}
+		memory_free(
+		 internal_record_iterator );
+	}
+	return( result );
+}
+
+/* Retrieves the data of a record
+ * The data is either read ahead, referenced in the memory mapped file data or,
+ * if the record wraps around the end of the file, copied into the record data buffer.
+ * The data remains valid until the data of the next record is retrieved.
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_get_record_data(
+     libevt_internal_record_iterator_t *internal_record_iterator,
+     off64_t record_offset,
+     size_t record_size,
+     const uint8_t **record_data,
+     libcerror_error_t **error )
+{
+	libevt_io_handle_t *io_handle = NULL;
+	uint8_t *reallocation         = NULL;
+	static char *function         = "libevt_record_iterator_get_record_data";
+	size_t read_size              = 0;
+	ssize_t read_count            = 0;
+
+	if( internal_record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_record_iterator->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record iterator - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	io_handle = internal_record_iterator->internal_file->io_handle;
+
+	if( ( record_offset < (off64_t) sizeof( evt_file_header_t ) )
+	 || ( (size64_t) record_offset >= io_handle->file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_size < 8 )
+	 || ( record_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( (size64_t) record_size > ( io_handle->file_size - sizeof( evt_file_header_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of the record data up to the end of the file
+	 */
+	read_size = record_size;
+
+	if( (size64_t) read_size > ( io_handle->file_size - record_offset ) )
+	{
+		read_size = (size_t) ( io_handle->file_size - record_offset );
+	}
+	if( read_size == record_size )
+	{
+		if( io_handle->mapped_data != NULL )
+		{
+			*record_data = &( io_handle->mapped_data[ record_offset ] );
+
+			return( 1 );
+		}
+		if( ( record_offset < internal_record_iterator->buffer_offset )
+		 || ( (size64_t) ( record_offset + record_size ) > (size64_t) ( internal_record_iterator->buffer_offset + internal_record_iterator->buffer_data_size ) ) )
+		{
+			if( record_size <= internal_record_iterator->buffer_size )
+			{
+				/* Records are stored consecutively hence read ahead from the start of the record
+				 */
+				read_size = internal_record_iterator->buffer_size;
+
+				if( (size64_t) read_size > ( io_handle->file_size - record_offset ) )
+				{
+					read_size = (size_t) ( io_handle->file_size - record_offset );
+				}
+				internal_record_iterator->buffer_offset    = 0;
+				internal_record_iterator->buffer_data_size = 0;
+
+				read_count = libevt_file_read_buffer_at_offset(
+				              internal_record_iterator->internal_file,
+				              record_offset,
+				              internal_record_iterator->buffer,
+				              read_size,
+				              error );
+
+				if( read_count != (ssize_t) read_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read ahead data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+					 function,
+					 record_offset,
+					 record_offset );
+
+					return( -1 );
+				}
+				internal_record_iterator->buffer_offset    = record_offset;
+				internal_record_iterator->buffer_data_size = read_size;
+			}
+		}
+		if( ( record_offset >= internal_record_iterator->buffer_offset )
+		 && ( (size64_t) ( record_offset + record_size ) <= (size64_t) ( internal_record_iterator->buffer_offset + internal_record_iterator->buffer_data_size ) ) )
+		{
+			*record_data = &( internal_record_iterator->buffer[ record_offset - internal_record_iterator->buffer_offset ] );
+
+			return( 1 );
+		}
+	}
+	/* The record is larger than the read-ahead buffer or wraps around
+	 * the end of the file
+	 */
+	if( record_size > internal_record_iterator->record_data_size )
+	{
+		reallocation = (uint8_t *) memory_reallocate(
+		                            internal_record_iterator->record_data,
+		                            sizeof( uint8_t ) * record_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize record data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_record_iterator->record_data      = reallocation;
+		internal_record_iterator->record_data_size = record_size;
+	}
+	if( io_handle->mapped_data != NULL )
+	{
+		if( memory_copy(
+		     internal_record_iterator->record_data,
+		     &( io_handle->mapped_data[ record_offset ] ),
+		     read_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record data.",
+			 function );
+
+			return( -1 );
+		}
+		if( read_size < record_size )
+		{
+			if( memory_copy(
+			     &( internal_record_iterator->record_data[ read_size ] ),
+			     &( io_handle->mapped_data[ sizeof( evt_file_header_t ) ] ),
+			     record_size - read_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy wrapped record data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else
+	{
+		read_count = libevt_file_read_buffer_at_offset(
+		              internal_record_iterator->internal_file,
+		              record_offset,
+		              internal_record_iterator->record_data,
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data at offset: %" PRIi64 " (0x%08" PRIx64 ").",
+			 function,
+			 record_offset,
+			 record_offset );
+
+			return( -1 );
+		}
+		if( read_size < record_size )
+		{
+			read_count = libevt_file_read_buffer_at_offset(
+			              internal_record_iterator->internal_file,
+			              (off64_t) sizeof( evt_file_header_t ),
+			              &( internal_record_iterator->record_data[ read_size ] ),
+			              record_size - read_size,
+			              error );
+
+			if( read_count != (ssize_t) ( record_size - read_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read wrapped record data.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	*record_data = internal_record_iterator->record_data;
+
+	return( 1 );
+}
+
+/* Retrieves the next record
+ * The record is managed by the record iterator and remains valid until the next
+ * record is retrieved or the record iterator is freed, it must not be freed
+ * Returns 1 if successful, 0 if no more records are available or -1 on error
+ */
+int libevt_record_iterator_get_next_record(
+     libevt_record_iterator_t *record_iterator,
+     libevt_record_t **record,
+     libcerror_error_t **error )
+{
+	libevt_internal_file_t *internal_file                       = NULL;
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	const uint8_t *record_data                                  = NULL;
+	static char *function                                       = "libevt_record_iterator_get_next_record";
+	size64_t record_size                                        = 0;
+	off64_t record_offset                                       = 0;
+	int filter_result                                           = 0;
+	int number_of_records                                       = 0;
+	int result                                                  = 1;
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	if( internal_record_iterator->internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record iterator - missing internal file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = internal_record_iterator->internal_file;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libevt_offset_table_get_number_of_entries(
+	     internal_file->records_table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from records table.",
+		 function );
+
+		result = -1;
+	}
+	/* The records that do not match the filter are skipped before the record values are read
+	 */
+	while( result == 1 )
+	{
+		if( ( internal_record_iterator->record_index >= number_of_records )
+		 || ( ( internal_record_iterator->end_record_index >= 0 )
+		  && ( internal_record_iterator->record_index >= internal_record_iterator->end_record_index ) ) )
+		{
+			result = 0;
+		}
+		else if( libevt_offset_table_get_entry_by_index(
+		          internal_file->records_table,
+		          internal_record_iterator->record_index,
+		          &record_offset,
+		          &record_size,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 internal_record_iterator->record_index );
+
+			result = -1;
+		}
+		else if( libevt_record_iterator_get_record_data(
+		          internal_record_iterator,
+		          record_offset,
+		          (size_t) record_size,
+		          &record_data,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to retrieve data of record: %d.",
+			 function,
+			 internal_record_iterator->record_index );
+
+			result = -1;
+		}
+		else if( internal_record_iterator->filter == NULL )
+		{
+			break;
+		}
+		else
+		{
+			filter_result = libevt_filter_match_record_data(
+			                 internal_record_iterator->filter,
+			                 record_data,
+			                 (size_t) record_size,
+			                 error );
+
+			if( filter_result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to determine if record: %d matches filter.",
+				 function,
+				 internal_record_iterator->record_index );
+
+				result = -1;
+			}
+			else if( filter_result != 0 )
+			{
+				break;
+			}
+			else
+			{
+				internal_record_iterator->record_index += 1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		/* The record values are reused hence the event record of
+		 * the previous record is freed first
+		 */
+		if( internal_record_iterator->record_values->event_record != NULL )
+		{
+			if( libevt_event_record_free(
+			     &( internal_record_iterator->record_values->event_record ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free event record.",
+				 function );
+
+				result = -1;
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		internal_record_iterator->record_values->offset = record_offset;
+
+		if( libevt_record_values_read_data(
+		     internal_record_iterator->record_values,
+		     record_data,
+		     (size_t) record_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record values of record: %d.",
+			 function,
+			 internal_record_iterator->record_index );
+
+			result = -1;
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_record_iterator->record == NULL ) )
+	{
+		if( libevt_record_initialize(
+		     &( internal_record_iterator->record ),
+		     internal_file->io_handle,
+		     internal_file->file_io_handle,
+		     internal_record_iterator->record_values,
+		     NULL,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_record_iterator->record_index += 1;
+
+		*record = internal_record_iterator->record;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the filter
+ * The records that do not match the filter are skipped before they are parsed
+ * The filter is not managed by the record iterator and must remain valid
+ * while it is set, a filter value of NULL removes the filter
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_set_filter(
+     libevt_record_iterator_t *record_iterator,
+     libevt_filter_t *filter,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	static char *function                                       = "libevt_record_iterator_set_filter";
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	internal_record_iterator->filter = (libevt_internal_filter_t *) filter;
+
+	return( 1 );
+}
+
+/* Sets the index of the next record
+ * The read-ahead buffer is discarded hence the record index can also be set
+ * to continue iterating after the file was refreshed
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_set_record_index(
+     libevt_record_iterator_t *record_iterator,
+     int record_index,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	static char *function                                       = "libevt_record_iterator_set_record_index";
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	if( record_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid record index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator->record_index     = record_index;
+	internal_record_iterator->buffer_data_size = 0;
+
+	return( 1 );
+}
+
+/* Sets the index of the record at which the iteration ends
+ * The record at the end record index and the records that follow it are not
+ * retrieved, an end record index value of -1 removes the end record index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_iterator_set_end_record_index(
+     libevt_record_iterator_t *record_iterator,
+     int end_record_index,
+     libcerror_error_t **error )
+{
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	static char *function                                       = "libevt_record_iterator_set_end_record_index";
+
+	if( record_iterator == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record iterator.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	if( end_record_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid end record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_record_iterator->end_record_index = end_record_index;
+
+	return( 1 );
+}
+
@@ -0,0 +1,140 @@
+/*
+ * Record iterator functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORD_ITERATOR_H )
+#define _LIBEVT_RECORD_ITERATOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_extern.h"
+#include "libevt_file.h"
+#include "libevt_filter.h"
+#include "libevt_libcerror.h"
+#include "libevt_record_values.h"
+#include "libevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_internal_record_iterator libevt_internal_record_iterator_t;
+
+struct libevt_internal_record_iterator
+{
+	/* The internal file
+	 */
+	libevt_internal_file_t *internal_file;
+
+	/* The index of the next record
+	 */
+	int record_index;
+
+	/* The index of the record at which the iteration ends or -1 if not set
+	 */
+	int end_record_index;
+
+	/* The read-ahead buffer
+	 */
+	uint8_t *buffer;
+
+	/* The read-ahead buffer size
+	 */
+	size_t buffer_size;
+
+	/* The offset of the data in the read-ahead buffer
+	 */
+	off64_t buffer_offset;
+
+	/* The size of the data in the read-ahead buffer
+	 */
+	size_t buffer_data_size;
+
+	/* The buffer of records that do not fit in the read-ahead buffer
+	 * or that wrap around the end of the file
+	 */
+	uint8_t *record_data;
+
+	/* The size of the record data buffer
+	 */
+	size_t record_data_size;
+
+	/* The record values that are reused for every record
+	 */
+	libevt_record_values_t *record_values;
+
+	/* The record that is reused for every record
+	 */
+	libevt_record_t *record;
+
+	/* The filter
+	 */
+	libevt_internal_filter_t *filter;
+};
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_initialize(
+     libevt_record_iterator_t **record_iterator,
+     libevt_file_t *file,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_free(
+     libevt_record_iterator_t **record_iterator,
+     libcerror_error_t **error );
+
+int libevt_record_iterator_get_record_data(
+     libevt_internal_record_iterator_t *internal_record_iterator,
+     off64_t record_offset,
+     size_t record_size,
+     const uint8_t **record_data,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_get_next_record(
+     libevt_record_iterator_t *record_iterator,
+     libevt_record_t **record,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_set_filter(
+     libevt_record_iterator_t *record_iterator,
+     libevt_filter_t *filter,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_set_record_index(
+     libevt_record_iterator_t *record_iterator,
+     int record_index,
+     libcerror_error_t **error );
+
+LIBEVT_EXTERN \
+int libevt_record_iterator_set_end_record_index(
+     libevt_record_iterator_t *record_iterator,
+     int end_record_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORD_ITERATOR_H ) */
+
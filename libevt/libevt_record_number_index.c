@@ -0,0 +1,561 @@
+/*
+ * Record number index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "libevt_libcerror.h"
+#include "libevt_record_number_index.h"
+
+/* Creates a record number index
+ * Make sure the value record_number_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_initialize(
+     libevt_record_number_index_t **record_number_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_number_index_initialize";
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_number_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record number index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*record_number_index = memory_allocate_structure(
+	                        libevt_record_number_index_t );
+
+	if( *record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record number index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *record_number_index,
+	     0,
+	     sizeof( libevt_record_number_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record number index.",
+		 function );
+
+		goto on_error;
+	}
+	( *record_number_index )->entries_are_sorted = 1;
+
+	return( 1 );
+
+on_error:
+	if( *record_number_index != NULL )
+	{
+		memory_free(
+		 *record_number_index );
+
+		*record_number_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a record number index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_free(
+     libevt_record_number_index_t **record_number_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_number_index_free";
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_number_index != NULL )
+	{
+		if( ( *record_number_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *record_number_index )->entries );
+		}
+		memory_free(
+		 *record_number_index );
+
+		*record_number_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a record number index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_empty(
+     libevt_record_number_index_t *record_number_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_number_index_empty";
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index->entries != NULL )
+	{
+		memory_free(
+		 record_number_index->entries );
+
+		record_number_index->entries = NULL;
+	}
+	record_number_index->first_record_number         = 0;
+	record_number_index->number_of_records           = 0;
+	record_number_index->number_of_allocated_entries = 0;
+	record_number_index->entries_are_sorted          = 1;
+
+	return( 1 );
+}
+
+/* Appends the record number of the next record
+ * As long as the record numbers are contiguous no entries are stored
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_append_record_number(
+     libevt_record_number_index_t *record_number_index,
+     int record_index,
+     uint32_t record_number,
+     libcerror_error_t **error )
+{
+	libevt_record_number_index_entry_t *reallocation = NULL;
+	static char *function                            = "libevt_record_number_index_append_record_number";
+	int entry_index                                  = 0;
+	int number_of_allocated_entries                  = 0;
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index != record_number_index->number_of_records )
+	 || ( record_index == INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index->entries == NULL )
+	{
+		if( record_index == 0 )
+		{
+			record_number_index->first_record_number = record_number;
+			record_number_index->number_of_records   = 1;
+
+			return( 1 );
+		}
+		if( record_number == ( record_number_index->first_record_number + (uint32_t) record_index ) )
+		{
+			record_number_index->number_of_records += 1;
+
+			return( 1 );
+		}
+	}
+	if( record_index >= record_number_index->number_of_allocated_entries )
+	{
+		if( record_index < 256 )
+		{
+			number_of_allocated_entries = 256;
+		}
+		else if( record_index > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_entries = record_index * 2;
+		}
+		if( (size_t) number_of_allocated_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_record_number_index_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated entries value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = (libevt_record_number_index_entry_t *) memory_reallocate(
+		                                                       record_number_index->entries,
+		                                                       sizeof( libevt_record_number_index_entry_t ) * number_of_allocated_entries );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		/* The record numbers of the preceding records are contiguous
+		 * if no entries were stored yet
+		 */
+		if( record_number_index->entries == NULL )
+		{
+			for( entry_index = 0;
+			     entry_index < record_index;
+			     entry_index++ )
+			{
+				reallocation[ entry_index ].record_number = record_number_index->first_record_number + (uint32_t) entry_index;
+				reallocation[ entry_index ].record_index  = entry_index;
+			}
+		}
+		record_number_index->entries                     = reallocation;
+		record_number_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( ( record_index > 0 )
+	 && ( record_number < record_number_index->entries[ record_index - 1 ].record_number ) )
+	{
+		record_number_index->entries_are_sorted = 0;
+	}
+	record_number_index->entries[ record_index ].record_number = record_number;
+	record_number_index->entries[ record_index ].record_index  = record_index;
+
+	record_number_index->number_of_records += 1;
+
+	return( 1 );
+}
+
+/* Compares two record number index entries
+ * Returns -1, 0 or 1 for use with qsort
+ */
+static int libevt_record_number_index_compare_entries(
+            const void *first_entry,
+            const void *second_entry )
+{
+	const libevt_record_number_index_entry_t *first  = (const libevt_record_number_index_entry_t *) first_entry;
+	const libevt_record_number_index_entry_t *second = (const libevt_record_number_index_entry_t *) second_entry;
+
+	if( first->record_number < second->record_number )
+	{
+		return( -1 );
+	}
+	else if( first->record_number > second->record_number )
+	{
+		return( 1 );
+	}
+	if( first->record_index < second->record_index )
+	{
+		return( -1 );
+	}
+	else if( first->record_index > second->record_index )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Finalizes the record number index after the last record number was appended
+ * The entries are sorted by record number and the unused entries are released
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_finalize(
+     libevt_record_number_index_t *record_number_index,
+     libcerror_error_t **error )
+{
+	libevt_record_number_index_entry_t *reallocation = NULL;
+	static char *function                            = "libevt_record_number_index_finalize";
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index->entries == NULL )
+	{
+		return( 1 );
+	}
+	if( record_number_index->number_of_allocated_entries > record_number_index->number_of_records )
+	{
+		reallocation = (libevt_record_number_index_entry_t *) memory_reallocate(
+		                                                       record_number_index->entries,
+		                                                       sizeof( libevt_record_number_index_entry_t ) * record_number_index->number_of_records );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		record_number_index->entries                     = reallocation;
+		record_number_index->number_of_allocated_entries = record_number_index->number_of_records;
+	}
+	if( record_number_index->entries_are_sorted == 0 )
+	{
+		qsort(
+		 record_number_index->entries,
+		 (size_t) record_number_index->number_of_records,
+		 sizeof( libevt_record_number_index_entry_t ),
+		 &libevt_record_number_index_compare_entries );
+
+		record_number_index->entries_are_sorted = 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the record index of a specific record number
+ * If the record numbers are contiguous the record index is calculated
+ * otherwise the entries are searched
+ * Returns 1 if successful, 0 if no such record number or -1 on error
+ */
+int libevt_record_number_index_get_record_index_by_record_number(
+     libevt_record_number_index_t *record_number_index,
+     uint32_t record_number,
+     int *record_index,
+     libcerror_error_t **error )
+{
+	static char *function    = "libevt_record_number_index_get_record_index_by_record_number";
+	uint32_t relative_number = 0;
+	int first_entry_index    = 0;
+	int last_entry_index     = 0;
+	int middle_entry_index   = 0;
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index->entries == NULL )
+	{
+		/* The relative number wraps for record numbers before the first record number
+		 */
+		relative_number = record_number - record_number_index->first_record_number;
+
+		if( relative_number >= (uint32_t) record_number_index->number_of_records )
+		{
+			return( 0 );
+		}
+		*record_index = (int) relative_number;
+
+		return( 1 );
+	}
+	if( record_number_index->entries_are_sorted == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid record number index - entries are not sorted.",
+		 function );
+
+		return( -1 );
+	}
+	first_entry_index = 0;
+	last_entry_index  = record_number_index->number_of_records - 1;
+
+	while( first_entry_index <= last_entry_index )
+	{
+		middle_entry_index = first_entry_index + ( ( last_entry_index - first_entry_index ) / 2 );
+
+		if( record_number_index->entries[ middle_entry_index ].record_number < record_number )
+		{
+			first_entry_index = middle_entry_index + 1;
+		}
+		else if( record_number_index->entries[ middle_entry_index ].record_number > record_number )
+		{
+			last_entry_index = middle_entry_index - 1;
+		}
+		else
+		{
+			*record_index = record_number_index->entries[ middle_entry_index ].record_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Retrieves the record numbers of all records ordered by record index
+ * The record numbers array must contain number of records elements
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_number_index_get_record_numbers(
+     libevt_record_number_index_t *record_number_index,
+     uint32_t *record_numbers,
+     int number_of_record_numbers,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_record_number_index_get_record_numbers";
+	int entry_index       = 0;
+	int record_index      = 0;
+
+	if( record_number_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record number index.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_numbers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record numbers.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_record_numbers != record_number_index->number_of_records )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of record numbers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_number_index->entries == NULL )
+	{
+		for( record_index = 0;
+		     record_index < record_number_index->number_of_records;
+		     record_index++ )
+		{
+			record_numbers[ record_index ] = record_number_index->first_record_number + (uint32_t) record_index;
+		}
+		return( 1 );
+	}
+	/* The entries can be sorted by record number hence the record index
+	 * stored in the entry is used
+	 */
+	for( entry_index = 0;
+	     entry_index < record_number_index->number_of_records;
+	     entry_index++ )
+	{
+		record_index = record_number_index->entries[ entry_index ].record_index;
+
+		if( ( record_index < 0 )
+		 || ( record_index >= number_of_record_numbers ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid entry: %d - record index value out of bounds.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		record_numbers[ record_index ] = record_number_index->entries[ entry_index ].record_number;
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,112 @@
+/*
+ * Record number index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORD_NUMBER_INDEX_H )
+#define _LIBEVT_RECORD_NUMBER_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_record_number_index_entry libevt_record_number_index_entry_t;
+
+struct libevt_record_number_index_entry
+{
+	/* The record number
+	 */
+	uint32_t record_number;
+
+	/* The record index
+	 */
+	int record_index;
+};
+
+typedef struct libevt_record_number_index libevt_record_number_index_t;
+
+struct libevt_record_number_index
+{
+	/* The record number of the first record
+	 */
+	uint32_t first_record_number;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The entries
+	 * The entries are only created when the record numbers are not contiguous
+	 */
+	libevt_record_number_index_entry_t *entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* Value to indicate the entries are sorted by record number
+	 */
+	uint8_t entries_are_sorted;
+};
+
+int libevt_record_number_index_initialize(
+     libevt_record_number_index_t **record_number_index,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_free(
+     libevt_record_number_index_t **record_number_index,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_empty(
+     libevt_record_number_index_t *record_number_index,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_append_record_number(
+     libevt_record_number_index_t *record_number_index,
+     int record_index,
+     uint32_t record_number,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_finalize(
+     libevt_record_number_index_t *record_number_index,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_get_record_index_by_record_number(
+     libevt_record_number_index_t *record_number_index,
+     uint32_t record_number,
+     int *record_index,
+     libcerror_error_t **error );
+
+int libevt_record_number_index_get_record_numbers(
+     libevt_record_number_index_t *record_number_index,
+     uint32_t *record_numbers,
+     int number_of_record_numbers,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORD_NUMBER_INDEX_H ) */
+
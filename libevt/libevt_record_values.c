@@ -37,6 +37,7 @@
 #include "libevt_record_values.h"
 #include "libevt_unused.h"
 
+#include "evt_event_record.h"
 #include "evt_file_header.h"
 #include "evt_record.h"
 
@@ -174,15 +175,14 @@ ssize_t libevt_record_values_read_file_io_handle(
 {
 	uint8_t record_size_data[ 4 ];
 
-	libevt_end_of_file_record_t *end_of_file_record = NULL;
-	uint8_t *record_data                            = NULL;
-	static char *function                           = "libevt_record_values_read_file_io_handle";
-	size_t read_size                                = 0;
-	size_t record_data_offset                       = 0;
-	ssize_t read_count                              = 0;
-	ssize_t total_read_count                        = 0;
-	off64_t safe_file_offset                        = 0;
-	uint32_t record_data_size                       = 0;
+	uint8_t *record_data      = NULL;
+	static char *function     = "libevt_record_values_read_file_io_handle";
+	size_t read_size          = 0;
+	size_t record_data_offset = 0;
+	ssize_t read_count        = 0;
+	ssize_t total_read_count  = 0;
+	off64_t safe_file_offset  = 0;
+	uint32_t record_data_size = 0;
 
 	if( record_values == NULL )
 	{
@@ -273,52 +273,839 @@ ssize_t libevt_record_values_read_file_io_handle(
 	record_data = (uint8_t *) memory_allocate(
 	                           sizeof( uint8_t ) * record_data_size );
 
-	if( record_data == NULL )
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record data.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 record_data,
+	 record_data_size );
+
+	record_data_offset = 4;
+
+	read_size = record_data_size - record_data_offset;
+
+	if( ( (size64_t) safe_file_offset > io_handle->file_size )
+	 || ( read_size > ( io_handle->file_size - safe_file_offset ) ) )
+	{
+		read_size = (size_t) ( io_handle->file_size - safe_file_offset );
+	}
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              &( record_data[ record_data_offset ] ),
+	              read_size,
+	              error );
+
+	if( read_count != (ssize_t) read_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record data.",
+		 function );
+
+		goto on_error;
+	}
+	safe_file_offset   += read_count;
+	record_data_offset += read_count;
+	total_read_count   += read_count;
+
+	if( record_data_offset < (size_t) record_data_size )
+	{
+		if( *has_wrapped != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid IO handle - record data has already wrapped.",
+			 function );
+
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record data wrapped at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 safe_file_offset,
+			 safe_file_offset );
+		}
+#endif
+		*has_wrapped = 1;
+
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     (off64_t) sizeof( evt_file_header_t ),
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek wrapped record data at offset: %" PRIzd " (0x%08" PRIzx ").",
+			 function,
+			 sizeof( evt_file_header_t ),
+			 sizeof( evt_file_header_t ) );
+
+			goto on_error;
+		}
+		safe_file_offset = (off64_t) sizeof( evt_file_header_t );
+
+		read_size = (size_t) record_data_size - record_data_offset;
+
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( record_data[ record_data_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record data.",
+			 function );
+
+			goto on_error;
+		}
+		safe_file_offset += read_count;
+		total_read_count += read_count;
+	}
+	if( libevt_record_values_read_data(
+	     record_values,
+	     record_data,
+	     (size_t) record_data_size,
+	     strict_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 record_data );
+
+	*file_offset = safe_file_offset;
+
+	return( total_read_count );
+
+on_error:
+	if( record_data != NULL )
+	{
+		memory_free(
+		 record_data );
+	}
+	*file_offset = safe_file_offset;
+
+	return( -1 );
+}
+
+/* Reads the record values data
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_record_values_read_data(
+     libevt_record_values_t *record_values,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint8_t strict_mode,
+     libcerror_error_t **error )
+{
+	libevt_end_of_file_record_t *end_of_file_record = NULL;
+	static char *function                           = "libevt_record_values_read_data";
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_data_size < 8 )
+	 || ( record_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     &( record_data[ 4 ] ),
+	     evt_file_signature,
+	     4 ) == 0 )
+	{
+		record_values->type = LIBEVT_RECORD_TYPE_EVENT;
+	}
+	else if( memory_compare(
+	          &( record_data[ 4 ] ),
+	          evt_end_of_file_record_signature1,
+	          4 ) == 0 )
+	{
+		record_values->type = LIBEVT_RECORD_TYPE_END_OF_FILE;
+	}
+	else
+	{
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record data:\n",
+			 function );
+			libcnotify_print_data(
+			 record_data,
+			 record_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record values signature.",
+		 function );
+
+		goto on_error;
+	}
+	if( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
+	{
+		if( libevt_record_values_read_event(
+		     record_values,
+		     record_data,
+		     record_data_size,
+		     strict_mode,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read event record values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	else if( record_values->type == LIBEVT_RECORD_TYPE_END_OF_FILE )
+	{
+		if( libevt_end_of_file_record_initialize(
+		     &end_of_file_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create end-of-file record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_end_of_file_record_read_data(
+		     end_of_file_record,
+		     record_data,
+		     record_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read end-of-file record.",
+			 function );
+
+			goto on_error;
+		}
+		if( libevt_end_of_file_record_free(
+		     &end_of_file_record,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free end-of-file record.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( end_of_file_record != NULL )
+	{
+		libevt_end_of_file_record_free(
+		 &end_of_file_record,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the record values header
+ * This only reads the record size, signature, number and times and skips over the remainder
+ * of the record, the record data is read when the record is accessed
+ * The end-of-file record is read in full
+ * Returns the number of bytes of the record if successful or -1 on error
+ */
+ssize_t libevt_record_values_read_header_file_io_handle(
+         libevt_record_values_t *record_values,
+         libbfio_handle_t *file_io_handle,
+         libevt_io_handle_t *io_handle,
+         off64_t *file_offset,
+         uint8_t *has_wrapped,
+         libcerror_error_t **error )
+{
+	uint8_t record_header_data[ 20 ];
+	uint8_t record_size_copy_data[ 4 ];
+
+	static char *function        = "libevt_record_values_read_header_file_io_handle";
+	size64_t remaining_size      = 0;
+	size_t read_size             = 0;
+	size_t record_header_offset  = 0;
+	ssize_t read_count           = 0;
+	off64_t safe_file_offset     = 0;
+	uint32_t copy_of_record_size = 0;
+	uint32_t record_data_size    = 0;
+	uint8_t safe_has_wrapped     = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_wrapped == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has wrapped.",
+		 function );
+
+		return( -1 );
+	}
+	record_values->offset = *file_offset;
+	safe_file_offset      = *file_offset;
+	safe_has_wrapped      = *has_wrapped;
+
+	read_count = libbfio_handle_read_buffer(
+	              file_io_handle,
+	              record_header_data,
+	              4,
+	              error );
+
+	if( read_count != (ssize_t) 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record size data.",
+		 function );
+
+		return( -1 );
+	}
+	safe_file_offset    += read_count;
+	record_header_offset = 4;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 record_header_data,
+	 record_data_size );
+
+	if( ( record_data_size < 20 )
+	 || ( record_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The signature, number and times can be stored on both sides of the wrap
+	 */
+	while( record_header_offset < 20 )
+	{
+		read_size = 20 - record_header_offset;
+
+		if( (size64_t) safe_file_offset >= io_handle->file_size )
+		{
+			if( safe_has_wrapped != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid IO handle - record data has already wrapped.",
+				 function );
+
+				return( -1 );
+			}
+			safe_has_wrapped = 1;
+
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     (off64_t) sizeof( evt_file_header_t ),
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek wrapped record data at offset: %" PRIzd " (0x%08" PRIzx ").",
+				 function,
+				 sizeof( evt_file_header_t ),
+				 sizeof( evt_file_header_t ) );
+
+				return( -1 );
+			}
+			safe_file_offset = (off64_t) sizeof( evt_file_header_t );
+		}
+		if( read_size > (size_t) ( io_handle->file_size - safe_file_offset ) )
+		{
+			read_size = (size_t) ( io_handle->file_size - safe_file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( record_header_data[ record_header_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record header data.",
+			 function );
+
+			return( -1 );
+		}
+		safe_file_offset     += read_count;
+		record_header_offset += read_count;
+	}
+	if( memory_compare(
+	     &( record_header_data[ 4 ] ),
+	     evt_file_signature,
+	     4 ) == 0 )
+	{
+		record_values->type = LIBEVT_RECORD_TYPE_EVENT;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_header_data[ 8 ] ),
+		 record_values->number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( record_header_data[ 16 ] ),
+		 record_values->written_time );
+	}
+	else if( memory_compare(
+	          &( record_header_data[ 4 ] ),
+	          evt_end_of_file_record_signature1,
+	          4 ) == 0 )
+	{
+		record_values->type = LIBEVT_RECORD_TYPE_END_OF_FILE;
+	}
+	else
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported record values signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values->type == LIBEVT_RECORD_TYPE_END_OF_FILE )
+	{
+		/* The end-of-file record is small and only stored once so read it in full
+		 */
+		if( libbfio_handle_seek_offset(
+		     file_io_handle,
+		     record_values->offset,
+		     SEEK_SET,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_SEEK_FAILED,
+			 "%s: unable to seek end-of-file record offset: %" PRIi64 ".",
+			 function,
+			 record_values->offset );
+
+			return( -1 );
+		}
+		read_count = libevt_record_values_read_file_io_handle(
+		              record_values,
+		              file_io_handle,
+		              io_handle,
+		              file_offset,
+		              has_wrapped,
+		              1,
+		              error );
+
+		if( read_count == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read end-of-file record.",
+			 function );
+
+			return( -1 );
+		}
+		return( read_count );
+	}
+	/* The event record must contain the fixed-size part and the copy of the size
+	 * otherwise it is corrupted and reading the record data would fail
+	 */
+	if( (size_t) record_data_size < ( sizeof( evt_event_record_t ) + 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	/* Skip the remainder of the event record up to the copy of the size
+	 */
+	remaining_size = (size64_t) record_data_size - 24;
+
+	if( ( (size64_t) safe_file_offset <= io_handle->file_size )
+	 && ( remaining_size > ( io_handle->file_size - safe_file_offset ) ) )
+	{
+		if( safe_has_wrapped != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid IO handle - record data has already wrapped.",
+			 function );
+
+			return( -1 );
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: record data wrapped at offset: %" PRIu64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 io_handle->file_size,
+			 io_handle->file_size );
+		}
+#endif
+		safe_has_wrapped = 1;
+
+		remaining_size  -= io_handle->file_size - safe_file_offset;
+		safe_file_offset = (off64_t) sizeof( evt_file_header_t );
+	}
+	safe_file_offset += (off64_t) remaining_size;
+
+	if( (size64_t) safe_file_offset > io_handle->file_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data size value exceeds file size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_seek_offset(
+	     file_io_handle,
+	     safe_file_offset,
+	     SEEK_SET,
+	     error ) == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek copy of record size offset: %" PRIi64 ".",
+		 function,
+		 safe_file_offset );
+
+		return( -1 );
+	}
+	/* The copy of the size can be stored on both sides of the wrap
+	 */
+	record_header_offset = 0;
+
+	while( record_header_offset < 4 )
+	{
+		read_size = 4 - record_header_offset;
+
+		if( (size64_t) safe_file_offset >= io_handle->file_size )
+		{
+			if( safe_has_wrapped != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid IO handle - record data has already wrapped.",
+				 function );
+
+				return( -1 );
+			}
+			safe_has_wrapped = 1;
+
+			if( libbfio_handle_seek_offset(
+			     file_io_handle,
+			     (off64_t) sizeof( evt_file_header_t ),
+			     SEEK_SET,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_SEEK_FAILED,
+				 "%s: unable to seek wrapped record data at offset: %" PRIzd " (0x%08" PRIzx ").",
+				 function,
+				 sizeof( evt_file_header_t ),
+				 sizeof( evt_file_header_t ) );
+
+				return( -1 );
+			}
+			safe_file_offset = (off64_t) sizeof( evt_file_header_t );
+		}
+		if( read_size > (size_t) ( io_handle->file_size - safe_file_offset ) )
+		{
+			read_size = (size_t) ( io_handle->file_size - safe_file_offset );
+		}
+		read_count = libbfio_handle_read_buffer(
+		              file_io_handle,
+		              &( record_size_copy_data[ record_header_offset ] ),
+		              read_size,
+		              error );
+
+		if( read_count != (ssize_t) read_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read copy of record size data.",
+			 function );
+
+			return( -1 );
+		}
+		safe_file_offset     += read_count;
+		record_header_offset += read_count;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 record_size_copy_data,
+	 copy_of_record_size );
+
+	/* A record of which the copy of the size does not match is corrupted
+	 */
+	if( record_data_size != copy_of_record_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_INPUT,
+		 LIBCERROR_INPUT_ERROR_VALUE_MISMATCH,
+		 "%s: value mismatch for record size and copy of record size.",
+		 function );
+
+		return( -1 );
+	}
+	*file_offset = safe_file_offset;
+	*has_wrapped = safe_has_wrapped;
+
+	return( (ssize_t) record_data_size );
+}
+
+/* Reads the record values from memory mapped file data
+ * The record data is read directly from the mapped data unless the record
+ * wraps at the end of the file in which case the record data is copied
+ * Returns the number of bytes read if successful or -1 on error
+ */
+ssize_t libevt_record_values_read_mapped_data(
+         libevt_record_values_t *record_values,
+         libevt_io_handle_t *io_handle,
+         off64_t *file_offset,
+         uint8_t *has_wrapped,
+         uint8_t strict_mode,
+         libcerror_error_t **error )
+{
+	const uint8_t *record_data = NULL;
+	uint8_t *wrapped_data      = NULL;
+	static char *function      = "libevt_record_values_read_mapped_data";
+	size_t first_part_size     = 0;
+	off64_t safe_file_offset   = 0;
+	uint32_t record_data_size  = 0;
+
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle->mapped_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid IO handle - missing mapped data.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( has_wrapped == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid has wrapped.",
+		 function );
+
+		return( -1 );
+	}
+	safe_file_offset = *file_offset;
+
+	if( ( safe_file_offset < 0 )
+	 || ( io_handle->file_size < 4 )
+	 || ( (size64_t) safe_file_offset > ( io_handle->file_size - 4 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create record data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file offset value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	byte_stream_copy_from_uint32_little_endian(
-	 record_data,
-	 record_data_size );
-
-	record_data_offset = 4;
-
-	read_size = record_data_size - record_data_offset;
+	record_values->offset = safe_file_offset;
 
-	if( ( (size64_t) safe_file_offset > io_handle->file_size )
-	 || ( read_size > ( io_handle->file_size - safe_file_offset ) ) )
-	{
-		read_size = (size_t) ( io_handle->file_size - safe_file_offset );
-	}
-	read_count = libbfio_handle_read_buffer(
-	              file_io_handle,
-	              &( record_data[ record_data_offset ] ),
-	              read_size,
-	              error );
+	byte_stream_copy_to_uint32_little_endian(
+	 &( io_handle->mapped_data[ safe_file_offset ] ),
+	 record_data_size );
 
-	if( read_count != (ssize_t) read_size )
+	if( ( record_data_size < 8 )
+	 || ( record_data_size > (uint32_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: record data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	safe_file_offset   += read_count;
-	record_data_offset += read_count;
-	total_read_count   += read_count;
-
-	if( record_data_offset < (size_t) record_data_size )
+	if( (size64_t) record_data_size <= ( io_handle->file_size - safe_file_offset ) )
+	{
+		record_data       = &( io_handle->mapped_data[ safe_file_offset ] );
+		safe_file_offset += record_data_size;
+	}
+	else
 	{
 		if( *has_wrapped != 0 )
 		{
@@ -329,182 +1116,111 @@ ssize_t libevt_record_values_read_file_io_handle(
 			 "%s: invalid IO handle - record data has already wrapped.",
 			 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: record data wrapped at offset: %" PRIi64 " (0x%08" PRIx64 ").\n",
-			 function,
-			 safe_file_offset,
-			 safe_file_offset );
-		}
-#endif
-		*has_wrapped = 1;
-
-		if( libbfio_handle_seek_offset(
-		     file_io_handle,
-		     (off64_t) sizeof( evt_file_header_t ),
-		     SEEK_SET,
-		     error ) == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_SEEK_FAILED,
-			 "%s: unable to seek wrapped record data at offset: %" PRIzd " (0x%08" PRIzx ").",
-			 function,
-			 sizeof( evt_file_header_t ),
-			 sizeof( evt_file_header_t ) );
-
-			goto on_error;
+			return( -1 );
 		}
-		safe_file_offset = (off64_t) sizeof( evt_file_header_t );
-
-		read_size = (size_t) record_data_size - record_data_offset;
+		first_part_size = (size_t) ( io_handle->file_size - safe_file_offset );
 
-		read_count = libbfio_handle_read_buffer(
-		              file_io_handle,
-		              &( record_data[ record_data_offset ] ),
-		              read_size,
-		              error );
-
-		if( read_count != (ssize_t) read_size )
+		if( ( (size64_t) record_data_size - first_part_size ) > ( io_handle->file_size - sizeof( evt_file_header_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read record data.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: record data size value exceeds file size.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		safe_file_offset += read_count;
-		total_read_count += read_count;
-	}
-	if( memory_compare(
-	     &( record_data[ 4 ] ),
-	     evt_file_signature,
-	     4 ) == 0 )
-	{
-		record_values->type = LIBEVT_RECORD_TYPE_EVENT;
-	}
-	else if( memory_compare(
-	          &( record_data[ 4 ] ),
-	          evt_end_of_file_record_signature1,
-	          4 ) == 0 )
-	{
-		record_values->type = LIBEVT_RECORD_TYPE_END_OF_FILE;
-	}
-	else
-	{
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: record data:\n",
-			 function );
-			libcnotify_print_data(
-			 record_data,
-			 (size_t) record_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			 "%s: record data wrapped at offset: %" PRIu64 " (0x%08" PRIx64 ").\n",
+			 function,
+			 io_handle->file_size,
+			 io_handle->file_size );
 		}
 #endif
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported record values signature.",
-		 function );
+		/* Only a record that straddles the wrap point requires a copy
+		 */
+		wrapped_data = (uint8_t *) memory_allocate(
+		                            sizeof( uint8_t ) * record_data_size );
 
-		goto on_error;
-	}
-	if( record_values->type == LIBEVT_RECORD_TYPE_EVENT )
-	{
-		if( libevt_record_values_read_event(
-		     record_values,
-		     record_data,
-		     (size_t) record_data_size,
-		     strict_mode,
-		     error ) != 1 )
+		if( wrapped_data == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read event record values.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create record data.",
 			 function );
 
 			goto on_error;
 		}
-	}
-	else if( record_values->type == LIBEVT_RECORD_TYPE_END_OF_FILE )
-	{
-		if( libevt_end_of_file_record_initialize(
-		     &end_of_file_record,
-		     error ) != 1 )
+		if( memory_copy(
+		     wrapped_data,
+		     &( io_handle->mapped_data[ safe_file_offset ] ),
+		     first_part_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create end-of-file record.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy record data.",
 			 function );
 
 			goto on_error;
 		}
-		if( libevt_end_of_file_record_read_data(
-		     end_of_file_record,
-		     record_data,
-		     (size_t) record_data_size,
-		     error ) != 1 )
+		if( memory_copy(
+		     &( wrapped_data[ first_part_size ] ),
+		     &( io_handle->mapped_data[ sizeof( evt_file_header_t ) ] ),
+		     (size_t) record_data_size - first_part_size ) == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read end-of-file record.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy wrapped record data.",
 			 function );
 
 			goto on_error;
 		}
-		if( libevt_end_of_file_record_free(
-		     &end_of_file_record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free end-of-file record.",
-			 function );
+		*has_wrapped = 1;
 
-			goto on_error;
-		}
+		record_data      = wrapped_data;
+		safe_file_offset = (off64_t) ( sizeof( evt_file_header_t ) + record_data_size - first_part_size );
 	}
-	memory_free(
-	 record_data );
+	if( libevt_record_values_read_data(
+	     record_values,
+	     record_data,
+	     (size_t) record_data_size,
+	     strict_mode,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read record values.",
+		 function );
 
+		goto on_error;
+	}
+	if( wrapped_data != NULL )
+	{
+		memory_free(
+		 wrapped_data );
+	}
 	*file_offset = safe_file_offset;
 
-	return( total_read_count );
+	return( (ssize_t) record_data_size );
 
 on_error:
-	if( end_of_file_record != NULL )
-	{
-		libevt_end_of_file_record_free(
-		 &end_of_file_record,
-		 NULL );
-	}
-	if( record_data != NULL )
+	if( wrapped_data != NULL )
 	{
 		memory_free(
-		 record_data );
+		 wrapped_data );
 	}
-	*file_offset = safe_file_offset;
-
 	return( -1 );
 }
 
@@ -513,7 +1229,7 @@ on_error:
  */
 int libevt_record_values_read_event(
      libevt_record_values_t *record_values,
-     uint8_t *record_data,
+     const uint8_t *record_data,
      size_t record_data_size,
      uint8_t strict_mode,
      libcerror_error_t **error )
@@ -1683,124 +2399,3 @@ int libevt_record_values_get_data(
 	return( 1 );
 }
 
-/* Reads record values
- * Callback for the (recovered) records list
- * Returns 1 if successful or -1 on error
- */
-int libevt_record_values_read_element_data(
-     libevt_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *element,
-     libfdata_cache_t *cache,
-     int element_file_index LIBEVT_ATTRIBUTE_UNUSED,
-     off64_t element_offset,
-     size64_t element_size LIBEVT_ATTRIBUTE_UNUSED,
-     uint32_t element_flags LIBEVT_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBEVT_ATTRIBUTE_UNUSED,
-     libcerror_error_t **error )
-{
-	libevt_record_values_t *record_values = NULL;
-	static char *function                 = "libevt_record_values_read_element_data";
-	off64_t file_offset                   = 0;
-	ssize_t read_count                    = 0;
-	uint8_t has_wrapped                   = 0;
-
-	LIBEVT_UNREFERENCED_PARAMETER( element_size )
-	LIBEVT_UNREFERENCED_PARAMETER( element_file_index )
-	LIBEVT_UNREFERENCED_PARAMETER( element_flags )
-	LIBEVT_UNREFERENCED_PARAMETER( read_flags )
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: reading record  at offset: %" PRIi64 " (0x%08" PRIx64 ")\n",
-		 function,
-		 element_offset,
-		 element_offset );
-	}
-#endif
-	if( libbfio_handle_seek_offset(
-	     file_io_handle,
-	     element_offset,
-	     SEEK_SET,
-	     error ) == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_SEEK_FAILED,
-		 "%s: unable to seek record offset: %" PRIi64 ".",
-		 function,
-		 element_offset );
-
-		goto on_error;
-	}
-	if( libevt_record_values_initialize(
-	     &record_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record values.",
-		 function );
-
-		goto on_error;
-	}
-	/* File offset must be before being passed to libevt_record_values_read
-	 */
-	file_offset = element_offset;
-
-	read_count = libevt_record_values_read_file_io_handle(
-		      record_values,
-		      file_io_handle,
-		      io_handle,
-		      &file_offset,
-		      &has_wrapped,
-		      0,
-		      error );
-
-	if( read_count == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read record at offset: %" PRIi64 ".",
-		 function,
-		 element_offset );
-
-		goto on_error;
-	}
-	if( libfdata_list_element_set_element_value(
-	     element,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     (intptr_t *) record_values,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libevt_record_values_free,
-	     LIBFDATA_LIST_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set record values as element value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( record_values != NULL )
-	{
-		libevt_record_values_free(
-		 &record_values,
-		 NULL );
-	}
-	return( -1 );
-}
-
@@ -29,8 +29,6 @@
 #include "libevt_io_handle.h"
 #include "libevt_libbfio.h"
 #include "libevt_libcerror.h"
-#include "libevt_libfcache.h"
-#include "libevt_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,9 +56,18 @@ struct libevt_record_values
 	 */
 	uint32_t number;
 
+	/* The (record) last written time
+	 */
+	uint32_t written_time;
+
 	/* The event record
 	 */
 	libevt_event_record_t *event_record;
+
+	/* The number of records that reference the record values
+	 * this value is maintained by the records cache
+	 */
+	int reference_count;
 };
 
 int libevt_record_values_initialize(
@@ -80,9 +87,32 @@ ssize_t libevt_record_values_read_file_io_handle(
          uint8_t strict_mode,
          libcerror_error_t **error );
 
+int libevt_record_values_read_data(
+     libevt_record_values_t *record_values,
+     const uint8_t *record_data,
+     size_t record_data_size,
+     uint8_t strict_mode,
+     libcerror_error_t **error );
+
+ssize_t libevt_record_values_read_header_file_io_handle(
+         libevt_record_values_t *record_values,
+         libbfio_handle_t *file_io_handle,
+         libevt_io_handle_t *io_handle,
+         off64_t *file_offset,
+         uint8_t *has_wrapped,
+         libcerror_error_t **error );
+
+ssize_t libevt_record_values_read_mapped_data(
+         libevt_record_values_t *record_values,
+         libevt_io_handle_t *io_handle,
+         off64_t *file_offset,
+         uint8_t *has_wrapped,
+         uint8_t strict_mode,
+         libcerror_error_t **error );
+
 int libevt_record_values_read_event(
      libevt_record_values_t *record_values,
-     uint8_t *record_values_data,
+     const uint8_t *record_values_data,
      size_t record_values_data_size,
      uint8_t strict_mode,
      libcerror_error_t **error );
@@ -235,18 +265,6 @@ int libevt_record_values_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
-int libevt_record_values_read_element_data(
-     libevt_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_list_element_t *element,
-     libfdata_cache_t *cache,
-     int element_file_index,
-     off64_t element_offset,
-     size64_t element_size,
-     uint32_t element_flags,
-     uint8_t read_flags,
-     libcerror_error_t **error );
-
 #if defined( __cplusplus )
 }
 #endif
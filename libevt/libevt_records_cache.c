@@ -0,0 +1,1574 @@
+/*
+ * Records cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_definitions.h"
+#include "libevt_event_record.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_record_values.h"
+#include "libevt_records_cache.h"
+
+/* Creates a records cache
+ * Make sure the value records_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_initialize(
+     libevt_records_cache_t **records_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_initialize";
+	size_t entries_size                 = 0;
+	int number_of_entries_per_shard     = 0;
+	int number_of_shards                = 0;
+	int shard_index                     = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid records cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_shards = LIBEVT_RECORDS_CACHE_NUMBER_OF_SHARDS;
+
+	if( number_of_shards > maximum_number_of_entries )
+	{
+		number_of_shards = maximum_number_of_entries;
+	}
+	number_of_entries_per_shard = maximum_number_of_entries / number_of_shards;
+
+	if( ( maximum_number_of_entries % number_of_shards ) != 0 )
+	{
+		number_of_entries_per_shard += 1;
+	}
+	entries_size = sizeof( libevt_records_cache_entry_t ) * number_of_entries_per_shard;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*records_cache = memory_allocate_structure(
+	                  libevt_records_cache_t );
+
+	if( *records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create records cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *records_cache,
+	     0,
+	     sizeof( libevt_records_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records cache.",
+		 function );
+
+		memory_free(
+		 *records_cache );
+
+		*records_cache = NULL;
+
+		return( -1 );
+	}
+	( *records_cache )->shards = (libevt_records_cache_shard_t *) memory_allocate(
+	                                                               sizeof( libevt_records_cache_shard_t ) * number_of_shards );
+
+	if( ( *records_cache )->shards == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create shards.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *records_cache )->shards,
+	     0,
+	     sizeof( libevt_records_cache_shard_t ) * number_of_shards ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear shards.",
+		 function );
+
+		memory_free(
+		 ( *records_cache )->shards );
+
+		( *records_cache )->shards = NULL;
+
+		goto on_error;
+	}
+	( *records_cache )->number_of_shards            = number_of_shards;
+	( *records_cache )->maximum_number_of_entries   = maximum_number_of_entries;
+	( *records_cache )->number_of_entries_per_shard = number_of_entries_per_shard;
+	( *records_cache )->maximum_size                = maximum_size;
+	( *records_cache )->maximum_size_per_shard      = maximum_size / number_of_shards;
+
+	if( ( maximum_size % number_of_shards ) != 0 )
+	{
+		( *records_cache )->maximum_size_per_shard += 1;
+	}
+
+	for( shard_index = 0;
+	     shard_index < number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( ( *records_cache )->shards[ shard_index ] );
+
+		shard->entries = (libevt_records_cache_entry_t *) memory_allocate(
+		                                                   entries_size );
+
+		if( shard->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     shard->entries,
+		     0,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		shard->number_of_entries = number_of_entries_per_shard;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( shard->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to initialize mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	return( 1 );
+
+on_error:
+	if( *records_cache != NULL )
+	{
+		libevt_records_cache_free(
+		 records_cache,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a records cache
+ * The record values are freed regardless if they are still referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_free(
+     libevt_records_cache_t **records_cache,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_free";
+	int entry_index                     = 0;
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *records_cache != NULL )
+	{
+		if( ( *records_cache )->shards != NULL )
+		{
+			for( shard_index = 0;
+			     shard_index < ( *records_cache )->number_of_shards;
+			     shard_index++ )
+			{
+				shard = &( ( *records_cache )->shards[ shard_index ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+				if( shard->mutex != NULL )
+				{
+					if( libcthreads_mutex_free(
+					     &( shard->mutex ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free mutex of shard: %d.",
+						 function,
+						 shard_index );
+
+						result = -1;
+					}
+				}
+#endif
+				if( shard->entries == NULL )
+				{
+					continue;
+				}
+				for( entry_index = 0;
+				     entry_index < shard->number_of_entries;
+				     entry_index++ )
+				{
+					if( shard->entries[ entry_index ].record_values == NULL )
+					{
+						continue;
+					}
+					if( libevt_record_values_free(
+					     &( shard->entries[ entry_index ].record_values ),
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+						 "%s: unable to free record values of shard: %d entry: %d.",
+						 function,
+						 shard_index,
+						 entry_index );
+
+						result = -1;
+					}
+				}
+				memory_free(
+				 shard->entries );
+			}
+			memory_free(
+			 ( *records_cache )->shards );
+		}
+		memory_free(
+		 *records_cache );
+
+		*records_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a records cache
+ * Record values that are still referenced are removed from the cache
+ * but freed when their last reference is released
+ * The cache statistics are reset
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_empty(
+     libevt_records_cache_t *records_cache,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *entry = NULL;
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_empty";
+	int entry_index                     = 0;
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < records_cache->number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( records_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		for( entry_index = 0;
+		     entry_index < shard->number_of_entries;
+		     entry_index++ )
+		{
+			entry = &( shard->entries[ entry_index ] );
+
+			if( ( entry->record_values != NULL )
+			 && ( entry->record_values->reference_count == 0 ) )
+			{
+				if( libevt_record_values_free(
+				     &( entry->record_values ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values of shard: %d entry: %d.",
+					 function,
+					 shard_index,
+					 entry_index );
+
+					result = -1;
+				}
+			}
+			entry->offset        = 0;
+			entry->record_values = NULL;
+			entry->size          = 0;
+			entry->timestamp     = 0;
+		}
+		shard->size              = 0;
+		shard->current_timestamp = 0;
+		shard->number_of_hits    = 0;
+		shard->number_of_misses  = 0;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( result );
+}
+
+/* Resizes a records cache
+ * The maximum number of entries is rounded up to a multiple of the number of shards
+ * A maximum size of 0 represents no maximum size
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_resize(
+     libevt_records_cache_t *records_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_resize";
+	size64_t maximum_size_per_shard     = 0;
+	int number_of_entries_per_shard     = 0;
+	int result                          = 1;
+	int shard_index                     = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_entries <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_ZERO_OR_LESS,
+		 "%s: invalid maximum number of entries value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries_per_shard = maximum_number_of_entries / records_cache->number_of_shards;
+
+	if( ( maximum_number_of_entries % records_cache->number_of_shards ) != 0 )
+	{
+		number_of_entries_per_shard += 1;
+	}
+	maximum_size_per_shard = maximum_size / records_cache->number_of_shards;
+
+	if( ( maximum_size % records_cache->number_of_shards ) != 0 )
+	{
+		maximum_size_per_shard += 1;
+	}
+	for( shard_index = 0;
+	     shard_index < records_cache->number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( records_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		/* Pinned record values are not removed from the cache
+		 */
+		if( ( records_cache->pin_all == 0 )
+		 || ( number_of_entries_per_shard > shard->number_of_entries ) )
+		{
+			if( libevt_records_cache_shard_resize(
+			     shard,
+			     number_of_entries_per_shard,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to resize shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+		if( ( result == 1 )
+		 && ( records_cache->pin_all == 0 ) )
+		{
+			if( libevt_records_cache_shard_reduce_size(
+			     shard,
+			     maximum_size_per_shard,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reduce size of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		if( result != 1 )
+		{
+			return( -1 );
+		}
+	}
+	records_cache->maximum_number_of_entries   = maximum_number_of_entries;
+	records_cache->number_of_entries_per_shard = number_of_entries_per_shard;
+	records_cache->maximum_size                = maximum_size;
+	records_cache->maximum_size_per_shard      = maximum_size_per_shard;
+
+	return( 1 );
+}
+
+/* Sets the value to indicate all record values should be kept in the cache
+ * When pinning is disabled the cache is reduced to its maximum number of entries and size
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_set_pin_all(
+     libevt_records_cache_t *records_cache,
+     uint8_t pin_all,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_cache_set_pin_all";
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( pin_all != 0 )
+	{
+		records_cache->pin_all = 1;
+	}
+	else if( records_cache->pin_all != 0 )
+	{
+		records_cache->pin_all = 0;
+
+		if( libevt_records_cache_resize(
+		     records_cache,
+		     records_cache->maximum_number_of_entries,
+		     records_cache->maximum_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize records cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the records cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_get_statistics(
+     libevt_records_cache_t *records_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_get_statistics";
+	uint64_t safe_number_of_hits        = 0;
+	uint64_t safe_number_of_misses      = 0;
+	int shard_index                     = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < records_cache->number_of_shards;
+	     shard_index++ )
+	{
+		shard = &( records_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		safe_number_of_hits   += shard->number_of_hits;
+		safe_number_of_misses += shard->number_of_misses;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	*number_of_hits   = safe_number_of_hits;
+	*number_of_misses = safe_number_of_misses;
+
+	return( 1 );
+}
+
+/* Retrieves the record values of a specific offset
+ * On success a reference to the record values is held, that must be released
+ * with libevt_records_cache_release_record_values
+ * Returns 1 if successful, 0 if not cached or -1 on error
+ */
+int libevt_records_cache_get_record_values_by_offset(
+     libevt_records_cache_t *records_cache,
+     off64_t offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *entry = NULL;
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_get_record_values_by_offset";
+	int entry_index                     = 0;
+	int result                          = 0;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	/* Records are 32-bit aligned hence the lower bits of the offset are ignored
+	 */
+	shard = &( records_cache->shards[ ( (uint64_t) offset >> 2 ) % records_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < shard->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( shard->entries[ entry_index ] );
+
+		if( ( entry->record_values != NULL )
+		 && ( entry->offset == offset ) )
+		{
+			shard->current_timestamp += 1;
+
+			entry->timestamp                       = shard->current_timestamp;
+			entry->record_values->reference_count += 1;
+
+			*record_values = entry->record_values;
+
+			result = 1;
+
+			break;
+		}
+	}
+	if( result != 0 )
+	{
+		shard->number_of_hits += 1;
+	}
+	else
+	{
+		shard->number_of_misses += 1;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the record values of a specific offset
+ * The cache takes over the management of the record values. If another thread
+ * cached record values of the same offset first, the record values are freed
+ * and replaced by the cached record values.
+ * On success a reference to the record values is held, that must be released
+ * with libevt_records_cache_release_record_values
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_set_record_values_by_offset(
+     libevt_records_cache_t *records_cache,
+     off64_t offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *cached_entry = NULL;
+	libevt_records_cache_entry_t *entry        = NULL;
+	libevt_records_cache_entry_t *unused_entry = NULL;
+	libevt_records_cache_shard_t *shard        = NULL;
+	static char *function                      = "libevt_records_cache_set_record_values_by_offset";
+	int entry_index                            = 0;
+	int result                                 = 1;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_values == NULL )
+	 || ( *record_values == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	shard = &( records_cache->shards[ ( (uint64_t) offset >> 2 ) % records_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Prefer an empty entry, then the least recently used entry that is not
+	 * referenced and otherwise the least recently used entry
+	 */
+	for( entry_index = 0;
+	     entry_index < shard->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( shard->entries[ entry_index ] );
+
+		if( entry->record_values == NULL )
+		{
+			if( unused_entry == NULL )
+			{
+				unused_entry = entry;
+			}
+			continue;
+		}
+		if( entry->offset == offset )
+		{
+			cached_entry = entry;
+
+			break;
+		}
+	}
+	if( cached_entry != NULL )
+	{
+		entry = cached_entry;
+
+		if( libevt_record_values_free(
+		     record_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			result = -1;
+		}
+	}
+	else
+	{
+		entry = unused_entry;
+
+		if( entry == NULL )
+		{
+			if( records_cache->pin_all != 0 )
+			{
+				/* All entries are in use hence the new entry is the first
+				 * entry after the current entries
+				 */
+				entry_index = shard->number_of_entries;
+
+				if( libevt_records_cache_shard_resize(
+				     shard,
+				     shard->number_of_entries * 2,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to resize shard.",
+					 function );
+
+					result = -1;
+				}
+				else
+				{
+					entry = &( shard->entries[ entry_index ] );
+				}
+			}
+			else
+			{
+				if( libevt_records_cache_shard_get_least_recently_used_entry(
+				     shard,
+				     NULL,
+				     0,
+				     &entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve least recently used entry.",
+					 function );
+
+					result = -1;
+				}
+				else if( libevt_records_cache_shard_remove_entry(
+				          shard,
+				          entry,
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+					 "%s: unable to remove least recently used entry.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+		if( result == 1 )
+		{
+			entry->offset        = offset;
+			entry->record_values = *record_values;
+			entry->size          = sizeof( libevt_record_values_t );
+
+			if( entry->record_values->event_record != NULL )
+			{
+				entry->size += sizeof( libevt_event_record_t )
+				             + entry->record_values->event_record->record_data_size;
+			}
+			shard->size += entry->size;
+
+			if( records_cache->pin_all == 0 )
+			{
+				if( libevt_records_cache_shard_reduce_size(
+				     shard,
+				     records_cache->maximum_size_per_shard,
+				     entry,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to reduce size of shard.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+	}
+	if( result == 1 )
+	{
+		shard->current_timestamp += 1;
+
+		entry->timestamp                       = shard->current_timestamp;
+		entry->record_values->reference_count += 1;
+
+		*record_values = entry->record_values;
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Releases a reference to record values
+ * The record values are freed when they are no longer cached or referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_release_record_values(
+     libevt_records_cache_t *records_cache,
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_shard_t *shard = NULL;
+	static char *function               = "libevt_records_cache_release_record_values";
+	int entry_index                     = 0;
+	int result                          = 1;
+
+	if( records_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offset of the record values is the offset they were cached by
+	 */
+	shard = &( records_cache->shards[ ( (uint64_t) record_values->offset >> 2 ) % records_cache->number_of_shards ] );
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( record_values->reference_count <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record values - reference count value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		record_values->reference_count -= 1;
+
+		if( record_values->reference_count == 0 )
+		{
+			for( entry_index = 0;
+			     entry_index < shard->number_of_entries;
+			     entry_index++ )
+			{
+				if( shard->entries[ entry_index ].record_values == record_values )
+				{
+					break;
+				}
+			}
+			if( entry_index >= shard->number_of_entries )
+			{
+				if( libevt_record_values_free(
+				     &record_values,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free record values.",
+					 function );
+
+					result = -1;
+				}
+			}
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves the least recently used entry of a shard
+ * Entries that are not referenced are preferred over entries that are referenced
+ * The shard mutex must be held by the caller
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libevt_records_cache_shard_get_least_recently_used_entry(
+     libevt_records_cache_shard_t *shard,
+     libevt_records_cache_entry_t *ignore_entry,
+     uint8_t unreferenced_only,
+     libevt_records_cache_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *oldest_entry = NULL;
+	libevt_records_cache_entry_t *safe_entry   = NULL;
+	static char *function                      = "libevt_records_cache_shard_get_least_recently_used_entry";
+	int entry_index                            = 0;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < shard->number_of_entries;
+	     entry_index++ )
+	{
+		safe_entry = &( shard->entries[ entry_index ] );
+
+		if( ( safe_entry->record_values == NULL )
+		 || ( safe_entry == ignore_entry ) )
+		{
+			continue;
+		}
+		if( ( unreferenced_only != 0 )
+		 && ( safe_entry->record_values->reference_count != 0 ) )
+		{
+			continue;
+		}
+		if( ( oldest_entry == NULL )
+		 || ( ( oldest_entry->record_values->reference_count != 0 )
+		  &&  ( safe_entry->record_values->reference_count == 0 ) )
+		 || ( ( ( oldest_entry->record_values->reference_count == 0 )
+		     == ( safe_entry->record_values->reference_count == 0 ) )
+		  &&  ( safe_entry->timestamp < oldest_entry->timestamp ) ) )
+		{
+			oldest_entry = safe_entry;
+		}
+	}
+	*entry = oldest_entry;
+
+	if( oldest_entry == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Removes an entry from a shard
+ * Record values that are still referenced are freed when their last reference is released
+ * The shard mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_shard_remove_entry(
+     libevt_records_cache_shard_t *shard,
+     libevt_records_cache_entry_t *entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_records_cache_shard_remove_entry";
+	int result            = 1;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry->record_values != NULL )
+	 && ( entry->record_values->reference_count == 0 ) )
+	{
+		if( libevt_record_values_free(
+		     &( entry->record_values ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record values.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( shard->size >= (size64_t) entry->size )
+	{
+		shard->size -= entry->size;
+	}
+	else
+	{
+		shard->size = 0;
+	}
+	entry->offset        = 0;
+	entry->record_values = NULL;
+	entry->size          = 0;
+	entry->timestamp     = 0;
+
+	return( result );
+}
+
+/* Resizes the entries of a shard
+ * The least recently used entries are removed if the shard contains more entries
+ * The shard mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_shard_resize(
+     libevt_records_cache_shard_t *shard,
+     int number_of_entries,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *entry        = NULL;
+	libevt_records_cache_entry_t *reallocation = NULL;
+	static char *function                      = "libevt_records_cache_shard_resize";
+	size_t entries_size                        = 0;
+	int entry_index                            = 0;
+	int number_of_used_entries                 = 0;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_entries <= 0 )
+	 || ( (size_t) number_of_entries > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libevt_records_cache_entry_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < shard->number_of_entries;
+	     entry_index++ )
+	{
+		if( shard->entries[ entry_index ].record_values != NULL )
+		{
+			number_of_used_entries++;
+		}
+	}
+	while( number_of_used_entries > number_of_entries )
+	{
+		if( libevt_records_cache_shard_get_least_recently_used_entry(
+		     shard,
+		     NULL,
+		     0,
+		     &entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		if( libevt_records_cache_shard_remove_entry(
+		     shard,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		number_of_used_entries--;
+	}
+	/* Move the used entries to the start of the entries
+	 */
+	number_of_used_entries = 0;
+
+	for( entry_index = 0;
+	     entry_index < shard->number_of_entries;
+	     entry_index++ )
+	{
+		if( shard->entries[ entry_index ].record_values == NULL )
+		{
+			continue;
+		}
+		if( entry_index != number_of_used_entries )
+		{
+			shard->entries[ number_of_used_entries ] = shard->entries[ entry_index ];
+		}
+		number_of_used_entries++;
+	}
+	if( number_of_entries != shard->number_of_entries )
+	{
+		entries_size = sizeof( libevt_records_cache_entry_t ) * number_of_entries;
+
+		reallocation = (libevt_records_cache_entry_t *) memory_reallocate(
+		                                                 shard->entries,
+		                                                 entries_size );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		shard->entries           = reallocation;
+		shard->number_of_entries = number_of_entries;
+	}
+	if( number_of_used_entries < number_of_entries )
+	{
+		if( memory_set(
+		     &( shard->entries[ number_of_used_entries ] ),
+		     0,
+		     sizeof( libevt_records_cache_entry_t ) * ( number_of_entries - number_of_used_entries ) ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Reduces the size of a shard to a maximum size
+ * The least recently used entries that are not referenced are removed until
+ * the size of the shard no longer exceeds the maximum size
+ * A maximum size of 0 represents no maximum size
+ * The shard mutex must be held by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_records_cache_shard_reduce_size(
+     libevt_records_cache_shard_t *shard,
+     size64_t maximum_size,
+     libevt_records_cache_entry_t *ignore_entry,
+     libcerror_error_t **error )
+{
+	libevt_records_cache_entry_t *entry = NULL;
+	static char *function               = "libevt_records_cache_shard_reduce_size";
+	int result                          = 0;
+
+	if( shard == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid shard.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_size == 0 )
+	{
+		return( 1 );
+	}
+	while( shard->size > maximum_size )
+	{
+		result = libevt_records_cache_shard_get_least_recently_used_entry(
+		          shard,
+		          ignore_entry,
+		          1,
+		          &entry,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			break;
+		}
+		if( libevt_records_cache_shard_remove_entry(
+		     shard,
+		     entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+			 "%s: unable to remove least recently used entry.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,204 @@
+/*
+ * Records cache functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_RECORDS_CACHE_H )
+#define _LIBEVT_RECORDS_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_record_values.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_records_cache_entry libevt_records_cache_entry_t;
+
+struct libevt_records_cache_entry
+{
+	/* The record offset
+	 */
+	off64_t offset;
+
+	/* The record values
+	 */
+	libevt_record_values_t *record_values;
+
+	/* The (estimated) memory size of the record values
+	 */
+	size_t size;
+
+	/* The timestamp of the last access
+	 */
+	int64_t timestamp;
+};
+
+typedef struct libevt_records_cache_shard libevt_records_cache_shard_t;
+
+struct libevt_records_cache_shard
+{
+	/* The entries
+	 */
+	libevt_records_cache_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The (estimated) memory size of the cached record values
+	 */
+	size64_t size;
+
+	/* The current timestamp
+	 */
+	int64_t current_timestamp;
+
+	/* The number of cache hits
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of cache misses
+	 */
+	uint64_t number_of_misses;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libevt_records_cache libevt_records_cache_t;
+
+struct libevt_records_cache
+{
+	/* The shards
+	 * Each shard caches the record values of a subset of the record offsets
+	 * and is locked independently of the other shards
+	 */
+	libevt_records_cache_shard_t *shards;
+
+	/* The number of shards
+	 */
+	int number_of_shards;
+
+	/* The maximum number of entries
+	 */
+	int maximum_number_of_entries;
+
+	/* The maximum number of entries per shard
+	 */
+	int number_of_entries_per_shard;
+
+	/* The maximum (estimated) memory size of the cached record values
+	 * 0 represents no maximum
+	 */
+	size64_t maximum_size;
+
+	/* The maximum memory size per shard
+	 */
+	size64_t maximum_size_per_shard;
+
+	/* Value to indicate all record values should be kept in the cache
+	 */
+	uint8_t pin_all;
+};
+
+int libevt_records_cache_initialize(
+     libevt_records_cache_t **records_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libevt_records_cache_free(
+     libevt_records_cache_t **records_cache,
+     libcerror_error_t **error );
+
+int libevt_records_cache_empty(
+     libevt_records_cache_t *records_cache,
+     libcerror_error_t **error );
+
+int libevt_records_cache_resize(
+     libevt_records_cache_t *records_cache,
+     int maximum_number_of_entries,
+     size64_t maximum_size,
+     libcerror_error_t **error );
+
+int libevt_records_cache_set_pin_all(
+     libevt_records_cache_t *records_cache,
+     uint8_t pin_all,
+     libcerror_error_t **error );
+
+int libevt_records_cache_get_statistics(
+     libevt_records_cache_t *records_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     libcerror_error_t **error );
+
+int libevt_records_cache_get_record_values_by_offset(
+     libevt_records_cache_t *records_cache,
+     off64_t offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevt_records_cache_set_record_values_by_offset(
+     libevt_records_cache_t *records_cache,
+     off64_t offset,
+     libevt_record_values_t **record_values,
+     libcerror_error_t **error );
+
+int libevt_records_cache_release_record_values(
+     libevt_records_cache_t *records_cache,
+     libevt_record_values_t *record_values,
+     libcerror_error_t **error );
+
+int libevt_records_cache_shard_get_least_recently_used_entry(
+     libevt_records_cache_shard_t *shard,
+     libevt_records_cache_entry_t *ignore_entry,
+     uint8_t unreferenced_only,
+     libevt_records_cache_entry_t **entry,
+     libcerror_error_t **error );
+
+int libevt_records_cache_shard_remove_entry(
+     libevt_records_cache_shard_t *shard,
+     libevt_records_cache_entry_t *entry,
+     libcerror_error_t **error );
+
+int libevt_records_cache_shard_resize(
+     libevt_records_cache_shard_t *shard,
+     int number_of_entries,
+     libcerror_error_t **error );
+
+int libevt_records_cache_shard_reduce_size(
+     libevt_records_cache_shard_t *shard,
+     size64_t maximum_size,
+     libevt_records_cache_entry_t *ignore_entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_RECORDS_CACHE_H ) */
+
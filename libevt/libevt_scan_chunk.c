@@ -0,0 +1,294 @@
+/*
+ * Recovery scan chunk functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcnotify.h"
+#include "libevt_offset_table.h"
+#include "libevt_record_values.h"
+#include "libevt_scan_chunk.h"
+#include "libevt_scan_context.h"
+
+/* Creates a scan chunk
+ * Make sure the value scan_chunk is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_chunk_initialize(
+     libevt_scan_chunk_t **scan_chunk,
+     libevt_io_handle_t *io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_chunk_initialize";
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_chunk != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan chunk value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_offset < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid file offset value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_chunk = memory_allocate_structure(
+	               libevt_scan_chunk_t );
+
+	if( *scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan chunk.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_chunk,
+	     0,
+	     sizeof( libevt_scan_chunk_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan chunk.",
+		 function );
+
+		memory_free(
+		 *scan_chunk );
+
+		*scan_chunk = NULL;
+
+		return( -1 );
+	}
+	if( libevt_offset_table_initialize(
+	     &( ( *scan_chunk )->records_table ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create records table.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_chunk )->io_handle   = io_handle;
+	( *scan_chunk )->file_offset = file_offset;
+	( *scan_chunk )->size        = size;
+	( *scan_chunk )->has_wrapped = io_handle->has_wrapped;
+
+	return( 1 );
+
+on_error:
+	if( *scan_chunk != NULL )
+	{
+		memory_free(
+		 *scan_chunk );
+
+		*scan_chunk = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a scan chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_chunk_free(
+     libevt_scan_chunk_t **scan_chunk,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_chunk_free";
+	int result            = 1;
+
+	if( scan_chunk == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan chunk.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_chunk != NULL )
+	{
+		if( ( *scan_chunk )->records_table != NULL )
+		{
+			if( libevt_offset_table_free(
+			     &( ( *scan_chunk )->records_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free records table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *scan_chunk );
+
+		*scan_chunk = NULL;
+	}
+	return( result );
+}
+
+/* Scans the chunk for candidate event records
+ * Callback function for the recovery scan thread pool
+ * The result of the scan is stored in the scan chunk
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_chunk_scan(
+     libevt_scan_chunk_t *scan_chunk,
+     libevt_scan_context_t *scan_context )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	static char *function            = "libevt_scan_chunk_scan";
+
+	if( scan_chunk == NULL )
+	{
+		return( -1 );
+	}
+	scan_chunk->result = -1;
+
+	if( libevt_scan_context_grab_file_io_handle(
+	     scan_context,
+	     &file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to grab file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The candidate records are not skipped over so that the results of
+	 * adjacent chunks can be merged as if the region was scanned at once
+	 */
+	scan_chunk->result = libevt_io_handle_event_record_scan(
+	                      scan_chunk->io_handle,
+	                      file_io_handle,
+	                      scan_chunk->file_offset,
+	                      scan_chunk->size,
+	                      0,
+	                      &( scan_chunk->has_wrapped ),
+	                      scan_chunk->records_table,
+	                      &error );
+
+	if( scan_chunk->result != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to scan chunk at offset: %" PRIi64 " for event records.",
+		 function,
+		 scan_chunk->file_offset );
+
+		scan_chunk->result = -1;
+	}
+	if( libevt_scan_context_release_file_io_handle(
+	     scan_context,
+	     file_io_handle,
+	     &error ) != 1 )
+	{
+		libcerror_error_set(
+		 &error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release file IO handle.",
+		 function );
+
+		scan_chunk->result = -1;
+	}
+	if( scan_chunk->result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_print_error_backtrace(
+		 error );
+	}
+#endif
+	libcerror_error_free(
+	 &error );
+
+	return( -1 );
+}
+
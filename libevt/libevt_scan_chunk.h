@@ -0,0 +1,87 @@
+/*
+ * Recovery scan chunk functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_SCAN_CHUNK_H )
+#define _LIBEVT_SCAN_CHUNK_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_io_handle.h"
+#include "libevt_libcerror.h"
+#include "libevt_offset_table.h"
+#include "libevt_scan_context.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_scan_chunk libevt_scan_chunk_t;
+
+struct libevt_scan_chunk
+{
+	/* The IO handle
+	 * This is shared with the other chunks so that an abort signal reaches the scan
+	 */
+	libevt_io_handle_t *io_handle;
+
+	/* Value to indicate the record data of the chunk has wrapped
+	 */
+	uint8_t has_wrapped;
+
+	/* The file offset
+	 */
+	off64_t file_offset;
+
+	/* The size
+	 */
+	size64_t size;
+
+	/* The candidate records table
+	 */
+	libevt_offset_table_t *records_table;
+
+	/* The result of the scan
+	 */
+	int result;
+};
+
+int libevt_scan_chunk_initialize(
+     libevt_scan_chunk_t **scan_chunk,
+     libevt_io_handle_t *io_handle,
+     off64_t file_offset,
+     size64_t size,
+     libcerror_error_t **error );
+
+int libevt_scan_chunk_free(
+     libevt_scan_chunk_t **scan_chunk,
+     libcerror_error_t **error );
+
+int libevt_scan_chunk_scan(
+     libevt_scan_chunk_t *scan_chunk,
+     libevt_scan_context_t *scan_context );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_SCAN_CHUNK_H ) */
+
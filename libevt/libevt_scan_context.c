@@ -0,0 +1,517 @@
+/*
+ * Recovery scan context functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+#include "libevt_scan_context.h"
+
+/* Creates a scan context
+ * Make sure the value scan_context is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_context_initialize(
+     libevt_scan_context_t **scan_context,
+     libbfio_handle_t *file_io_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_context_initialize";
+	int handle_index      = 0;
+	int result            = 0;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_context != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scan context value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_file_io_handles <= 0 )
+	 || ( (size_t) number_of_file_io_handles > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libbfio_handle_t * ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of file IO handles value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*scan_context = memory_allocate_structure(
+	                 libevt_scan_context_t );
+
+	if( *scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scan context.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scan_context,
+	     0,
+	     sizeof( libevt_scan_context_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scan context.",
+		 function );
+
+		memory_free(
+		 *scan_context );
+
+		*scan_context = NULL;
+
+		return( -1 );
+	}
+	( *scan_context )->file_io_handles = (libbfio_handle_t **) memory_allocate(
+	                                                            sizeof( libbfio_handle_t * ) * number_of_file_io_handles );
+
+	if( ( *scan_context )->file_io_handles == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scan_context )->file_io_handles,
+	     0,
+	     sizeof( libbfio_handle_t * ) * number_of_file_io_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_context )->file_io_handles_in_use = (uint8_t *) memory_allocate(
+	                                                         sizeof( uint8_t ) * number_of_file_io_handles );
+
+	if( ( *scan_context )->file_io_handles_in_use == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file IO handles in use.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scan_context )->file_io_handles_in_use,
+	     0,
+	     sizeof( uint8_t ) * number_of_file_io_handles ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file IO handles in use.",
+		 function );
+
+		goto on_error;
+	}
+	( *scan_context )->number_of_file_io_handles = number_of_file_io_handles;
+
+	for( handle_index = 0;
+	     handle_index < number_of_file_io_handles;
+	     handle_index++ )
+	{
+		if( libbfio_handle_clone(
+		     &( ( *scan_context )->file_io_handles[ handle_index ] ),
+		     file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to clone file IO handle: %d.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		result = libbfio_handle_is_open(
+		          ( *scan_context )->file_io_handles[ handle_index ],
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if file IO handle: %d is open.",
+			 function,
+			 handle_index );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     ( *scan_context )->file_io_handles[ handle_index ],
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open file IO handle: %d.",
+				 function,
+				 handle_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *scan_context )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *scan_context != NULL )
+	{
+		libevt_scan_context_free(
+		 scan_context,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a scan context
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_context_free(
+     libevt_scan_context_t **scan_context,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_context_free";
+	int handle_index      = 0;
+	int result            = 1;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scan_context != NULL )
+	{
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+		if( ( *scan_context )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *scan_context )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+#endif
+		if( ( *scan_context )->file_io_handles != NULL )
+		{
+			for( handle_index = 0;
+			     handle_index < ( *scan_context )->number_of_file_io_handles;
+			     handle_index++ )
+			{
+				if( ( *scan_context )->file_io_handles[ handle_index ] == NULL )
+				{
+					continue;
+				}
+				if( libbfio_handle_is_open(
+				     ( *scan_context )->file_io_handles[ handle_index ],
+				     NULL ) == 1 )
+				{
+					if( libbfio_handle_close(
+					     ( *scan_context )->file_io_handles[ handle_index ],
+					     error ) != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+						 "%s: unable to close file IO handle: %d.",
+						 function,
+						 handle_index );
+
+						result = -1;
+					}
+				}
+				if( libbfio_handle_free(
+				     &( ( *scan_context )->file_io_handles[ handle_index ] ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free file IO handle: %d.",
+					 function,
+					 handle_index );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 ( *scan_context )->file_io_handles );
+		}
+		if( ( *scan_context )->file_io_handles_in_use != NULL )
+		{
+			memory_free(
+			 ( *scan_context )->file_io_handles_in_use );
+		}
+		memory_free(
+		 *scan_context );
+
+		*scan_context = NULL;
+	}
+	return( result );
+}
+
+/* Grabs a file IO handle that is not in use
+ * Returns 1 if successful, 0 if no file IO handle is available or -1 on error
+ */
+int libevt_scan_context_grab_file_io_handle(
+     libevt_scan_context_t *scan_context,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_context_grab_file_io_handle";
+	int handle_index      = 0;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*file_io_handle = NULL;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scan_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( handle_index = 0;
+	     handle_index < scan_context->number_of_file_io_handles;
+	     handle_index++ )
+	{
+		if( scan_context->file_io_handles_in_use[ handle_index ] == 0 )
+		{
+			scan_context->file_io_handles_in_use[ handle_index ] = 1;
+
+			*file_io_handle = scan_context->file_io_handles[ handle_index ];
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scan_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( *file_io_handle == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Releases a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_scan_context_release_file_io_handle(
+     libevt_scan_context_t *scan_context,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_scan_context_release_file_io_handle";
+	int handle_index      = 0;
+	int result            = -1;
+
+	if( scan_context == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scan context.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     scan_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( handle_index = 0;
+	     handle_index < scan_context->number_of_file_io_handles;
+	     handle_index++ )
+	{
+		if( scan_context->file_io_handles[ handle_index ] == file_io_handle )
+		{
+			scan_context->file_io_handles_in_use[ handle_index ] = 0;
+
+			result = 1;
+
+			break;
+		}
+	}
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     scan_context->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -0,0 +1,85 @@
+/*
+ * Recovery scan context functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_SCAN_CONTEXT_H )
+#define _LIBEVT_SCAN_CONTEXT_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libbfio.h"
+#include "libevt_libcerror.h"
+#include "libevt_libcthreads.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_scan_context libevt_scan_context_t;
+
+struct libevt_scan_context
+{
+	/* The file IO handles
+	 * These are clones of the file IO handle of the file, one per thread
+	 */
+	libbfio_handle_t **file_io_handles;
+
+	/* Values to indicate the file IO handles are in use
+	 */
+	uint8_t *file_io_handles_in_use;
+
+	/* The number of file IO handles
+	 */
+	int number_of_file_io_handles;
+
+#if defined( HAVE_LIBEVT_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+int libevt_scan_context_initialize(
+     libevt_scan_context_t **scan_context,
+     libbfio_handle_t *file_io_handle,
+     int number_of_file_io_handles,
+     libcerror_error_t **error );
+
+int libevt_scan_context_free(
+     libevt_scan_context_t **scan_context,
+     libcerror_error_t **error );
+
+int libevt_scan_context_grab_file_io_handle(
+     libevt_scan_context_t *scan_context,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+int libevt_scan_context_release_file_io_handle(
+     libevt_scan_context_t *scan_context,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_SCAN_CONTEXT_H ) */
+
@@ -0,0 +1,371 @@
+/*
+ * Signature scanner functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_signature_scanner.h"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __SSE2__ )
+#define LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2	1
+
+#include <emmintrin.h>
+
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define LIBEVT_SIGNATURE_SCANNER_HAVE_AVX2	1
+
+#include <immintrin.h>
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_AMD64 ) )
+#define LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2	1
+
+#include <emmintrin.h>
+
+#endif
+
+/* Determines the best scan method supported by the CPU
+ * The scan method is not cached, it is determined once when the IO handle
+ * is created and passed to libevt_signature_scanner_scan
+ * Returns the scan method
+ */
+int libevt_signature_scanner_get_supported_scan_method(
+     void )
+{
+	int scan_method = LIBEVT_SCAN_METHOD_SCALAR;
+
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+	scan_method = LIBEVT_SCAN_METHOD_SSE2;
+#endif
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_AVX2 )
+	__builtin_cpu_init();
+
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		scan_method = LIBEVT_SCAN_METHOD_AVX2;
+	}
+#endif
+	return( scan_method );
+}
+
+/* Scans the data for a signature using 32-bit comparisons
+ * Returns the offset of the signature or data_size if not found
+ */
+static size_t libevt_signature_scanner_scan_scalar(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset,
+               uint8_t signature_flags,
+               uint8_t *signature_flag )
+{
+	uint32_t value_32bit = 0;
+
+	while( ( data_offset + 4 ) <= data_size )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( data[ data_offset ] ),
+		 value_32bit );
+
+		if( ( ( signature_flags & LIBEVT_SIGNATURE_FLAG_RECORD ) != 0 )
+		 && ( value_32bit == LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE ) )
+		{
+			*signature_flag = LIBEVT_SIGNATURE_FLAG_RECORD;
+
+			return( data_offset );
+		}
+		if( ( ( signature_flags & LIBEVT_SIGNATURE_FLAG_END_OF_FILE ) != 0 )
+		 && ( value_32bit == LIBEVT_SIGNATURE_SCANNER_END_OF_FILE_SIGNATURE ) )
+		{
+			*signature_flag = LIBEVT_SIGNATURE_FLAG_END_OF_FILE;
+
+			return( data_offset );
+		}
+		data_offset += 4;
+	}
+	return( data_size );
+}
+
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+
+/* Scans the data for a signature comparing 4 values of 32-bit at a time using SSE2
+ * Returns the offset of the signature or data_size if not found
+ */
+static size_t libevt_signature_scanner_scan_sse2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset,
+               uint8_t signature_flags,
+               uint8_t *signature_flag )
+{
+	__m128i compare_result        = _mm_setzero_si128();
+	__m128i data_block            = _mm_setzero_si128();
+	__m128i end_of_file_signature = _mm_set1_epi32( (int) LIBEVT_SIGNATURE_SCANNER_END_OF_FILE_SIGNATURE );
+	__m128i record_signature      = _mm_set1_epi32( (int) LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE );
+	int compare_mask              = 0;
+
+	while( ( data_offset + 16 ) <= data_size )
+	{
+		data_block     = _mm_loadu_si128( (const __m128i *) &( data[ data_offset ] ) );
+		compare_result = _mm_setzero_si128();
+
+		if( ( signature_flags & LIBEVT_SIGNATURE_FLAG_RECORD ) != 0 )
+		{
+			compare_result = _mm_or_si128(
+			                  compare_result,
+			                  _mm_cmpeq_epi32( data_block, record_signature ) );
+		}
+		if( ( signature_flags & LIBEVT_SIGNATURE_FLAG_END_OF_FILE ) != 0 )
+		{
+			compare_result = _mm_or_si128(
+			                  compare_result,
+			                  _mm_cmpeq_epi32( data_block, end_of_file_signature ) );
+		}
+		compare_mask = _mm_movemask_ps( _mm_castsi128_ps( compare_result ) );
+
+		if( compare_mask != 0 )
+		{
+			while( ( compare_mask & 0x01 ) == 0 )
+			{
+				compare_mask >>= 1;
+				data_offset   += 4;
+			}
+			break;
+		}
+		data_offset += 16;
+	}
+	/* The scalar scan determines the signature type and handles the remainder
+	 */
+	return( libevt_signature_scanner_scan_scalar(
+	         data,
+	         data_size,
+	         data_offset,
+	         signature_flags,
+	         signature_flag ) );
+}
+
+#endif /* defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 ) */
+
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_AVX2 )
+
+/* Scans the data for a signature comparing 8 values of 32-bit at a time using AVX2
+ * Returns the offset of the signature or data_size if not found
+ */
+__attribute__((target("avx2")))
+static size_t libevt_signature_scanner_scan_avx2(
+               const uint8_t *data,
+               size_t data_size,
+               size_t data_offset,
+               uint8_t signature_flags,
+               uint8_t *signature_flag )
+{
+	__m256i compare_result        = _mm256_setzero_si256();
+	__m256i data_block            = _mm256_setzero_si256();
+	__m256i end_of_file_signature = _mm256_set1_epi32( (int) LIBEVT_SIGNATURE_SCANNER_END_OF_FILE_SIGNATURE );
+	__m256i record_signature      = _mm256_set1_epi32( (int) LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE );
+	int compare_mask              = 0;
+
+	while( ( data_offset + 32 ) <= data_size )
+	{
+		data_block     = _mm256_loadu_si256( (const __m256i *) &( data[ data_offset ] ) );
+		compare_result = _mm256_setzero_si256();
+
+		if( ( signature_flags & LIBEVT_SIGNATURE_FLAG_RECORD ) != 0 )
+		{
+			compare_result = _mm256_or_si256(
+			                  compare_result,
+			                  _mm256_cmpeq_epi32( data_block, record_signature ) );
+		}
+		if( ( signature_flags & LIBEVT_SIGNATURE_FLAG_END_OF_FILE ) != 0 )
+		{
+			compare_result = _mm256_or_si256(
+			                  compare_result,
+			                  _mm256_cmpeq_epi32( data_block, end_of_file_signature ) );
+		}
+		compare_mask = _mm256_movemask_ps( _mm256_castsi256_ps( compare_result ) );
+
+		if( compare_mask != 0 )
+		{
+			while( ( compare_mask & 0x01 ) == 0 )
+			{
+				compare_mask >>= 1;
+				data_offset   += 4;
+			}
+			break;
+		}
+		data_offset += 32;
+	}
+	/* The scalar scan determines the signature type and handles the remainder
+	 */
+	return( libevt_signature_scanner_scan_scalar(
+	         data,
+	         data_size,
+	         data_offset,
+	         signature_flags,
+	         signature_flag ) );
+}
+
+#endif /* defined( LIBEVT_SIGNATURE_SCANNER_HAVE_AVX2 ) */
+
+/* Scans the data for the next record or end-of-file record signature
+ * Only offsets that are a multitude of 4 relative to the data offset are considered
+ * The scan method must be supported by the CPU, such as the one returned by
+ * libevt_signature_scanner_get_supported_scan_method, it is not checked here
+ * Returns 1 if a signature was found, 0 if not or -1 on error
+ */
+int libevt_signature_scanner_scan(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t signature_flags,
+     int scan_method,
+     size_t *signature_offset,
+     uint8_t *signature_flag,
+     libcerror_error_t **error )
+{
+	static char *function        = "libevt_signature_scanner_scan";
+	size_t safe_signature_offset = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_offset > data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( signature_flags & ~( LIBEVT_SIGNATURE_FLAG_RECORD | LIBEVT_SIGNATURE_FLAG_END_OF_FILE ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported signature flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( scan_method != LIBEVT_SCAN_METHOD_SCALAR )
+	 && ( scan_method != LIBEVT_SCAN_METHOD_SSE2 )
+	 && ( scan_method != LIBEVT_SCAN_METHOD_AVX2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported scan method.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_flag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid signature flag.",
+		 function );
+
+		return( -1 );
+	}
+	if( signature_flags == 0 )
+	{
+		return( 0 );
+	}
+	switch( scan_method )
+	{
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_AVX2 )
+		case LIBEVT_SCAN_METHOD_AVX2:
+			safe_signature_offset = libevt_signature_scanner_scan_avx2(
+			                         data,
+			                         data_size,
+			                         data_offset,
+			                         signature_flags,
+			                         signature_flag );
+			break;
+#endif
+#if defined( LIBEVT_SIGNATURE_SCANNER_HAVE_SSE2 )
+		case LIBEVT_SCAN_METHOD_SSE2:
+			safe_signature_offset = libevt_signature_scanner_scan_sse2(
+			                         data,
+			                         data_size,
+			                         data_offset,
+			                         signature_flags,
+			                         signature_flag );
+			break;
+#endif
+		default:
+			safe_signature_offset = libevt_signature_scanner_scan_scalar(
+			                         data,
+			                         data_size,
+			                         data_offset,
+			                         signature_flags,
+			                         signature_flag );
+			break;
+	}
+	if( safe_signature_offset >= data_size )
+	{
+		return( 0 );
+	}
+	*signature_offset = safe_signature_offset;
+
+	return( 1 );
+}
+
@@ -0,0 +1,78 @@
+/*
+ * Signature scanner functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_SIGNATURE_SCANNER_H )
+#define _LIBEVT_SIGNATURE_SCANNER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The signature flags
+ */
+enum LIBEVT_SIGNATURE_FLAGS
+{
+	LIBEVT_SIGNATURE_FLAG_RECORD				= 0x01,
+	LIBEVT_SIGNATURE_FLAG_END_OF_FILE			= 0x02
+};
+
+/* The scan methods
+ */
+enum LIBEVT_SCAN_METHODS
+{
+	LIBEVT_SCAN_METHOD_DEFAULT				= 0,
+	LIBEVT_SCAN_METHOD_SCALAR				= 1,
+	LIBEVT_SCAN_METHOD_SSE2					= 2,
+	LIBEVT_SCAN_METHOD_AVX2					= 3
+};
+
+/* The "LfLe" record signature as a 32-bit little-endian value
+ */
+#define LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE		0x654c664cUL
+
+/* The first end-of-file record signature as a 32-bit little-endian value
+ */
+#define LIBEVT_SIGNATURE_SCANNER_END_OF_FILE_SIGNATURE		0x11111111UL
+
+int libevt_signature_scanner_get_supported_scan_method(
+     void );
+
+int libevt_signature_scanner_scan(
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t signature_flags,
+     int scan_method,
+     size_t *signature_offset,
+     uint8_t *signature_flag,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_SIGNATURE_SCANNER_H ) */
+
@@ -123,20 +123,12 @@ int libevt_strings_array_free(
 	}
 	if( *strings_array != NULL )
 	{
-		if( ( *strings_array )->string_sizes != NULL )
+		/* The strings data is referenced and freed elsewhere
+		 */
+		if( ( *strings_array )->string_offsets != NULL )
 		{
 			memory_free(
-			 ( *strings_array )->string_sizes );
-		}
-		if( ( *strings_array )->strings != NULL )
-		{
-			memory_free(
-			 ( *strings_array )->strings );
-		}
-		if( ( *strings_array )->strings_data != NULL )
-		{
-			memory_free(
-			 ( *strings_array )->strings_data );
+			 ( *strings_array )->string_offsets );
 		}
 		memory_free(
 		 *strings_array );
@@ -147,6 +139,10 @@ int libevt_strings_array_free(
 }
 
 /* Reads the strings array data
+ * The strings array references the data, which must remain valid
+ * for the lifetime of the strings array
+ * The offsets of the strings are determined so that a string can be retrieved
+ * without scanning the strings data
  * Returns 1 if successful or -1 on error
  */
 int libevt_strings_array_read_data(
@@ -155,11 +151,11 @@ int libevt_strings_array_read_data(
      size_t data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevt_strings_array_read_data";
-	size_t data_offset    = 0;
-	size_t string_offset  = 0;
-	int number_of_strings = 0;
-	int string_index      = 0;
+	size_t *string_offsets = NULL;
+	static char *function  = "libevt_strings_array_read_data";
+	size_t data_offset     = 0;
+	int number_of_strings  = 0;
+	int string_index       = 0;
 
 	if( strings_array == NULL )
 	{
@@ -251,149 +247,59 @@ int libevt_strings_array_read_data(
 		 "\n" );
 	}
 #endif
-	strings_array->strings_data = (uint8_t *) memory_allocate(
-	                                           sizeof( uint8_t ) * data_size );
-
-	if( strings_array->strings_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create strings data.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_copy(
-	     strings_array->strings_data,
-	     data,
-	     sizeof( uint8_t ) * data_size ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy strings data.",
-		 function );
-
-		goto on_error;
-	}
-	strings_array->strings_data_size = data_size;
-
-	strings_array->strings = (uint8_t **) memory_allocate(
-	                                       sizeof( uint8_t* ) * number_of_strings );
-
-	if( strings_array->strings == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create strings.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     strings_array->strings,
-	     0,
-	     sizeof( uint8_t* ) * number_of_strings ) == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear strings.",
-		 function );
-
-		goto on_error;
-	}
-	strings_array->string_sizes = (size_t *) memory_allocate(
-	                                          sizeof( size_t ) * number_of_strings );
-
-	if( strings_array->string_sizes == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create string sizes.",
-		 function );
-
-		goto on_error;
-	}
-	if( memory_set(
-	     strings_array->string_sizes,
-	     0,
-	     sizeof( uint8_t* ) * number_of_strings ) == NULL )
+	if( number_of_strings > 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-		 "%s: unable to clear string sizes.",
-		 function );
+		if( (size_t) number_of_strings >= ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( size_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of strings value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		string_offsets = (size_t *) memory_allocate(
+		                             sizeof( size_t ) * ( number_of_strings + 1 ) );
 
-		goto on_error;
-	}
-	for( data_offset = 0;
-	     data_offset < strings_array->strings_data_size;
-	     data_offset += 2 )
-	{
-		if( ( strings_array->strings_data[ data_offset ] == 0 )
-		 && ( strings_array->strings_data[ data_offset + 1 ] == 0 ) )
+		if( string_offsets == NULL )
 		{
-			strings_array->strings[ string_index ]      = &( strings_array->strings_data[ string_offset ] );
-			strings_array->string_sizes[ string_index ] = ( data_offset + 2 ) - string_offset;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create string offsets.",
+			 function );
+
+			return( -1 );
+		}
+		string_offsets[ 0 ] = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+		for( data_offset = 0;
+		     data_offset < data_size;
+		     data_offset += 2 )
+		{
+			if( ( data[ data_offset ] == 0 )
+			 && ( data[ data_offset + 1 ] == 0 ) )
 			{
-				libcnotify_printf(
-				 "%s: string: %d data:\n",
-				 function,
-				 string_index );
-				libcnotify_print_data(
-				 strings_array->strings[ string_index ],
-				 strings_array->string_sizes[ string_index ],
-				 0 );
-			}
-#endif
-			string_offset = data_offset + 2;
+				string_index++;
+
+				string_offsets[ string_index ] = data_offset + 2;
 
-			string_index++;
+				if( string_index == number_of_strings )
+				{
+					break;
+				}
+			}
 		}
 	}
+	strings_array->strings_data      = data;
+	strings_array->strings_data_size = data_size;
 	strings_array->number_of_strings = number_of_strings;
+	strings_array->string_offsets    = string_offsets;
 
 	return( 1 );
-
-on_error:
-	if( strings_array->string_sizes != NULL )
-	{
-		memory_free(
-		 strings_array->string_sizes );
-
-		strings_array->string_sizes = NULL;
-	}
-	if( strings_array->strings != NULL )
-	{
-		memory_free(
-		 strings_array->strings );
-
-		strings_array->strings = NULL;
-	}
-	if( strings_array->strings_data != NULL )
-	{
-		memory_free(
-		 strings_array->strings_data );
-
-		strings_array->strings_data = NULL;
-	}
-	strings_array->strings_data_size = 0;
-
-	return( -1 );
 }
 
 /* Retrieves the number of strings
@@ -433,17 +339,19 @@ int libevt_strings_array_get_number_of_strings(
 	return( 1 );
 }
 
-/* Retrieves the size of a specific UTF-8 encoded string
- * The returned size includes the end of string character
+/* Retrieves a specific string
+ * The string is a reference to the UTF-16 little-endian string data
+ * including the end of string character
  * Returns 1 if successful or -1 on error
  */
-int libevt_strings_array_get_utf8_string_size(
+int libevt_strings_array_get_string(
      libevt_strings_array_t *strings_array,
      int string_index,
-     size_t *utf8_string_size,
+     const uint8_t **string,
+     size_t *string_size,
      libcerror_error_t **error )
 {
-	static char *function = "libevt_strings_array_get_utf8_string_size";
+	static char *function = "libevt_strings_array_get_string";
 
 	if( strings_array == NULL )
 	{
@@ -451,18 +359,18 @@ int libevt_strings_array_get_utf8_string_size(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record values.",
+		 "%s: invalid strings array.",
 		 function );
 
 		return( -1 );
 	}
-	if( strings_array->strings == NULL )
+	if( strings_array->strings_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string index value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid strings array - missing strings data.",
 		 function );
 
 		return( -1 );
@@ -479,9 +387,79 @@ int libevt_strings_array_get_utf8_string_size(
 
 		return( -1 );
 	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string size.",
+		 function );
+
+		return( -1 );
+	}
+	*string      = &( strings_array->strings_data[ strings_array->string_offsets[ string_index ] ] );
+	*string_size = strings_array->string_offsets[ string_index + 1 ] - strings_array->string_offsets[ string_index ];
+
+	return( 1 );
+}
+
+/* Retrieves the size of a specific UTF-8 encoded string
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_strings_array_get_utf8_string_size(
+     libevt_strings_array_t *strings_array,
+     int string_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_strings_array_get_utf8_string_size";
+	const uint8_t *string  = NULL;
+	size_t string_size     = 0;
+
+	if( strings_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_strings_array_get_string(
+	     strings_array,
+	     string_index,
+	     &string,
+	     &string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
+
+		return( -1 );
+	}
 	if( libuna_utf8_string_size_from_utf16_stream(
-	     strings_array->strings[ string_index ],
-	     strings_array->string_sizes[ string_index ],
+	     string,
+	     string_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     utf8_string_size,
 	     error ) != 1 )
@@ -511,6 +489,8 @@ int libevt_strings_array_get_utf8_string(
      libcerror_error_t **error )
 {
 	static char *function = "libevt_values_record_get_utf8_string";
+	const uint8_t *string  = NULL;
+	size_t string_size     = 0;
 
 	if( strings_array == NULL )
 	{
@@ -523,34 +503,28 @@ int libevt_strings_array_get_utf8_string(
 
 		return( -1 );
 	}
-	if( strings_array->strings == NULL )
+	if( libevt_strings_array_get_string(
+	     strings_array,
+	     string_index,
+	     &string,
+	     &string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string index value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( string_index < 0 )
-	 || ( string_index >= strings_array->number_of_strings ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid strings index value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	if( libuna_utf8_string_copy_from_utf16_stream(
 	     (libuna_utf8_character_t *) utf8_string,
 	     utf8_string_size,
-	     strings_array->strings[ string_index ],
-	     strings_array->string_sizes[ string_index ],
+	     string,
+	     string_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
@@ -578,6 +552,8 @@ int libevt_strings_array_get_utf16_string_size(
      libcerror_error_t **error )
 {
 	static char *function = "libevt_strings_array_get_utf16_string_size";
+	const uint8_t *string  = NULL;
+	size_t string_size     = 0;
 
 	if( strings_array == NULL )
 	{
@@ -590,32 +566,26 @@ int libevt_strings_array_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( strings_array->strings == NULL )
+	if( libevt_strings_array_get_string(
+	     strings_array,
+	     string_index,
+	     &string,
+	     &string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string index value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( string_index < 0 )
-	 || ( string_index >= strings_array->number_of_strings ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid strings index value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	if( libuna_utf16_string_size_from_utf16_stream(
-	     strings_array->strings[ string_index ],
-	     strings_array->string_sizes[ string_index ],
+	     string,
+	     string_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     utf16_string_size,
 	     error ) != 1 )
@@ -645,6 +615,8 @@ int libevt_strings_array_get_utf16_string(
      libcerror_error_t **error )
 {
 	static char *function = "libevt_values_record_get_utf16_string";
+	const uint8_t *string  = NULL;
+	size_t string_size     = 0;
 
 	if( strings_array == NULL )
 	{
@@ -657,34 +629,28 @@ int libevt_strings_array_get_utf16_string(
 
 		return( -1 );
 	}
-	if( strings_array->strings == NULL )
+	if( libevt_strings_array_get_string(
+	     strings_array,
+	     string_index,
+	     &string,
+	     &string_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid string index value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( string_index < 0 )
-	 || ( string_index >= strings_array->number_of_strings ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid strings index value out of bounds.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve string: %d.",
+		 function,
+		 string_index );
 
 		return( -1 );
 	}
 	if( libuna_utf16_string_copy_from_utf16_stream(
 	     (libuna_utf16_character_t *) utf16_string,
 	     utf16_string_size,
-	     strings_array->strings[ string_index ],
-	     strings_array->string_sizes[ string_index ],
+	     string,
+	     string_size,
 	     LIBUNA_ENDIAN_LITTLE,
 	     error ) != 1 )
 	{
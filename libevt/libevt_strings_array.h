@@ -36,8 +36,9 @@ typedef struct libevt_strings_array libevt_strings_array_t;
 struct libevt_strings_array
 {
 	/* The strings data
+	 * This is a reference to data owned by the event record
 	 */
-	uint8_t *strings_data;
+	const uint8_t *strings_data;
 
 	/* The strings data size
 	 */
@@ -47,13 +48,10 @@ struct libevt_strings_array
 	 */
 	int number_of_strings;
 
-	/* The strings
+	/* The offsets of the strings in the strings data
+	 * The last offset is the end of the last string
 	 */
-	uint8_t **strings;
-
-	/* The string sizes
-	 */
-	size_t *string_sizes;
+	size_t *string_offsets;
 };
 
 int libevt_strings_array_initialize(
@@ -75,6 +73,13 @@ int libevt_strings_array_get_number_of_strings(
      int *number_of_strings,
      libcerror_error_t **error );
 
+int libevt_strings_array_get_string(
+     libevt_strings_array_t *strings_array,
+     int string_index,
+     const uint8_t **string,
+     size_t *string_size,
+     libcerror_error_t **error );
+
 int libevt_strings_array_get_utf8_string_size(
      libevt_strings_array_t *strings_array,
      int string_index,
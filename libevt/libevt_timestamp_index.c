@@ -0,0 +1,581 @@
+/*
+ * Timestamp index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+#include "libevt_timestamp_index.h"
+
+/* Creates a timestamp index
+ * Make sure the value timestamp_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_initialize(
+     libevt_timestamp_index_t **timestamp_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_timestamp_index_initialize";
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timestamp_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid timestamp index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*timestamp_index = memory_allocate_structure(
+	                    libevt_timestamp_index_t );
+
+	if( *timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *timestamp_index,
+	     0,
+	     sizeof( libevt_timestamp_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear timestamp index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *timestamp_index != NULL )
+	{
+		memory_free(
+		 *timestamp_index );
+
+		*timestamp_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a timestamp index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_free(
+     libevt_timestamp_index_t **timestamp_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_timestamp_index_free";
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *timestamp_index != NULL )
+	{
+		if( ( *timestamp_index )->runs != NULL )
+		{
+			memory_free(
+			 ( *timestamp_index )->runs );
+		}
+		if( ( *timestamp_index )->timestamps != NULL )
+		{
+			memory_free(
+			 ( *timestamp_index )->timestamps );
+		}
+		memory_free(
+		 *timestamp_index );
+
+		*timestamp_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a timestamp index
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_empty(
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_timestamp_index_empty";
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp_index->runs != NULL )
+	{
+		memory_free(
+		 timestamp_index->runs );
+
+		timestamp_index->runs = NULL;
+	}
+	if( timestamp_index->timestamps != NULL )
+	{
+		memory_free(
+		 timestamp_index->timestamps );
+
+		timestamp_index->timestamps = NULL;
+	}
+	timestamp_index->number_of_timestamps           = 0;
+	timestamp_index->number_of_allocated_timestamps = 0;
+	timestamp_index->number_of_runs                 = 0;
+	timestamp_index->number_of_allocated_runs       = 0;
+
+	return( 1 );
+}
+
+/* Appends the timestamp of the next record
+ * A new run is started when the timestamp is smaller than that of the previous record
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_append_timestamp(
+     libevt_timestamp_index_t *timestamp_index,
+     int record_index,
+     uint32_t timestamp,
+     libcerror_error_t **error )
+{
+	int *runs_reallocation             = NULL;
+	uint32_t *timestamps_reallocation  = NULL;
+	static char *function              = "libevt_timestamp_index_append_timestamp";
+	int number_of_allocated_runs       = 0;
+	int number_of_allocated_timestamps = 0;
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( record_index != timestamp_index->number_of_timestamps )
+	 || ( record_index == INT_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_index >= timestamp_index->number_of_allocated_timestamps )
+	{
+		if( record_index < 256 )
+		{
+			number_of_allocated_timestamps = 256;
+		}
+		else if( record_index > ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_timestamps = INT_MAX;
+		}
+		else
+		{
+			number_of_allocated_timestamps = record_index * 2;
+		}
+		if( (size_t) number_of_allocated_timestamps > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid number of allocated timestamps value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		timestamps_reallocation = (uint32_t *) memory_reallocate(
+		                                        timestamp_index->timestamps,
+		                                        sizeof( uint32_t ) * number_of_allocated_timestamps );
+
+		if( timestamps_reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize timestamps.",
+			 function );
+
+			return( -1 );
+		}
+		timestamp_index->timestamps                     = timestamps_reallocation;
+		timestamp_index->number_of_allocated_timestamps = number_of_allocated_timestamps;
+	}
+	if( ( record_index == 0 )
+	 || ( timestamp < timestamp_index->timestamps[ record_index - 1 ] ) )
+	{
+		if( timestamp_index->number_of_runs >= timestamp_index->number_of_allocated_runs )
+		{
+			if( timestamp_index->number_of_runs < 16 )
+			{
+				number_of_allocated_runs = 16;
+			}
+			else if( timestamp_index->number_of_runs > ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_runs = INT_MAX;
+			}
+			else
+			{
+				number_of_allocated_runs = timestamp_index->number_of_runs * 2;
+			}
+			if( (size_t) number_of_allocated_runs > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( int ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of allocated runs value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			runs_reallocation = (int *) memory_reallocate(
+			                             timestamp_index->runs,
+			                             sizeof( int ) * number_of_allocated_runs );
+
+			if( runs_reallocation == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize runs.",
+				 function );
+
+				return( -1 );
+			}
+			timestamp_index->runs                     = runs_reallocation;
+			timestamp_index->number_of_allocated_runs = number_of_allocated_runs;
+		}
+		timestamp_index->runs[ timestamp_index->number_of_runs ] = record_index;
+
+		timestamp_index->number_of_runs += 1;
+	}
+	timestamp_index->timestamps[ record_index ] = timestamp;
+
+	timestamp_index->number_of_timestamps += 1;
+
+	return( 1 );
+}
+
+/* Finalizes the timestamp index after the last timestamp was appended
+ * The unused timestamps and runs are released
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_finalize(
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error )
+{
+	int *runs_reallocation            = NULL;
+	uint32_t *timestamps_reallocation = NULL;
+	static char *function             = "libevt_timestamp_index_finalize";
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( timestamp_index->number_of_timestamps == 0 )
+	{
+		return( 1 );
+	}
+	if( timestamp_index->number_of_allocated_timestamps > timestamp_index->number_of_timestamps )
+	{
+		timestamps_reallocation = (uint32_t *) memory_reallocate(
+		                                        timestamp_index->timestamps,
+		                                        sizeof( uint32_t ) * timestamp_index->number_of_timestamps );
+
+		if( timestamps_reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize timestamps.",
+			 function );
+
+			return( -1 );
+		}
+		timestamp_index->timestamps                     = timestamps_reallocation;
+		timestamp_index->number_of_allocated_timestamps = timestamp_index->number_of_timestamps;
+	}
+	if( timestamp_index->number_of_allocated_runs > timestamp_index->number_of_runs )
+	{
+		runs_reallocation = (int *) memory_reallocate(
+		                             timestamp_index->runs,
+		                             sizeof( int ) * timestamp_index->number_of_runs );
+
+		if( runs_reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize runs.",
+			 function );
+
+			return( -1 );
+		}
+		timestamp_index->runs                     = runs_reallocation;
+		timestamp_index->number_of_allocated_runs = timestamp_index->number_of_runs;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of runs of non-decreasing timestamps
+ * Returns 1 if successful or -1 on error
+ */
+int libevt_timestamp_index_get_number_of_runs(
+     libevt_timestamp_index_t *timestamp_index,
+     int *number_of_runs,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_timestamp_index_get_number_of_runs";
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_runs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of runs.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_runs = timestamp_index->number_of_runs;
+
+	return( 1 );
+}
+
+/* Determines the index of the first timestamp in a run that is not smaller than a specific timestamp
+ * Returns the index or the end index of the run if all timestamps are smaller
+ */
+static int libevt_timestamp_index_search_run(
+            const uint32_t *timestamps,
+            int start_index,
+            int end_index,
+            uint32_t timestamp )
+{
+	int middle_index = 0;
+
+	while( start_index < end_index )
+	{
+		middle_index = start_index + ( ( end_index - start_index ) / 2 );
+
+		if( timestamps[ middle_index ] < timestamp )
+		{
+			start_index = middle_index + 1;
+		}
+		else
+		{
+			end_index = middle_index;
+		}
+	}
+	return( start_index );
+}
+
+/* Retrieves the range of indexes of the timestamps within a specific time range
+ * The start and end timestamps are inclusive
+ * Every run of non-decreasing timestamps is searched with a binary search, if the
+ * timestamps consist of multiple runs the range can contain timestamps outside
+ * the time range
+ * Returns 1 if successful, 0 if no timestamp is within the time range or -1 on error
+ */
+int libevt_timestamp_index_get_index_range(
+     libevt_timestamp_index_t *timestamp_index,
+     uint32_t start_timestamp,
+     uint32_t end_timestamp,
+     int *first_index,
+     int *last_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libevt_timestamp_index_get_index_range";
+	int range_end_index   = 0;
+	int range_start_index = 0;
+	int result            = 0;
+	int run_end_index     = 0;
+	int run_index         = 0;
+	int run_start_index   = 0;
+	int safe_first_index  = 0;
+	int safe_last_index   = 0;
+
+	if( timestamp_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid timestamp index.",
+		 function );
+
+		return( -1 );
+	}
+	if( start_timestamp > end_timestamp )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid start timestamp value exceeds end timestamp.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first index.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last index.",
+		 function );
+
+		return( -1 );
+	}
+	for( run_index = 0;
+	     run_index < timestamp_index->number_of_runs;
+	     run_index++ )
+	{
+		run_start_index = timestamp_index->runs[ run_index ];
+
+		if( ( run_index + 1 ) < timestamp_index->number_of_runs )
+		{
+			run_end_index = timestamp_index->runs[ run_index + 1 ];
+		}
+		else
+		{
+			run_end_index = timestamp_index->number_of_timestamps;
+		}
+		range_start_index = libevt_timestamp_index_search_run(
+		                     timestamp_index->timestamps,
+		                     run_start_index,
+		                     run_end_index,
+		                     start_timestamp );
+
+		if( end_timestamp == (uint32_t) UINT32_MAX )
+		{
+			range_end_index = run_end_index;
+		}
+		else
+		{
+			range_end_index = libevt_timestamp_index_search_run(
+			                   timestamp_index->timestamps,
+			                   range_start_index,
+			                   run_end_index,
+			                   end_timestamp + 1 );
+		}
+		if( range_start_index >= range_end_index )
+		{
+			continue;
+		}
+		if( ( result == 0 )
+		 || ( range_start_index < safe_first_index ) )
+		{
+			safe_first_index = range_start_index;
+		}
+		if( ( result == 0 )
+		 || ( ( range_end_index - 1 ) > safe_last_index ) )
+		{
+			safe_last_index = range_end_index - 1;
+		}
+		result = 1;
+	}
+	if( result != 0 )
+	{
+		*first_index = safe_first_index;
+		*last_index  = safe_last_index;
+	}
+	return( result );
+}
+
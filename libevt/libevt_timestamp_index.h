@@ -0,0 +1,103 @@
+/*
+ * Timestamp index functions
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBEVT_TIMESTAMP_INDEX_H )
+#define _LIBEVT_TIMESTAMP_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libevt_timestamp_index libevt_timestamp_index_t;
+
+struct libevt_timestamp_index
+{
+	/* The timestamps, one per record
+	 */
+	uint32_t *timestamps;
+
+	/* The number of timestamps
+	 */
+	int number_of_timestamps;
+
+	/* The number of allocated timestamps
+	 */
+	int number_of_allocated_timestamps;
+
+	/* The index of the first timestamp of each run of non-decreasing timestamps
+	 */
+	int *runs;
+
+	/* The number of runs
+	 */
+	int number_of_runs;
+
+	/* The number of allocated runs
+	 */
+	int number_of_allocated_runs;
+};
+
+int libevt_timestamp_index_initialize(
+     libevt_timestamp_index_t **timestamp_index,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_free(
+     libevt_timestamp_index_t **timestamp_index,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_empty(
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_append_timestamp(
+     libevt_timestamp_index_t *timestamp_index,
+     int record_index,
+     uint32_t timestamp,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_finalize(
+     libevt_timestamp_index_t *timestamp_index,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_get_number_of_runs(
+     libevt_timestamp_index_t *timestamp_index,
+     int *number_of_runs,
+     libcerror_error_t **error );
+
+int libevt_timestamp_index_get_index_range(
+     libevt_timestamp_index_t *timestamp_index,
+     uint32_t start_timestamp,
+     uint32_t end_timestamp,
+     int *first_index,
+     int *last_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBEVT_TIMESTAMP_INDEX_H ) */
+
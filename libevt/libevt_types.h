@@ -34,12 +34,20 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libevt_carver {}	libevt_carver_t;
 typedef struct libevt_file {}	libevt_file_t;
+typedef struct libevt_filter {}	libevt_filter_t;
+typedef struct libevt_multi_file {}	libevt_multi_file_t;
 typedef struct libevt_record {}	libevt_record_t;
+typedef struct libevt_record_iterator {}	libevt_record_iterator_t;
 
 #else
+typedef intptr_t libevt_carver_t;
 typedef intptr_t libevt_file_t;
+typedef intptr_t libevt_filter_t;
+typedef intptr_t libevt_multi_file_t;
 typedef intptr_t libevt_record_t;
+typedef intptr_t libevt_record_iterator_t;
 
 #endif /* defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI ) */
 
@@ -36,6 +36,7 @@
 #include "pyevt_libbfio.h"
 #include "pyevt_libcerror.h"
 #include "pyevt_libevt.h"
+#include "pyevt_multi_file.h"
 #include "pyevt_python.h"
 #include "pyevt_record.h"
 #include "pyevt_records.h"
@@ -658,6 +659,23 @@ PyMODINIT_FUNC initpyevt(
 	 "file_flags",
 	 (PyObject *) &pyevt_file_flags_type_object );
 
+	/* Setup the multi_file type object
+	 */
+	pyevt_multi_file_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyevt_multi_file_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyevt_multi_file_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "multi_file",
+	 (PyObject *) &pyevt_multi_file_type_object );
+
 	/* Setup the record type object
 	 */
 	pyevt_record_type_object.tp_new = PyType_GenericNew;
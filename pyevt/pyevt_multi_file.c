@@ -0,0 +1,579 @@
+/*
+ * Python object wrapper of libevt_multi_file_t
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyevt_error.h"
+#include "pyevt_file.h"
+#include "pyevt_libcerror.h"
+#include "pyevt_libevt.h"
+#include "pyevt_multi_file.h"
+#include "pyevt_python.h"
+#include "pyevt_unused.h"
+
+PyMethodDef pyevt_multi_file_object_methods[] = {
+
+	{ "append_file",
+	  (PyCFunction) pyevt_multi_file_append_file,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "append_file(file) -> Integer\n"
+	  "\n"
+	  "Appends an opened file and returns its index." },
+
+	{ "get_number_of_files",
+	  (PyCFunction) pyevt_multi_file_get_number_of_files,
+	  METH_NOARGS,
+	  "get_number_of_files() -> Integer\n"
+	  "\n"
+	  "Retrieves the number of files." },
+
+	{ "get_next_record",
+	  (PyCFunction) pyevt_multi_file_get_next_record,
+	  METH_NOARGS,
+	  "get_next_record() -> Object or None\n"
+	  "\n"
+	  "Retrieves the next record of the files in order of last written time." },
+
+	/* Sentinel */
+	{ NULL, NULL, 0, NULL }
+};
+
+PyGetSetDef pyevt_multi_file_object_get_set_definitions[] = {
+
+	{ "number_of_files",
+	  (getter) pyevt_multi_file_get_number_of_files,
+	  (setter) 0,
+	  "The number of files.",
+	  NULL },
+
+	/* Sentinel */
+	{ NULL, NULL, NULL, NULL, NULL }
+};
+
+PyTypeObject pyevt_multi_file_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyevt.multi_file",
+	/* tp_basicsize */
+	sizeof( pyevt_multi_file_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyevt_multi_file_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyevt multi file object (wraps libevt_multi_file_t)",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyevt_multi_file_iter,
+	/* tp_iternext */
+	(iternextfunc) pyevt_multi_file_iternext,
+	/* tp_methods */
+	pyevt_multi_file_object_methods,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	pyevt_multi_file_object_get_set_definitions,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyevt_multi_file_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Initializes a multi file object
+ * Returns 0 if successful or -1 on error
+ */
+int pyevt_multi_file_init(
+     pyevt_multi_file_t *pyevt_multi_file )
+{
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevt_multi_file_init";
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure libevt multi file is set to NULL
+	 */
+	pyevt_multi_file->multi_file   = NULL;
+	pyevt_multi_file->file_objects = NULL;
+
+	if( libevt_multi_file_initialize(
+	     &( pyevt_multi_file->multi_file ),
+	     &error ) != 1 )
+	{
+		pyevt_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to initialize multi file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( -1 );
+	}
+	pyevt_multi_file->file_objects = PyList_New(
+	                                  0 );
+
+	if( pyevt_multi_file->file_objects == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create file objects list.",
+		 function );
+
+		libevt_multi_file_free(
+		 &( pyevt_multi_file->multi_file ),
+		 NULL );
+
+		return( -1 );
+	}
+	return( 0 );
+}
+
+/* Frees a multi file object
+ */
+void pyevt_multi_file_free(
+      pyevt_multi_file_t *pyevt_multi_file )
+{
+	struct _typeobject *ob_type = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevt_multi_file_free";
+	int result                  = 0;
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyevt_multi_file );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	/* The multi file is freed before the file objects it references
+	 */
+	if( pyevt_multi_file->multi_file != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		result = libevt_multi_file_free(
+		          &( pyevt_multi_file->multi_file ),
+		          &error );
+
+		Py_END_ALLOW_THREADS
+
+		if( result != 1 )
+		{
+			pyevt_error_raise(
+			 error,
+			 PyExc_MemoryError,
+			 "%s: unable to free libevt multi file.",
+			 function );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	if( pyevt_multi_file->file_objects != NULL )
+	{
+		Py_DecRef(
+		 pyevt_multi_file->file_objects );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyevt_multi_file );
+}
+
+/* Appends a file
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevt_multi_file_append_file(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *file_object       = NULL;
+	PyObject *integer_object    = NULL;
+	libcerror_error_t *error    = NULL;
+	static char *function       = "pyevt_multi_file_append_file";
+	static char *keyword_list[] = { "file", NULL };
+	int file_index              = 0;
+	int result                  = 0;
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "O",
+	     keyword_list,
+	     &file_object ) == 0 )
+	{
+		return( NULL );
+	}
+	PyErr_Clear();
+
+	result = PyObject_IsInstance(
+	          file_object,
+	          (PyObject *) &pyevt_file_type_object );
+
+	if( result == -1 )
+	{
+		pyevt_error_fetch_and_raise(
+		 PyExc_RuntimeError,
+		 "%s: unable to determine if object is of type file.",
+		 function );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: unsupported object type.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevt_multi_file_append_file(
+	          pyevt_multi_file->multi_file,
+	          ( (pyevt_file_t *) file_object )->file,
+	          &file_index,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to append file.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	/* The file object is referenced so that the file remains open
+	 * while it is used by the multi file
+	 */
+	if( PyList_Append(
+	     pyevt_multi_file->file_objects,
+	     file_object ) != 0 )
+	{
+		pyevt_error_fetch_and_raise(
+		 PyExc_MemoryError,
+		 "%s: unable to append file object.",
+		 function );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) file_index );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) file_index );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves the number of files
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyevt_multi_file_get_number_of_files(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments PYEVT_ATTRIBUTE_UNUSED )
+{
+	PyObject *integer_object = NULL;
+	libcerror_error_t *error = NULL;
+	static char *function    = "pyevt_multi_file_get_number_of_files";
+	int number_of_files      = 0;
+	int result               = 0;
+
+	PYEVT_UNREFERENCED_PARAMETER( arguments )
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevt_multi_file_get_number_of_files(
+	          pyevt_multi_file->multi_file,
+	          &number_of_files,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyevt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of files.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+#if PY_MAJOR_VERSION >= 3
+	integer_object = PyLong_FromLong(
+	                  (long) number_of_files );
+#else
+	integer_object = PyInt_FromLong(
+	                  (long) number_of_files );
+#endif
+	return( integer_object );
+}
+
+/* Retrieves the next record
+ * Returns a Python object if successful, None if no more records are available or NULL on error
+ */
+PyObject *pyevt_multi_file_get_next_record(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments PYEVT_ATTRIBUTE_UNUSED )
+{
+	PyObject *record_object = NULL;
+
+	PYEVT_UNREFERENCED_PARAMETER( arguments )
+
+	record_object = pyevt_multi_file_iternext(
+	                 pyevt_multi_file );
+
+	if( ( record_object == NULL )
+	 && ( PyErr_Occurred() == NULL ) )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	return( record_object );
+}
+
+/* The multi file iter() function
+ */
+PyObject *pyevt_multi_file_iter(
+           pyevt_multi_file_t *pyevt_multi_file )
+{
+	static char *function = "pyevt_multi_file_iter";
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyevt_multi_file );
+
+	return( (PyObject *) pyevt_multi_file );
+}
+
+/* The multi file iternext() function
+ * The record of the multi file is only valid until the next record is retrieved
+ * hence the record is retrieved again by index from its file
+ */
+PyObject *pyevt_multi_file_iternext(
+           pyevt_multi_file_t *pyevt_multi_file )
+{
+	PyObject *file_object    = NULL;
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	static char *function    = "pyevt_multi_file_iternext";
+	int file_index           = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	if( pyevt_multi_file == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid multi file.",
+		 function );
+
+		return( NULL );
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libevt_multi_file_get_next_record(
+	          pyevt_multi_file->multi_file,
+	          &file_index,
+	          &record_index,
+	          &record,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result == -1 )
+	{
+		pyevt_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve next record.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		return( NULL );
+	}
+	else if( result == 0 )
+	{
+		return( NULL );
+	}
+	file_object = PyList_GetItem(
+	               pyevt_multi_file->file_objects,
+	               (Py_ssize_t) file_index );
+
+	if( file_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_IOError,
+		 "%s: missing file object: %d.",
+		 function,
+		 file_index );
+
+		return( NULL );
+	}
+	return( pyevt_file_get_record_by_index(
+	         file_object,
+	         record_index ) );
+}
+
@@ -0,0 +1,85 @@
+/*
+ * Python object wrapper of libevt_multi_file_t
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYEVT_MULTI_FILE_H )
+#define _PYEVT_MULTI_FILE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyevt_libevt.h"
+#include "pyevt_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyevt_multi_file pyevt_multi_file_t;
+
+struct pyevt_multi_file
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The libevt multi file
+	 */
+	libevt_multi_file_t *multi_file;
+
+	/* The list of file objects that are referenced by the multi file
+	 */
+	PyObject *file_objects;
+};
+
+extern PyMethodDef pyevt_multi_file_object_methods[];
+extern PyTypeObject pyevt_multi_file_type_object;
+
+int pyevt_multi_file_init(
+     pyevt_multi_file_t *pyevt_multi_file );
+
+void pyevt_multi_file_free(
+      pyevt_multi_file_t *pyevt_multi_file );
+
+PyObject *pyevt_multi_file_append_file(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyevt_multi_file_get_number_of_files(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments );
+
+PyObject *pyevt_multi_file_get_next_record(
+           pyevt_multi_file_t *pyevt_multi_file,
+           PyObject *arguments );
+
+PyObject *pyevt_multi_file_iter(
+           pyevt_multi_file_t *pyevt_multi_file );
+
+PyObject *pyevt_multi_file_iternext(
+           pyevt_multi_file_t *pyevt_multi_file );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYEVT_MULTI_FILE_H ) */
+
@@ -0,0 +1,987 @@
+/*
+ * Library carver type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_functions.h"
+#include "evt_test_libbfio.h"
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+/* The size of the scan data, which is larger than the 1 MiB scan block of the carver
+ */
+#define EVT_TEST_CARVER_DATA_SIZE		( ( 1024 * 1024 ) + 4096 )
+
+/* The offset of the record of which the size is not a multitude of 4
+ */
+#define EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET	4096
+
+/* The offset of the record that crosses the first scan block boundary
+ */
+#define EVT_TEST_CARVER_BOUNDARY_RECORD_OFFSET	( ( 1024 * 1024 ) - 32 )
+
+#define EVT_TEST_CARVER_MAXIMUM_NUMBER_OF_RECORDS	8
+
+uint8_t evt_test_carver_record_data1[ 68 ] = {
+	0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00 };
+
+typedef struct evt_test_carver_scan_values evt_test_carver_scan_values_t;
+
+struct evt_test_carver_scan_values
+{
+	/* The offsets of the records that were found
+	 */
+	off64_t record_offsets[ EVT_TEST_CARVER_MAXIMUM_NUMBER_OF_RECORDS ];
+
+	/* The identifiers of the records that were found
+	 */
+	uint32_t record_identifiers[ EVT_TEST_CARVER_MAXIMUM_NUMBER_OF_RECORDS ];
+
+	/* The number of records that were found
+	 */
+	int number_of_records;
+
+	/* The number of records after which the callback stops the scan
+	 */
+	int stop_after_number_of_records;
+
+	/* Value to indicate the callback should fail
+	 */
+	int fail;
+};
+
+/* Writes a record with a specific identifier into the scan data
+ */
+void evt_test_carver_write_record(
+      uint8_t *data,
+      size_t record_offset,
+      uint32_t record_identifier )
+{
+	memory_copy(
+	 &( data[ record_offset ] ),
+	 evt_test_carver_record_data1,
+	 68 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ record_offset + 8 ] ),
+	 record_identifier );
+}
+
+/* Creates the scan data
+ * Returns the scan data or NULL on error
+ */
+uint8_t *evt_test_carver_create_data(
+          void )
+{
+	uint8_t *data = NULL;
+
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * EVT_TEST_CARVER_DATA_SIZE );
+
+	if( data == NULL )
+	{
+		return( NULL );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     EVT_TEST_CARVER_DATA_SIZE ) == NULL )
+	{
+		memory_free(
+		 data );
+
+		return( NULL );
+	}
+	/* A record at an aligned offset
+	 */
+	evt_test_carver_write_record(
+	 data,
+	 64,
+	 1 );
+
+	/* A signature candidate with a record size that is too small
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 1024 ] ),
+	 0x00000010UL );
+
+	memory_copy(
+	 &( data[ 1028 ] ),
+	 "LfLe",
+	 4 );
+
+	/* A signature candidate with a record size that exceeds the data
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 1536 ] ),
+	 0x7fffff00UL );
+
+	memory_copy(
+	 &( data[ 1540 ] ),
+	 "LfLe",
+	 4 );
+
+	/* A record with a corrupt copy of the record size
+	 */
+	evt_test_carver_write_record(
+	 data,
+	 2048,
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ 2048 + 64 ] ),
+	 0x00000048UL );
+
+	/* A record of which the size is not a multitude of 4 followed by
+	 * a record at the next 32-bit aligned offset
+	 */
+	evt_test_carver_write_record(
+	 data,
+	 EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET,
+	 4 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET ] ),
+	 0x00000046UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET + 64 ] ),
+	 0x00000000UL );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( data[ EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET + 66 ] ),
+	 0x00000046UL );
+
+	evt_test_carver_write_record(
+	 data,
+	 EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET + 72,
+	 5 );
+
+	/* A record that crosses the boundary of the first scan block
+	 */
+	evt_test_carver_write_record(
+	 data,
+	 EVT_TEST_CARVER_BOUNDARY_RECORD_OFFSET,
+	 3 );
+
+	return( data );
+}
+
+/* Record callback for the scan tests
+ * Returns 1 to continue, 0 to stop or -1 on error
+ */
+int evt_test_carver_record_callback(
+     libevt_record_t *record,
+     off64_t record_offset,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	evt_test_carver_scan_values_t *scan_values = NULL;
+	static char *function                      = "evt_test_carver_record_callback";
+	uint32_t record_identifier                 = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	scan_values = (evt_test_carver_scan_values_t *) callback_data;
+
+	if( scan_values->fail != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: callback failed.",
+		 function );
+
+		return( -1 );
+	}
+	if( scan_values->number_of_records >= EVT_TEST_CARVER_MAXIMUM_NUMBER_OF_RECORDS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: too many records.",
+		 function );
+
+		return( -1 );
+	}
+	if( libevt_record_get_identifier(
+	     record,
+	     &record_identifier,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record identifier.",
+		 function );
+
+		return( -1 );
+	}
+	scan_values->record_offsets[ scan_values->number_of_records ]     = record_offset;
+	scan_values->record_identifiers[ scan_values->number_of_records ] = record_identifier;
+
+	scan_values->number_of_records += 1;
+
+	if( ( scan_values->stop_after_number_of_records > 0 )
+	 && ( scan_values->number_of_records >= scan_values->stop_after_number_of_records ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Tests the libevt_carver_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_carver_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_carver_t *carver         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 2;
+	int number_of_memset_fail_tests = 2;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_carver_initialize(
+	          &carver,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_carver_free(
+	          &carver,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_carver_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	carver = (libevt_carver_t *) 0x12345678UL;
+
+	result = libevt_carver_initialize(
+	          &carver,
+	          &error );
+
+	carver = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_carver_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libevt_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_carver_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_carver_initialize(
+		          &carver,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( carver != NULL )
+			{
+				libevt_carver_free(
+				 &carver,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "carver",
+			 carver );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libevt_carver_free(
+		 &carver,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_carver_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_carver_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_carver_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_carver_scan_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_carver_scan_file_io_handle(
+     void )
+{
+	evt_test_carver_scan_values_t scan_values;
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_carver_t *carver          = NULL;
+	uint8_t *data                    = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	data = evt_test_carver_create_data();
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          EVT_TEST_CARVER_DATA_SIZE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_carver_initialize(
+	          &carver,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "carver",
+	 carver );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test scan of the entire data
+	 * The aligned record, the record of which the size is not a multitude of 4,
+	 * the record that follows it and the record that crosses the scan block
+	 * boundary are found, the corrupt candidates are skipped
+	 */
+	memory_set(
+	 &scan_values,
+	 0,
+	 sizeof( evt_test_carver_scan_values_t ) );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "scan_values.number_of_records",
+	 scan_values.number_of_records,
+	 4 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 0 ]",
+	 (int64_t) scan_values.record_offsets[ 0 ],
+	 (int64_t) 64 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "scan_values.record_identifiers[ 0 ]",
+	 scan_values.record_identifiers[ 0 ],
+	 (uint32_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 1 ]",
+	 (int64_t) scan_values.record_offsets[ 1 ],
+	 (int64_t) EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "scan_values.record_identifiers[ 1 ]",
+	 scan_values.record_identifiers[ 1 ],
+	 (uint32_t) 4 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 2 ]",
+	 (int64_t) scan_values.record_offsets[ 2 ],
+	 (int64_t) EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET + 72 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "scan_values.record_identifiers[ 2 ]",
+	 scan_values.record_identifiers[ 2 ],
+	 (uint32_t) 5 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 3 ]",
+	 (int64_t) scan_values.record_offsets[ 3 ],
+	 (int64_t) EVT_TEST_CARVER_BOUNDARY_RECORD_OFFSET );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "scan_values.record_identifiers[ 3 ]",
+	 scan_values.record_identifiers[ 3 ],
+	 (uint32_t) 3 );
+
+	/* Test scan of a range that starts after the aligned record
+	 */
+	memory_set(
+	 &scan_values,
+	 0,
+	 sizeof( evt_test_carver_scan_values_t ) );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          128,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "scan_values.number_of_records",
+	 scan_values.number_of_records,
+	 3 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 0 ]",
+	 (int64_t) scan_values.record_offsets[ 0 ],
+	 (int64_t) EVT_TEST_CARVER_UNALIGNED_RECORD_OFFSET );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 2 ]",
+	 (int64_t) scan_values.record_offsets[ 2 ],
+	 (int64_t) EVT_TEST_CARVER_BOUNDARY_RECORD_OFFSET );
+
+	/* Test scan of a range that ends before the end of the record that crosses
+	 * the scan block boundary
+	 */
+	memory_set(
+	 &scan_values,
+	 0,
+	 sizeof( evt_test_carver_scan_values_t ) );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          (size64_t) EVT_TEST_CARVER_BOUNDARY_RECORD_OFFSET + 64,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "scan_values.number_of_records",
+	 scan_values.number_of_records,
+	 3 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 0 ]",
+	 (int64_t) scan_values.record_offsets[ 0 ],
+	 (int64_t) 64 );
+
+	/* Test scan that is stopped by the callback
+	 */
+	memory_set(
+	 &scan_values,
+	 0,
+	 sizeof( evt_test_carver_scan_values_t ) );
+
+	scan_values.stop_after_number_of_records = 1;
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "scan_values.number_of_records",
+	 scan_values.number_of_records,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "scan_values.record_offsets[ 0 ]",
+	 (int64_t) scan_values.record_offsets[ 0 ],
+	 (int64_t) 64 );
+
+	/* Test error cases
+	 */
+	result = libevt_carver_scan_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          NULL,
+	          0,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          -1,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          (off64_t) EVT_TEST_CARVER_DATA_SIZE + 4,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          0,
+	          NULL,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test scan with a callback that fails
+	 */
+	memory_set(
+	 &scan_values,
+	 0,
+	 sizeof( evt_test_carver_scan_values_t ) );
+
+	scan_values.fail = 1;
+
+	result = libevt_carver_scan_file_io_handle(
+	          carver,
+	          file_io_handle,
+	          0,
+	          0,
+	          &evt_test_carver_record_callback,
+	          &scan_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_carver_free(
+	          &carver,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "carver",
+	 carver );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( carver != NULL )
+	{
+		libevt_carver_free(
+		 &carver,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "libevt_carver_initialize",
+	 evt_test_carver_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_carver_free",
+	 evt_test_carver_free );
+
+	EVT_TEST_RUN(
+	 "libevt_carver_scan_file_io_handle",
+	 evt_test_carver_scan_file_io_handle );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
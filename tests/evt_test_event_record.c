@@ -322,12 +322,26 @@ int evt_test_event_record_read_data(
 
 	/* Test regular cases
 	 */
+#if defined( HAVE_EVT_TEST_MEMORY )
+	/* Reading the record should allocate only the record data copy
+	 * and the strings array, the other values reference the record data
+	 */
+	evt_test_malloc_attempts_before_fail = 2;
+#endif
 	result = libevt_event_record_read_data(
 	          event_record,
 	          evt_test_event_record_data1,
 	          144,
 	          &error );
 
+#if defined( HAVE_EVT_TEST_MEMORY )
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "evt_test_malloc_attempts_before_fail",
+	 evt_test_malloc_attempts_before_fail,
+	 0 );
+
+	evt_test_malloc_attempts_before_fail = -1;
+#endif
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -30,6 +32,10 @@
 #include <stdlib.h>
 #endif
 
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #include "evt_test_functions.h"
 #include "evt_test_getopt.h"
 #include "evt_test_libbfio.h"
@@ -61,10 +67,470 @@ int libevt_file_open_file_io_handle(
 #error Unsupported size of wchar_t
 #endif
 
+/* A minimal event log with records 5 and 6 followed by the end-of-file record
+ */
+uint8_t evt_test_file_data1[ 224 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0xb8, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3a, 0x09, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x05, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x10, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x06, 0x00, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00,
+	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00,
+	0x70, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+	0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00,
+	0xb8, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x05, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
+/* Writes data at a specific offset of the event log data, wrapping the data
+ * that does not fit at the end to the start of the records area
+ */
+void evt_test_file_write_wrapped_data(
+     uint8_t *file_data,
+     size_t file_data_size,
+     size_t file_offset,
+     const uint8_t *data,
+     size_t data_size )
+{
+	size_t data_offset = 0;
+
+	for( data_offset = 0;
+	     data_offset < data_size;
+	     data_offset++ )
+	{
+		if( file_offset >= file_data_size )
+		{
+			file_offset = 48;
+		}
+		file_data[ file_offset++ ] = data[ data_offset ];
+	}
+}
+
+/* Writes an event record at a specific offset of the event log data
+ * The written time of the record is the record number multiplied by 0x1000
+ */
+void evt_test_file_write_event_record(
+     uint8_t *file_data,
+     size_t file_data_size,
+     size_t file_offset,
+     uint32_t record_number )
+{
+	uint8_t record_data[ 68 ];
+
+	memory_copy(
+	 record_data,
+	 &( evt_test_file_data1[ 48 ] ),
+	 68 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 8 ] ),
+	 record_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 12 ] ),
+	 record_number * 0x1000 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( record_data[ 16 ] ),
+	 record_number * 0x1000 );
+
+	evt_test_file_write_wrapped_data(
+	 file_data,
+	 file_data_size,
+	 file_offset,
+	 record_data,
+	 68 );
+}
+
+/* Writes the file header and the end-of-file record of the event log data
+ */
+void evt_test_file_write_end_of_file(
+     uint8_t *file_data,
+     size_t file_data_size,
+     uint32_t first_record_offset,
+     uint32_t end_of_file_record_offset,
+     uint32_t first_record_number,
+     uint32_t last_record_number,
+     uint32_t file_flags )
+{
+	uint8_t end_of_file_record_data[ 40 ];
+
+	memory_copy(
+	 file_data,
+	 evt_test_file_data1,
+	 48 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 16 ] ),
+	 first_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 20 ] ),
+	 end_of_file_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 24 ] ),
+	 last_record_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 28 ] ),
+	 first_record_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 32 ] ),
+	 (uint32_t) file_data_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 36 ] ),
+	 file_flags );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( file_data[ 40 ] ),
+	 0 );
+
+	memory_copy(
+	 end_of_file_record_data,
+	 &( evt_test_file_data1[ 184 ] ),
+	 40 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_file_record_data[ 20 ] ),
+	 first_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_file_record_data[ 24 ] ),
+	 end_of_file_record_offset );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_file_record_data[ 28 ] ),
+	 last_record_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( end_of_file_record_data[ 32 ] ),
+	 first_record_number );
+
+	evt_test_file_write_wrapped_data(
+	 file_data,
+	 file_data_size,
+	 (size_t) end_of_file_record_offset,
+	 end_of_file_record_data,
+	 40 );
+}
+
+/* Checks the records of a file against the expected record numbers and offsets
+ * using the records table, the record number index and the timestamp index
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_check_records(
+     libevt_file_t *file,
+     const uint32_t *record_numbers,
+     const off64_t *record_offsets,
+     int expected_number_of_records,
+     int expected_number_of_recovered_records )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	off64_t record_offset    = 0;
+	uint32_t record_number   = 0;
+	uint32_t written_time    = 0;
+	int first_record_index   = 0;
+	int last_record_index    = 0;
+	int number_of_records    = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 expected_number_of_records );
+
+	result = libevt_file_get_number_of_recovered_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_recovered_records",
+	 number_of_records,
+	 expected_number_of_recovered_records );
+
+	for( record_index = 0;
+	     record_index < expected_number_of_records;
+	     record_index++ )
+	{
+		/* Check the records table
+		 */
+		result = libevt_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) record_offsets[ record_index ] );
+
+		result = libevt_record_get_identifier(
+		          record,
+		          &record_number,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "record_number",
+		 record_number,
+		 record_numbers[ record_index ] );
+
+		result = libevt_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "written_time",
+		 written_time,
+		 record_numbers[ record_index ] * 0x1000 );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Check the record number index
+		 */
+		result = libevt_file_get_record_by_record_number(
+		          file,
+		          record_numbers[ record_index ],
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) record_offsets[ record_index ] );
+
+		result = libevt_record_free(
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Check the timestamp index
+		 */
+		result = libevt_file_get_record_index_range_by_time(
+		          file,
+		          record_numbers[ record_index ] * 0x1000,
+		          record_numbers[ record_index ] * 0x1000,
+		          &first_record_index,
+		          &last_record_index,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "first_record_index",
+		 first_record_index,
+		 record_index );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "last_record_index",
+		 last_record_index,
+		 record_index );
+	}
+	/* Records that are no longer part of the event log cannot be retrieved
+	 */
+	result = libevt_file_get_record_by_record_number(
+	          file,
+	          record_numbers[ 0 ] - 1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Define to make evt_test_file generate verbose output
 #define EVT_TEST_FILE_VERBOSE
  */
 
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+
+#define EVT_TEST_FILE_NUMBER_OF_ITERATIONS	4
+#define EVT_TEST_FILE_NUMBER_OF_THREADS		8
+
+typedef struct evt_test_file_thread_data evt_test_file_thread_data_t;
+
+struct evt_test_file_thread_data
+{
+	/* The file
+	 */
+	libevt_file_t *file;
+
+	/* The expected record offsets
+	 */
+	off64_t *record_offsets;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* The index of the first record retrieved by the thread
+	 */
+	int first_record_index;
+
+	/* The result of the thread
+	 */
+	int result;
+};
+
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
 /* Creates and opens a source file
  * Returns 1 if successful or -1 on error
  */
@@ -598,15 +1064,13 @@ on_error:
 	return( 0 );
 }
 
-#if defined( HAVE_WIDE_CHARACTER_TYPE )
-
-/* Tests the libevt_file_open_wide function
+/* Tests the libevt_file_open_mapped function
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_open_wide(
+int evt_test_file_open_mapped(
      const system_character_t *source )
 {
-	wchar_t wide_source[ 256 ];
+	char narrow_source[ 256 ];
 
 	libcerror_error_t *error = NULL;
 	libevt_file_t *file      = NULL;
@@ -614,9 +1078,9 @@ int evt_test_file_open_wide(
 
 	/* Initialize test
 	 */
-	result = evt_test_get_wide_source(
+	result = evt_test_get_narrow_source(
 	          source,
-	          wide_source,
+	          narrow_source,
 	          256,
 	          &error );
 
@@ -648,9 +1112,9 @@ int evt_test_file_open_wide(
 
 	/* Test open
 	 */
-	result = libevt_file_open_wide(
+	result = libevt_file_open_mapped(
 	          file,
-	          wide_source,
+	          narrow_source,
 	          LIBEVT_OPEN_READ,
 	          &error );
 
@@ -665,9 +1129,9 @@ int evt_test_file_open_wide(
 
 	/* Test error cases
 	 */
-	result = libevt_file_open_wide(
+	result = libevt_file_open_mapped(
 	          NULL,
-	          wide_source,
+	          narrow_source,
 	          LIBEVT_OPEN_READ,
 	          &error );
 
@@ -683,7 +1147,7 @@ int evt_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libevt_file_open_wide(
+	result = libevt_file_open_mapped(
 	          file,
 	          NULL,
 	          LIBEVT_OPEN_READ,
@@ -701,9 +1165,9 @@ int evt_test_file_open_wide(
 	libcerror_error_free(
 	 &error );
 
-	result = libevt_file_open_wide(
+	result = libevt_file_open_mapped(
 	          file,
-	          wide_source,
+	          narrow_source,
 	          -1,
 	          &error );
 
@@ -721,7 +1185,184 @@ int evt_test_file_open_wide(
 
 	/* Test open when already opened
 	 */
-	result = libevt_file_open_wide(
+	result = libevt_file_open_mapped(
+	          file,
+	          narrow_source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libevt_file_open_wide function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_open_wide(
+     const system_character_t *source )
+{
+	wchar_t wide_source[ 256 ];
+
+	libcerror_error_t *error = NULL;
+	libevt_file_t *file      = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_get_wide_source(
+	          source,
+	          wide_source,
+	          256,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test open
+	 */
+	result = libevt_file_open_wide(
+	          file,
+	          wide_source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_open_wide(
+	          NULL,
+	          wide_source,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_open_wide(
+	          file,
+	          NULL,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_open_wide(
+	          file,
+	          wide_source,
+	          -1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test open when already opened
+	 */
+	result = libevt_file_open_wide(
 	          file,
 	          wide_source,
 	          LIBEVT_OPEN_READ,
@@ -1234,40 +1875,69 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevt_file_get_ascii_codepage function
+/* Tests the libevt_file_refresh function
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_get_ascii_codepage(
+int evt_test_file_refresh(
      libevt_file_t *file )
 {
-	libcerror_error_t *error  = NULL;
-	int ascii_codepage        = 0;
-	int ascii_codepage_is_set = 0;
-	int result                = 0;
+	libcerror_error_t *error        = NULL;
+	int number_of_records           = 0;
+	int refreshed_number_of_records = 0;
+	int result                      = 0;
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
-	result = libevt_file_get_ascii_codepage(
+	result = libevt_file_refresh(
 	          file,
-	          &ascii_codepage,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	ascii_codepage_is_set = result;
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &refreshed_number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "refreshed_number_of_records",
+	 refreshed_number_of_records,
+	 number_of_records );
 
 	/* Test error cases
 	 */
-	result = libevt_file_get_ascii_codepage(
+	result = libevt_file_refresh(
 	          NULL,
-	          &ascii_codepage,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1282,25 +1952,6 @@ int evt_test_file_get_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	if( ascii_codepage_is_set != 0 )
-	{
-		result = libevt_file_get_ascii_codepage(
-		          file,
-		          NULL,
-		          &error );
-
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
-
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
-
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1312,64 +1963,2484 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libevt_file_set_ascii_codepage function
+/* Tests the libevt_file_refresh function on an event log that grows and wraps
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_set_ascii_codepage(
-     libevt_file_t *file )
+int evt_test_file_refresh_append_and_wrap(
+     void )
 {
-	int supported_codepages[ 15 ] = {
-		LIBEVT_CODEPAGE_ASCII,
-		LIBEVT_CODEPAGE_WINDOWS_874,
-		LIBEVT_CODEPAGE_WINDOWS_932,
-		LIBEVT_CODEPAGE_WINDOWS_936,
-		LIBEVT_CODEPAGE_WINDOWS_949,
-		LIBEVT_CODEPAGE_WINDOWS_950,
-		LIBEVT_CODEPAGE_WINDOWS_1250,
-		LIBEVT_CODEPAGE_WINDOWS_1251,
-		LIBEVT_CODEPAGE_WINDOWS_1252,
-		LIBEVT_CODEPAGE_WINDOWS_1253,
+	uint8_t file_data[ 352 ];
+
+	uint32_t expected_record_numbers[ 3 ];
+	off64_t expected_record_offsets[ 3 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_file_t *file              = NULL;
+	void *memset_result              = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 * Records 5 and 6 followed by the end-of-file record and a stale record 3
+	 */
+	memset_result = memory_set(
+	                 file_data,
+	                 0,
+	                 352 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x108,
+	 3 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x30,
+	 5 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x74,
+	 6 );
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0x30,
+	 0xb8,
+	 5,
+	 7,
+	 0 );
+
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          352,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_record_numbers[ 0 ] = 5;
+	expected_record_numbers[ 1 ] = 6;
+	expected_record_offsets[ 0 ] = 0x30;
+	expected_record_offsets[ 1 ] = 0x74;
+
+	result = evt_test_file_check_records(
+	          file,
+	          expected_record_numbers,
+	          expected_record_offsets,
+	          2,
+	          1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test refresh after a record 7 with a mismatching copy of the record size
+	 * was appended, the previously read records are retained
+	 */
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0xb8,
+	 7 );
+
+	file_data[ 0xb8 + 64 ] = 0xff;
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0x30,
+	 0xfc,
+	 5,
+	 8,
+	 0 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = evt_test_file_check_records(
+	          file,
+	          expected_record_numbers,
+	          expected_record_offsets,
+	          2,
+	          1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test refresh after record 7 was appended, the new end-of-file record
+	 * overwrites the stale record 3
+	 */
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0xb8,
+	 7 );
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0x30,
+	 0xfc,
+	 5,
+	 8,
+	 0 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_record_numbers[ 2 ] = 7;
+	expected_record_offsets[ 2 ] = 0xb8;
+
+	result = evt_test_file_check_records(
+	          file,
+	          expected_record_numbers,
+	          expected_record_offsets,
+	          3,
+	          0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test refresh after records 8 and 9 were appended, record 9 wraps
+	 * and together with the new end-of-file record overwrites records 5 and 6
+	 */
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0xfc,
+	 8 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x140,
+	 9 );
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0xb8,
+	 0x54,
+	 7,
+	 10,
+	 LIBEVT_FILE_FLAG_HAS_WRAPPED );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_record_numbers[ 0 ] = 7;
+	expected_record_numbers[ 1 ] = 8;
+	expected_record_numbers[ 2 ] = 9;
+	expected_record_offsets[ 0 ] = 0xb8;
+	expected_record_offsets[ 1 ] = 0xfc;
+	expected_record_offsets[ 2 ] = 0x140;
+
+	result = evt_test_file_check_records(
+	          file,
+	          expected_record_numbers,
+	          expected_record_offsets,
+	          3,
+	          0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = evt_test_file_close_source(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_refresh function on an event log that was cleared
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_refresh_cleared(
+     void )
+{
+	uint8_t file_data[ 352 ];
+
+	uint32_t expected_record_numbers[ 2 ];
+	off64_t expected_record_offsets[ 2 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_file_t *file              = NULL;
+	void *memset_result              = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 * Records 5 and 6 followed by the end-of-file record and a stale record 3
+	 */
+	memset_result = memory_set(
+	                 file_data,
+	                 0,
+	                 352 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x108,
+	 3 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x30,
+	 5 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x74,
+	 6 );
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0x30,
+	 0xb8,
+	 5,
+	 7,
+	 0 );
+
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          file_data,
+	          352,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test refresh after the event log was cleared and records 1 and 2 were written,
+	 * the lower first record number causes all records to be read again
+	 */
+	memset_result = memory_set(
+	                 file_data,
+	                 0,
+	                 352 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memset_result",
+	 memset_result );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x30,
+	 1 );
+
+	evt_test_file_write_event_record(
+	 file_data,
+	 352,
+	 0x74,
+	 2 );
+
+	evt_test_file_write_end_of_file(
+	 file_data,
+	 352,
+	 0x30,
+	 0xb8,
+	 1,
+	 3,
+	 0 );
+
+	result = libevt_file_refresh(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	expected_record_numbers[ 0 ] = 1;
+	expected_record_numbers[ 1 ] = 2;
+	expected_record_offsets[ 0 ] = 0x30;
+	expected_record_offsets[ 1 ] = 0x74;
+
+	result = evt_test_file_check_records(
+	          file,
+	          expected_record_numbers,
+	          expected_record_offsets,
+	          2,
+	          0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = evt_test_file_close_source(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_ascii_codepage(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	int ascii_codepage        = 0;
+	int ascii_codepage_is_set = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_ascii_codepage(
+	          file,
+	          &ascii_codepage,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ascii_codepage_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_ascii_codepage(
+	          NULL,
+	          &ascii_codepage,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( ascii_codepage_is_set != 0 )
+	{
+		result = libevt_file_get_ascii_codepage(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_ascii_codepage function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_ascii_codepage(
+     libevt_file_t *file )
+{
+	int supported_codepages[ 15 ] = {
+		LIBEVT_CODEPAGE_ASCII,
+		LIBEVT_CODEPAGE_WINDOWS_874,
+		LIBEVT_CODEPAGE_WINDOWS_932,
+		LIBEVT_CODEPAGE_WINDOWS_936,
+		LIBEVT_CODEPAGE_WINDOWS_949,
+		LIBEVT_CODEPAGE_WINDOWS_950,
+		LIBEVT_CODEPAGE_WINDOWS_1250,
+		LIBEVT_CODEPAGE_WINDOWS_1251,
+		LIBEVT_CODEPAGE_WINDOWS_1252,
+		LIBEVT_CODEPAGE_WINDOWS_1253,
 		LIBEVT_CODEPAGE_WINDOWS_1254,
 		LIBEVT_CODEPAGE_WINDOWS_1255,
 		LIBEVT_CODEPAGE_WINDOWS_1256,
 		LIBEVT_CODEPAGE_WINDOWS_1257,
 		LIBEVT_CODEPAGE_WINDOWS_1258 };
 
-	int unsupported_codepages[ 17 ] = {
-		LIBEVT_CODEPAGE_ISO_8859_1,
-		LIBEVT_CODEPAGE_ISO_8859_2,
-		LIBEVT_CODEPAGE_ISO_8859_3,
-		LIBEVT_CODEPAGE_ISO_8859_4,
-		LIBEVT_CODEPAGE_ISO_8859_5,
-		LIBEVT_CODEPAGE_ISO_8859_6,
-		LIBEVT_CODEPAGE_ISO_8859_7,
-		LIBEVT_CODEPAGE_ISO_8859_8,
-		LIBEVT_CODEPAGE_ISO_8859_9,
-		LIBEVT_CODEPAGE_ISO_8859_10,
-		LIBEVT_CODEPAGE_ISO_8859_11,
-		LIBEVT_CODEPAGE_ISO_8859_13,
-		LIBEVT_CODEPAGE_ISO_8859_14,
-		LIBEVT_CODEPAGE_ISO_8859_15,
-		LIBEVT_CODEPAGE_ISO_8859_16,
-		LIBEVT_CODEPAGE_KOI8_R,
-		LIBEVT_CODEPAGE_KOI8_U };
+	int unsupported_codepages[ 17 ] = {
+		LIBEVT_CODEPAGE_ISO_8859_1,
+		LIBEVT_CODEPAGE_ISO_8859_2,
+		LIBEVT_CODEPAGE_ISO_8859_3,
+		LIBEVT_CODEPAGE_ISO_8859_4,
+		LIBEVT_CODEPAGE_ISO_8859_5,
+		LIBEVT_CODEPAGE_ISO_8859_6,
+		LIBEVT_CODEPAGE_ISO_8859_7,
+		LIBEVT_CODEPAGE_ISO_8859_8,
+		LIBEVT_CODEPAGE_ISO_8859_9,
+		LIBEVT_CODEPAGE_ISO_8859_10,
+		LIBEVT_CODEPAGE_ISO_8859_11,
+		LIBEVT_CODEPAGE_ISO_8859_13,
+		LIBEVT_CODEPAGE_ISO_8859_14,
+		LIBEVT_CODEPAGE_ISO_8859_15,
+		LIBEVT_CODEPAGE_ISO_8859_16,
+		LIBEVT_CODEPAGE_KOI8_R,
+		LIBEVT_CODEPAGE_KOI8_U };
+
+	libcerror_error_t *error = NULL;
+	int codepage             = 0;
+	int index                = 0;
+	int result               = 0;
+
+	/* Test set ASCII codepage
+	 */
+	for( index = 0;
+	     index < 15;
+	     index++ )
+	{
+		codepage = supported_codepages[ index ];
+
+		result = libevt_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_file_set_ascii_codepage(
+	          NULL,
+	          LIBEVT_CODEPAGE_ASCII,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( index = 0;
+	     index < 17;
+	     index++ )
+	{
+		codepage = unsupported_codepages[ index ];
+
+		result = libevt_file_set_ascii_codepage(
+		          file,
+		          codepage,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	/* Clean up
+	 */
+	result = libevt_file_set_ascii_codepage(
+	          file,
+	          LIBEVT_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_maximum_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_maximum_number_of_threads(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error      = NULL;
+	int maximum_number_of_threads = 0;
+	int result                    = 0;
+
+	/* Test set maximum number of threads
+	 */
+	result = libevt_file_set_maximum_number_of_threads(
+	          file,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_maximum_number_of_threads(
+	          file,
+	          &maximum_number_of_threads,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_threads",
+	 maximum_number_of_threads,
+	 4 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_maximum_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_maximum_number_of_threads(
+	          file,
+	          -1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_maximum_number_of_threads(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_set_maximum_number_of_threads(
+	          file,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_records_cache_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_records_cache_size(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error      = NULL;
+	size64_t maximum_size         = 0;
+	int maximum_number_of_entries = 0;
+	int result                    = 0;
+
+	/* Test set records cache size
+	 */
+	result = libevt_file_set_records_cache_size(
+	          file,
+	          64,
+	          (size64_t) 1048576,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_records_cache_size(
+	          file,
+	          &maximum_number_of_entries,
+	          &maximum_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "maximum_number_of_entries",
+	 maximum_number_of_entries,
+	 64 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "maximum_size",
+	 (uint64_t) maximum_size,
+	 (uint64_t) 1048576 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_records_cache_size(
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_set_records_cache_size(
+	          file,
+	          0,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_cache_size(
+	          file,
+	          NULL,
+	          &maximum_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_cache_size(
+	          file,
+	          &maximum_number_of_entries,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_set_records_cache_size(
+	          file,
+	          256,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_set_records_cache_pin_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_set_records_cache_pin_size(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	size64_t pin_size        = 0;
+	int result               = 0;
+
+	/* Test set records cache pin size
+	 */
+	result = libevt_file_set_records_cache_pin_size(
+	          file,
+	          (size64_t) 16777216,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_records_cache_pin_size(
+	          file,
+	          &pin_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "pin_size",
+	 (uint64_t) pin_size,
+	 (uint64_t) 16777216 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_set_records_cache_pin_size(
+	          NULL,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_cache_pin_size(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_set_records_cache_pin_size(
+	          file,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_records_cache_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_records_cache_statistics(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error  = NULL;
+	uint64_t number_of_hits   = 0;
+	uint64_t number_of_misses = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_records_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_records_cache_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_cache_statistics(
+	          file,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_cache_statistics(
+	          file,
+	          &number_of_hits,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_first_record_number function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_first_record_number(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	uint32_t first_record_number = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_first_record_number(
+	          file,
+	          &first_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_first_record_number(
+	          NULL,
+	          &first_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_first_record_number(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_last_record_number function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_last_record_number(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error    = NULL;
+	uint32_t last_record_number = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_last_record_number(
+	          file,
+	          &last_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_last_record_number(
+	          NULL,
+	          &last_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_last_record_number(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_maximum_file_size function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_maximum_file_size(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error   = NULL;
+	uint32_t maximum_file_size = 0;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_maximum_file_size(
+	          file,
+	          &maximum_file_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_maximum_file_size(
+	          NULL,
+	          &maximum_file_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_maximum_file_size(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_retention function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_retention(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t retention       = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_retention(
+	          file,
+	          &retention,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_retention(
+	          NULL,
+	          &retention,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_retention(
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the values returned by the libevt_file_get_first_record_number, libevt_file_get_last_record_number,
+ * libevt_file_get_maximum_file_size and libevt_file_get_retention functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_file_header_values(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libevt_file_t *file              = NULL;
+	uint32_t first_record_number     = 0;
+	uint32_t last_record_number      = 0;
+	uint32_t maximum_file_size       = 0;
+	uint32_t retention               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_file_data1,
+	          224,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_file_open_source(
+	          &file,
+	          file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_first_record_number(
+	          file,
+	          &first_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "first_record_number",
+	 first_record_number,
+	 (uint32_t) 5 );
+
+	result = libevt_file_get_last_record_number(
+	          file,
+	          &last_record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "last_record_number",
+	 last_record_number,
+	 (uint32_t) 7 );
+
+	result = libevt_file_get_maximum_file_size(
+	          file,
+	          &maximum_file_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "maximum_file_size",
+	 maximum_file_size,
+	 (uint32_t) 0x00010000UL );
+
+	result = libevt_file_get_retention(
+	          file,
+	          &retention,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "retention",
+	 retention,
+	 (uint32_t) 0x00093a80UL );
+
+	/* Clean up
+	 */
+	result = evt_test_file_close_source(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_flags(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t flags           = 0;
+	int flags_is_set         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_flags(
+	          file,
+	          &flags,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	flags_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_flags(
+	          NULL,
+	          &flags,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( flags_is_set != 0 )
+	{
+		result = libevt_file_get_flags(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_number_of_records(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error     = NULL;
+	int number_of_records        = 0;
+	int number_of_records_is_set = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_records_is_set = result;
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	if( number_of_records_is_set != 0 )
+	{
+		result = libevt_file_get_number_of_records(
+		          file,
+		          NULL,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_record_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_by_index(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_by_index(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_index(
+	          file,
+	          -1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_record_by_record_number function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_by_record_number(
+     libevt_file_t *file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = 0;
+	uint32_t identifier      = 0;
+	uint32_t record_number   = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	result = libevt_file_get_record_by_index(
+	          file,
+	          number_of_records - 1,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &record_number,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_by_record_number(
+	          file,
+	          record_number,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record",
+	 record );
+
+	result = libevt_record_get_identifier(
+	          record,
+	          &identifier,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "identifier",
+	 identifier,
+	 record_number );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_by_record_number(
+	          NULL,
+	          record_number,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_by_record_number(
+	          file,
+	          record_number,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
 
+/* Tests the libevt_file_get_record_index_range_by_time function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_record_index_range_by_time(
+     libevt_file_t *file )
+{
 	libcerror_error_t *error = NULL;
-	int codepage             = 0;
-	int index                = 0;
+	libevt_record_t *record  = 0;
+	uint32_t written_time    = 0;
+	int first_record_index   = 0;
+	int last_record_index    = 0;
+	int number_of_records    = 0;
 	int result               = 0;
 
-	/* Test set ASCII codepage
-	 */
-	for( index = 0;
-	     index < 15;
-	     index++ )
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	result = libevt_file_get_record_by_index(
+	          file,
+	          0,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_get_written_time(
+	          record,
+	          &written_time,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_free(
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_file_get_record_index_range_by_time(
+	          file,
+	          written_time,
+	          written_time,
+	          &first_record_index,
+	          &last_record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_record_index",
+	 first_record_index,
+	 0 );
+
+	EVT_TEST_ASSERT_LESS_THAN_INT(
+	 "last_record_index",
+	 last_record_index,
+	 number_of_records );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_record_index_range_by_time(
+	          file,
+	          0,
+	          0xffffffffUL,
+	          &first_record_index,
+	          &last_record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_record_index",
+	 first_record_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_record_index",
+	 last_record_index,
+	 number_of_records - 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_file_get_record_index_range_by_time(
+	          NULL,
+	          0,
+	          0xffffffffUL,
+	          &first_record_index,
+	          &last_record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_record_index_range_by_time(
+	          file,
+	          0,
+	          0xffffffffUL,
+	          NULL,
+	          &last_record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_file_get_records_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_file_get_records_range(
+     libevt_file_t *file )
+{
+	libevt_record_t *records[ 2 ] = { NULL, NULL };
+
+	libcerror_error_t *error      = NULL;
+	off64_t record_offset         = 0;
+	int array_index               = 0;
+	int number_of_records         = 0;
+	int number_of_range_records   = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	number_of_range_records = number_of_records;
+
+	if( number_of_range_records > 2 )
+	{
+		number_of_range_records = 2;
+	}
+	/* Test regular cases
+	 */
+	result = libevt_file_get_records_range(
+	          file,
+	          0,
+	          number_of_range_records,
+	          records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( array_index = 0;
+	     array_index < number_of_range_records;
+	     array_index++ )
 	{
-		codepage = supported_codepages[ index ];
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "records[ array_index ]",
+		 records[ array_index ] );
 
-		result = libevt_file_set_ascii_codepage(
-		          file,
-		          codepage,
+		result = libevt_record_get_offset(
+		          records[ array_index ],
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &( records[ array_index ] ),
 		          &error );
 
 		EVT_TEST_ASSERT_EQUAL_INT(
@@ -1383,9 +4454,11 @@ int evt_test_file_set_ascii_codepage(
 	}
 	/* Test error cases
 	 */
-	result = libevt_file_set_ascii_codepage(
+	result = libevt_file_get_records_range(
 	          NULL,
-	          LIBEVT_CODEPAGE_ASCII,
+	          0,
+	          1,
+	          records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1393,6 +4466,10 @@ int evt_test_file_set_ascii_codepage(
 	 result,
 	 -1 );
 
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
 	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
@@ -1400,45 +4477,98 @@ int evt_test_file_set_ascii_codepage(
 	libcerror_error_free(
 	 &error );
 
-	for( index = 0;
-	     index < 17;
-	     index++ )
-	{
-		codepage = unsupported_codepages[ index ];
+	result = libevt_file_get_records_range(
+	          file,
+	          -1,
+	          1,
+	          records,
+	          &error );
 
-		result = libevt_file_set_ascii_codepage(
-		          file,
-		          codepage,
-		          &error );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	/* Clean up
-	 */
-	result = libevt_file_set_ascii_codepage(
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_range(
 	          file,
-	          LIBEVT_CODEPAGE_WINDOWS_1252,
+	          0,
+	          -1,
+	          records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_range(
+	          file,
+	          0,
+	          number_of_records + 1,
+	          records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_file_get_records_range(
+	          file,
+	          0,
+	          1,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	return( 1 );
 
 on_error:
@@ -1447,25 +4577,41 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( array_index = 0;
+	     array_index < 2;
+	     array_index++ )
+	{
+		if( records[ array_index ] != NULL )
+		{
+			libevt_record_free(
+			 &( records[ array_index ] ),
+			 NULL );
+		}
+	}
 	return( 0 );
 }
 
-/* Tests the libevt_file_get_flags function
+/* Tests the libevt_record_iterator_get_next_record function
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_get_flags(
+int evt_test_file_record_iterator(
      libevt_file_t *file )
 {
-	libcerror_error_t *error = NULL;
-	uint32_t flags           = 0;
-	int flags_is_set         = 0;
-	int result               = 0;
+	libcerror_error_t *error                  = NULL;
+	libevt_record_iterator_t *record_iterator = NULL;
+	libevt_record_t *indexed_record           = NULL;
+	libevt_record_t *record                   = NULL;
+	off64_t indexed_record_offset             = 0;
+	off64_t record_offset                     = 0;
+	int number_of_records                     = 0;
+	int record_index                          = 0;
+	int result                                = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libevt_file_get_flags(
+	result = libevt_file_get_number_of_records(
 	          file,
-	          &flags,
+	          &number_of_records,
 	          &error );
 
 	EVT_TEST_ASSERT_NOT_EQUAL_INT(
@@ -1477,91 +4623,128 @@ int evt_test_file_get_flags(
 	 "error",
 	 error );
 
-	flags_is_set = result;
-
-	/* Test error cases
-	 */
-	result = libevt_file_get_flags(
-	          NULL,
-	          &flags,
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	if( flags_is_set != 0 )
+	/* Test regular cases
+	 */
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
 	{
-		result = libevt_file_get_flags(
-		          file,
-		          NULL,
+		result = libevt_record_iterator_get_next_record(
+		          record_iterator,
+		          &record,
 		          &error );
 
 		EVT_TEST_ASSERT_EQUAL_INT(
 		 "result",
 		 result,
-		 -1 );
+		 1 );
 
 		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
 		 "error",
 		 error );
 
-		libcerror_error_free(
-		 &error );
-	}
-	return( 1 );
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
 
-/* Tests the libevt_file_get_number_of_records function
- * Returns 1 if successful or 0 if not
- */
-int evt_test_file_get_number_of_records(
-     libevt_file_t *file )
-{
-	libcerror_error_t *error     = NULL;
-	int number_of_records        = 0;
-	int number_of_records_is_set = 0;
-	int result                   = 0;
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
 
-	/* Test regular cases
-	 */
-	result = libevt_file_get_number_of_records(
-	          file,
-	          &number_of_records,
+		result = libevt_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &indexed_record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          indexed_record,
+		          &indexed_record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &indexed_record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) indexed_record_offset );
+	}
+	result = libevt_record_iterator_get_next_record(
+	          record_iterator,
+	          &record,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	number_of_records_is_set = result;
-
 	/* Test error cases
 	 */
-	result = libevt_file_get_number_of_records(
+	result = libevt_record_iterator_get_next_record(
 	          NULL,
-	          &number_of_records,
+	          &record,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1576,25 +4759,42 @@ int evt_test_file_get_number_of_records(
 	libcerror_error_free(
 	 &error );
 
-	if( number_of_records_is_set != 0 )
-	{
-		result = libevt_file_get_number_of_records(
-		          file,
-		          NULL,
-		          &error );
+	result = libevt_record_iterator_get_next_record(
+	          record_iterator,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-		EVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 -1 );
+	/* Clean up
+	 */
+	result = libevt_record_iterator_free(
+	          &record_iterator,
+	          &error );
 
-		EVT_TEST_ASSERT_IS_NOT_NULL(
-		 "error",
-		 error );
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-		libcerror_error_free(
-		 &error );
-	}
 	return( 1 );
 
 on_error:
@@ -1603,63 +4803,143 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	if( indexed_record != NULL )
+	{
+		libevt_record_free(
+		 &indexed_record,
+		 NULL );
+	}
+	if( record_iterator != NULL )
+	{
+		libevt_record_iterator_free(
+		 &record_iterator,
+		 NULL );
+	}
 	return( 0 );
 }
 
-/* Tests the libevt_file_get_record_by_index function
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+
+/* Tests the libevt_file_get_record_by_index function from a single thread
+ * Returns NULL
+ */
+void *evt_test_file_get_record_by_index_thread(
+       void *arguments )
+{
+	evt_test_file_thread_data_t *thread_data = NULL;
+	libevt_record_t *record                  = NULL;
+	off64_t record_offset                    = 0;
+	int iteration                            = 0;
+	int record_index                         = 0;
+	int record_iterator                      = 0;
+
+	thread_data = (evt_test_file_thread_data_t *) arguments;
+
+	thread_data->result = 1;
+
+	for( iteration = 0;
+	     iteration < EVT_TEST_FILE_NUMBER_OF_ITERATIONS;
+	     iteration++ )
+	{
+		for( record_iterator = 0;
+		     record_iterator < thread_data->number_of_records;
+		     record_iterator++ )
+		{
+			/* Each thread starts at a different record so that cache hits
+			 * and misses are interleaved between the threads
+			 */
+			record_index = ( thread_data->first_record_index + record_iterator ) % thread_data->number_of_records;
+
+			if( libevt_file_get_record_by_index(
+			     thread_data->file,
+			     record_index,
+			     &record,
+			     NULL ) != 1 )
+			{
+				thread_data->result = 0;
+
+				return( NULL );
+			}
+			if( libevt_record_get_offset(
+			     record,
+			     &record_offset,
+			     NULL ) != 1 )
+			{
+				thread_data->result = 0;
+			}
+			else if( record_offset != thread_data->record_offsets[ record_index ] )
+			{
+				thread_data->result = 0;
+			}
+			if( libevt_record_free(
+			     &record,
+			     NULL ) != 1 )
+			{
+				thread_data->result = 0;
+			}
+			if( thread_data->result != 1 )
+			{
+				return( NULL );
+			}
+		}
+	}
+	return( NULL );
+}
+
+/* Tests the libevt_file_get_record_by_index function with multiple threads
  * Returns 1 if successful or 0 if not
  */
-int evt_test_file_get_record_by_index(
-     libevt_file_t *file )
+int evt_test_file_get_record_by_index_threaded(
+     libbfio_handle_t *file_io_handle )
 {
+	evt_test_file_thread_data_t thread_data[ EVT_TEST_FILE_NUMBER_OF_THREADS ];
+	pthread_t threads[ EVT_TEST_FILE_NUMBER_OF_THREADS ];
+
 	libcerror_error_t *error = NULL;
-	libevt_record_t *record  = 0;
+	libevt_file_t *file      = NULL;
+	libevt_record_t *record  = NULL;
+	off64_t *record_offsets  = NULL;
 	int number_of_records    = 0;
+	int number_of_threads    = 0;
+	int record_index         = 0;
 	int result               = 0;
+	int thread_index         = 0;
 
 	/* Initialize test
 	 */
-	result = libevt_file_get_number_of_records(
-	          file,
-	          &number_of_records,
+	result = libevt_file_initialize(
+	          &file,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( number_of_records == 0 )
-	{
-		return( 1 );
-	}
-	/* Test regular cases
+	/* The file IO handle is cloned for every thread when the file is opened
 	 */
-	result = libevt_file_get_record_by_index(
+	result = libevt_file_set_maximum_number_of_threads(
 	          file,
-	          0,
-	          &record,
+	          EVT_TEST_FILE_NUMBER_OF_THREADS,
 	          &error );
 
-	EVT_TEST_ASSERT_NOT_EQUAL_INT(
+	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
-	 "record",
-	 record );
-
-	result = libevt_record_free(
-	          &record,
+	result = libevt_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
@@ -1671,74 +4951,155 @@ int evt_test_file_get_record_by_index(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libevt_file_get_record_by_index(
-	          NULL,
-	          0,
-	          &record,
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
-	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	if( number_of_records > 0 )
+	{
+		record_offsets = (off64_t *) memory_allocate(
+		                              sizeof( off64_t ) * number_of_records );
 
-	result = libevt_file_get_record_by_index(
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record_offsets",
+		 record_offsets );
+
+		for( record_index = 0;
+		     record_index < number_of_records;
+		     record_index++ )
+		{
+			result = libevt_file_get_record_by_index(
+			          file,
+			          record_index,
+			          &record,
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevt_record_get_offset(
+			          record,
+			          &( record_offsets[ record_index ] ),
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			result = libevt_record_free(
+			          &record,
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		/* Test regular cases
+		 */
+		for( thread_index = 0;
+		     thread_index < EVT_TEST_FILE_NUMBER_OF_THREADS;
+		     thread_index++ )
+		{
+			thread_data[ thread_index ].file               = file;
+			thread_data[ thread_index ].record_offsets     = record_offsets;
+			thread_data[ thread_index ].number_of_records  = number_of_records;
+			thread_data[ thread_index ].first_record_index = ( thread_index * number_of_records ) / EVT_TEST_FILE_NUMBER_OF_THREADS;
+			thread_data[ thread_index ].result             = 0;
+
+			result = pthread_create(
+			          &( threads[ thread_index ] ),
+			          NULL,
+			          &evt_test_file_get_record_by_index_thread,
+			          (void *) &( thread_data[ thread_index ] ) );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			number_of_threads++;
+		}
+		while( number_of_threads > 0 )
+		{
+			number_of_threads--;
+
+			result = pthread_join(
+			          threads[ number_of_threads ],
+			          NULL );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 0 );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "thread_data.result",
+			 thread_data[ number_of_threads ].result,
+			 1 );
+		}
+		memory_free(
+		 record_offsets );
+
+		record_offsets = NULL;
+	}
+	/* Clean up
+	 */
+	result = libevt_file_close(
 	          file,
-	          -1,
-	          &record,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 0 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
-
-	EVT_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
-	result = libevt_file_get_record_by_index(
-	          file,
-	          0,
-	          NULL,
+	result = libevt_file_free(
+	          &file,
 	          &error );
 
 	EVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
 	EVT_TEST_ASSERT_IS_NULL(
-	 "record",
-	 record );
+	 "file",
+	 file );
 
-	EVT_TEST_ASSERT_IS_NOT_NULL(
+	EVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
-
 	return( 1 );
 
 on_error:
@@ -1747,9 +5108,36 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	while( number_of_threads > 0 )
+	{
+		number_of_threads--;
+
+		pthread_join(
+		 threads[ number_of_threads ],
+		 NULL );
+	}
+	if( record != NULL )
+	{
+		libevt_record_free(
+		 &record,
+		 NULL );
+	}
+	if( record_offsets != NULL )
+	{
+		memory_free(
+		 record_offsets );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
 	return( 0 );
 }
 
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
 /* Tests the libevt_file_get_number_of_recovered_records function
  * Returns 1 if successful or 0 if not
  */
@@ -2029,6 +5417,18 @@ int main(
 	 "libevt_file_free",
 	 evt_test_file_free );
 
+	EVT_TEST_RUN(
+	 "libevt_file_get_file_header_values",
+	 evt_test_file_get_file_header_values );
+
+	EVT_TEST_RUN(
+	 "libevt_file_refresh_append_and_wrap",
+	 evt_test_file_refresh_append_and_wrap );
+
+	EVT_TEST_RUN(
+	 "libevt_file_refresh_cleared",
+	 evt_test_file_refresh_cleared );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
 	{
@@ -2103,6 +5503,11 @@ int main(
 
 #endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_open_mapped",
+		 evt_test_file_open_mapped,
+		 source );
+
 		EVT_TEST_RUN_WITH_ARGS(
 		 "libevt_file_open_file_io_handle",
 		 evt_test_file_open_file_io_handle,
@@ -2142,6 +5547,11 @@ int main(
 		 evt_test_file_signal_abort,
 		 file );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_refresh",
+		 evt_test_file_refresh,
+		 file );
+
 #if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
 
 		/* TODO: add tests for libevt_file_open_read */
@@ -2160,10 +5570,50 @@ int main(
 		 evt_test_file_set_ascii_codepage,
 		 file );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_set_maximum_number_of_threads",
+		 evt_test_file_set_maximum_number_of_threads,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_set_records_cache_size",
+		 evt_test_file_set_records_cache_size,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_set_records_cache_pin_size",
+		 evt_test_file_set_records_cache_pin_size,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_records_cache_statistics",
+		 evt_test_file_get_records_cache_statistics,
+		 file );
+
 		/* TODO: add tests for libevt_file_get_format_version */
 
 		/* TODO: add tests for libevt_file_get_version */
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_first_record_number",
+		 evt_test_file_get_first_record_number,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_last_record_number",
+		 evt_test_file_get_last_record_number,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_maximum_file_size",
+		 evt_test_file_get_maximum_file_size,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_retention",
+		 evt_test_file_get_retention,
+		 file );
+
 		EVT_TEST_RUN_WITH_ARGS(
 		 "libevt_file_get_flags",
 		 evt_test_file_get_flags,
@@ -2179,6 +5629,35 @@ int main(
 		 evt_test_file_get_record_by_index,
 		 file );
 
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_record_by_record_number",
+		 evt_test_file_get_record_by_record_number,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_record_index_range_by_time",
+		 evt_test_file_get_record_index_range_by_time,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_records_range",
+		 evt_test_file_get_records_range,
+		 file );
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_record_iterator_get_next_record",
+		 evt_test_file_record_iterator,
+		 file );
+
+#if defined( HAVE_PTHREAD ) && !defined( WINAPI )
+
+		EVT_TEST_RUN_WITH_ARGS(
+		 "libevt_file_get_record_by_index_threaded",
+		 evt_test_file_get_record_by_index_threaded,
+		 file_io_handle );
+
+#endif /* defined( HAVE_PTHREAD ) && !defined( WINAPI ) */
+
 		EVT_TEST_RUN_WITH_ARGS(
 		 "libevt_file_get_number_of_recovered_records",
 		 evt_test_file_get_number_of_recovered_records,
@@ -324,6 +324,61 @@ int evt_test_file_header_read_data(
 	 "error",
 	 error );
 
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->size",
+	 file_header->size,
+	 (uint32_t) 0x00000030UL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->major_format_version",
+	 file_header->major_format_version,
+	 (uint32_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->minor_format_version",
+	 file_header->minor_format_version,
+	 (uint32_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->first_record_offset",
+	 file_header->first_record_offset,
+	 (uint32_t) 0x00000030UL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->end_of_file_record_offset",
+	 file_header->end_of_file_record_offset,
+	 (uint32_t) 0x000ae538UL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->last_record_number",
+	 file_header->last_record_number,
+	 (uint32_t) 0x00000f1bUL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->first_record_number",
+	 file_header->first_record_number,
+	 (uint32_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->maximum_file_size",
+	 file_header->maximum_file_size,
+	 (uint32_t) 0x000b0000UL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->file_flags",
+	 file_header->file_flags,
+	 (uint32_t) 0x00000009UL );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->retention",
+	 file_header->retention,
+	 (uint32_t) 0 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "file_header->copy_of_size",
+	 file_header->copy_of_size,
+	 (uint32_t) 0x00000030UL );
+
 	/* Test error cases
 	 */
 	result = libevt_file_header_read_data(
@@ -0,0 +1,1054 @@
+/*
+ * Library filter type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_filter.h"
+
+uint8_t evt_test_filter_record_data1[ 68 ] = {
+	0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x20, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00 };
+
+/* Tests the libevt_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_filter_t *filter         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	filter = (libevt_filter_t *) 0x12345678UL;
+
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	filter = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_filter_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libevt_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_filter_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_filter_initialize(
+		          &filter,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( filter != NULL )
+			{
+				libevt_filter_free(
+				 &filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "filter",
+			 filter );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_filter_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_set_time_range function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_set_time_range(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_filter_t *filter  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_set_time_range(
+	          filter,
+	          0x1000,
+	          0x2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_set_time_range(
+	          NULL,
+	          0x1000,
+	          0x2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          0x2000,
+	          0x1000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_filter_append_event_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_append_event_identifier(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_filter_t *filter  = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          30,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          10,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          20,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* An event identifier that was already appended is ignored
+	 */
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          10,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_event_identifiers",
+	 ( (libevt_internal_filter_t *) filter )->number_of_event_identifiers,
+	 3 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifiers[ 0 ]",
+	 ( (libevt_internal_filter_t *) filter )->event_identifiers[ 0 ],
+	 10 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifiers[ 1 ]",
+	 ( (libevt_internal_filter_t *) filter )->event_identifiers[ 1 ],
+	 20 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "event_identifiers[ 2 ]",
+	 ( (libevt_internal_filter_t *) filter )->event_identifiers[ 2 ],
+	 30 );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_append_event_identifier(
+	          NULL,
+	          10,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_filter_match_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_filter_match_record_data(
+     void )
+{
+	uint16_t source_name1[ 3 ] = { 'A', 'p', 'p' };
+	uint16_t source_name2[ 2 ] = { 'A', 'p' };
+	libcerror_error_t *error   = NULL;
+	libevt_filter_t *filter    = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_filter_initialize(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the event types
+	 */
+	result = libevt_filter_set_event_types(
+	          filter,
+	          LIBEVT_EVENT_TYPE_ERROR,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_event_types(
+	          filter,
+	          LIBEVT_EVENT_TYPE_ERROR | LIBEVT_EVENT_TYPE_WARNING,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the time range
+	 */
+	result = libevt_filter_set_time_range(
+	          filter,
+	          0x2001,
+	          0x3000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_time_range(
+	          filter,
+	          0x1000,
+	          0x2000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the event identifiers
+	 */
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          0x40000002UL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_append_event_identifier(
+	          filter,
+	          0x40000001UL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the event categories
+	 */
+	result = libevt_filter_append_event_category(
+	          filter,
+	          4,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_append_event_category(
+	          filter,
+	          3,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test the source name, a prefix of the source name does not match
+	 */
+	result = libevt_filter_set_utf16_source_name(
+	          filter,
+	          source_name2,
+	          2,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_set_utf16_source_name(
+	          filter,
+	          source_name1,
+	          3,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_filter_match_record_data(
+	          NULL,
+	          evt_test_filter_record_data1,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          NULL,
+	          68,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_filter_match_record_data(
+	          (libevt_internal_filter_t *) filter,
+	          evt_test_filter_record_data1,
+	          20,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_filter_free(
+	          &filter,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "filter",
+	 filter );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( filter != NULL )
+	{
+		libevt_filter_free(
+		 &filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "libevt_filter_initialize",
+	 evt_test_filter_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_free",
+	 evt_test_filter_free );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_set_time_range",
+	 evt_test_filter_set_time_range );
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_filter_append_event_identifier",
+	 evt_test_filter_append_event_identifier );
+
+	EVT_TEST_RUN(
+	 "libevt_filter_match_record_data",
+	 evt_test_filter_match_record_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
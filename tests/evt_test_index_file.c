@@ -0,0 +1,766 @@
+/*
+ * Library index_file type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_functions.h"
+#include "evt_test_libbfio.h"
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_index_file.h"
+#include "../libevt/libevt_offset_table.h"
+#include "../libevt/libevt_record_number_index.h"
+#include "../libevt/libevt_timestamp_index.h"
+
+uint8_t evt_test_index_file_evt_data1[ 88 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33,
+	0x44, 0x44, 0x44, 0x44, 0x30, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_index_file_write_file_io_handle and libevt_index_file_read_file_io_handle functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_index_file_write_and_read_file_io_handle(
+     void )
+{
+	uint8_t index_data[ 256 ];
+
+	libbfio_handle_t *file_io_handle                  = NULL;
+	libbfio_handle_t *index_file_io_handle            = NULL;
+	libcerror_error_t *error                          = NULL;
+	libevt_offset_table_t *recovered_records_table    = NULL;
+	libevt_offset_table_t *records_table              = NULL;
+	libevt_record_number_index_t *record_number_index = NULL;
+	libevt_timestamp_index_t *timestamp_index         = NULL;
+	off64_t record_offset                             = 0;
+	size64_t record_size                              = 0;
+	uint8_t io_handle_flags                           = 0;
+	int entry_index                                   = 0;
+	int record_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_offset_table_initialize(
+	          &records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_initialize(
+	          &recovered_records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_initialize(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_initialize(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_append_entry(
+	          records_table,
+	          &entry_index,
+	          48,
+	          40,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_append_record_number(
+	          record_number_index,
+	          entry_index,
+	          7,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_append_timestamp(
+	          timestamp_index,
+	          entry_index,
+	          0x5e0be100UL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_append_entry(
+	          recovered_records_table,
+	          &entry_index,
+	          56,
+	          32,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_index_file_evt_data1,
+	          88,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          index_file_io_handle,
+	          index_data,
+	          256,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          index_file_io_handle,
+	          LIBBFIO_OPEN_WRITE,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_index_file_write_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          0x01,
+	          records_table,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_free(
+	          &index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The index file consists of the header, 1 record entry and 1 recovered record entry
+	 */
+	result = evt_test_open_file_io_handle(
+	          &index_file_io_handle,
+	          index_data,
+	          120 + 16 + 8,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_empty(
+	          records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_offset_table_empty(
+	          recovered_records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_number_index_empty(
+	          record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_timestamp_index_empty(
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_index_file_read_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          records_table,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &io_handle_flags,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "io_handle_flags",
+	 io_handle_flags,
+	 0x01 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "records_table->number_of_entries",
+	 records_table->number_of_entries,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "recovered_records_table->number_of_entries",
+	 recovered_records_table->number_of_entries,
+	 1 );
+
+	result = libevt_offset_table_get_entry_by_index(
+	          records_table,
+	          0,
+	          &record_offset,
+	          &record_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "record_offset",
+	 (int64_t) record_offset,
+	 (int64_t) 48 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "record_size",
+	 (uint64_t) record_size,
+	 (uint64_t) 40 );
+
+	result = libevt_offset_table_get_entry_by_index(
+	          recovered_records_table,
+	          0,
+	          &record_offset,
+	          &record_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "record_offset",
+	 (int64_t) record_offset,
+	 (int64_t) 56 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "record_size",
+	 (uint64_t) record_size,
+	 (uint64_t) 32 );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          7,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "timestamp_index->number_of_timestamps",
+	 timestamp_index->number_of_timestamps,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "timestamp_index->timestamps[ 0 ]",
+	 timestamp_index->timestamps[ 0 ],
+	 (uint32_t) 0x5e0be100UL );
+
+	/* Test an index file that does not match the EVT file
+	 */
+	result = libevt_offset_table_empty(
+	          records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_offset_table_empty(
+	          recovered_records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_number_index_empty(
+	          record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_timestamp_index_empty(
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* The last record number of the EVT file is changed
+	 */
+	evt_test_index_file_evt_data1[ 24 ] = 0x02;
+
+	result = libevt_index_file_read_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          records_table,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &io_handle_flags,
+	          &error );
+
+	evt_test_index_file_evt_data1[ 24 ] = 0x01;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The size of the EVT file is changed
+	 */
+	result = libevt_index_file_read_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          96,
+	          48,
+	          records_table,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &io_handle_flags,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_index_file_read_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          NULL,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &io_handle_flags,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_index_file_read_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          records_table,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_index_file_write_file_io_handle(
+	          index_file_io_handle,
+	          file_io_handle,
+	          88,
+	          48,
+	          0,
+	          NULL,
+	          recovered_records_table,
+	          record_number_index,
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = evt_test_close_file_io_handle(
+	          &index_file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_free(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_free(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_free(
+	          &recovered_records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_free(
+	          &records_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &index_file_io_handle,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( timestamp_index != NULL )
+	{
+		libevt_timestamp_index_free(
+		 &timestamp_index,
+		 NULL );
+	}
+	if( record_number_index != NULL )
+	{
+		libevt_record_number_index_free(
+		 &record_number_index,
+		 NULL );
+	}
+	if( recovered_records_table != NULL )
+	{
+		libevt_offset_table_free(
+		 &recovered_records_table,
+		 NULL );
+	}
+	if( records_table != NULL )
+	{
+		libevt_offset_table_free(
+		 &records_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_index_file_write_file_io_handle",
+	 evt_test_index_file_write_and_read_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
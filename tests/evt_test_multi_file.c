@@ -0,0 +1,810 @@
+/*
+ * Library multi_file type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_multi_file.h"
+
+/* Tests the libevt_multi_file_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_multi_file_t *multi_file = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_multi_file_initialize(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_multi_file_free(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	multi_file = (libevt_multi_file_t *) 0x12345678UL;
+
+	result = libevt_multi_file_initialize(
+	          &multi_file,
+	          &error );
+
+	multi_file = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_multi_file_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_multi_file_initialize(
+		          &multi_file,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( multi_file != NULL )
+			{
+				libevt_multi_file_free(
+				 &multi_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "multi_file",
+			 multi_file );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_multi_file_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_multi_file_initialize(
+		          &multi_file,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( multi_file != NULL )
+			{
+				libevt_multi_file_free(
+				 &multi_file,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "multi_file",
+			 multi_file );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( multi_file != NULL )
+	{
+		libevt_multi_file_free(
+		 &multi_file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_multi_file_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_multi_file_append_file function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_append_file(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_file_t *file             = NULL;
+	libevt_multi_file_t *multi_file = NULL;
+	int file_index                  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_multi_file_initialize(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_append_file(
+	          NULL,
+	          file,
+	          &file_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_append_file(
+	          multi_file,
+	          NULL,
+	          &file_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_append_file(
+	          multi_file,
+	          file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file that is not open
+	 */
+	result = libevt_multi_file_append_file(
+	          multi_file,
+	          file,
+	          &file_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_multi_file_free(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( multi_file != NULL )
+	{
+		libevt_multi_file_free(
+		 &multi_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_multi_file_get_number_of_files function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_get_number_of_files(
+     libevt_multi_file_t *multi_file )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_files      = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_multi_file_get_number_of_files(
+	          multi_file,
+	          &number_of_files,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_files",
+	 number_of_files,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_get_number_of_files(
+	          NULL,
+	          &number_of_files,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_get_number_of_files(
+	          multi_file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_multi_file_set_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_set_filter(
+     libevt_multi_file_t *multi_file )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_multi_file_set_filter(
+	          multi_file,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_set_filter(
+	          NULL,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_multi_file_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_multi_file_get_next_record(
+     libevt_multi_file_t *multi_file )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	int file_index           = 0;
+	int record_index         = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libevt_multi_file_get_next_record(
+	          multi_file,
+	          &file_index,
+	          &record_index,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_multi_file_get_next_record(
+	          NULL,
+	          &file_index,
+	          &record_index,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_get_next_record(
+	          multi_file,
+	          NULL,
+	          &record_index,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_get_next_record(
+	          multi_file,
+	          &file_index,
+	          NULL,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_multi_file_get_next_record(
+	          multi_file,
+	          &file_index,
+	          &record_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error        = NULL;
+	libevt_multi_file_t *multi_file = NULL;
+	int result                      = 0;
+
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "libevt_multi_file_initialize",
+	 evt_test_multi_file_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_multi_file_free",
+	 evt_test_multi_file_free );
+
+	EVT_TEST_RUN(
+	 "libevt_multi_file_append_file",
+	 evt_test_multi_file_append_file );
+
+	/* Initialize multi file for tests
+	 */
+	result = libevt_multi_file_initialize(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_RUN_WITH_ARGS(
+	 "libevt_multi_file_get_number_of_files",
+	 evt_test_multi_file_get_number_of_files,
+	 multi_file );
+
+	EVT_TEST_RUN_WITH_ARGS(
+	 "libevt_multi_file_set_filter",
+	 evt_test_multi_file_set_filter,
+	 multi_file );
+
+	EVT_TEST_RUN_WITH_ARGS(
+	 "libevt_multi_file_get_next_record",
+	 evt_test_multi_file_get_next_record,
+	 multi_file );
+
+	/* Clean up
+	 */
+	result = libevt_multi_file_free(
+	          &multi_file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "multi_file",
+	 multi_file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( multi_file != NULL )
+	{
+		libevt_multi_file_free(
+		 &multi_file,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,634 @@
+/*
+ * Library offset_table type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_offset_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_offset_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_offset_table_initialize(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libevt_offset_table_t *offset_table = NULL;
+	int result                          = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests     = 1;
+	int number_of_memset_fail_tests     = 1;
+	int test_number                     = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_offset_table_initialize(
+	          &offset_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_table",
+	 offset_table );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_free(
+	          &offset_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "offset_table",
+	 offset_table );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_offset_table_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	offset_table = (libevt_offset_table_t *) 0x12345678UL;
+
+	result = libevt_offset_table_initialize(
+	          &offset_table,
+	          &error );
+
+	offset_table = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_offset_table_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_offset_table_initialize(
+		          &offset_table,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( offset_table != NULL )
+			{
+				libevt_offset_table_free(
+				 &offset_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "offset_table",
+			 offset_table );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_offset_table_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_offset_table_initialize(
+		          &offset_table,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( offset_table != NULL )
+			{
+				libevt_offset_table_free(
+				 &offset_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "offset_table",
+			 offset_table );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_table != NULL )
+	{
+		libevt_offset_table_free(
+		 &offset_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_offset_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_offset_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_offset_table_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_offset_table_append_entry and libevt_offset_table_get_entry_by_index functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_offset_table_append_entry(
+     void )
+{
+	libcerror_error_t *error            = NULL;
+	libevt_offset_table_t *offset_table = NULL;
+	size64_t size                       = 0;
+	off64_t offset                      = 0;
+	int entry_index                     = 0;
+	int number_of_entries               = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_offset_table_initialize(
+	          &offset_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "offset_table",
+	 offset_table );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * More entries than the initial allocation are appended to test that the table grows
+	 */
+	for( entry_index = 0;
+	     entry_index < 1000;
+	     entry_index++ )
+	{
+		result = libevt_offset_table_append_entry(
+		          offset_table,
+		          &number_of_entries,
+		          (off64_t) ( 48 + ( entry_index * 64 ) ),
+		          64,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "number_of_entries",
+		 number_of_entries,
+		 entry_index );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libevt_offset_table_get_number_of_entries(
+	          offset_table,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1000 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_resize(
+	          offset_table,
+	          number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_get_entry_by_index(
+	          offset_table,
+	          999,
+	          &offset,
+	          &size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "offset",
+	 (int64_t) offset,
+	 (int64_t) ( 48 + ( 999 * 64 ) ) );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "size",
+	 (uint64_t) size,
+	 (uint64_t) 64 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_offset_table_append_entry(
+	          NULL,
+	          &entry_index,
+	          48,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_append_entry(
+	          offset_table,
+	          NULL,
+	          48,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_append_entry(
+	          offset_table,
+	          &entry_index,
+	          (off64_t) 0x100000000ULL,
+	          64,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_append_entry(
+	          offset_table,
+	          &entry_index,
+	          48,
+	          (size64_t) 0x100000000ULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_get_entry_by_index(
+	          offset_table,
+	          -1,
+	          &offset,
+	          &size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_get_entry_by_index(
+	          offset_table,
+	          1000,
+	          &offset,
+	          &size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_offset_table_resize(
+	          offset_table,
+	          999,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libevt_offset_table_empty
+	 */
+	result = libevt_offset_table_empty(
+	          offset_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_offset_table_get_number_of_entries(
+	          offset_table,
+	          &number_of_entries,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevt_offset_table_free(
+	          &offset_table,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "offset_table",
+	 offset_table );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( offset_table != NULL )
+	{
+		libevt_offset_table_free(
+		 &offset_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_offset_table_initialize",
+	 evt_test_offset_table_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_offset_table_free",
+	 evt_test_offset_table_free );
+
+	EVT_TEST_RUN(
+	 "libevt_offset_table_append_entry",
+	 evt_test_offset_table_append_entry );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -0,0 +1,1506 @@
+/*
+ * Library record_iterator type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_functions.h"
+#include "evt_test_libbfio.h"
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_record_iterator.h"
+
+#if !defined( LIBEVT_HAVE_BFIO )
+
+LIBEVT_EXTERN \
+int libevt_file_open_file_io_handle(
+     libevt_file_t *file,
+     libbfio_handle_t *file_io_handle,
+     int access_flags,
+     libevt_error_t **error );
+
+#endif /* !defined( LIBEVT_HAVE_BFIO ) */
+
+/* An event log that has wrapped with records 7, 8 and 9 followed by the end-of-file record
+ * Record 9 at offset 0x140 wraps around the end of the file
+ */
+uint8_t evt_test_record_iterator_data1[ 352 ] = {
+	0x30, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0xb8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00, 0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00,
+	0x60, 0x01, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x22, 0x22, 0x22, 0x22,
+	0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0xb8, 0x00, 0x00, 0x00, 0x54, 0x00, 0x00, 0x00,
+	0x0a, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65,
+	0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40,
+	0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
+	0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+	0x4c, 0x66, 0x4c, 0x65, 0x08, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00,
+	0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x40, 0x00, 0x00, 0x00, 0x41, 0x00, 0x70, 0x00, 0x70, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+	0x44, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x09, 0x00, 0x00, 0x00, 0x00, 0x90, 0x00, 0x00,
+	0x00, 0x90, 0x00, 0x00, 0x01, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00 };
+
+/* Tests the libevt_record_iterator_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libevt_file_t *file                       = NULL;
+	libevt_record_iterator_t *record_iterator = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_initialize(
+	          NULL,
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_iterator = (libevt_record_iterator_t *) 0x12345678UL;
+
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
+	          &error );
+
+	record_iterator = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with a file that is not open
+	 */
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_iterator_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_iterator_get_next_record function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_get_next_record(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libevt_record_t *record  = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_get_next_record(
+	          NULL,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_iterator_set_record_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_set_record_index(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_set_record_index(
+	          NULL,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_iterator_set_end_record_index function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_set_end_record_index(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_set_end_record_index(
+	          NULL,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Checks the records retrieved by a record iterator against the records
+ * retrieved by index
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_check_records(
+     libevt_record_iterator_t *record_iterator,
+     libevt_file_t *file,
+     int first_record_index,
+     int end_record_index )
+{
+	libcerror_error_t *error        = NULL;
+	libevt_record_t *indexed_record = NULL;
+	libevt_record_t *record         = NULL;
+	off64_t indexed_record_offset   = 0;
+	off64_t record_offset           = 0;
+	uint32_t indexed_record_number  = 0;
+	uint32_t indexed_written_time   = 0;
+	uint32_t record_number          = 0;
+	uint32_t written_time           = 0;
+	int record_index                = 0;
+	int result                      = 0;
+
+	for( record_index = first_record_index;
+	     record_index < end_record_index;
+	     record_index++ )
+	{
+		result = libevt_record_iterator_get_next_record(
+		          record_iterator,
+		          &record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          record,
+		          &record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_identifier(
+		          record,
+		          &record_number,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_written_time(
+		          record,
+		          &written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_file_get_record_by_index(
+		          file,
+		          record_index,
+		          &indexed_record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NOT_NULL(
+		 "indexed_record",
+		 indexed_record );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_offset(
+		          indexed_record,
+		          &indexed_record_offset,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_identifier(
+		          indexed_record,
+		          &indexed_record_number,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_get_written_time(
+		          indexed_record,
+		          &indexed_written_time,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_record_free(
+		          &indexed_record,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		EVT_TEST_ASSERT_EQUAL_INT64(
+		 "record_offset",
+		 (int64_t) record_offset,
+		 (int64_t) indexed_record_offset );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "record_number",
+		 record_number,
+		 indexed_record_number );
+
+		EVT_TEST_ASSERT_EQUAL_UINT32(
+		 "written_time",
+		 written_time,
+		 indexed_written_time );
+	}
+	result = libevt_record_iterator_get_next_record(
+	          record_iterator,
+	          &record,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( indexed_record != NULL )
+	{
+		libevt_record_free(
+		 &indexed_record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests iterating the records of a file
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_get_next_record_with_data(
+     void )
+{
+	libbfio_handle_t *file_io_handle                            = NULL;
+	libcerror_error_t *error                                    = NULL;
+	libevt_file_t *file                                         = NULL;
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	libevt_record_iterator_t *record_iterator                   = NULL;
+	int number_of_records                                       = 0;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_record_iterator_data1,
+	          352,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_get_number_of_records(
+	          file,
+	          &number_of_records,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 3 );
+
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	/* Test iterating all records using the read-ahead buffer, the last record wraps
+	 */
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          0,
+	          number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test iterating with an end record index
+	 */
+	result = libevt_record_iterator_set_record_index(
+	          record_iterator,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_iterator_set_end_record_index(
+	          record_iterator,
+	          2,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          0,
+	          2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_iterator_set_record_index(
+	          record_iterator,
+	          1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          1,
+	          2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_iterator_set_end_record_index(
+	          record_iterator,
+	          -1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test iterating with a read-ahead buffer that holds a single record
+	 * hence is read again for every record
+	 */
+	internal_record_iterator->buffer_size = 100;
+
+	result = libevt_record_iterator_set_record_index(
+	          record_iterator,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          0,
+	          number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Test iterating with records that do not fit in the read-ahead buffer
+	 */
+	internal_record_iterator->buffer_size = 32;
+
+	result = libevt_record_iterator_set_record_index(
+	          record_iterator,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          0,
+	          number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_iterator_free(
+	          &record_iterator,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test iterating a memory mapped file, the test data is used as
+	 * the memory mapped file data
+	 */
+	( (libevt_internal_file_t *) file )->io_handle->mapped_data = evt_test_record_iterator_data1;
+
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "internal_record_iterator->buffer",
+	 internal_record_iterator->buffer );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          0,
+	          number_of_records );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libevt_record_iterator_set_record_index(
+	          record_iterator,
+	          1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_iterator_set_end_record_index(
+	          record_iterator,
+	          2,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_record_iterator_check_records(
+	          record_iterator,
+	          file,
+	          1,
+	          2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Clean up
+	 */
+	result = libevt_record_iterator_free(
+	          &record_iterator,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	( (libevt_internal_file_t *) file )->io_handle->mapped_data = NULL;
+
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_iterator != NULL )
+	{
+		libevt_record_iterator_free(
+		 &record_iterator,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		( (libevt_internal_file_t *) file )->io_handle->mapped_data = NULL;
+
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_iterator_get_record_data function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_iterator_get_record_data(
+     void )
+{
+	libbfio_handle_t *file_io_handle                            = NULL;
+	libcerror_error_t *error                                    = NULL;
+	libevt_file_t *file                                         = NULL;
+	libevt_internal_record_iterator_t *internal_record_iterator = NULL;
+	libevt_record_iterator_t *record_iterator                   = NULL;
+	const uint8_t *record_data                                  = NULL;
+	int result                                                  = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_record_iterator_data1,
+	          352,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_initialize(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_open_file_io_handle(
+	          file,
+	          file_io_handle,
+	          LIBEVT_OPEN_READ,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_iterator_initialize(
+	          &record_iterator,
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	internal_record_iterator = (libevt_internal_record_iterator_t *) record_iterator;
+
+	/* Test regular cases
+	 */
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0xb8,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_data",
+	 record_data );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          record_data,
+	          &( evt_test_record_iterator_data1[ 0xb8 ] ),
+	          68 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a record that is stored in the read-ahead buffer
+	 */
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0xfc,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "buffer_offset",
+	 (int64_t) ( record_data - internal_record_iterator->buffer ),
+	 (int64_t) ( 0xfc - 0xb8 ) );
+
+	result = memory_compare(
+	          record_data,
+	          &( evt_test_record_iterator_data1[ 0xfc ] ),
+	          68 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test a record that wraps around the end of the file
+	 */
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0x140,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "record_data_offset",
+	 (int64_t) ( record_data - internal_record_iterator->record_data ),
+	 (int64_t) 0 );
+
+	result = memory_compare(
+	          record_data,
+	          &( evt_test_record_iterator_data1[ 0x140 ] ),
+	          32 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = memory_compare(
+	          &( record_data[ 32 ] ),
+	          &( evt_test_record_iterator_data1[ 48 ] ),
+	          36 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libevt_record_iterator_get_record_data(
+	          NULL,
+	          0xb8,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          352,
+	          68,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0xb8,
+	          4,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0xb8,
+	          352,
+	          &record_data,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_iterator_get_record_data(
+	          internal_record_iterator,
+	          0xb8,
+	          68,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_record_iterator_free(
+	          &record_iterator,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_iterator",
+	 record_iterator );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_close(
+	          file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_file_free(
+	          &file,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_iterator != NULL )
+	{
+		libevt_record_iterator_free(
+		 &record_iterator,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libevt_file_free(
+		 &file,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_initialize",
+	 evt_test_record_iterator_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_free",
+	 evt_test_record_iterator_free );
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_get_next_record",
+	 evt_test_record_iterator_get_next_record );
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_set_record_index",
+	 evt_test_record_iterator_set_record_index );
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_set_end_record_index",
+	 evt_test_record_iterator_set_end_record_index );
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_get_record_data",
+	 evt_test_record_iterator_get_record_data );
+
+	EVT_TEST_RUN(
+	 "libevt_record_iterator_get_next_record_with_data",
+	 evt_test_record_iterator_get_next_record_with_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
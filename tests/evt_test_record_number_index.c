@@ -0,0 +1,809 @@
+/*
+ * Library record_number_index type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_record_number_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_record_number_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_number_index_initialize(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libevt_record_number_index_t *record_number_index = NULL;
+	int result                                        = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests                   = 1;
+	int number_of_memset_fail_tests                   = 1;
+	int test_number                                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_record_number_index_initialize(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_free(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_number_index_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	record_number_index = (libevt_record_number_index_t *) 0x12345678UL;
+
+	result = libevt_record_number_index_initialize(
+	          &record_number_index,
+	          &error );
+
+	record_number_index = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_record_number_index_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_record_number_index_initialize(
+		          &record_number_index,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( record_number_index != NULL )
+			{
+				libevt_record_number_index_free(
+				 &record_number_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "record_number_index",
+			 record_number_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_record_number_index_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_record_number_index_initialize(
+		          &record_number_index,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( record_number_index != NULL )
+			{
+				libevt_record_number_index_free(
+				 &record_number_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "record_number_index",
+			 record_number_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_number_index != NULL )
+	{
+		libevt_record_number_index_free(
+		 &record_number_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_number_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_number_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_record_number_index_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_number_index_get_record_index_by_record_number function with contiguous record numbers
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_number_index_get_record_index_by_record_number_contiguous(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libevt_record_number_index_t *record_number_index = NULL;
+	int record_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_record_number_index_initialize(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Contiguous record numbers are expected to be stored without entries
+	 */
+	for( record_index = 0;
+	     record_index < 1000;
+	     record_index++ )
+	{
+		result = libevt_record_number_index_append_record_number(
+		          record_number_index,
+		          record_index,
+		          (uint32_t) ( 5 + record_index ),
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_number_index->entries",
+	 record_number_index->entries );
+
+	result = libevt_record_number_index_finalize(
+	          record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          5,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1004,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 999 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          4,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1005,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          NULL,
+	          5,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          5,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_number_index_append_record_number(
+	          record_number_index,
+	          0,
+	          5,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_record_number_index_free(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_number_index != NULL )
+	{
+		libevt_record_number_index_free(
+		 &record_number_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_record_number_index_get_record_index_by_record_number function with non-contiguous record numbers
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_number_index_get_record_index_by_record_number_sparse(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libevt_record_number_index_t *record_number_index = NULL;
+	int record_index                                  = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_record_number_index_initialize(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record numbers wrap around half way to emulate a circular buffer
+	 */
+	for( record_index = 0;
+	     record_index < 1000;
+	     record_index++ )
+	{
+		result = libevt_record_number_index_append_record_number(
+		          record_number_index,
+		          record_index,
+		          (uint32_t) ( ( ( record_index + 500 ) % 1000 ) * 2 + 1 ),
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_number_index->entries",
+	 record_number_index->entries );
+
+	/* Test error cases before the index is finalized
+	 */
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1001,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_record_number_index_finalize(
+	          record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1001,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 500 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          999,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 999 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          1999,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_index",
+	 record_index,
+	 499 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          2,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_number_index_get_record_index_by_record_number(
+	          record_number_index,
+	          2001,
+	          &record_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libevt_record_number_index_empty
+	 */
+	result = libevt_record_number_index_empty(
+	          record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_number_index->entries",
+	 record_number_index->entries );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_number_index->number_of_records",
+	 record_number_index->number_of_records,
+	 0 );
+
+	/* Clean up
+	 */
+	result = libevt_record_number_index_free(
+	          &record_number_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_number_index",
+	 record_number_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_number_index != NULL )
+	{
+		libevt_record_number_index_free(
+		 &record_number_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_record_number_index_initialize",
+	 evt_test_record_number_index_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_record_number_index_free",
+	 evt_test_record_number_index_free );
+
+	EVT_TEST_RUN(
+	 "libevt_record_number_index_get_record_index_by_record_number",
+	 evt_test_record_number_index_get_record_index_by_record_number_contiguous );
+
+	EVT_TEST_RUN(
+	 "libevt_record_number_index_get_record_index_by_record_number",
+	 evt_test_record_number_index_get_record_index_by_record_number_sparse );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -27,14 +27,28 @@
 #include <stdlib.h>
 #endif
 
+#include "evt_test_functions.h"
+#include "evt_test_libbfio.h"
 #include "evt_test_libcerror.h"
 #include "evt_test_libevt.h"
 #include "evt_test_macros.h"
 #include "evt_test_memory.h"
 #include "evt_test_unused.h"
 
+#include "../libevt/libevt_io_handle.h"
 #include "../libevt/libevt_record_values.h"
 
+/* A 48-byte dummy file header followed by 2 records of 16 bytes
+ * the second record wraps after its signature
+ */
+uint8_t evt_test_record_values_wrapped_data1[ 88 ] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x18, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65, 0x01, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+	0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x4c, 0x66, 0x4c, 0x65,
+	0x02, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00 };
+
 #if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
 
 /* Tests the libevt_record_values_initialize function
@@ -380,6 +394,342 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevt_record_values_read_header_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_record_values_read_header_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle      = NULL;
+	libcerror_error_t *error              = NULL;
+	libevt_io_handle_t *io_handle         = NULL;
+	libevt_record_values_t *record_values = NULL;
+	ssize_t read_count                    = 0;
+	off64_t file_offset                   = 0;
+	uint8_t has_wrapped                   = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->file_size = 88;
+
+	result = libevt_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = evt_test_open_file_io_handle(
+	          &file_io_handle,
+	          evt_test_record_values_wrapped_data1,
+	          88,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	file_offset = libbfio_handle_seek_offset(
+	               file_io_handle,
+	               48,
+	               SEEK_SET,
+	               &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 48 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              record_values,
+	              file_io_handle,
+	              io_handle,
+	              &file_offset,
+	              &has_wrapped,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 24 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 72 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "has_wrapped",
+	 has_wrapped,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "record_values->type",
+	 record_values->type,
+	 LIBEVT_RECORD_TYPE_EVENT );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_values->number",
+	 record_values->number,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_values->written_time",
+	 record_values->written_time,
+	 0x00000020 );
+
+	/* Test the record that wraps to the start of the records
+	 */
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              record_values,
+	              file_io_handle,
+	              io_handle,
+	              &file_offset,
+	              &has_wrapped,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) 24 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "file_offset",
+	 (int64_t) file_offset,
+	 (int64_t) 56 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT8(
+	 "has_wrapped",
+	 has_wrapped,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_values->number",
+	 record_values->number,
+	 2 );
+
+	/* The written time is stored after the wrap
+	 */
+	EVT_TEST_ASSERT_EQUAL_UINT32(
+	 "record_values->written_time",
+	 record_values->written_time,
+	 0x00000018 );
+
+	/* Test error cases
+	 */
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              NULL,
+	              file_io_handle,
+	              io_handle,
+	              &file_offset,
+	              &has_wrapped,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              record_values,
+	              file_io_handle,
+	              NULL,
+	              &file_offset,
+	              &has_wrapped,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              record_values,
+	              file_io_handle,
+	              io_handle,
+	              NULL,
+	              &has_wrapped,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	read_count = libevt_record_values_read_header_file_io_handle(
+	              record_values,
+	              file_io_handle,
+	              io_handle,
+	              &file_offset,
+	              NULL,
+	              &error );
+
+	EVT_TEST_ASSERT_EQUAL_SSIZE(
+	 "read_count",
+	 read_count,
+	 (ssize_t) -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = evt_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevt_record_values_free(
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "record_values",
+	 record_values );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libevt_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libevt_record_values_get_type function
  * Returns 1 if successful or 0 if not
  */
@@ -534,6 +884,10 @@ int main(
 	 "libevt_record_values_read_file_io_handle",
 	 evt_test_record_values_read_file_io_handle );
 
+	EVT_TEST_RUN(
+	 "libevt_record_values_read_header_file_io_handle",
+	 evt_test_record_values_read_header_file_io_handle );
+
 	/* TODO: add tests for libevt_record_values_read_event */
 
 	/* TODO: add tests for libevt_record_values_read_end_of_file */
@@ -542,8 +896,6 @@ int main(
 	 "libevt_record_values_get_type",
 	 evt_test_record_values_get_type );
 
-	/* TODO: add tests for libevt_record_values_read_element_data */
-
 #endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
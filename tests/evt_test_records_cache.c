@@ -0,0 +1,1209 @@
+/*
+ * Library records_cache type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_record_values.h"
+#include "../libevt/libevt_records_cache.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_records_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_records_cache_initialize(
+     void )
+{
+	libcerror_error_t *error               = NULL;
+	libevt_records_cache_t *records_cache  = NULL;
+	int result                             = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests        = 3;
+	int number_of_memset_fail_tests        = 3;
+	int test_number                        = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          64,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_records_cache_initialize(
+	          NULL,
+	          64,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	records_cache = (libevt_records_cache_t *) 0x12345678UL;
+
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          64,
+	          0,
+	          &error );
+
+	records_cache = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          0,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_records_cache_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_records_cache_initialize(
+		          &records_cache,
+		          64,
+		          0,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( records_cache != NULL )
+			{
+				libevt_records_cache_free(
+				 &records_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "records_cache",
+			 records_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_records_cache_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_records_cache_initialize(
+		          &records_cache,
+		          64,
+		          0,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( records_cache != NULL )
+			{
+				libevt_records_cache_free(
+				 &records_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "records_cache",
+			 records_cache );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( records_cache != NULL )
+	{
+		libevt_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_records_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_records_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_records_cache_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_records_cache_get_record_values_by_offset and
+ * libevt_records_cache_set_record_values_by_offset functions
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_records_cache_get_set_record_values_by_offset(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevt_record_values_t *cached_record_values = NULL;
+	libevt_record_values_t *record_values        = NULL;
+	libevt_records_cache_t *records_cache        = NULL;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          16,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          128,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "cached_record_values",
+	 cached_record_values );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_record_values_initialize(
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_values->offset = 128;
+
+	result = libevt_records_cache_set_record_values_by_offset(
+	          records_cache,
+	          128,
+	          &record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "record_values",
+	 record_values );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_values->reference_count",
+	 record_values->reference_count,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          128,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "cached_record_values == record_values",
+	 (int) ( cached_record_values == record_values ),
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "record_values->reference_count",
+	 record_values->reference_count,
+	 2 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_release_record_values(
+	          records_cache,
+	          cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_record_values = NULL;
+
+	/* Test emptying the cache while the record values are still referenced
+	 */
+	result = libevt_records_cache_empty(
+	          records_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          128,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The record values are freed by releasing the last reference
+	 */
+	result = libevt_records_cache_release_record_values(
+	          records_cache,
+	          record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	record_values = NULL;
+
+	/* Test error cases
+	 */
+	result = libevt_records_cache_get_record_values_by_offset(
+	          NULL,
+	          128,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          -1,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          128,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_set_record_values_by_offset(
+	          records_cache,
+	          128,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_release_record_values(
+	          records_cache,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevt_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_records_cache_resize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_records_cache_resize(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevt_record_values_t *cached_record_values = NULL;
+	libevt_record_values_t *record_values        = NULL;
+	libevt_records_cache_t *records_cache        = NULL;
+	uint64_t number_of_hits                      = 0;
+	uint64_t number_of_misses                    = 0;
+	off64_t offset                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          32,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The offsets 0 and 64 are cached by the same shard
+	 */
+	for( offset = 0;
+	     offset <= 64;
+	     offset += 64 )
+	{
+		result = libevt_record_values_initialize(
+		          &record_values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values->offset = offset;
+
+		result = libevt_records_cache_set_record_values_by_offset(
+		          records_cache,
+		          offset,
+		          &record_values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_records_cache_release_record_values(
+		          records_cache,
+		          record_values,
+		          &error );
+
+		record_values = NULL;
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libevt_records_cache_resize(
+	          records_cache,
+	          16,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "records_cache->number_of_entries_per_shard",
+	 records_cache->number_of_entries_per_shard,
+	 1 );
+
+	/* The least recently used record values are removed from the cache
+	 */
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          0,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          64,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_release_record_values(
+	          records_cache,
+	          cached_record_values,
+	          &error );
+
+	cached_record_values = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_get_statistics(
+	          records_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	EVT_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a maximum size smaller than the cached record values
+	 */
+	result = libevt_records_cache_resize(
+	          records_cache,
+	          16,
+	          16,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          64,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_records_cache_resize(
+	          NULL,
+	          16,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_resize(
+	          records_cache,
+	          0,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_records_cache_get_statistics(
+	          records_cache,
+	          NULL,
+	          &number_of_misses,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevt_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_records_cache_set_pin_all function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_records_cache_set_pin_all(
+     void )
+{
+	libcerror_error_t *error                     = NULL;
+	libevt_record_values_t *cached_record_values = NULL;
+	libevt_record_values_t *record_values        = NULL;
+	libevt_records_cache_t *records_cache        = NULL;
+	off64_t offset                               = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_records_cache_initialize(
+	          &records_cache,
+	          16,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_records_cache_set_pin_all(
+	          records_cache,
+	          1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The offsets 0, 64 and 128 are cached by the same shard
+	 */
+	for( offset = 0;
+	     offset <= 128;
+	     offset += 64 )
+	{
+		result = libevt_record_values_initialize(
+		          &record_values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		record_values->offset = offset;
+
+		result = libevt_records_cache_set_record_values_by_offset(
+		          records_cache,
+		          offset,
+		          &record_values,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libevt_records_cache_release_record_values(
+		          records_cache,
+		          record_values,
+		          &error );
+
+		record_values = NULL;
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Pinned record values are not removed from the cache
+	 */
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          0,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_records_cache_release_record_values(
+	          records_cache,
+	          cached_record_values,
+	          &error );
+
+	cached_record_values = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Unpinning reduces the cache to its maximum number of entries
+	 */
+	result = libevt_records_cache_set_pin_all(
+	          records_cache,
+	          0,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "records_cache->shards[ 0 ].number_of_entries",
+	 records_cache->shards[ 0 ].number_of_entries,
+	 1 );
+
+	result = libevt_records_cache_get_record_values_by_offset(
+	          records_cache,
+	          64,
+	          &cached_record_values,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_records_cache_set_pin_all(
+	          NULL,
+	          1,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_records_cache_free(
+	          &records_cache,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "records_cache",
+	 records_cache );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record_values != NULL )
+	{
+		libevt_record_values_free(
+		 &record_values,
+		 NULL );
+	}
+	if( records_cache != NULL )
+	{
+		libevt_records_cache_free(
+		 &records_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_records_cache_initialize",
+	 evt_test_records_cache_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_records_cache_free",
+	 evt_test_records_cache_free );
+
+	EVT_TEST_RUN(
+	 "libevt_records_cache_get_set_record_values_by_offset",
+	 evt_test_records_cache_get_set_record_values_by_offset );
+
+	EVT_TEST_RUN(
+	 "libevt_records_cache_resize",
+	 evt_test_records_cache_resize );
+
+	EVT_TEST_RUN(
+	 "libevt_records_cache_set_pin_all",
+	 evt_test_records_cache_set_pin_all );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
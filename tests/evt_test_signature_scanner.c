@@ -0,0 +1,492 @@
+/*
+ * Library signature scanner functions test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_signature_scanner.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* The size of the test data, deliberately not a multitude of the SIMD block sizes
+ */
+#define EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE	4099
+
+uint8_t evt_test_signature_scanner_data1[ EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE ];
+
+/* The expected signature offsets and flags in the test data
+ */
+size_t evt_test_signature_scanner_offsets1[ 6 ] = {
+	4, 36, 1000, 2000, 4060, 4092 };
+
+uint8_t evt_test_signature_scanner_flags1[ 6 ] = {
+	LIBEVT_SIGNATURE_FLAG_RECORD,
+	LIBEVT_SIGNATURE_FLAG_RECORD,
+	LIBEVT_SIGNATURE_FLAG_END_OF_FILE,
+	LIBEVT_SIGNATURE_FLAG_RECORD,
+	LIBEVT_SIGNATURE_FLAG_END_OF_FILE,
+	LIBEVT_SIGNATURE_FLAG_RECORD };
+
+/* Fills the test data
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_fill_data(
+     void )
+{
+	int signature_index = 0;
+
+	if( memory_set(
+	     evt_test_signature_scanner_data1,
+	     0x4c,
+	     EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE ) == NULL )
+	{
+		return( 0 );
+	}
+	for( signature_index = 0;
+	     signature_index < 6;
+	     signature_index++ )
+	{
+		if( evt_test_signature_scanner_flags1[ signature_index ] == LIBEVT_SIGNATURE_FLAG_RECORD )
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( evt_test_signature_scanner_data1[ evt_test_signature_scanner_offsets1[ signature_index ] ] ),
+			 LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE );
+		}
+		else
+		{
+			byte_stream_copy_from_uint32_little_endian(
+			 &( evt_test_signature_scanner_data1[ evt_test_signature_scanner_offsets1[ signature_index ] ] ),
+			 LIBEVT_SIGNATURE_SCANNER_END_OF_FILE_SIGNATURE );
+		}
+	}
+	/* A signature that is not 32-bit aligned should not be found
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 &( evt_test_signature_scanner_data1[ 502 ] ),
+	 LIBEVT_SIGNATURE_SCANNER_RECORD_SIGNATURE );
+
+	/* A signature that is truncated by the end of the data should not be found
+	 */
+	evt_test_signature_scanner_data1[ 4096 ] = 'L';
+	evt_test_signature_scanner_data1[ 4097 ] = 'f';
+	evt_test_signature_scanner_data1[ 4098 ] = 'L';
+
+	return( 1 );
+}
+
+/* Tests the libevt_signature_scanner_scan function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_signature_scanner_scan(
+     void )
+{
+	int scan_methods[ 3 ] = {
+		LIBEVT_SCAN_METHOD_SCALAR,
+		LIBEVT_SCAN_METHOD_SSE2,
+		LIBEVT_SCAN_METHOD_AVX2 };
+
+	libcerror_error_t *error  = NULL;
+	size_t data_offset        = 0;
+	size_t signature_offset   = 0;
+	uint8_t signature_flag    = 0;
+	int method_index          = 0;
+	int result                = 0;
+	int signature_index       = 0;
+	int supported_scan_method = 0;
+
+	/* Initialize test
+	 */
+	result = evt_test_signature_scanner_fill_data();
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	supported_scan_method = libevt_signature_scanner_get_supported_scan_method();
+
+	EVT_TEST_ASSERT_GREATER_THAN_INT(
+	 "supported_scan_method",
+	 supported_scan_method,
+	 LIBEVT_SCAN_METHOD_DEFAULT );
+
+	/* Test regular cases
+	 * Every scan method supported by the CPU should return the same results
+	 */
+	for( method_index = 0;
+	     method_index < 3;
+	     method_index++ )
+	{
+		if( scan_methods[ method_index ] > supported_scan_method )
+		{
+			continue;
+		}
+		data_offset = 0;
+
+		for( signature_index = 0;
+		     signature_index < 6;
+		     signature_index++ )
+		{
+			result = libevt_signature_scanner_scan(
+			          evt_test_signature_scanner_data1,
+			          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+			          data_offset,
+			          LIBEVT_SIGNATURE_FLAG_RECORD | LIBEVT_SIGNATURE_FLAG_END_OF_FILE,
+			          scan_methods[ method_index ],
+			          &signature_offset,
+			          &signature_flag,
+			          &error );
+
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			EVT_TEST_ASSERT_EQUAL_SIZE(
+			 "signature_offset",
+			 signature_offset,
+			 evt_test_signature_scanner_offsets1[ signature_index ] );
+
+			EVT_TEST_ASSERT_EQUAL_UINT8(
+			 "signature_flag",
+			 signature_flag,
+			 evt_test_signature_scanner_flags1[ signature_index ] );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+
+			data_offset = signature_offset + 4;
+		}
+		result = libevt_signature_scanner_scan(
+		          evt_test_signature_scanner_data1,
+		          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+		          data_offset,
+		          LIBEVT_SIGNATURE_FLAG_RECORD | LIBEVT_SIGNATURE_FLAG_END_OF_FILE,
+		          scan_methods[ method_index ],
+		          &signature_offset,
+		          &signature_flag,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test scanning for a single signature type
+		 */
+		result = libevt_signature_scanner_scan(
+		          evt_test_signature_scanner_data1,
+		          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+		          0,
+		          LIBEVT_SIGNATURE_FLAG_END_OF_FILE,
+		          scan_methods[ method_index ],
+		          &signature_offset,
+		          &signature_flag,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_SIZE(
+		 "signature_offset",
+		 signature_offset,
+		 (size_t) 1000 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT8(
+		 "signature_flag",
+		 signature_flag,
+		 LIBEVT_SIGNATURE_FLAG_END_OF_FILE );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Test scanning relative to an unaligned data offset
+		 */
+		result = libevt_signature_scanner_scan(
+		          evt_test_signature_scanner_data1,
+		          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+		          42,
+		          LIBEVT_SIGNATURE_FLAG_RECORD,
+		          scan_methods[ method_index ],
+		          &signature_offset,
+		          &signature_flag,
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_EQUAL_SIZE(
+		 "signature_offset",
+		 signature_offset,
+		 (size_t) 502 );
+
+		EVT_TEST_ASSERT_EQUAL_UINT8(
+		 "signature_flag",
+		 signature_flag,
+		 LIBEVT_SIGNATURE_FLAG_RECORD );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libevt_signature_scanner_scan(
+	          NULL,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE + 1,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          0xff,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          -1,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_DEFAULT,
+	          &signature_offset,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          NULL,
+	          &signature_flag,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_signature_scanner_scan(
+	          evt_test_signature_scanner_data1,
+	          EVT_TEST_SIGNATURE_SCANNER_DATA_SIZE,
+	          0,
+	          LIBEVT_SIGNATURE_FLAG_RECORD,
+	          LIBEVT_SCAN_METHOD_SCALAR,
+	          &signature_offset,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_signature_scanner_scan",
+	 evt_test_signature_scanner_scan );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -506,6 +506,239 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libevt_strings_array_get_string function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_strings_array_get_string(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libevt_strings_array_t *strings_array = NULL;
+	const uint8_t *string                 = NULL;
+	size_t string_size                    = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_strings_array_initialize(
+	          &strings_array,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "strings_array",
+	 strings_array );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_strings_array_read_data(
+	          strings_array,
+	          evt_test_strings_array_data1,
+	          28,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          1,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "string offset",
+	 (int64_t) ( string - evt_test_strings_array_data1 ),
+	 (int64_t) 10 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 18 );
+
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          0,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	EVT_TEST_ASSERT_EQUAL_INT64(
+	 "string offset",
+	 (int64_t) ( string - evt_test_strings_array_data1 ),
+	 (int64_t) 0 );
+
+	EVT_TEST_ASSERT_EQUAL_SIZE(
+	 "string_size",
+	 string_size,
+	 (size_t) 10 );
+
+	/* Test error cases
+	 */
+	result = libevt_strings_array_get_string(
+	          NULL,
+	          0,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          -1,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          2,
+	          &string,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          0,
+	          NULL,
+	          &string_size,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_strings_array_get_string(
+	          strings_array,
+	          0,
+	          &string,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_strings_array_free(
+	          &strings_array,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "strings_array",
+	 strings_array );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( strings_array != NULL )
+	{
+		libevt_strings_array_free(
+		 &strings_array,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -539,6 +772,10 @@ int main(
 
 	/* TODO add tests for libevt_strings_array_get_number_of_strings */
 
+	EVT_TEST_RUN(
+	 "libevt_strings_array_get_string",
+	 evt_test_strings_array_get_string );
+
 	/* TODO add tests for libevt_strings_array_get_utf8_string_size */
 
 	/* TODO add tests for libevt_strings_array_get_utf8_string */
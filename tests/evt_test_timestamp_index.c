@@ -0,0 +1,973 @@
+/*
+ * Library timestamp_index type test program
+ *
+ * Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "evt_test_libcerror.h"
+#include "evt_test_libevt.h"
+#include "evt_test_macros.h"
+#include "evt_test_memory.h"
+#include "evt_test_unused.h"
+
+#include "../libevt/libevt_timestamp_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+/* Tests the libevt_timestamp_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_timestamp_index_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libevt_timestamp_index_t *timestamp_index = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 1;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libevt_timestamp_index_initialize(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_free(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_timestamp_index_initialize(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	timestamp_index = (libevt_timestamp_index_t *) 0x12345678UL;
+
+	result = libevt_timestamp_index_initialize(
+	          &timestamp_index,
+	          &error );
+
+	timestamp_index = NULL;
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_EVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_timestamp_index_initialize with malloc failing
+		 */
+		evt_test_malloc_attempts_before_fail = test_number;
+
+		result = libevt_timestamp_index_initialize(
+		          &timestamp_index,
+		          &error );
+
+		if( evt_test_malloc_attempts_before_fail != -1 )
+		{
+			evt_test_malloc_attempts_before_fail = -1;
+
+			if( timestamp_index != NULL )
+			{
+				libevt_timestamp_index_free(
+				 &timestamp_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "timestamp_index",
+			 timestamp_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libevt_timestamp_index_initialize with memset failing
+		 */
+		evt_test_memset_attempts_before_fail = test_number;
+
+		result = libevt_timestamp_index_initialize(
+		          &timestamp_index,
+		          &error );
+
+		if( evt_test_memset_attempts_before_fail != -1 )
+		{
+			evt_test_memset_attempts_before_fail = -1;
+
+			if( timestamp_index != NULL )
+			{
+				libevt_timestamp_index_free(
+				 &timestamp_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			EVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			EVT_TEST_ASSERT_IS_NULL(
+			 "timestamp_index",
+			 timestamp_index );
+
+			EVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_EVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_index != NULL )
+	{
+		libevt_timestamp_index_free(
+		 &timestamp_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_timestamp_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_timestamp_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libevt_timestamp_index_free(
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_timestamp_index_get_index_range function with a single run of timestamps
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_timestamp_index_get_index_range_single_run(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libevt_timestamp_index_t *timestamp_index = NULL;
+	int first_index                           = 0;
+	int last_index                            = 0;
+	int number_of_runs                        = 0;
+	int record_index                          = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_timestamp_index_initialize(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Every timestamp is stored for 2 consecutive records
+	 */
+	for( record_index = 0;
+	     record_index < 1000;
+	     record_index++ )
+	{
+		result = libevt_timestamp_index_append_timestamp(
+		          timestamp_index,
+		          record_index,
+		          (uint32_t) ( 1000000 + ( ( record_index / 2 ) * 10 ) ),
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libevt_timestamp_index_finalize(
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_number_of_runs(
+	          timestamp_index,
+	          &number_of_runs,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000000,
+	          1000000,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000005,
+	          1000025,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 2 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 5 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          0xffffffffUL,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 999 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1004990,
+	          0xffffffffUL,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 998 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 999 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          999999,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000001,
+	          1000009,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1004991,
+	          0xffffffffUL,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libevt_timestamp_index_get_index_range(
+	          NULL,
+	          0,
+	          0xffffffffUL,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000010,
+	          1000000,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          0xffffffffUL,
+	          NULL,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          0xffffffffUL,
+	          &first_index,
+	          NULL,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libevt_timestamp_index_append_timestamp(
+	          timestamp_index,
+	          0,
+	          1000000,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libevt_timestamp_index_free(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_index != NULL )
+	{
+		libevt_timestamp_index_free(
+		 &timestamp_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libevt_timestamp_index_get_index_range function with multiple runs of timestamps
+ * Returns 1 if successful or 0 if not
+ */
+int evt_test_timestamp_index_get_index_range_multiple_runs(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libevt_timestamp_index_t *timestamp_index = NULL;
+	int first_index                           = 0;
+	int last_index                            = 0;
+	int number_of_runs                        = 0;
+	int record_index                          = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = libevt_timestamp_index_initialize(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NOT_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The timestamps are set back by 1000 seconds half way to emulate a clock change
+	 */
+	for( record_index = 0;
+	     record_index < 1000;
+	     record_index++ )
+	{
+		result = libevt_timestamp_index_append_timestamp(
+		          timestamp_index,
+		          record_index,
+		          (uint32_t) ( 1000000 + ( ( record_index % 500 ) * 10 ) ),
+		          &error );
+
+		EVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		EVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	result = libevt_timestamp_index_finalize(
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_number_of_runs(
+	          timestamp_index,
+	          &number_of_runs,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 2 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000000,
+	          1000000,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 0 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 500 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1004990,
+	          1004990,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 499 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 999 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          1000100,
+	          1000190,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "first_index",
+	 first_index,
+	 10 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "last_index",
+	 last_index,
+	 519 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          999999,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test libevt_timestamp_index_empty
+	 */
+	result = libevt_timestamp_index_empty(
+	          timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_number_of_runs(
+	          timestamp_index,
+	          &number_of_runs,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_runs",
+	 number_of_runs,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libevt_timestamp_index_get_index_range(
+	          timestamp_index,
+	          0,
+	          0xffffffffUL,
+	          &first_index,
+	          &last_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libevt_timestamp_index_free(
+	          &timestamp_index,
+	          &error );
+
+	EVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "timestamp_index",
+	 timestamp_index );
+
+	EVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( timestamp_index != NULL )
+	{
+		libevt_timestamp_index_free(
+		 &timestamp_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc EVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] EVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	EVT_TEST_UNREFERENCED_PARAMETER( argc )
+	EVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT )
+
+	EVT_TEST_RUN(
+	 "libevt_timestamp_index_initialize",
+	 evt_test_timestamp_index_initialize );
+
+	EVT_TEST_RUN(
+	 "libevt_timestamp_index_free",
+	 evt_test_timestamp_index_free );
+
+	EVT_TEST_RUN(
+	 "libevt_timestamp_index_get_index_range",
+	 evt_test_timestamp_index_get_index_range_single_run );
+
+	EVT_TEST_RUN(
+	 "libevt_timestamp_index_get_index_range",
+	 evt_test_timestamp_index_get_index_range_multiple_runs );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
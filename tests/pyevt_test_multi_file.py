@@ -0,0 +1,121 @@
+#!/usr/bin/env python
+#
+# Python-bindings multi file type test script
+#
+# Copyright (C) 2011-2020, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import sys
+import unittest
+
+import pyevt
+
+
+class MultiFileTypeTests(unittest.TestCase):
+  """Tests the multi file type."""
+
+  def test_append_file(self):
+    """Tests the append_file function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    evt_file = pyevt.file()
+    evt_multi_file = pyevt.multi_file()
+
+    with self.assertRaises(IOError):
+      evt_multi_file.append_file(evt_file)
+
+    evt_file.open(unittest.source)
+
+    file_index = evt_multi_file.append_file(evt_file)
+    self.assertEqual(file_index, 0)
+
+    with self.assertRaises(TypeError):
+      evt_multi_file.append_file(None)
+
+    del evt_multi_file
+
+    evt_file.close()
+
+  def test_get_number_of_files(self):
+    """Tests the get_number_of_files function and number_of_files property."""
+    evt_multi_file = pyevt.multi_file()
+
+    number_of_files = evt_multi_file.get_number_of_files()
+    self.assertEqual(number_of_files, 0)
+
+    self.assertEqual(evt_multi_file.number_of_files, 0)
+
+  def test_get_next_record(self):
+    """Tests the get_next_record function."""
+    if not unittest.source:
+      raise unittest.SkipTest("missing source")
+
+    evt_multi_file = pyevt.multi_file()
+
+    record = evt_multi_file.get_next_record()
+    self.assertIsNone(record)
+
+    evt_files = []
+    number_of_records = 0
+
+    for _ in range(2):
+      evt_file = pyevt.file()
+      evt_file.open(unittest.source)
+
+      evt_multi_file.append_file(evt_file)
+
+      evt_files.append(evt_file)
+      number_of_records += evt_file.get_number_of_records()
+
+    self.assertEqual(evt_multi_file.number_of_files, 2)
+
+    last_written_time = 0
+    number_of_merged_records = 0
+
+    for record in evt_multi_file:
+      written_time = record.get_written_time_as_integer()
+      self.assertGreaterEqual(written_time, last_written_time)
+
+      last_written_time = written_time
+      number_of_merged_records += 1
+
+    self.assertEqual(number_of_merged_records, number_of_records)
+
+    record = evt_multi_file.get_next_record()
+    self.assertIsNone(record)
+
+    del evt_multi_file
+
+    for evt_file in evt_files:
+      evt_file.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
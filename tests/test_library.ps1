@@ -6,7 +6,7 @@ $ExitSuccess = 0
 $ExitFailure = 1
 $ExitIgnore = 77
 
-$LibraryTests = "end_of_file_record error event_record file_header io_handle notify record record_values strings_array"
+$LibraryTests = "carver end_of_file_record error event_record file_header filter index_file io_handle multi_file notify offset_table record record_iterator record_number_index record_values records_cache signature_scanner strings_array timestamp_index"
 $LibraryTestsWithInput = "file support"
 $OptionSets = ""
 
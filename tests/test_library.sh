@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="end_of_file_record error event_record file_header io_handle notify record record_values strings_array";
+LIBRARY_TESTS="carver end_of_file_record error event_record file_header filter index_file io_handle multi_file notify offset_table record record_iterator record_number_index record_values records_cache signature_scanner strings_array timestamp_index";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 
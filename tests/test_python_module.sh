@@ -8,7 +8,7 @@ EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
 TEST_FUNCTIONS="support";
-TEST_FUNCTIONS_WITH_INPUT="file";
+TEST_FUNCTIONS_WITH_INPUT="file multi_file";
 OPTION_SETS="";
 
 TEST_TOOL_DIRECTORY=".";